@@ -1,9 +1,11 @@
 #define _CRT_SECURE_NO_WARNINGS 1
 #include <stdio.h>
+#include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <time.h>
+#include <functional>
 #include <vector>
 #include "utfz.h"
 
@@ -14,10 +16,10 @@ cl /nologo /Zi /EHsc test.cpp utfz.cpp && test
 opencppcoverage --sources c:\dev\head\maps\third_party\utfz --modules test.exe -- test.exe
 
 Unix GCC:
-g++ -O2 -o test -std=c++11 test.cpp utfz.cpp && ./test
+g++ -O2 -o test -std=c++14 test.cpp utfz.cpp && ./test
 
 Unix Clang:
-clang++ -O2 -o test -std=c++11 test.cpp utfz.cpp && ./test
+clang++ -O2 -o test -std=c++14 test.cpp utfz.cpp && ./test
 
 
 */
@@ -66,14 +68,34 @@ void test_iterators(const char* s)
 		cp4.push_back(cp);
 		printf("%02x ", cp);
 	}
+
+	// backwards, using 'prev', and the reverse iterators with known and unknown length
+	std::vector<int> cp5, cp6, cp7;
+	iter = end;
+	while (utfz::prev(iter, s, cp))
+		cp5.push_back(cp);
+	utfz::cp c(s);
+	for (auto it = c.rbegin(); it != c.rend(); ++it)
+		cp6.push_back(*it);
+	utfz::cp cz(sz);
+	for (auto it = cz.rbegin(); it != cz.rend(); ++it)
+		cp7.push_back(*it);
+
 	assert(cp1.size() == cp2.size());
 	assert(cp1.size() == cp3.size());
 	assert(cp1.size() == cp4.size());
+	assert(cp1.size() == cp5.size());
+	assert(cp1.size() == cp6.size());
+	assert(cp1.size() == cp7.size());
 	for (size_t i = 0; i < cp1.size(); i++)
 	{
+		size_t r = cp1.size() - 1 - i;
 		assert(cp1[i] == cp2[i]);
 		assert(cp1[i] == cp3[i]);
 		assert(cp1[i] == cp4[i]);
+		assert(cp1[i] == cp5[r]);
+		assert(cp1[i] == cp6[r]);
+		assert(cp1[i] == cp7[r]);
 	}
 	printf("\n");
 }
@@ -119,6 +141,461 @@ void bench(const char* name, int runLength[4])
 	free(enc);
 }
 
+// Reference implementation of validate, built on top of decode
+bool validate_ref(const char* s, const char* end)
+{
+	while (s != end)
+	{
+		int slen;
+		utfz::decode(s, end, slen);
+		if (slen == 0)
+			return false;
+		s += slen;
+	}
+	return true;
+}
+
+// Fill 'buf' with 'len' bytes of random valid UTF-8, with code points of up to 'maxBytes' bytes
+void random_utf8(char* buf, int len, int maxBytes)
+{
+	int maxValues[4] = {utfz::max1, utfz::max2, utfz::max3, utfz::max4};
+	int i            = 0;
+	while (i < len)
+	{
+		int  cp = rand() % (maxValues[rand() % maxBytes] + 1);
+		char enc[4];
+		int  n = utfz::encode(enc, cp);
+		if (n == 0 || i + n > len)
+			n = utfz::encode(enc, 'a' + rand() % 26);
+		memcpy(buf + i, enc, n);
+		i += n;
+	}
+}
+
+void test_validate()
+{
+	// every 1, 2 and 3 byte string
+	char buf[160];
+	for (int i = 0; i < 256 * 256 * 256; i++)
+	{
+		buf[0] = (char) i;
+		buf[1] = (char) (i >> 8);
+		buf[2] = (char) (i >> 16);
+		assert(utfz::validate(buf, buf + 1) == validate_ref(buf, buf + 1));
+		assert(utfz::validate(buf, buf + 2) == validate_ref(buf, buf + 2));
+		assert(utfz::validate(buf, buf + 3) == validate_ref(buf, buf + 3));
+	}
+
+	// 4 byte strings made of interesting bytes, placed at different positions around
+	// vector boundaries inside a longer valid string
+	const unsigned char interesting[] = {0x00, 0x41, 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2,
+	                                     0xdf, 0xe0, 0xe1, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf3, 0xf4, 0xf5, 0xf8, 0xff};
+	const int           ni            = sizeof(interesting);
+	const int           offsets[]     = {0, 13, 14, 15, 30, 31, 62, 63, 78, 92};
+	const int           len           = 96;
+	srand(1);
+	random_utf8(buf, len, 4);
+	for (int a = 0; a < ni; a++)
+	{
+		for (int b = 0; b < ni; b++)
+		{
+			for (int c = 0; c < ni; c++)
+			{
+				for (int d = 0; d < ni; d++)
+				{
+					for (int o : offsets)
+					{
+						char copy[len];
+						memcpy(copy, buf, len);
+						copy[o + 0] = (char) interesting[a];
+						copy[o + 1] = (char) interesting[b];
+						copy[o + 2] = (char) interesting[c];
+						copy[o + 3] = (char) interesting[d];
+						assert(utfz::validate(copy, copy + len) == validate_ref(copy, copy + len));
+						assert(utfz::validate(copy + 1, copy + len - 1) == validate_ref(copy + 1, copy + len - 1));
+					}
+				}
+			}
+		}
+	}
+
+	// random strings, with random corruption
+	std::vector<char> big(5000);
+	for (int i = 0; i < 2000; i++)
+	{
+		random_utf8(&big[0], (int) big.size(), 1 + i % 4);
+		int nerr = rand() % 3;
+		for (int j = 0; j < nerr; j++)
+			big[rand() % big.size()] = (char) rand();
+		int         start = rand() % 70;
+		const char* s     = &big[start];
+		const char* end   = &big[0] + big.size() - rand() % 70;
+		assert(utfz::validate(s, end) == validate_ref(s, end));
+
+		// everything before the first error is valid, and the error itself is not
+		const char* bad = utfz::first_invalid(s, end);
+		assert(validate_ref(s, bad));
+		int slen;
+		assert(bad == end || (utfz::decode(bad, end, slen) == utfz::replace && slen == 0));
+	}
+
+	// a genuine U+FFFD is valid, and the null terminated variant stops at the first zero
+	assert(utfz::validate("a\xEF\xBF\xBD"));
+	assert(!utfz::validate("a\xEF\xBF\xBE"));
+	assert(utfz::validate("a\0\xff"));
+	assert(utfz::validate(""));
+}
+
+void test_decode_all()
+{
+	// random strings of 1..4 byte code points, with random corruption, compared against next()
+	std::vector<char>     buf(3000);
+	std::vector<char32_t> out(buf.size());
+	std::vector<char32_t> ref(buf.size());
+	for (int i = 0; i < 4000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+			buf[rand() % buf.size()] = (char) (0x80 + rand() % 0x80);
+		if (i % 7 == 0)
+			memcpy(&buf[rand() % (buf.size() - 4)], "\xEF\xBF\xBD\x80", 4); // a genuine U+FFFD, followed by a continuation byte
+		const char* s   = &buf[rand() % 40];
+		const char* end = &buf[0] + buf.size() - rand() % 40;
+
+		size_t nref = 0;
+		int    cp;
+		for (const char* p = s; utfz::next(p, end, cp);)
+			ref[nref++] = cp;
+
+		size_t n = utfz::decode_all(s, end, &out[0]);
+		assert(n == nref);
+		assert(memcmp(&out[0], &ref[0], n * sizeof(char32_t)) == 0);
+	}
+
+	char32_t    small[4];
+	const char* str = "\xC3\xA9t\xC3";
+	assert(utfz::decode_all(str, str + 4, small) == 3);
+	assert(small[0] == 0xe9 && small[1] == 't' && small[2] == utfz::replace);
+	assert(utfz::decode_all(str, str, small) == 0);
+}
+
+void test_encode_all()
+{
+	std::vector<char32_t> cps(2000);
+	std::vector<char>     buf;
+	for (int i = 0; i < 4000; i++)
+	{
+		// random code points, mostly below a limit that varies per iteration, and some invalid ones
+		int limits[6] = {utfz::max1, utfz::max2, utfz::max2, utfz::max3, utfz::max3, utfz::max4};
+		int limit     = limits[i % 6];
+		for (size_t j = 0; j < cps.size(); j++)
+			cps[j] = rand() % (limit + 1);
+		int nerr = i % 3 == 0 ? 0 : rand() % 5;
+		for (int j = 0; j < nerr; j++)
+		{
+			char32_t bad[] = {0xd800, 0xdfff, 0xfffe, 0xffff, 0x110000, 0xffffffff, 0x80000000};
+			cps[rand() % cps.size()] = bad[rand() % 7];
+		}
+		size_t n = cps.size() - rand() % 40;
+
+		std::string ref;
+		bool        refValid = true;
+		for (size_t j = 0; j < n; j++)
+			refValid &= utfz::encode(ref, (int) cps[j]);
+
+		// encode into a buffer of exactly the right size, and make sure nothing after it is touched
+		size_t len = utfz::encoded_length(&cps[0], n);
+		assert(len == ref.size());
+		buf.assign(len + 16, 'x');
+		assert(utfz::encode(&buf[0], &cps[0], n) == len);
+		assert(memcmp(&buf[0], ref.c_str(), len) == 0);
+		for (size_t j = len; j < buf.size(); j++)
+			assert(buf[j] == 'x');
+
+		std::string str = "prefix";
+		assert(utfz::encode(str, &cps[0], n) == refValid);
+		assert(str == "prefix" + ref);
+	}
+
+	std::string str;
+	char32_t    one = 0xd800;
+	assert(!utfz::encode(str, &one, 1));
+	assert(str.empty());
+	assert(utfz::encode(str, &one, 0));
+	assert(utfz::encoded_length(&one, 1) == 0);
+}
+
+// Store the UTF-16 code units 'u' into 'out', in byte order 'order'
+void put_units(const std::u16string& u, char16_t* out, utfz::byte_order order)
+{
+	for (size_t i = 0; i < u.size(); i++)
+	{
+		unsigned char bytes[2] = {(unsigned char) (u[i] & 0xff), (unsigned char) (u[i] >> 8)};
+		if (order == utfz::big_endian)
+			std::swap(bytes[0], bytes[1]);
+		memcpy(out + i, bytes, 2);
+	}
+}
+
+// Reference UTF-16 transcoding of [s, end), built on top of next()
+std::u16string utf16_ref(const char* s, const char* end)
+{
+	std::u16string u;
+	int            cp;
+	for (const char* p = s; utfz::next(p, end, cp);)
+	{
+		if (cp > utfz::max3)
+		{
+			u += (char16_t) (0xd800 + ((cp - 0x10000) >> 10));
+			u += (char16_t) (0xdc00 + ((cp - 0x10000) & 0x3ff));
+		}
+		else
+		{
+			u += (char16_t) cp;
+		}
+	}
+	return u;
+}
+
+// Check utf8_to_utf16 and utf16_length against utf16_ref, and then transcode back again
+void check_utf8_to_utf16(const char* s, const char* end, utfz::byte_order order)
+{
+	std::u16string ref = utf16_ref(s, end);
+	size_t         len = utfz::utf16_length(s, end);
+	assert(len == ref.size());
+
+	// transcode into a buffer of exactly the right size, and make sure nothing after it is touched
+	std::vector<char16_t> out(len + 16, 'x');
+	std::vector<char16_t> expect(len + 16, 'x');
+	put_units(ref, &expect[0], order);
+	assert(utfz::utf8_to_utf16(s, end, &out[0], order) == len);
+	assert(out == expect);
+
+	std::u16string str   = u"prefix";
+	bool           valid = validate_ref(s, end);
+	assert(utfz::utf8_to_utf16(str, s, end, order) == valid);
+	assert(str.size() == 6 + len && memcmp(&str[6], &out[0], len * 2) == 0);
+
+	// valid UTF-8 survives the round trip
+	if (valid)
+	{
+		std::string back;
+		assert(utfz::utf16_to_utf8(back, &out[0], len, order));
+		assert(back == std::string(s, end));
+	}
+}
+
+void test_utf16()
+{
+	// UTF-8 to UTF-16, on random strings with random corruption
+	std::vector<char> buf(3000);
+	for (int i = 0; i < 4000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+			buf[rand() % buf.size()] = (char) (0x80 + rand() % 0x80);
+		if (i % 7 == 0)
+			memcpy(&buf[rand() % (buf.size() - 4)], "\xEF\xBF\xBD\x80", 4); // a genuine U+FFFD, followed by a continuation byte
+		const char* s   = &buf[rand() % 40];
+		const char* end = &buf[0] + buf.size() - rand() % 40;
+		check_utf8_to_utf16(s, end, i % 2 == 0 ? utfz::little_endian : utfz::big_endian);
+	}
+
+	// long strings, which are validated in chunks, with sequences and errors across the chunk boundaries
+	std::vector<char> big(200000);
+	for (int i = 0; i < 40; i++)
+	{
+		random_utf8(&big[0], (int) big.size(), 1 + i % 4);
+		if (i % 3 == 1)
+			big[65536 + rand() % 8 - 4] = (char) (0x80 + rand() % 0x80);
+		if (i % 3 == 2)
+			memcpy(&big[65536 - rand() % 4], "\xF0\x90\x8D\x88\x80\x80", 6);
+		check_utf8_to_utf16(&big[i % 5], &big[0] + big.size(), utfz::little_endian);
+	}
+
+	// UTF-16 to UTF-8, on random code units, with unpaired surrogates, 0xFFFE and 0xFFFF
+	std::vector<char16_t> units(2000);
+	std::vector<char16_t> in(units.size() + 1);
+	std::vector<char>     out;
+	for (int i = 0; i < 4000; i++)
+	{
+		int limits[4] = {utfz::max1, utfz::max2, utfz::max3, utfz::max4};
+		int limit     = limits[i % 4];
+		units.clear();
+		while (units.size() < 2000)
+		{
+			int cp = rand() % (limit + 1);
+			if (cp > utfz::max3)
+			{
+				units.push_back((char16_t) (0xd800 + ((cp - 0x10000) >> 10)));
+				units.push_back((char16_t) (0xdc00 + ((cp - 0x10000) & 0x3ff)));
+			}
+			else if (cp < 0xd800 || cp > 0xdfff)
+			{
+				units.push_back((char16_t) cp);
+			}
+		}
+		int nerr = i % 3 == 0 ? 0 : rand() % 5;
+		for (int j = 0; j < nerr; j++)
+		{
+			char16_t bad[] = {0xd800, 0xdbff, 0xdc00, 0xdfff, 0xfffe, 0xffff};
+			units[rand() % units.size()] = bad[rand() % 6];
+		}
+		size_t n = units.size() - rand() % 40;
+
+		std::string ref;
+		bool        refValid = true;
+		for (size_t j = 0; j < n; j++)
+		{
+			int u = units[j];
+			if (u >= 0xd800 && u <= 0xdbff && j + 1 < n && units[j + 1] >= 0xdc00 && units[j + 1] <= 0xdfff)
+			{
+				utfz::encode(ref, 0x10000 + ((u - 0xd800) << 10) + (units[j + 1] - 0xdc00));
+				j++;
+			}
+			else if (!utfz::encode(ref, u))
+			{
+				utfz::encode(ref, utfz::replace);
+				refValid = false;
+			}
+		}
+
+		utfz::byte_order order = i % 2 == 0 ? utfz::little_endian : utfz::big_endian;
+		put_units(std::u16string(units.begin(), units.begin() + n), &in[0], order);
+		size_t len = utfz::utf8_length(&in[0], n, order);
+		assert(len == ref.size());
+		out.assign(len + 16, 'x');
+		assert(utfz::utf16_to_utf8(&in[0], n, &out[0], order) == len);
+		assert(memcmp(&out[0], ref.c_str(), len) == 0);
+		for (size_t j = len; j < out.size(); j++)
+			assert(out[j] == 'x');
+
+		std::string str = "prefix";
+		assert(utfz::utf16_to_utf8(str, &in[0], n, order) == refValid);
+		assert(str == "prefix" + ref);
+	}
+
+	char16_t    u[4];
+	const char* s = "a\xF0\x90\x8D\x88\xE0";
+	assert(utfz::utf8_to_utf16(s, s + 6, u) == 4);
+	assert(u[0] == 'a' && u[1] == 0xd800 && u[2] == 0xdf48 && u[3] == utfz::replace);
+	char16_t lone[3] = {0xdf48, 0xd800, 0xfffe};
+	std::string str;
+	assert(!utfz::utf16_to_utf8(str, lone, 3));
+	assert(str == "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD");
+	assert(utfz::utf8_length(lone, 0) == 0 && utfz::utf16_length(s, s) == 0);
+}
+
+void test_codepage()
+{
+	const int npages = utfz::windows_1252 + 1;
+	for (int p = 0; p < npages; p++)
+	{
+		utfz::codepage page = (utfz::codepage) p;
+
+		// decode and encode agree with each other on every byte and code point
+		for (int b = 0; b < 256; b++)
+		{
+			int cp = utfz::decode((char) b, page);
+			assert(cp == utfz::replace || utfz::encode(cp, page) == b);
+		}
+		for (int cp = 0; cp <= utfz::max3; cp++)
+		{
+			int b = utfz::encode(cp, page);
+			assert(b == utfz::invalid || utfz::decode((char) b, page) == cp);
+		}
+
+		// random bytes to UTF-8, compared against decode and encode, and then back again
+		std::vector<char> in(1000);
+		std::vector<char> out;
+		std::vector<char> back(in.size() + 16);
+		for (int i = 0; i < 200; i++)
+		{
+			int highPercent = i % 4 == 0 ? 0 : (i % 4) * 30;
+			for (size_t j = 0; j < in.size(); j++)
+				in[j] = (char) (rand() % 100 < highPercent ? 0x80 + rand() % 0x80 : rand() % 0x80);
+			const char* s   = &in[rand() % 20];
+			const char* end = &in[0] + in.size() - rand() % 20;
+
+			std::string ref;
+			bool        refDefined = true;
+			for (const char* c = s; c != end; c++)
+			{
+				int cp = utfz::decode(*c, page);
+				refDefined &= cp != utfz::replace;
+				utfz::encode(ref, cp);
+			}
+
+			size_t len = utfz::utf8_length(s, end, page);
+			assert(len == ref.size());
+			out.assign(len + 16, 'x');
+			assert(utfz::codepage_to_utf8(s, end, &out[0], page) == len);
+			assert(memcmp(&out[0], ref.c_str(), len) == 0);
+			for (size_t j = len; j < out.size(); j++)
+				assert(out[j] == 'x');
+
+			std::string str = "prefix";
+			assert(utfz::codepage_to_utf8(str, s, end, page) == refDefined);
+			assert(str == "prefix" + ref);
+
+			if (refDefined)
+			{
+				assert(utfz::utf8_to_codepage(&out[0], &out[0] + len, &back[0], page) == (size_t) (end - s));
+				assert(memcmp(&back[0], s, end - s) == 0);
+			}
+		}
+	}
+
+	// UTF-8 to a code page, with both fallback policies, compared against next() and encode
+	std::vector<char> buf(1000);
+	std::vector<char> out(buf.size());
+	for (int i = 0; i < 4000; i++)
+	{
+		utfz::codepage page = (utfz::codepage) (i % npages);
+		random_utf8(&buf[0], (int) buf.size(), i % 5 == 0 ? 3 : 2);
+		int nerr = i % 3 == 0 ? 0 : rand() % 4;
+		for (int j = 0; j < nerr; j++)
+			buf[rand() % buf.size()] = (char) (0x80 + rand() % 0x80);
+		const char* s   = &buf[rand() % 20];
+		const char* end = &buf[0] + buf.size() - rand() % 20;
+
+		utfz::unmappable policy = i % 2 == 0 ? utfz::unmappable_replace : utfz::unmappable_skip;
+		std::string      ref;
+		bool             refMapped = true;
+		int              cp;
+		for (const char* p = s; utfz::next(p, end, cp);)
+		{
+			int b = utfz::encode(cp, page);
+			if (b == utfz::invalid)
+			{
+				refMapped = false;
+				if (policy == utfz::unmappable_skip)
+					continue;
+				b = '#';
+			}
+			ref += (char) b;
+		}
+
+		assert(utfz::utf8_to_codepage(s, end, &out[0], page, policy, '#') == ref.size());
+		assert(memcmp(&out[0], ref.c_str(), ref.size()) == 0);
+		std::string str = "prefix";
+		assert(utfz::utf8_to_codepage(str, s, end, page, policy, '#') == refMapped);
+		assert(str == "prefix" + ref);
+	}
+
+	assert(utfz::decode('\x80', utfz::windows_1252) == 0x20ac);
+	assert(utfz::decode('\x81', utfz::windows_1252) == utfz::replace);
+	assert(utfz::decode('\xa4', utfz::iso_8859_15) == 0x20ac);
+	assert(utfz::encode(0x20ac, utfz::iso_8859_1) == utfz::invalid);
+	assert(utfz::encode(0xe9, utfz::iso_8859_1) == 0xe9);
+	assert(utfz::encode(-1, utfz::iso_8859_1) == utfz::invalid);
+	std::string str;
+	assert(utfz::utf8_to_codepage(str, "caf\xC3\xA9 \xE2\x82\xAC", "caf\xC3\xA9 \xE2\x82\xAC" + 8, utfz::iso_8859_1) == false);
+	assert(str == "caf\xE9 ?");
+}
+
 int encode_any(int cp, char* buf)
 {
 	unsigned ucp = (unsigned) cp;
@@ -154,6 +631,1174 @@ int encode_any(int cp, char* buf)
 	}
 }
 
+// Checks that cp_blocks hands out the same code points as cp, at the right positions
+void check_cp_blocks(utfz::cp_blocks blocks, utfz::cp ref, size_t block_size)
+{
+	std::vector<int> expect;
+	for (int cp : ref)
+		expect.push_back(cp);
+
+	size_t      i    = 0;
+	const char* prev = blocks.Str;
+	for (auto block : blocks)
+	{
+		assert(block.size() != 0 && block.size() <= block_size);
+		assert(block.Start == prev);
+		for (size_t j = 0; j < block.size(); j++)
+		{
+			assert(i < expect.size());
+			assert((int) block[j] == expect[i++]);
+			assert(j == 0 ? block.Offset[j] == 0 : block.Offset[j] > block.Offset[j - 1]);
+			assert((int) block[j] == utfz::decode(block.pos(j), blocks.End));
+		}
+		prev = block.End;
+	}
+	assert(i == expect.size());
+	assert(prev == blocks.End);
+}
+
+void test_cp_blocks()
+{
+	// random strings of 1..4 byte code points, with random corruption
+	std::vector<char> buf(2000);
+	for (int i = 0; i < 2000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+			buf[rand() % buf.size()] = (char) (0x80 + rand() % 0x80);
+		const char* s          = &buf[rand() % 40];
+		const char* end        = &buf[0] + buf.size() - rand() % 40;
+		size_t      block_size = 1 + rand() % 100;
+		check_cp_blocks(utfz::cp_blocks(s, end, block_size), utfz::cp(s, end - s), block_size);
+
+		// null terminated, with the terminator inside a sequence some of the time
+		buf[buf.size() - 1 - rand() % 40] = 0;
+		check_cp_blocks(utfz::cp_blocks(s, block_size), utfz::cp(s), block_size);
+	}
+
+	std::string str = "h\xC3\xA9llo";
+	check_cp_blocks(utfz::cp_blocks(str, 2), utfz::cp(str), 2);
+	check_cp_blocks(utfz::cp_blocks("", 4), utfz::cp(""), 4);
+	check_cp_blocks(utfz::cp_blocks("\xF0\x90\x8D", 4), utfz::cp("\xF0\x90\x8D"), 4);
+
+	// iterate past the end
+	utfz::cp_blocks blocks(str, 16);
+	auto            it = blocks.begin();
+	assert((*it).size() == 5 && (*it)[1] == 0xe9 && (*it).pos(2) == &str[3]);
+	++it;
+	assert(it == blocks.end());
+	++it;
+	assert(it == blocks.end());
+}
+
+size_t count_ref(utfz::cp cps)
+{
+	size_t n = 0;
+	for (auto it = cps.begin(); it != cps.end(); ++it)
+		n++;
+	return n;
+}
+
+void test_count()
+{
+	// every 1, 2 and 3 byte string
+	char buf[4];
+	for (int i = 0; i < 256 * 256 * 256; i++)
+	{
+		buf[0] = (char) i;
+		buf[1] = (char) (i >> 8);
+		buf[2] = (char) (i >> 16);
+		buf[3] = 0;
+		for (int len = 1; len <= 3; len++)
+			assert(utfz::count(buf, buf + len) == count_ref(utfz::cp(buf, len)));
+		assert(utfz::count(buf) == count_ref(utfz::cp(buf)));
+	}
+
+	// random strings, with random corruption, and sometimes random bytes
+	std::vector<char> big(5000);
+	for (int i = 0; i < 3000; i++)
+	{
+		random_utf8(&big[0], (int) big.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 10;
+		for (int j = 0; j < nerr; j++)
+			big[rand() % big.size()] = (char) (i % 2 == 0 ? rand() : 0x80 + rand() % 0x80);
+		if (i % 11 == 0)
+		{
+			for (int j = rand() % 4000, k = 0; k < 200; k++)
+				big[j + k] = (char) rand();
+		}
+		const char* s   = &big[rand() % 70];
+		const char* end = &big[0] + big.size() - rand() % 70;
+		assert(utfz::count(s, end) == count_ref(utfz::cp(s, end - s)));
+
+		big[big.size() - 1 - rand() % 70] = 0;
+		assert(utfz::count(s) == count_ref(utfz::cp(s)));
+	}
+
+	// longer than one chunk
+	std::vector<char> huge(200000);
+	random_utf8(&huge[0], (int) huge.size(), 3);
+	huge[70000] = (char) 0xe4;
+	assert(utfz::count(&huge[0], &huge[0] + huge.size()) == count_ref(utfz::cp(&huge[0], huge.size())));
+
+	assert(utfz::count("") == 0);
+	assert(utfz::count("h\xC3\xA9llo") == 5);
+	assert(utfz::count("\xE4\x41\x42") == 1); // cp skips the whole sequence
+}
+
+void test_index()
+{
+	// random strings, with random corruption, compared against the positions from cp_blocks
+	std::vector<char> big(3000);
+	for (int i = 0; i < 600; i++)
+	{
+		random_utf8(&big[0], (int) big.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 10;
+		for (int j = 0; j < nerr; j++)
+			big[rand() % big.size()] = (char) (i % 2 == 0 ? rand() : 0x80 + rand() % 0x80);
+		const char* s   = &big[rand() % 70];
+		const char* end = &big[0] + big.size() - rand() % 70;
+
+		std::vector<const char*> ref;
+		for (auto block : utfz::cp_blocks(s, end, 100))
+		{
+			for (size_t j = 0; j < block.size(); j++)
+				ref.push_back(block.pos(j));
+		}
+
+		size_t      k = 1 + rand() % 80;
+		utfz::index idx(s, end, k);
+		assert(idx.size() == ref.size());
+		assert(idx.size() == utfz::count(s, end));
+		for (size_t j = 0; j < ref.size(); j++)
+			assert(idx.pos(j) == ref[j]);
+		assert(idx.pos(ref.size()) == end);
+		size_t cp = 0;
+		for (size_t off = 0; off < (size_t) (end - s); off++)
+		{
+			while (cp + 1 < ref.size() && ref[cp + 1] <= s + off)
+				cp++;
+			assert(idx.code_point(off) == cp);
+		}
+		assert(idx.code_point(end - s) == ref.size());
+	}
+
+	// longer than one chunk
+	std::vector<char> huge(300000);
+	random_utf8(&huge[0], (int) huge.size(), 3);
+	huge[100000] = (char) 0xff;
+	utfz::index idx(&huge[0], &huge[0] + huge.size(), 1000);
+	assert(idx.size() == utfz::count(&huge[0], &huge[0] + huge.size()));
+	for (size_t cp = 0; cp < idx.size(); cp += 777)
+		assert(idx.code_point(idx.pos(cp) - &huge[0]) == cp);
+
+	std::string str = "h\xC3\xA9llo";
+	utfz::index small(str, 2);
+	assert(small.size() == 5 && small.pos(2) == &str[3] && small.code_point(2) == 1);
+	const char* e = "";
+	utfz::index empty(e, e, 4);
+	assert(empty.size() == 0 && empty.code_point(0) == 0);
+}
+
+void test_stream_decoder()
+{
+	// random streams with random corruption, split into random chunks, compared against decode_all
+	const char*           nasty[] = {"\xEF\xBF\xBD\x80\x80", "\xF0\x90\x8D", "\xE4\xB8", "\xC3", "\xED\xA0\x80", "\xF8\x80"};
+	std::vector<char>     buf(1000);
+	std::vector<char32_t> ref(buf.size());
+	std::vector<char32_t> out(buf.size() + 1);
+	std::vector<char32_t> got;
+	utfz::stream_decoder  dec;
+	for (int i = 0; i < 4000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+		{
+			const char* n = nasty[rand() % 6];
+			memcpy(&buf[rand() % (buf.size() - 5)], n, strlen(n));
+		}
+		size_t len = buf.size() - rand() % 5;
+		ref.resize(utfz::decode_all(&buf[0], &buf[0] + len, &ref[0]));
+
+		got.clear();
+		int maxchunk = i % 3 == 0 ? 4 : i % 3 == 1 ? 40 : 400;
+		for (size_t pos = 0; pos < len;)
+		{
+			size_t n = rand() % maxchunk;
+			if (n > len - pos)
+				n = len - pos;
+			got.insert(got.end(), &out[0], &out[0] + dec.feed(&buf[pos], &buf[pos] + n, &out[0]));
+			assert(dec.pending() <= 3);
+			pos += n;
+		}
+		got.insert(got.end(), &out[0], &out[0] + dec.finish(&out[0]));
+		assert(got == ref);
+		ref.resize(buf.size());
+	}
+
+	// a sequence that arrives one byte at a time
+	const char* euro = "\xE2\x82\xAC";
+	assert(dec.feed(euro, euro + 1, &out[0]) == 0);
+	assert(dec.feed(euro + 1, euro + 2, &out[0]) == 0 && dec.pending() == 2);
+	assert(dec.feed(euro + 2, euro + 3, &out[0]) == 1 && out[0] == 0x20ac);
+	assert(dec.finish(&out[0]) == 0);
+
+	// a truncated sequence at the end of the stream
+	assert(dec.feed(euro, euro + 2, &out[0]) == 0);
+	assert(dec.finish(&out[0]) == 1 && out[0] == utfz::replace);
+	assert(dec.pending() == 0);
+}
+
+void test_parallel()
+{
+	// An executor that runs the tasks backwards, on this thread
+	utfz::executor backwards = [](size_t n, const std::function<void(size_t)>& task) {
+		for (size_t i = n; i != 0; i--)
+			task(i - 1);
+	};
+	utfz::executor threads = utfz::thread_executor(3);
+
+	// several pieces, with invalid sequences around the piece boundaries
+	const char*           nasty[] = {"\xEF\xBF\xBD\x80\x80", "\xF0\x90\x8D", "\xE4\xB8", "\xC3", "\x80\x80\x80\x80\x80", "\xF8\x80"};
+	const size_t          mb      = 1 << 20;
+	std::vector<char>     buf(3 * mb + 12345);
+	std::vector<char32_t> cps(buf.size()), cps_ref(buf.size());
+	std::vector<char16_t> u16(buf.size()), u16_ref(buf.size());
+	std::vector<char>     u8(3 * buf.size()), u8_ref(3 * buf.size());
+	for (int i = 0; i < 24; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		if (i % 4 != 0)
+		{
+			for (size_t b = mb; b < buf.size(); b += mb)
+			{
+				const char* n = nasty[rand() % 6];
+				memcpy(&buf[b - 3 + rand() % 7], n, strlen(n));
+			}
+		}
+		if (i % 4 == 3)
+			buf[rand() % buf.size()] = (char) 0xff;
+		const char*     s    = &buf[rand() % 5];
+		const char*     end  = &buf[0] + buf.size() - rand() % 5;
+		utfz::executor& exec = i % 2 == 0 ? backwards : threads;
+
+		assert(utfz::parallel::first_invalid(s, end, exec) == utfz::first_invalid(s, end));
+		assert(utfz::parallel::validate(s, end, exec) == utfz::validate(s, end));
+		assert(utfz::parallel::count(s, end, exec) == utfz::count(s, end));
+
+		size_t n = utfz::parallel::decode_all(s, end, &cps[0], exec);
+		assert(n == utfz::decode_all(s, end, &cps_ref[0]));
+		assert(memcmp(&cps[0], &cps_ref[0], n * sizeof(char32_t)) == 0);
+
+		utfz::byte_order order = i % 3 == 0 ? utfz::big_endian : utfz::little_endian;
+		n                      = utfz::parallel::utf8_to_utf16(s, end, &u16[0], order, exec);
+		assert(n == utfz::utf8_to_utf16(s, end, &u16_ref[0], order));
+		assert(memcmp(&u16[0], &u16_ref[0], n * sizeof(char16_t)) == 0);
+
+		// lone surrogates around the piece boundaries
+		if (i % 4 != 0)
+		{
+			unsigned lone = i % 2 == 0 ? 0xd801 : 0xdc01;
+			for (size_t b = mb; b < n; b += mb)
+				u16[b - 1 + rand() % 3] = (char16_t) (order == utfz::big_endian ? (lone >> 8) | ((lone & 0xff) << 8) : lone);
+		}
+		size_t n8 = utfz::parallel::utf16_to_utf8(&u16[0], n, &u8[0], order, exec);
+		assert(n8 == utfz::utf16_to_utf8(&u16[0], n, &u8_ref[0], order));
+		assert(memcmp(&u8[0], &u8_ref[0], n8) == 0);
+	}
+
+	// a piece that ends with a full vector of 2 byte sequences, whose stores run past its end
+	std::string two;
+	for (size_t i = 0; i < mb; i++)
+		utfz::encode(two, 0x80 + i % 0x700);
+	size_t n = utfz::parallel::decode_all(two.data(), two.data() + two.size(), &cps[0], backwards);
+	assert(n == mb);
+	for (size_t i = 0; i < n; i++)
+		assert(cps[i] == 0x80 + i % 0x700);
+
+	// small inputs run on this thread, without calling the executor
+	utfz::executor never = [](size_t, const std::function<void(size_t)>&) { assert(false); };
+	const char*    str   = "h\xC3\xA9llo";
+	assert(utfz::parallel::count(str, str + 6, never) == 5);
+	assert(utfz::parallel::validate(str, str, never));
+	assert(utfz::parallel::utf16_to_utf8(u16.data(), 0, &u8[0], utfz::little_endian, never) == 0);
+}
+
+void test_sanitize()
+{
+	// random strings with random corruption, compared against re-encoding the output of decode_all
+	const char*           nasty[] = {"\xEF\xBF\xBD\x80\x80", "\xF0\x90\x8D", "\xE4\xB8", "\xC3", "\xED\xA0\x80", "\xF8\x80"};
+	std::vector<char>     buf(2000);
+	std::vector<char32_t> cps(buf.size());
+	for (int i = 0; i < 4000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+		{
+			const char* n = nasty[rand() % 6];
+			memcpy(&buf[rand() % (buf.size() - 5)], n, strlen(n));
+		}
+		const char* s   = &buf[rand() % 40];
+		const char* end = &buf[0] + buf.size() - rand() % 40;
+
+		std::string ref;
+		utfz::encode(ref, &cps[0], utfz::decode_all(s, end, &cps[0]));
+
+		std::string out = "prefix";
+		bool        ok  = utfz::sanitize(s, end, out);
+		assert(ok == utfz::validate(s, end));
+		if (ok)
+			assert(out == "prefix" && ref == std::string(s, end));
+		else
+			assert(out == "prefix" + ref && utfz::validate(out.data(), out.data() + out.size()));
+
+		std::string inplace(s, end);
+		assert(utfz::sanitize(inplace) == ok);
+		assert(inplace == ref);
+	}
+
+	std::string str = "a\xC3(b\xEF\xBF\xBD\x80\x80"
+	                  "c\xFF\xFE";
+	assert(!utfz::sanitize(str));
+	assert(str == "a\xEF\xBF\xBD(b\xEF\xBF\xBD" "c\xEF\xBF\xBD");
+	assert(utfz::sanitize(str));
+
+	// every replacement grows the string, which is repaired in place
+	str.clear();
+	std::string fixed;
+	for (int i = 0; i < 1000; i++)
+	{
+		str += "\xC3" "a";
+		fixed += "\xEF\xBF\xBD" "a";
+	}
+	assert(!utfz::sanitize(str));
+	assert(str == fixed);
+
+	// next() restarts after a genuine U+FFFD, which swallows a 0xF8 to 0xFF byte too
+	str = "\xEF\xBF\xBD\xF8\x80"
+	      "a";
+	assert(!utfz::sanitize(str));
+	assert(str == "\xEF\xBF\xBD" "a");
+}
+
+void test_reverse()
+{
+	// random strings with a lot of corruption, including runs of lead bytes, which cp::iter
+	// breaks up differently depending on where the run starts
+	const unsigned char nasty[] = {0x80, 0xbf, 0xc3, 0xe4, 0xed, 0xef, 0xf0, 0xf4, 0xf8, 0xff};
+	std::vector<char>   buf(300);
+	for (int i = 0; i < 20000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size() - 1, 1 + i % 4);
+		int nerr = rand() % 40;
+		for (int j = 0; j < nerr; j++)
+		{
+			size_t at  = rand() % (buf.size() - 1);
+			int    run = j % 4 == 0 ? 1 + rand() % 12 : 1;
+			for (size_t k = at; k < at + run && k < buf.size() - 1; k++)
+				buf[k] = (char) nasty[rand() % sizeof(nasty)];
+		}
+		buf.back() = 0;
+		const char* s   = &buf[rand() % 8];
+		const char* end = s + strlen(s);
+
+		// cp::iter, with known and unknown length
+		for (int known = 0; known < 2; known++)
+		{
+			utfz::cp                 c = known ? utfz::cp(s, end - s) : utfz::cp(s);
+			std::vector<const char*> pos;
+			std::vector<int>         cps;
+			for (auto it = c.begin(); it != c.end(); ++it)
+			{
+				pos.push_back(it.S);
+				cps.push_back(*it);
+			}
+			auto it = c.end();
+			for (size_t j = pos.size(); j != 0; j--)
+			{
+				--it;
+				assert(it.S == pos[j - 1] && *it == cps[j - 1]);
+			}
+			assert(it == c.begin());
+			--it;
+			assert(it == c.begin());
+
+			size_t j = cps.size();
+			for (auto r = c.rbegin(); r != c.rend(); ++r)
+				assert(*r == cps[--j]);
+			assert(j == 0);
+		}
+
+		// next and prev
+		std::vector<const char*> pos;
+		std::vector<int>         cps;
+		int                      cp;
+		for (const char* p = s; pos.push_back(p), utfz::next(p, end, cp);)
+			cps.push_back(cp);
+		const char* p = end;
+		for (size_t j = cps.size(); j != 0; j--)
+		{
+			assert(utfz::prev(p, s, cp));
+			assert(p == pos[j - 1] && cp == cps[j - 1]);
+		}
+		assert(p == s && !utfz::prev(p, s, cp) && cp == utfz::replace && p == s);
+	}
+
+	// the empty string
+	utfz::cp empty("");
+	assert(empty.rbegin() == empty.rend());
+	auto it = empty.end();
+	--it;
+	assert(it == empty.begin());
+}
+
+void test_find()
+{
+	// Haystacks and needles are made of a few pieces, so that there are plenty of matches, and
+	// plenty of near misses inside sequences, and inside bytes that invalid sequences swallow
+	const char* valid[]   = {"a", "b", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x90\x8d\x88", "\xef\xbf\xbd"};
+	const char* invalid[] = {"\xe2\x82", "\x82", "\xac", "\xf0\x90", "\xc3", "\xff"};
+	const int   nvalid    = sizeof(valid) / sizeof(valid[0]);
+	const int   ninvalid  = sizeof(invalid) / sizeof(invalid[0]);
+	for (int i = 0; i < 20000; i++)
+	{
+		std::string hay;
+		int         len = rand() % 300;
+		while ((int) hay.size() < len)
+			hay += rand() % 5 == 0 ? invalid[rand() % ninvalid] : valid[rand() % nvalid];
+		std::string needle;
+		for (int n = 1 + rand() % 3; n != 0; n--)
+			needle += valid[rand() % nvalid];
+		const char* s   = hay.c_str();
+		const char* end = s + hay.size();
+
+		// the first position that cp::iter stops at, where the needle fits and matches
+		const char* expect = end;
+		for (auto it = utfz::cp(s, hay.size()).begin(); it.S != end && expect == end; ++it)
+		{
+			if ((size_t) (end - it.S) >= needle.size() && memcmp(it.S, needle.c_str(), needle.size()) == 0)
+				expect = it.S;
+		}
+		assert(utfz::find(s, end, needle.c_str(), needle.c_str() + needle.size()) == expect);
+
+		int cp = utfz::decode(needle.c_str(), needle.c_str() + needle.size());
+		expect = end;
+		for (auto it = utfz::cp(s, hay.size()).begin(); it.S != end && expect == end; ++it)
+		{
+			if (*it == cp && !(cp == utfz::replace && memcmp(it.S, "\xef\xbf\xbd", 3) != 0))
+				expect = it.S;
+		}
+		assert(utfz::find_cp(s, end, cp) == expect);
+	}
+
+	const char* s = "a\xe2\x82\xac\xe2\x82\xac";
+	assert(utfz::find(s, s + 7, s, s) == s);
+	assert(utfz::find(s, s + 7, "\x82\xac", "\x82\xac" + 2) == s + 7); // never in the middle of a sequence
+	assert(utfz::find(s, s + 7, "\xe2\x82", "\xe2\x82" + 2) == s + 7); // an invalid needle
+	assert(utfz::find_cp(s, s + 7, 0x20ac) == s + 1);
+	assert(utfz::find_cp(s + 2, s + 7, 0x20ac) == s + 4);
+	assert(utfz::find_cp(s, s + 7, 0xd800) == s + 7);
+	assert(utfz::find_cp(s, s + 4, 'b') == s + 4);
+
+	// an invalid lead byte swallows an 'a', which is not found, but the next one is
+	s = "\xe2" "ab" "a";
+	assert(utfz::find_cp(s, s + 4, 'a') == s + 3);
+}
+
+// Changes the case of [s, end) one code point at a time, with the simple mappings
+static std::string case_ref(const char* s, const char* end, int (*map)(int))
+{
+	std::string out;
+	int         cp;
+	while (utfz::next(s, end, cp))
+		utfz::encode(out, map(cp));
+	return out;
+}
+
+void test_case()
+{
+	for (int c = 0; c < 128; c++)
+	{
+		assert(utfz::to_lower(c) == tolower(c));
+		assert(utfz::to_upper(c) == toupper(c));
+		assert(utfz::fold_case(c) == tolower(c));
+	}
+	assert(utfz::to_lower(0x3a3) == 0x3c3); // Σ, whether or not it is final
+	assert(utfz::to_upper(0x1c5) == 0x1c4); // ǅ, a title case letter
+	assert(utfz::to_lower(0x1c5) == 0x1c6);
+	assert(utfz::to_lower(0x212a) == 'k');      // Kelvin sign
+	assert(utfz::fold_case(0x1e9e) == 0xdf);    // ẞ
+	assert(utfz::to_upper(0xdf) == 0xdf);       // ß has no simple upper case
+	assert(utfz::to_upper(0x10428) == 0x10400); // Deseret
+	assert(utfz::to_lower(0x4e2d) == 0x4e2d);
+	assert(utfz::to_lower(-1) == -1 && utfz::to_lower(0x110000) == 0x110000);
+
+	struct
+	{
+		const char* In;
+		const char* Lower;
+		const char* Upper;
+		const char* Fold;
+	} full[] = {
+	    {"Stra\xc3\x9f" "e", "stra\xc3\x9f" "e", "STRASSE", "strasse"},
+	    {"\xc4\xb0", "i\xcc\x87", "\xc4\xb0", "i\xcc\x87"},                               // İ
+	    {"\xce\x90", "\xce\x90", "\xce\x99\xcc\x88\xcc\x81", "\xce\xb9\xcc\x88\xcc\x81"}, // ΐ grows 3 times
+	    {"\xef\xac\x83", "\xef\xac\x83", "FFI", "ffi"},                                   // ﬃ
+	    {"\xe1\xbe\x88", "\xe1\xbe\x80", "\xe1\xbc\x88\xce\x99", "\xe1\xbc\x80\xce\xb9"}, // ᾈ
+	    {"a\x80" "B", "a\xef\xbf\xbd" "b", "A\xef\xbf\xbd" "B", "a\xef\xbf\xbd" "b"},
+	};
+	for (auto& t : full)
+	{
+		const char* end = t.In + strlen(t.In);
+		bool        ok  = strchr(t.In, '\x80') == nullptr;
+		std::string lower, upper, fold;
+		assert(utfz::to_lower(lower, t.In, end) == ok && lower == t.Lower);
+		assert(utfz::to_upper(upper, t.In, end) == ok && upper == t.Upper);
+		assert(utfz::fold_case(fold, t.In, end) == ok && fold == t.Fold);
+	}
+
+	// Random text with runs of ASCII, in every alignment, against mapping one code point at a
+	// time. The full mappings grow by at most 3 times, even for invalid sequences.
+	std::vector<char> buf(300);
+	for (int i = 0; i < 2000; i++)
+	{
+		int len = rand() % (int) buf.size();
+		random_utf8(&buf[0], len, i % 5 == 0 ? 1 : 1 + i % 4);
+		for (int j = rand() % 3; j != 0 && len != 0; j--)
+			buf[rand() % len] = (char) (0x80 + rand() % 0x80);
+		const char* s   = &buf[0];
+		const char* end = s + len;
+		bool        ok  = utfz::validate(s, end);
+
+		std::string lower = "x", upper, fold;
+		assert(utfz::to_lower(lower, s, end, utfz::case_simple) == ok);
+		assert(utfz::to_upper(upper, s, end, utfz::case_simple) == ok);
+		assert(utfz::fold_case(fold, s, end, utfz::case_simple) == ok);
+		assert(lower == "x" + case_ref(s, end, utfz::to_lower));
+		assert(upper == case_ref(s, end, utfz::to_upper));
+		assert(fold == case_ref(s, end, utfz::fold_case));
+
+		std::vector<char> out(3 * len + 1, 'z');
+		size_t            n = utfz::to_upper(s, end, &out[0]);
+		assert(out[3 * len] == 'z');
+		upper.clear();
+		assert(utfz::to_upper(upper, s, end) == ok);
+		assert(std::string(&out[0], n) == upper);
+		// folding twice changes nothing
+		fold.clear();
+		utfz::fold_case(fold, s, end);
+		std::string folded_again;
+		utfz::fold_case(folded_again, fold.data(), fold.data() + fold.size());
+		assert(folded_again == fold);
+	}
+}
+
+void test_normalize()
+{
+	struct
+	{
+		utfz::normalization_form Form;
+		const char*              In;
+		const char*              Out;
+	} cases[] = {
+	    {utfz::nfc, "e\xcc\x81", "\xc3\xa9"},
+	    {utfz::nfd, "\xc3\xa9", "e\xcc\x81"},
+	    {utfz::nfc, "a\xcc\x81\xcc\xa3", "\xe1\xba\xa1\xcc\x81"},    // reordered, then composed
+	    {utfz::nfc, "\xe2\x84\xab", "\xc3\x85"},                     // Angstrom sign, a singleton
+	    {utfz::nfc, "\xe0\xa5\x98", "\xe0\xa4\x95\xe0\xa4\xbc"},     // excluded from composition
+	    {utfz::nfc, "\xe1\xba\x9b\xcc\xa3", "\xe1\xba\x9b\xcc\xa3"}, // already NFC
+	    {utfz::nfkc, "\xe1\xba\x9b\xcc\xa3", "\xe1\xb9\xa9"},
+	    {utfz::nfkc, "\xef\xac\x81\xc2\xb2", "fi2"},
+	    {utfz::nfc, "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", "\xea\xb0\x81"}, // Hangul
+	    {utfz::nfd, "\xea\xb0\x81", "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8"},
+	    {utfz::nfc, "caf\x80", "caf\xef\xbf\xbd"},
+	    {utfz::nfc, "", ""},
+	};
+	for (auto& c : cases)
+	{
+		const char* end  = c.In + strlen(c.In);
+		bool        same = strcmp(c.In, c.Out) == 0;
+		std::string out  = "x";
+		assert(utfz::normalize(c.In, end, out, c.Form) == same);
+		assert(out == (same ? "x" : "x" + std::string(c.Out)));
+		assert(utfz::is_normalized(c.In, end, c.Form) == same);
+		utfz::quick_check_result qc = utfz::quick_check(c.In, end, c.Form);
+		assert(same ? qc != utfz::quick_check_no : qc != utfz::quick_check_yes);
+	}
+	const char* maybe = "\xe1\x84\x80\xe1\x85\xa1"; // a vowel might compose with what comes before
+	assert(utfz::quick_check(maybe, maybe + 6, utfz::nfc) == utfz::quick_check_maybe);
+
+	// Random text made of letters, precomposed letters, combining marks, compatibility
+	// characters and Hangul, which must satisfy the invariants of UAX #15
+	const int pieces[] = {'a', 'e', 'A', ' ', 0xe9, 0xc5, 0x1e9b, 0x212b, 0xfb01, 0xb2, 0x300, 0x301, 0x323, 0x308, 0x345,
+	                      0x1100, 0x1161, 0x11a8, 0xac00, 0xac01, 0x958, 0x915, 0x93c, 0x1f80, 0x3b9, 0x4e00};
+	for (int i = 0; i < 3000; i++)
+	{
+		std::string in;
+		if (i % 3 == 0)
+			in.append(rand() % 100, 'x');
+		for (int n = rand() % 12; n != 0; n--)
+			utfz::encode(in, pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))]);
+		if (i % 5 == 0)
+			in.append(rand() % 100, 'y');
+		const char* s   = in.data();
+		const char* end = s + in.size();
+
+		std::string f[4];
+		for (int form = utfz::nfc; form <= utfz::nfkd; form++)
+		{
+			utfz::normalization_form nf = (utfz::normalization_form) form;
+			if (utfz::normalize(s, end, f[form], nf))
+				f[form] = in;
+			assert(utfz::is_normalized(s, end, nf) == (f[form] == in));
+			if (utfz::quick_check(s, end, nf) == utfz::quick_check_yes)
+				assert(f[form] == in);
+			std::string again;
+			assert(utfz::normalize(f[form].data(), f[form].data() + f[form].size(), again, nf) && again.empty());
+		}
+		std::string x;
+		if (utfz::normalize(f[utfz::nfd].data(), f[utfz::nfd].data() + f[utfz::nfd].size(), x, utfz::nfc))
+			x = f[utfz::nfd];
+		assert(x == f[utfz::nfc]);
+		x.clear();
+		if (utfz::normalize(f[utfz::nfc].data(), f[utfz::nfc].data() + f[utfz::nfc].size(), x, utfz::nfd))
+			x = f[utfz::nfc];
+		assert(x == f[utfz::nfd]);
+		x.clear();
+		if (utfz::normalize(f[utfz::nfkd].data(), f[utfz::nfkd].data() + f[utfz::nfkd].size(), x, utfz::nfkc))
+			x = f[utfz::nfkd];
+		assert(x == f[utfz::nfkc]);
+	}
+
+	std::string s = "A\xcc\x8a";
+	assert(!utfz::normalize(s, utfz::nfc) && s == "\xc3\x85");
+	assert(utfz::normalize(s, utfz::nfc) && s == "\xc3\x85");
+}
+
+void test_graphemes()
+{
+	// The clusters are separated by '|'
+	const char* cases[] = {
+	    "a|b|c",
+	    "\r\n|\n|\r|\r\n|x",
+	    "e\xcc\x81|x",                                                                        // e with an acute accent
+	    "\t|\xcc\x81",                                                                        // a mark after a control
+	    "\xf0\x9f\x87\xbf\xf0\x9f\x87\xa6|\xf0\x9f\x87\xaf\xf0\x9f\x87\xb5|\xf0\x9f\x87\xa7", // two flags, and a lone regional indicator
+	    "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7|!",         // family, as an emoji ZWJ sequence
+	    "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd|a",                                                 // thumbs up, with a skin tone
+	    "a\xe2\x80\x8d|\xf0\x9f\x91\xa8",                                                     // ZWJ that doesn't follow a pictograph
+	    "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8|\xea\xb0\x81|\xe1\x84\x80\xea\xb0\x81",         // Hangul
+	    "\xe0\xa4\x95\xe0\xa4\xbf|\xe0\xa4\x95",                                              // Devanagari, with a spacing mark
+	    "\xd8\x80" "1|2",                                                                     // Arabic number sign, which is prepended
+	    "\x80\xcc\x81|a",                                                                     // an invalid byte is U+FFFD, which takes marks
+	    "\xf3\xa0\x80\x81|\xf3\xa0\x84\x80",                                                  // a control in plane 14, then a variation selector
+	};
+	for (const char* c : cases)
+	{
+		std::string in;
+		for (const char* p = c; *p != 0; p++)
+		{
+			if (*p != '|')
+				in += *p;
+		}
+		std::string got;
+		for (utfz::span g : utfz::graphemes(in))
+		{
+			assert(g.size() != 0);
+			got += (got.empty() ? "" : "|") + g.str();
+		}
+		assert(got == c);
+		assert(utfz::count_graphemes(in.data(), in.data() + in.size()) == (size_t) std::count(c, c + strlen(c), '|') + 1);
+	}
+	const char* empty = "";
+	assert(utfz::count_graphemes(empty, empty) == 0);
+	assert(utfz::graphemes(empty).begin() == utfz::graphemes(empty).end());
+
+	// Long runs of ASCII, with CR LF at every position of the vector blocks, broken by marks and
+	// emoji. The clusters must cover the string, and count_graphemes must agree with them.
+	const char* pieces[] = {"a", "a", "a", " ", "\r", "\n", "\r\n", "\xcc\x81", "\xe2\x80\x8d", "\xf0\x9f\x91\xa8", "\xf0\x9f\x87\xbf", "\xe4\xb8\xad", "\x80"};
+	for (int i = 0; i < 3000; i++)
+	{
+		std::string in;
+		for (int n = rand() % 300; n != 0; n--)
+			in += rand() % 8 != 0 ? pieces[rand() % 7] : pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+		const char* s   = in.data();
+		const char* end = s + in.size();
+		size_t      n   = 0;
+		const char* pos = s;
+		for (auto it = utfz::graphemes(s, end).begin(); it != utfz::graphemes(s, end).end(); it++, n++)
+		{
+			assert(it->Start == pos && it->End > pos);
+			assert(utfz::next_grapheme(pos, end) == it->End);
+			pos = it->End;
+		}
+		assert(pos == end);
+		assert(utfz::count_graphemes(s, end) == n);
+	}
+}
+
+void test_display_width()
+{
+	struct
+	{
+		const char* Str;
+		size_t      Width;
+	} cases[] = {
+	    {"", 0},
+	    {"hello", 5},
+	    {"a\tb\r\n", 2},                                                                  // controls take up no room
+	    {"e\xcc\x81", 1},                                                                 // e with an acute accent
+	    {"\xe4\xb8\xad\xe6\x96\x87", 4},                                                  // CJK ideographs
+	    {"\xef\xbc\xa1", 2},                                                              // fullwidth A
+	    {"\xc2\xb1", 1},                                                                  // East Asian Ambiguous
+	    {"\xf0\x9f\x98\x80", 2},                                                          // emoji
+	    {"\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7", 2},  // emoji ZWJ sequence
+	    {"\xf0\x9f\x87\xbf\xf0\x9f\x87\xa6", 2},                                          // flag
+	    {"\xe2\x9d\xa4", 1},                                                              // heavy black heart, as text
+	    {"\xe2\x9d\xa4\xef\xb8\x8f", 2},                                                  // and as an emoji
+	    {"#\xef\xb8\x8f\xe2\x83\xa3", 2},                                                 // keycap
+	    {"a\xe2\x80\x8b" "b", 2},                                                         // zero width space
+	    {"\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", 2},                                      // Hangul jamo, as one syllable
+	    {"\xf0\xa0\x80\x80", 2},                                                          // plane 2 ideograph
+	    {"\x80", 1},                                                                      // U+FFFD
+	};
+	for (auto& c : cases)
+		assert(utfz::display_width(c.Str, c.Str + strlen(c.Str)) == c.Width);
+
+	const char* s = "ab\xe4\xb8\xad\xe6\x96\x87" "e\xcc\x81!";
+	const char* e = s + strlen(s);
+	size_t      w = 99;
+	assert(utfz::truncate_to_width(s, e, 0, &w) == s && w == 0);
+	assert(utfz::truncate_to_width(s, e, 3, &w) == s + 2 && w == 2); // the ideograph doesn't fit in 1 column
+	assert(utfz::truncate_to_width(s, e, 4, &w) == s + 5 && w == 4);
+	assert(utfz::truncate_to_width(s, e, 7, &w) == s + 11 && w == 7); // the accent stays with its e
+	assert(utfz::truncate_to_width(s, e, 100, &w) == e && w == 8);
+	assert(utfz::truncate_to_width(s, e, 7) == s + 11);
+
+	// Long runs of ASCII, broken by wide and zero width clusters. The width of the whole must be
+	// the sum of the widths of its clusters, and truncating must stop where the clusters say.
+	const char* pieces[] = {"a", "b", " ", "\t", "\r\n", "\xcc\x81", "\xe4\xb8\xad", "\xf0\x9f\x98\x80", "\xef\xb8\x8f", "\x80"};
+	for (int i = 0; i < 2000; i++)
+	{
+		std::string in;
+		for (int n = rand() % 300; n != 0; n--)
+			in += rand() % 8 != 0 ? pieces[rand() % 5] : pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+		const char* s   = in.data();
+		const char* end = s + in.size();
+		size_t      max = rand() % 300;
+		size_t      sum = 0;
+		const char* cut = nullptr;
+		for (utfz::span g : utfz::graphemes(s, end))
+		{
+			size_t gw = utfz::display_width(g.Start, g.End);
+			if (cut == nullptr && sum + gw > max)
+				cut = g.Start;
+			sum += gw;
+		}
+		assert(utfz::display_width(s, end) == sum);
+		size_t width;
+		assert(utfz::truncate_to_width(s, end, max, &width) == (cut == nullptr ? end : cut));
+		assert(width == (cut == nullptr ? sum : utfz::display_width(s, cut)));
+	}
+}
+
+void test_truncate()
+{
+	const char* s        = "a\xc3\xa9\xe2\x82\xac\xf0\x90\x8d\x88"; // a, e acute, euro, and a 4 byte code point
+	const char* e        = s + strlen(s);
+	size_t      expect[] = {0, 1, 1, 3, 3, 3, 6, 6, 6, 6, 10, 10};
+	for (size_t max = 0; max < sizeof(expect) / sizeof(expect[0]); max++)
+		assert(utfz::truncate(s, e, max) == s + expect[max]);
+
+	std::string str = s;
+	assert(!utfz::truncate(str, 5) && str == "a\xc3\xa9");
+	assert(utfz::truncate(str, 5) && str == "a\xc3\xa9");
+
+	// Random text with invalid sequences. A cut must never fall inside a valid sequence, and in
+	// valid text, it must be as late as it can be.
+	const char* valid[]   = {"a", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x90\x8d\x88"};
+	const char* invalid[] = {"\x80", "\xbf\xbf\xbf\xbf\xbf", "\xe2\x82", "\xf0\x90\x8d", "\xff"};
+	for (int i = 0; i < 3000; i++)
+	{
+		bool        ok = i % 2 == 0;
+		std::string in;
+		for (int n = rand() % 40; n != 0; n--)
+			in += ok || rand() % 4 != 0 ? valid[rand() % 4] : invalid[rand() % 5];
+		const char* s   = in.data();
+		const char* end = s + in.size();
+		size_t      max = rand() % (in.size() + 2);
+		const char* cut = utfz::truncate(s, end, max);
+		assert(cut >= s && cut <= end && (size_t) (cut - s) <= max);
+		for (const char* p = s; p < end; p++)
+		{
+			int len;
+			if (utfz::decode(p, end, len) != utfz::replace)
+				assert(!(cut > p && cut < p + len));
+		}
+		if (ok)
+		{
+			assert(utfz::validate(s, cut) && utfz::validate(cut, end));
+			assert(cut == end || cut + utfz::seq_len(*cut) > s + max);
+		}
+
+		size_t      piece = 1 + rand() % 12;
+		std::string joined;
+		for (utfz::span c : utfz::chunks(in, piece))
+		{
+			assert(c.size() != 0);
+			assert(c.size() <= piece || (piece < 4 && (int) c.size() <= utfz::seq_len(*c.Start)));
+			if (ok)
+				assert(utfz::validate(c.Start, c.End));
+			joined += c.str();
+		}
+		assert(joined == in);
+	}
+	const char* empty = "";
+	assert(utfz::chunks(empty, empty, 10).begin() == utfz::chunks(empty, empty, 10).end());
+}
+
+void test_stats()
+{
+	struct kind_case
+	{
+		const char*      Str;
+		utfz::error_kind Kind;
+	} kinds[] = {
+	    {"\x80", utfz::error_bad_lead},
+	    {"\xff", utfz::error_bad_lead},
+	    {"\xf8\x88\x80\x80\x80", utfz::error_bad_lead},
+	    {"\xc3", utfz::error_truncated},
+	    {"\xe2\x82(", utfz::error_truncated},
+	    {"\xf0\x90\x8d", utfz::error_truncated},
+	    {"\xc0\xaf", utfz::error_overlong},
+	    {"\xe0\x80\xaf", utfz::error_overlong},
+	    {"\xf0\x80\x80\xaf", utfz::error_overlong},
+	    {"\xed\xa0\x80", utfz::error_surrogate},
+	    {"\xed\xbf\xbf", utfz::error_surrogate},
+	    {"\xef\xbf\xbe", utfz::error_noncharacter},
+	    {"\xef\xbf\xbf", utfz::error_noncharacter},
+	    {"\xf4\x90\x80\x80", utfz::error_too_large},
+	    {"\xf7\xbf\xbf\xbf", utfz::error_too_large},
+	};
+	for (auto k : kinds)
+	{
+		std::string in = std::string("ab") + k.Str + "\xe2\x82\xac";
+		utfz::stats st(in);
+		assert(!st.valid() && st.errors() == 1 && st.Errors[k.Kind] == 1);
+		assert(st.FirstError == 2 && st.FirstErrorKind == k.Kind);
+		assert(st.Sequences[1] == (strchr(k.Str, '(') ? 3 : 2) && st.Sequences[3] == 1);
+	}
+
+	utfz::stats st(std::string("a\xc3\xa9\xe2\x82\xac\xf0\x90\x8d\x88"));
+	assert(st.valid() && st.errors() == 0);
+	assert(st.Sequences[1] == 1 && st.Sequences[2] == 1 && st.Sequences[3] == 1 && st.Sequences[4] == 1);
+	assert(st.CodePoints == 4);
+
+	// Unlike next(), the invalid bytes after a genuine U+FFFD are counted
+	st = utfz::stats(std::string("\xEF\xBF\xBD\x80" "a"));
+	assert(st.errors() == 1 && st.FirstError == 3 && st.FirstErrorKind == utfz::error_bad_lead && st.Sequences[3] == 1);
+
+	// The code points are those of cp::iter, which steps over the second C3 here, and stops on
+	// the 80 after the overlong E0 80 AF, where next() restarts at 'a'
+	st = utfz::stats(std::string("\xC3\xC3"));
+	assert(st.errors() == 2 && st.CodePoints == 1);
+	st = utfz::stats(std::string("\xE0\x80\xAF\x80" "a"));
+	assert(st.errors() == 1 && st.CodePoints == 3);
+
+	// Random text, long enough to cross the 64K chunks, against counting with decode
+	const char*       nasty[] = {"\xEF\xBF\xBD\x80\x80", "\xF0\x90\x8D", "\xE4\xB8", "\xC3", "\xED\xA0\x80", "\xF8\x80"};
+	std::vector<char> buf(70000);
+	for (int i = 0; i < 60; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		int nerr = i % 5 == 0 ? 0 : rand() % 40;
+		for (int j = 0; j < nerr; j++)
+		{
+			const char* n = nasty[rand() % 6];
+			memcpy(&buf[rand() % (buf.size() - 5)], n, strlen(n));
+		}
+		const char* s   = &buf[rand() % 40];
+		const char* end = &buf[0] + buf.size() - rand() % 40;
+
+		size_t sequences[5] = {}, errors = 0, first = -1;
+		for (const char* p = s; p != end;)
+		{
+			const char* bad = utfz::first_invalid(p, end);
+			for (int len; p != bad; p += len)
+				utfz::decode(p, end, len), sequences[len]++;
+			if (bad == end)
+				break;
+			if (errors++ == 0)
+				first = bad - s;
+			p = utfz::restart(bad, end);
+		}
+		utfz::stats st(s, end);
+		assert(st.errors() == errors && st.FirstError == first && st.valid() == utfz::validate(s, end));
+		assert(st.CodePoints == utfz::count(s, end));
+		for (int len = 1; len <= 4; len++)
+			assert(st.Sequences[len] == sequences[len]);
+	}
+}
+
+void test_instruction_set()
+{
+	utfz::instruction_set initial = utfz::current_instruction_set();
+	assert(utfz::has_instruction_set(initial));
+	assert(strcmp(utfz::instruction_set_name(utfz::isa_avx2), "avx2") == 0);
+	assert(strcmp(utfz::instruction_set_name((utfz::instruction_set) 7), "unknown") == 0);
+	assert(!utfz::use_instruction_set((utfz::instruction_set) 7));
+	assert(utfz::current_instruction_set() == initial);
+	for (int isa = utfz::isa_scalar; isa <= utfz::isa_avx512; isa++)
+	{
+		if (utfz::use_instruction_set((utfz::instruction_set) isa))
+			assert(utfz::current_instruction_set() == isa);
+		else
+			assert(!utfz::has_instruction_set((utfz::instruction_set) isa));
+	}
+	utfz::use_instruction_set(initial);
+}
+
+// Stops at the first invalid sequence, and counts how many times it is asked
+struct counting_stop : utfz::stop_errors
+{
+	int Count = 0;
+
+	utfz::error_action error(const char*)
+	{
+		Count++;
+		return utfz::action_stop;
+	}
+};
+
+void test_policies()
+{
+	const char* fffe = "\xef\xbf\xbe";
+	const char* ffff = "\xef\xbf\xbf";
+	const char* surr = "\xed\xa0\x80";
+	int         len;
+	assert(utfz::decode<utfz::replace_errors>(fffe, fffe + 3, len) == utfz::replace && len == 0);
+	assert(utfz::decode<utfz::allow_noncharacters<>>(fffe, fffe + 3, len) == 0xfffe && len == 3);
+	assert(utfz::decode<utfz::allow_noncharacters<>>(ffff, ffff + 3, len) == 0xffff && len == 3);
+	assert(utfz::decode<utfz::allow_noncharacters<>>(surr, surr + 3, len) == utfz::replace && len == 0);
+	assert(utfz::decode<utfz::allow_noncharacters<>>(ffff, ffff + 2, len) == utfz::replace && len == 0);
+
+	std::string str = "a\xef\xbf\xbf"
+	                  "b\x80\x80"
+	                  "c";
+	std::vector<int> cps;
+	for (int cp : utfz::decoder<utfz::skip_errors>(str))
+		cps.push_back(cp);
+	assert((cps == std::vector<int>{'a', 'b', 'c'}));
+	cps.clear();
+	for (int cp : utfz::decoder<utfz::allow_noncharacters<utfz::skip_errors>>(str))
+		cps.push_back(cp);
+	assert((cps == std::vector<int>{'a', 0xffff, 'b', 'c'}));
+
+	// The continuation byte after a genuine U+FFFD has no replacement of its own, but it is
+	// still an error, at the same place that first_invalid finds
+	const char* fffd = "\xEF\xBF\xBD\x80x";
+	const char* fend = fffd + 5;
+	assert(utfz::first_invalid(fffd, fend) == fffd + 3);
+	utfz::decoder<utfz::report_errors> freport(fffd, fend);
+	cps.clear();
+	for (int cp : freport)
+		cps.push_back(cp);
+	assert((cps == std::vector<int>{utfz::replace, 'x'}));
+	assert(freport.Errors.Count == 1 && freport.Errors.First == fffd + 3);
+	cps.clear();
+	for (int cp : utfz::decoder<utfz::skip_errors>(fffd, fend))
+		cps.push_back(cp);
+	assert((cps == std::vector<int>{utfz::replace, 'x'}));
+	// A policy that stops is told about them once, and the U+FFFD is left in 'cp'
+	utfz::decoder<counting_stop> fstop(fffd, fend);
+	cps.clear();
+	for (int cp : fstop)
+		cps.push_back(cp);
+	assert(cps.empty() && fstop.S == fffd + 3 && fstop.Errors.Count == 1);
+	const char* fp = fffd;
+	int         fcp;
+	assert(!utfz::next(fp, fend, fcp, fstop.Errors) && fcp == utfz::replace && fp == fffd + 3);
+	assert(fstop.Errors.Count == 2);
+
+	// Random text with errors, but no genuine U+FFFD, so that first_invalid finds the same errors
+	const char*       nasty[] = {"\xF0\x90\x8D", "\xE4\xB8", "\xC3", "\xED\xA0\x80", "\xF8\x80", "\xEF\xBF\xBE"};
+	std::vector<char> buf(500);
+	for (int i = 0; i < 2000; i++)
+	{
+		random_utf8(&buf[0], (int) buf.size(), 1 + i % 4);
+		for (char& c : buf)
+		{
+			if (c == '\xEF')
+				c = 'x';
+		}
+		int nerr = i % 5 == 0 ? 0 : rand() % 8;
+		for (int j = 0; j < nerr; j++)
+		{
+			const char* n = nasty[rand() % 6];
+			memcpy(&buf[rand() % (buf.size() - 5)], n, strlen(n));
+		}
+		const char* s   = &buf[rand() % 40];
+		const char* end = &buf[0] + buf.size() - rand() % 40;
+
+		std::vector<int> ref;
+		const char*      p = s;
+		int              cp;
+		while (utfz::next(p, end, cp))
+			ref.push_back(cp);
+
+		utfz::decoder<utfz::report_errors> report(s, end);
+		std::vector<int>                   replaced, skipped, stopped;
+		for (int cp : report)
+			replaced.push_back(cp);
+		for (int cp : utfz::decoder<utfz::skip_errors>(s, end))
+			skipped.push_back(cp);
+		utfz::decoder<utfz::stop_errors> stop(s, end);
+		for (int cp : stop)
+			stopped.push_back(cp);
+
+		const char* bad = utfz::first_invalid(s, end);
+		assert(replaced == ref);
+		assert(report.Errors.First == (bad == end ? nullptr : bad));
+		assert(skipped.size() == ref.size() - report.Errors.Count);
+		assert(std::count(ref.begin(), ref.end(), (int) utfz::replace) == (ptrdiff_t) report.Errors.Count);
+		assert(stop.S == bad && stopped.size() == utfz::count(s, bad));
+		assert(std::equal(stopped.begin(), stopped.end(), ref.begin()));
+	}
+}
+
+void test_builder()
+{
+	// against encode(std::string&, int), with some invalid code points mixed in
+	srand(3);
+	std::vector<char32_t> cps;
+	for (int i = 0; i < 20000; i++)
+	{
+		int r = rand() % 20;
+		cps.push_back(r == 0 ? 0xd800 + rand() % 0x800 : r == 1 ? utfz::max4 + 1 : (char32_t) (rand() % utfz::max4));
+	}
+	std::string   ref;
+	utfz::builder b;
+	for (size_t i = 0; i < cps.size(); i++)
+	{
+		bool valid = utfz::encode(ref, (int) cps[i]);
+		assert(b.append((int) cps[i]) == valid);
+		assert(b.size() == ref.size());
+	}
+	assert(std::string(b.data(), b.size()) == ref);
+
+	// bulk code points, and spans of UTF-8
+	b.clear();
+	assert(b.size() == 0);
+	assert(!b.append(&cps[0], cps.size()));
+	assert(b.append(&cps[0], 0));
+	b.append("h\xC3\xA9");
+	b.append(std::string("llo"));
+	b.append(ref.data(), ref.data() + ref.size());
+	assert(std::string(b.data(), b.size()) == ref + "h\xC3\xA9llo" + ref);
+
+	// str() copies the string out, and the builder starts again, in the same buffer
+	const char* data = b.data();
+	std::string out  = b.str();
+	assert(out == ref + "h\xC3\xA9llo" + ref);
+	assert(b.size() == 0);
+	b.append(0x20ac);
+	assert(b.str() == "\xE2\x82\xAC");
+	b.append(out);
+	assert(b.data() == data && b.str() == out);
+
+	utfz::builder reserved(1000);
+	const char*   before = reserved.data();
+	for (int i = 0; i < 250; i++)
+		reserved.append(0x1f600);
+	assert(reserved.data() == before && reserved.size() == 1000);
+	reserved.append('!');
+	assert(reserved.size() == 1001);
+
+	// an arena that starts with a buffer on the stack, and then moves on to the heap
+	char        buf[1024];
+	utfz::arena arena(buf, sizeof(buf), 256);
+	for (int round = 0; round < 3; round++)
+	{
+		char* p1 = (char*) arena.allocate(3);
+		char* p2 = (char*) arena.allocate(8, 8);
+		assert(p1 == buf && p2 >= p1 + 3 && ((uintptr_t) p2 & 7) == 0);
+
+		std::vector<utfz::arena_string> strs;
+		for (int i = 0; i < 200; i++)
+		{
+			utfz::arena_builder ab(arena);
+			for (int j = 0; j <= i; j++)
+				ab.append(0x400 + j);
+			strs.push_back(ab.str());
+		}
+		for (int i = 0; i < 200; i++)
+		{
+			std::string expect;
+			for (int j = 0; j <= i; j++)
+				utfz::encode(expect, 0x400 + j);
+			assert(strs[i].size() == expect.size() && memcmp(strs[i].data(), expect.data(), expect.size()) == 0);
+		}
+		assert(strs[10].data() > buf && strs[10].data() < buf + sizeof(buf));
+		strs.clear();
+		arena.reset();
+	}
+}
+
+#ifdef UTFZ_CONSTEXPR
+constexpr char32_t first_cp(const char* s)
+{
+	char buf[4] = {};
+	int  n      = utfz::compile_time::encode(buf, utfz::compile_time::decode(s, s + 4));
+	return (char32_t) utfz::compile_time::decode(buf, buf + n);
+}
+
+void test_compile_time()
+{
+	constexpr auto hello = UTFZ_LITERAL("h\xC3\xA9llo \xE4\xB8\x96\xF0\x9F\x98\x80");
+	static_assert(hello.size() == 8 && hello.Bytes == 14, "");
+	static_assert(hello[1] == 0xe9 && hello[6] == 0x4e16 && hello[7] == 0x1f600 && hello.CP[8] == 0, "");
+	constexpr auto empty = UTFZ_LITERAL("");
+	static_assert(empty.size() == 0 && empty.begin() == empty.end(), "");
+	static_assert(first_cp("\xF0\x9F\x98\x80") == 0x1f600, "");
+	static_assert(!utfz::compile_time::validate("\xED\xA0\x80", "\xED\xA0\x80" + 3), "");
+	// UTFZ_LITERAL("\xC3") fails to compile
+
+	std::u32string cps;
+	for (char32_t cp : hello)
+		cps += cp;
+	assert(cps == U"héllo 世\U0001F600");
+	assert(strcmp(hello.Str, "h\xC3\xA9llo \xE4\xB8\x96\xF0\x9F\x98\x80") == 0);
+
+	// the compile time functions agree with the run time functions, when run at run time
+	char buf[5];
+	for (int i = 0; i < 256 * 256 * 256; i++)
+	{
+		buf[0] = (char) i;
+		buf[1] = (char) (i >> 8);
+		buf[2] = (char) (i >> 16);
+		buf[3] = (char) 0xbf;
+		for (int len = 1; len <= 4; len++)
+		{
+			int a = 0, b = 0;
+			assert(utfz::compile_time::decode(buf, buf + len, a) == utfz::decode(buf, buf + len, b) && a == b);
+			assert(utfz::compile_time::validate(buf, buf + len) == utfz::validate(buf, buf + len));
+			assert(utfz::compile_time::count(buf, buf + len) == utfz::count(buf, buf + len));
+			assert(utfz::compile_time::restart(buf, buf + len) == utfz::restart(buf, buf + len));
+		}
+		assert(utfz::compile_time::seq_len(buf[0]) == utfz::seq_len(buf[0]));
+	}
+	for (int cp = -1; cp <= utfz::max4 + 1; cp++)
+	{
+		char a[4], b[4];
+		int  n = utfz::compile_time::encode(a, cp);
+		assert(n == utfz::encode(b, cp) && memcmp(a, b, n) == 0);
+	}
+}
+#endif
+
 int main(int argc, char** argv)
 {
 	const char* s1        = "$"; // 1 byte
@@ -181,6 +1826,42 @@ int main(int argc, char** argv)
 	for (int i = 0; i < allsize; i++)
 		test_iterators(all[i]);
 
+	test_instruction_set();
+
+	// Once with each set of kernels that this build has, and that this CPU can run
+	utfz::instruction_set initial = utfz::current_instruction_set();
+	for (int isa = utfz::isa_scalar; isa <= utfz::isa_avx512; isa++)
+	{
+		if (!utfz::use_instruction_set((utfz::instruction_set) isa))
+			continue;
+		printf("kernels: %s\n", utfz::instruction_set_name((utfz::instruction_set) isa));
+		test_validate();
+		test_decode_all();
+		test_encode_all();
+		test_utf16();
+		test_codepage();
+		test_cp_blocks();
+		test_count();
+		test_index();
+		test_stream_decoder();
+		test_parallel();
+		test_sanitize();
+		test_builder();
+		test_reverse();
+		test_find();
+		test_case();
+		test_normalize();
+		test_graphemes();
+		test_display_width();
+		test_truncate();
+		test_stats();
+		test_policies();
+	}
+	utfz::use_instruction_set(initial);
+#ifdef UTFZ_CONSTEXPR
+	test_compile_time();
+#endif
+
 	int testCP[] = {1, 0x7f, 0x80, 0x7ff, 0x800, 0xfffd, 0x10000, 0x10ffff};
 	for (size_t i = 0; i < sizeof(testCP) / sizeof(testCP[0]); i++)
 	{
@@ -0,0 +1,1143 @@
+// -----------------------------------------------------------------------
+// This is free and unencumbered software released into the public domain.
+// -----------------------------------------------------------------------
+
+// utfz-bench: measures the speed of each public function of utfz, on text in several scripts,
+// and on malformed text.
+//
+// usage: utfz-bench [-s size] [-r repetitions] [-t ms] [-b filter] [-c filter] [-i isa] [-j results.json] [file...]
+//
+// Each benchmark is warmed up, and then timed 'repetitions' times. Each of those samples runs
+// the benchmark as many times as it takes to last at least 't' milliseconds. The median sample
+// is reported as GB/s of input, nanoseconds per code point, and cycles per byte of input. The
+// cycles come from the time stamp counter, which ticks at a fixed rate on modern x86 CPUs, so
+// they are reference cycles, rather than core cycles. They are left out on other CPUs.
+// With -j, the results are also written as JSON, so that builds and releases can be compared.
+// Files that are given on the command line are benchmarked instead of the generated corpora.
+// Build with optimization. With UTFZ_DISPATCH (the CMake default on x86-64), -i picks the vector
+// kernels to measure; otherwise build with -march=native (or similar) to measure them.
+// The parallel functions only split inputs of 2 MB or more, so use -s 64M to measure them.
+// validate stops at the first error, so on the malformed corpus it only measures how quickly
+// that error is found.
+
+#include "utfz.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define UTFZ_BENCH_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UTFZ_BENCH_TSC 1
+#endif
+
+static uint64_t cycles()
+{
+#ifdef UTFZ_BENCH_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+// The results of each run are added to this, so that the compiler can't remove the work
+static volatile uint64_t Sink;
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Corpora
+
+// xorshift64*, so that the corpora are the same with every compiler and standard library
+struct rng
+{
+	uint64_t State = 0x9E3779B97F4A7C15ull;
+
+	uint32_t next()
+	{
+		State ^= State >> 12;
+		State ^= State << 25;
+		State ^= State >> 27;
+		return (uint32_t) ((State * 0x2545F4914F6CDD1Dull) >> 32);
+	}
+
+	size_t below(size_t n) { return next() % n; }
+};
+
+const char* english[] = {
+    "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by",
+    "on", "not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an",
+    "had", "they", "you", "were", "their", "one", "all", "we", "can", "her", "has", "there",
+    "been", "if", "more", "when", "will", "would", "who", "so", "no", "time", "people", "year",
+    "report", "value", "number", "system", "between", "information", "government", "2024",
+    "customer", "address", "invoice", "total", "(see", "below)", "e.g.", "\"quoted\"", "$1,250.00",
+};
+
+const char* latin[] = {
+    "le", "la", "les", "de", "et", "à", "un", "une", "est", "pour", "que", "qui", "dans", "être",
+    "très", "déjà", "où", "français", "élève", "garçon", "café", "naïve", "crème", "brûlée",
+    "der", "die", "und", "ist", "nicht", "für", "über", "schön", "Straße", "Größe", "Müller",
+    "el", "los", "año", "señor", "niño", "información", "también", "corazón", "ação", "não",
+    "São", "Paulo", "coração", "Ångström", "Øresund", "Łódź", "Kraków", "Dvořák", "Škoda",
+};
+
+const char* cyrillic[] = {
+    "и", "в", "не", "на", "я", "что", "он", "с", "как", "это", "по", "но", "они", "к", "у",
+    "мы", "из", "за", "вы", "так", "же", "от", "все", "год", "человек", "время", "жизнь",
+    "день", "рука", "работа", "слово", "место", "вопрос", "дом", "сторона", "страна", "мир",
+    "случай", "голова", "ребёнок", "сила", "конец", "вид", "система", "часть", "город",
+    "отношение", "Москва", "Россия", "Україна", "Київ", "Беларусь", "2024", "№", "руб.",
+};
+
+const char* cjk[] = {
+    "的", "一", "是", "不", "了", "人", "我", "在", "有", "他", "这", "中", "大", "来", "上",
+    "国", "个", "到", "说", "们", "为", "子", "和", "你", "地", "出", "道", "也", "时", "年",
+    "中国", "我们", "他们", "时间", "问题", "工作", "经济", "社会", "发展", "国家", "政府",
+    "北京", "上海", "文化", "历史", "技术", "電腦", "資料", "東京", "日本語", "です", "ます",
+    "ありがとう", "こんにちは", "コンピューター", "データ", "한국어", "안녕하세요", "서울",
+};
+
+const char* emoji[] = {
+    "😀", "😂", "🥲", "😍", "🤔", "👍", "👍🏽", "🙏🏿", "🎉", "🔥", "🚀", "✅", "❤️", "💯",
+    "👨‍👩‍👧‍👦", "👩🏻‍💻", "🏳️‍🌈", "🇿🇦", "🇯🇵", "🇧🇷", "⭐", "☕", "🍕", "🐍", "⚽", "🎵",
+};
+
+// The sequences that the malformed corpus is sprinkled with
+const char* malformed[] = {
+    "\x80",             // stray continuation byte
+    "\xBF\xBF",         // two of them
+    "\xC3",             // truncated 2 byte sequence
+    "\xE4\xB8",         // truncated 3 byte sequence
+    "\xF0\x9F\x98",     // truncated 4 byte sequence
+    "\xC0\xAF",         // overlong '/'
+    "\xE0\x80\xAF",     // overlong '/'
+    "\xED\xA0\x80",     // UTF-16 surrogate
+    "\xEF\xBF\xBE",     // U+FFFE
+    "\xF4\x90\x80\x80", // above max4
+    "\xF8\x88\x80\x80", // 5 byte sequence
+    "\xFF",             // never valid
+};
+
+#define COUNT(a) (sizeof(a) / sizeof(a[0]))
+
+// Adds a sentence of 'n' random words from 'words' to 'text'
+static void sentences(rng& r, std::string& text, const char* const* words, size_t nwords, size_t n, const char* space, const char* stop)
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		std::string word = words[r.below(nwords)];
+		if (i == 0 && word[0] >= 'a' && word[0] <= 'z')
+			word[0] -= 'a' - 'A';
+		if (i != 0)
+			text += space;
+		text += word;
+	}
+	text += stop;
+	text += r.below(8) == 0 ? "\n" : space;
+}
+
+// Cuts 'text' down to 'size' bytes, without splitting a sequence
+static void truncate(std::string& text, size_t size)
+{
+	if (text.size() <= size)
+		return;
+	while (size != 0 && ((uint8_t) text[size] & 0xc0) == 0x80)
+		size--;
+	text.resize(size);
+}
+
+enum corpus_kind
+{
+	corpus_ascii,
+	corpus_latin,
+	corpus_cyrillic,
+	corpus_cjk,
+	corpus_emoji,
+	corpus_mixed,
+	corpus_malformed,
+};
+
+// Adds one sentence in the style of the corpus 'kind' to 'text'
+static void sentence(rng& r, std::string& text, corpus_kind kind)
+{
+	size_t n = 4 + r.below(14);
+	switch (kind)
+	{
+	case corpus_ascii: sentences(r, text, english, COUNT(english), n, " ", "."); break;
+	case corpus_latin: sentences(r, text, latin, COUNT(latin), n, " ", "."); break;
+	case corpus_cyrillic: sentences(r, text, cyrillic, COUNT(cyrillic), n, " ", "."); break;
+	case corpus_cjk: sentences(r, text, cjk, COUNT(cjk), n * 2, r.below(4) == 0 ? "，" : "", "。"); break;
+	case corpus_emoji:
+		// chat messages, with an emoji every few words
+		for (size_t i = 0; i < n; i++)
+		{
+			text += english[r.below(COUNT(english))];
+			text += " ";
+			if (r.below(3) == 0)
+			{
+				text += emoji[r.below(COUNT(emoji))];
+				text += " ";
+			}
+		}
+		text += "\n";
+		break;
+	default: break;
+	}
+}
+
+const char* corpus_names[] = {"ascii", "latin", "cyrillic", "cjk", "emoji", "mixed", "malformed"};
+
+// Generates 'size' bytes of text. Every corpus is free of zero bytes, so that the null
+// terminated functions see all of it.
+static std::string generate(corpus_kind kind, size_t size)
+{
+	rng         r;
+	std::string text;
+	text.reserve(size + 256);
+	while (text.size() < size)
+	{
+		if (kind < corpus_mixed)
+		{
+			sentence(r, text, kind);
+		}
+		else
+		{
+			// paragraphs in each script, in random order
+			corpus_kind k = (corpus_kind) r.below(corpus_mixed);
+			for (size_t i = 1 + r.below(6); i != 0; i--)
+				sentence(r, text, k);
+		}
+	}
+	truncate(text, size);
+	if (kind == corpus_malformed)
+	{
+		// about one error every 100 bytes
+		for (size_t i = 0; i < text.size() / 100; i++)
+		{
+			const char* bad = malformed[r.below(COUNT(malformed))];
+			size_t      len = strlen(bad);
+			size_t      at  = r.below(text.size() - len);
+			memcpy(&text[at], bad, len);
+		}
+	}
+	return text;
+}
+
+// A corpus, in all of the forms that the benchmarks need as input
+struct corpus
+{
+	std::string           Name;
+	std::string           Text; // UTF-8
+	bool                  HasZero    = false;
+	size_t                CodePoints = 0;
+	std::vector<char32_t> CP;     // decode_all(Text)
+	std::u16string        UTF16;  // utf8_to_utf16(Text)
+	std::string           Latin1; // utf8_to_codepage(Text, iso_8859_1)
+
+	std::unique_ptr<utfz::index> Index;
+
+	void prepare()
+	{
+		const char* s   = Text.data();
+		const char* end = s + Text.size();
+		HasZero         = memchr(s, 0, Text.size()) != nullptr;
+		CP.resize(Text.size() + 1);
+		CP.resize(utfz::decode_all(s, end, &CP[0]));
+		CodePoints = CP.size();
+		UTF16.clear();
+		utfz::utf8_to_utf16(UTF16, s, end);
+		Latin1.clear();
+		utfz::utf8_to_codepage(Latin1, s, end, utfz::iso_8859_1);
+		Index.reset(new utfz::index(s, end, 64));
+	}
+};
+
+// Output buffers, which are big enough for every benchmark
+struct scratch
+{
+	std::vector<char32_t> CP;
+	std::vector<char16_t> UTF16;
+	std::vector<char>     Bytes;
+	std::string           Str;
+	std::u16string        Str16;
+
+	void prepare(const corpus& c)
+	{
+		CP.resize(c.Text.size() + 1);
+		UTF16.resize(c.Text.size() + 1);
+		Bytes.resize(std::max(4 * c.CP.size(), 3 * c.Latin1.size()) + 1);
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+
+// What the throughput of a benchmark is measured against
+enum input_kind
+{
+	input_utf8,      // Text
+	input_utf16,     // UTF16, 2 bytes per code unit
+	input_codepage,  // Latin1
+	input_codepoint, // CP, 4 bytes per code point
+};
+
+struct benchmark
+{
+	const char* Name;
+	input_kind  Input;
+	bool        NullTerminated; // The benchmark stops at the first zero byte
+	uint64_t (*Run)(const corpus& c, scratch& out);
+};
+
+static utfz::executor Pool;
+
+static uint64_t bench_seq_len(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	uint64_t sum = 0;
+	while (s < end)
+	{
+		int n = utfz::seq_len(*s);
+		sum += n;
+		s = n > 0 ? s + n : utfz::restart(s, end);
+	}
+	return sum;
+}
+
+static uint64_t bench_decode(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	uint64_t sum = 0;
+	while (s < end)
+	{
+		int len;
+		int cp = utfz::decode(s, end, len);
+		sum += cp;
+		s = cp == utfz::replace ? utfz::restart(s, end) : s + len;
+	}
+	return sum;
+}
+
+static uint64_t bench_decode_nt(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.c_str();
+	uint64_t    sum = 0;
+	while (true)
+	{
+		int len;
+		int cp = utfz::decode(s, len);
+		if (cp == 0)
+			break;
+		sum += cp;
+		s = cp == utfz::replace ? utfz::restart(s) : s + len;
+	}
+	return sum;
+}
+
+static uint64_t bench_next(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	uint64_t sum = 0;
+	int      cp;
+	while (utfz::next(s, end, cp))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_decoder_skip(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (int cp : utfz::decoder<utfz::skip_errors>(c.Text))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_next_nt(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.c_str();
+	uint64_t    sum = 0;
+	int         cp;
+	while (utfz::next(s, cp))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_prev(const corpus& c, scratch&)
+{
+	const char* begin = c.Text.data();
+	const char* s     = begin + c.Text.size();
+	uint64_t    sum   = 0;
+	int         cp;
+	while (utfz::prev(s, begin, cp))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_cp(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (int cp : utfz::cp(c.Text))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_cp_nt(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (int cp : utfz::cp(c.Text.c_str()))
+		sum += cp;
+	return sum;
+}
+
+static uint64_t bench_cp_reverse(const corpus& c, scratch&)
+{
+	utfz::cp cps(c.Text);
+	uint64_t sum = 0;
+	for (auto it = cps.rbegin(); it != cps.rend(); ++it)
+		sum += *it;
+	return sum;
+}
+
+static uint64_t bench_cp_blocks(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (const auto& block : utfz::cp_blocks(c.Text))
+	{
+		for (char32_t cp : block)
+			sum += cp;
+	}
+	return sum;
+}
+
+static uint64_t bench_count(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::count(s, end);
+}
+
+static uint64_t bench_count_nt(const corpus& c, scratch&)
+{
+	return utfz::count(c.Text.c_str());
+}
+
+static uint64_t bench_validate(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::validate(s, end);
+}
+
+static uint64_t bench_validate_nt(const corpus& c, scratch&)
+{
+	return utfz::validate(c.Text.c_str());
+}
+
+static uint64_t bench_first_invalid(const corpus& c, scratch&)
+{
+	// walks from error to error, which is what a sanitizer does
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	uint64_t errors = 0;
+	for (s = utfz::first_invalid(s, end); s != end; s = utfz::first_invalid(utfz::restart(s, end), end))
+		errors++;
+	return errors;
+}
+
+static uint64_t bench_stats(const corpus& c, scratch&)
+{
+	utfz::stats st(c.Text);
+	return st.Sequences[1] + st.Sequences[2] + st.Sequences[3] + st.Sequences[4] + st.errors();
+}
+
+static uint64_t bench_sanitize(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str.clear();
+	return utfz::sanitize(s, end, out.Str) + out.Str.size();
+}
+
+static uint64_t bench_find(const corpus& c, scratch&)
+{
+	// a needle that none of the well formed corpora contain, so this measures a scan of the whole text
+	const char* s        = c.Text.data();
+	const char* end      = s + c.Text.size();
+	const char  needle[] = "\xe2\x80\xbd"; // ‽
+	return utfz::find(s, end, needle, needle + 3) - s;
+}
+
+static uint64_t bench_find_cp(const corpus& c, scratch&)
+{
+	// finds every line break
+	const char* s     = c.Text.data();
+	const char* end   = s + c.Text.size();
+	uint64_t    lines = 0;
+	for (s = utfz::find_cp(s, end, '\n'); s != end; s = utfz::find_cp(s + 1, end, '\n'))
+		lines++;
+	return lines;
+}
+
+static uint64_t bench_to_lower(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str.clear();
+	return utfz::to_lower(out.Str, s, end) + out.Str.size();
+}
+
+static uint64_t bench_fold_case(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str.clear();
+	return utfz::fold_case(out.Str, s, end) + out.Str.size();
+}
+
+static uint64_t bench_quick_check(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::quick_check(s, end, utfz::nfc);
+}
+
+static uint64_t bench_normalize(const corpus& c, scratch& out)
+{
+	// the corpora are in NFC, so this measures the quick check, apart from the malformed one
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str.clear();
+	return utfz::normalize(s, end, out.Str, utfz::nfc) + out.Str.size();
+}
+
+static uint64_t bench_normalize_nfd(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str.clear();
+	return utfz::normalize(s, end, out.Str, utfz::nfd) + out.Str.size();
+}
+
+static uint64_t bench_graphemes(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (utfz::span g : utfz::graphemes(c.Text))
+		sum += g.size();
+	return sum;
+}
+
+static uint64_t bench_count_graphemes(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::count_graphemes(s, end);
+}
+
+static uint64_t bench_display_width(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::display_width(s, end);
+}
+
+static uint64_t bench_decode_all(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::decode_all(s, end, &out.CP[0]);
+}
+
+static uint64_t bench_stream_decoder(const corpus& c, scratch& out)
+{
+	// 4 KB chunks, as they might come from a socket
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	utfz::stream_decoder dec;
+	uint64_t             n = 0;
+	for (; s != end; s += std::min<size_t>(end - s, 4096))
+		n += dec.feed(s, s + std::min<size_t>(end - s, 4096), &out.CP[0]);
+	return n + dec.finish(&out.CP[0]);
+}
+
+static uint64_t bench_index_build(const corpus& c, scratch&)
+{
+	utfz::index idx(c.Text, 64);
+	return idx.size();
+}
+
+static uint64_t bench_index_lookup(const corpus& c, scratch&)
+{
+	// pos() and code_point() of every 61st code point, which touches all of the text
+	const utfz::index& idx = *c.Index;
+	uint64_t           sum = 0;
+	for (size_t i = 0; i < idx.size(); i += 61)
+		sum += idx.code_point(idx.pos(i) - idx.Str);
+	return sum;
+}
+
+static uint64_t bench_encode(const corpus& c, scratch& out)
+{
+	char* p = &out.Bytes[0];
+	for (char32_t cp : c.CP)
+		p += utfz::encode(p, (int) cp);
+	return p - &out.Bytes[0];
+}
+
+static uint64_t bench_encode_string(const corpus& c, scratch& out)
+{
+	out.Str.clear();
+	for (char32_t cp : c.CP)
+		utfz::encode(out.Str, (int) cp);
+	return out.Str.size();
+}
+
+static uint64_t bench_builder(const corpus& c, scratch&)
+{
+	utfz::builder b;
+	for (char32_t cp : c.CP)
+		b.append((int) cp);
+	return b.str().size();
+}
+
+static uint64_t bench_builder_arena(const corpus& c, scratch&)
+{
+	// short strings of 16 code points each, like tokens or keys
+	char        buf[4096];
+	utfz::arena arena(buf, sizeof(buf));
+	uint64_t    n = 0;
+	for (size_t i = 0; i < c.CP.size(); i += 16)
+	{
+		utfz::arena_builder b(arena);
+		b.append(&c.CP[i], std::min<size_t>(16, c.CP.size() - i));
+		n += b.str().size();
+		if ((i & 0xfff) == 0)
+			arena.reset();
+	}
+	return n;
+}
+
+static uint64_t bench_encoded_length(const corpus& c, scratch&)
+{
+	return utfz::encoded_length(c.CP.data(), c.CP.size());
+}
+
+static uint64_t bench_encode_all(const corpus& c, scratch& out)
+{
+	return utfz::encode(&out.Bytes[0], c.CP.data(), c.CP.size());
+}
+
+static uint64_t bench_encode_all_string(const corpus& c, scratch& out)
+{
+	out.Str.clear();
+	utfz::encode(out.Str, c.CP.data(), c.CP.size());
+	return out.Str.size();
+}
+
+static uint64_t bench_utf16_length(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::utf16_length(s, end);
+}
+
+static uint64_t bench_utf8_to_utf16(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::utf8_to_utf16(s, end, &out.UTF16[0]);
+}
+
+static uint64_t bench_utf8_to_utf16_be(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::utf8_to_utf16(s, end, &out.UTF16[0], utfz::big_endian);
+}
+
+static uint64_t bench_utf8_to_utf16_string(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	out.Str16.clear();
+	return utfz::utf8_to_utf16(out.Str16, s, end) + out.Str16.size();
+}
+
+static uint64_t bench_utf8_length(const corpus& c, scratch&)
+{
+	return utfz::utf8_length(c.UTF16.data(), c.UTF16.size());
+}
+
+static uint64_t bench_utf16_to_utf8(const corpus& c, scratch& out)
+{
+	return utfz::utf16_to_utf8(c.UTF16.data(), c.UTF16.size(), &out.Bytes[0]);
+}
+
+static uint64_t bench_utf16_to_utf8_string(const corpus& c, scratch& out)
+{
+	out.Str.clear();
+	return utfz::utf16_to_utf8(out.Str, c.UTF16.data(), c.UTF16.size()) + out.Str.size();
+}
+
+static uint64_t bench_codepage_decode(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (char b : c.Latin1)
+		sum += utfz::decode(b, utfz::windows_1252);
+	return sum;
+}
+
+static uint64_t bench_codepage_encode(const corpus& c, scratch&)
+{
+	uint64_t sum = 0;
+	for (char32_t cp : c.CP)
+		sum += utfz::encode((int) cp, utfz::windows_1252);
+	return sum;
+}
+
+static uint64_t bench_codepage_utf8_length(const corpus& c, scratch&)
+{
+	return utfz::utf8_length(c.Latin1.data(), c.Latin1.data() + c.Latin1.size(), utfz::windows_1252);
+}
+
+static uint64_t bench_codepage_to_utf8(const corpus& c, scratch& out)
+{
+	return utfz::codepage_to_utf8(c.Latin1.data(), c.Latin1.data() + c.Latin1.size(), &out.Bytes[0], utfz::windows_1252);
+}
+
+static uint64_t bench_utf8_to_codepage(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::utf8_to_codepage(s, end, &out.Bytes[0], utfz::iso_8859_1);
+}
+
+static uint64_t bench_parallel_first_invalid(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::parallel::first_invalid(s, end, Pool) - s;
+}
+
+static uint64_t bench_parallel_validate(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::parallel::validate(s, end, Pool);
+}
+
+static uint64_t bench_parallel_count(const corpus& c, scratch&)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::parallel::count(s, end, Pool);
+}
+
+static uint64_t bench_parallel_decode_all(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::parallel::decode_all(s, end, &out.CP[0], Pool);
+}
+
+static uint64_t bench_parallel_utf8_to_utf16(const corpus& c, scratch& out)
+{
+	const char* s   = c.Text.data();
+	const char* end = s + c.Text.size();
+	return utfz::parallel::utf8_to_utf16(s, end, &out.UTF16[0], utfz::little_endian, Pool);
+}
+
+static uint64_t bench_parallel_utf16_to_utf8(const corpus& c, scratch& out)
+{
+	return utfz::parallel::utf16_to_utf8(c.UTF16.data(), c.UTF16.size(), &out.Bytes[0], utfz::little_endian, Pool);
+}
+
+benchmark benchmarks[] = {
+	{"seq_len", input_utf8, false, bench_seq_len},
+	{"decode", input_utf8, false, bench_decode},
+	{"decode_nt", input_utf8, true, bench_decode_nt},
+	{"next", input_utf8, false, bench_next},
+	{"next_nt", input_utf8, true, bench_next_nt},
+	{"decoder_skip", input_utf8, false, bench_decoder_skip},
+	{"prev", input_utf8, false, bench_prev},
+	{"cp", input_utf8, false, bench_cp},
+	{"cp_nt", input_utf8, true, bench_cp_nt},
+	{"cp_reverse", input_utf8, false, bench_cp_reverse},
+	{"cp_blocks", input_utf8, false, bench_cp_blocks},
+	{"count", input_utf8, false, bench_count},
+	{"count_nt", input_utf8, true, bench_count_nt},
+	{"validate", input_utf8, false, bench_validate},
+	{"validate_nt", input_utf8, true, bench_validate_nt},
+	{"first_invalid", input_utf8, false, bench_first_invalid},
+	{"stats", input_utf8, false, bench_stats},
+	{"sanitize", input_utf8, false, bench_sanitize},
+	{"find", input_utf8, false, bench_find},
+	{"find_cp", input_utf8, false, bench_find_cp},
+	{"to_lower", input_utf8, false, bench_to_lower},
+	{"fold_case", input_utf8, false, bench_fold_case},
+	{"quick_check", input_utf8, false, bench_quick_check},
+	{"normalize", input_utf8, false, bench_normalize},
+	{"normalize_nfd", input_utf8, false, bench_normalize_nfd},
+	{"graphemes", input_utf8, false, bench_graphemes},
+	{"count_graphemes", input_utf8, false, bench_count_graphemes},
+	{"display_width", input_utf8, false, bench_display_width},
+	{"decode_all", input_utf8, false, bench_decode_all},
+	{"stream_decoder", input_utf8, false, bench_stream_decoder},
+	{"index_build", input_utf8, false, bench_index_build},
+	{"index_lookup", input_utf8, false, bench_index_lookup},
+	{"encode", input_codepoint, false, bench_encode},
+	{"encode_string", input_codepoint, false, bench_encode_string},
+	{"builder", input_codepoint, false, bench_builder},
+	{"builder_arena", input_codepoint, false, bench_builder_arena},
+	{"encoded_length", input_codepoint, false, bench_encoded_length},
+	{"encode_all", input_codepoint, false, bench_encode_all},
+	{"encode_all_string", input_codepoint, false, bench_encode_all_string},
+	{"utf16_length", input_utf8, false, bench_utf16_length},
+	{"utf8_to_utf16", input_utf8, false, bench_utf8_to_utf16},
+	{"utf8_to_utf16_be", input_utf8, false, bench_utf8_to_utf16_be},
+	{"utf8_to_utf16_string", input_utf8, false, bench_utf8_to_utf16_string},
+	{"utf8_length", input_utf16, false, bench_utf8_length},
+	{"utf16_to_utf8", input_utf16, false, bench_utf16_to_utf8},
+	{"utf16_to_utf8_string", input_utf16, false, bench_utf16_to_utf8_string},
+	{"codepage_decode", input_codepage, false, bench_codepage_decode},
+	{"codepage_encode", input_codepoint, false, bench_codepage_encode},
+	{"codepage_utf8_length", input_codepage, false, bench_codepage_utf8_length},
+	{"codepage_to_utf8", input_codepage, false, bench_codepage_to_utf8},
+	{"utf8_to_codepage", input_utf8, false, bench_utf8_to_codepage},
+	{"parallel_first_invalid", input_utf8, false, bench_parallel_first_invalid},
+	{"parallel_validate", input_utf8, false, bench_parallel_validate},
+	{"parallel_count", input_utf8, false, bench_parallel_count},
+	{"parallel_decode_all", input_utf8, false, bench_parallel_decode_all},
+	{"parallel_utf8_to_utf16", input_utf8, false, bench_parallel_utf8_to_utf16},
+	{"parallel_utf16_to_utf8", input_utf16, false, bench_parallel_utf16_to_utf8},
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Measurement
+
+struct options
+{
+	size_t      Size        = 1 << 20;
+	int         Repetitions = 9;
+	double      MinSampleMs = 10;
+	const char* Benchmarks  = nullptr; // only run benchmarks whose name contains this
+	const char* Corpora     = nullptr; // only run corpora whose name contains this
+	const char* JSON        = nullptr;
+};
+
+struct result
+{
+	const char* Benchmark;
+	std::string Corpus;
+	size_t      Bytes;
+	size_t      CodePoints;
+	size_t      Iterations; // per sample
+	int         Samples;
+	double      MedianNs; // per iteration
+	double      MinNs;
+	double      MaxNs;
+	double      Cycles; // per iteration, in the median sample, or 0 if unknown
+
+	double gb_per_s() const { return Bytes / MedianNs; }
+	double ns_per_cp() const { return CodePoints == 0 ? 0 : MedianNs / CodePoints; }
+	double cycles_per_byte() const { return Cycles / Bytes; }
+};
+
+static size_t input_bytes(const corpus& c, input_kind input)
+{
+	switch (input)
+	{
+	case input_utf8: return c.Text.size();
+	case input_utf16: return c.UTF16.size() * 2;
+	case input_codepage: return c.Latin1.size();
+	case input_codepoint: return c.CP.size() * 4;
+	}
+	return 0;
+}
+
+static result measure(const benchmark& b, const corpus& c, scratch& out, const options& opt)
+{
+	typedef std::chrono::steady_clock clock;
+
+	// Warm up the caches, the branch predictors and the clock speed, while finding out how many
+	// iterations it takes for a sample to last long enough.
+	double minNs = opt.MinSampleMs * 1e6;
+	size_t iters = 1;
+	double warm  = 0;
+	while (true)
+	{
+		auto start = clock::now();
+		for (size_t i = 0; i < iters; i++)
+			Sink = Sink + b.Run(c, out);
+		double ns = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+		warm += ns;
+		if (ns >= minNs && warm >= 2 * minNs)
+			break;
+		if (ns < minNs)
+			iters = std::max(iters * 2, (size_t) (iters * 1.2 * minNs / std::max(ns, 1.0)));
+	}
+
+	std::vector<std::pair<double, double>> samples; // ns and cycles, per iteration
+	for (int r = 0; r < opt.Repetitions; r++)
+	{
+		uint64_t c0    = cycles();
+		auto     start = clock::now();
+		for (size_t i = 0; i < iters; i++)
+			Sink = Sink + b.Run(c, out);
+		double   ns = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+		uint64_t c1 = cycles();
+		samples.push_back(std::make_pair(ns / iters, (double) (c1 - c0) / iters));
+	}
+	std::sort(samples.begin(), samples.end());
+
+	result res;
+	res.Benchmark  = b.Name;
+	res.Corpus     = c.Name;
+	res.Bytes      = input_bytes(c, b.Input);
+	res.CodePoints = c.CodePoints;
+	res.Iterations = iters;
+	res.Samples    = opt.Repetitions;
+	res.MedianNs   = samples[samples.size() / 2].first;
+	res.MinNs      = samples.front().first;
+	res.MaxNs      = samples.back().first;
+	res.Cycles     = samples[samples.size() / 2].second;
+	return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Reporting
+
+static const char* isa()
+{
+	return utfz::instruction_set_name(utfz::current_instruction_set());
+}
+
+static const char* compiler()
+{
+#if defined(__clang__)
+	return "clang " __clang_version__;
+#elif defined(__GNUC__)
+	return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+	return "msvc";
+#else
+	return "unknown";
+#endif
+}
+
+static void json_string(FILE* f, const char* s)
+{
+	fputc('"', f);
+	for (; *s != 0; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf(f, "\\%c", *s);
+		else if ((uint8_t) *s < 0x20)
+			fprintf(f, "\\u%04x", (unsigned) *s);
+		else
+			fputc(*s, f);
+	}
+	fputc('"', f);
+}
+
+static bool write_json(const char* filename, const options& opt, const std::vector<result>& results)
+{
+	FILE* f = fopen(filename, "w");
+	if (f == nullptr)
+		return false;
+	fprintf(f, "{\n  \"version\": 1,\n  \"compiler\": ");
+	json_string(f, compiler());
+	fprintf(f, ",\n  \"isa\": \"%s\",\n  \"pointer_bits\": %d,\n", isa(), (int) sizeof(void*) * 8);
+	fprintf(f, "  \"repetitions\": %d,\n  \"min_sample_ms\": %g,\n  \"results\": [", opt.Repetitions, opt.MinSampleMs);
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const result& r = results[i];
+		fprintf(f, "%s\n    {\"benchmark\": \"%s\", \"corpus\": ", i == 0 ? "" : ",", r.Benchmark);
+		json_string(f, r.Corpus.c_str());
+		fprintf(f, ", \"bytes\": %llu, \"code_points\": %llu, \"iterations\": %llu, \"samples\": %d, ",
+		        (unsigned long long) r.Bytes, (unsigned long long) r.CodePoints, (unsigned long long) r.Iterations, r.Samples);
+		fprintf(f, "\"median_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"gb_per_s\": %.4f, \"ns_per_cp\": %.4f, \"cycles_per_byte\": ",
+		        r.MedianNs, r.MinNs, r.MaxNs, r.gb_per_s(), r.ns_per_cp());
+		if (r.Cycles != 0)
+			fprintf(f, "%.4f}", r.cycles_per_byte());
+		else
+			fprintf(f, "null}");
+	}
+	fprintf(f, "\n  ]\n}\n");
+	return fclose(f) == 0;
+}
+
+static void print_result(const result& r)
+{
+	printf("  %-24s %9.3f %9.3f", r.Benchmark, r.gb_per_s(), r.ns_per_cp());
+	if (r.Cycles != 0)
+		printf(" %9.3f", r.cycles_per_byte());
+	printf("\n");
+	fflush(stdout);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool read_file(const char* filename, std::string& text)
+{
+	FILE* f = fopen(filename, "rb");
+	if (f == nullptr)
+		return false;
+	char   buf[65536];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) != 0)
+		text.append(buf, n);
+	bool ok = ferror(f) == 0;
+	fclose(f);
+	return ok;
+}
+
+// Parses a size such as 4096, 64K or 16M
+static bool parse_size(const char* s, size_t& size)
+{
+	char*  end;
+	double v = strtod(s, &end);
+	if (end == s || v <= 0)
+		return false;
+	if (*end == 'K' || *end == 'k')
+		v *= 1024, end++;
+	else if (*end == 'M' || *end == 'm')
+		v *= 1024 * 1024, end++;
+	else if (*end == 'G' || *end == 'g')
+		v *= 1024 * 1024 * 1024, end++;
+	size = (size_t) v;
+	return *end == 0 && size != 0;
+}
+
+// Switches to the kernels named 'name', such as "avx2"
+static bool use_isa(const char* name)
+{
+	for (int i = utfz::isa_scalar; i <= utfz::isa_avx512; i++)
+	{
+		if (strcmp(name, utfz::instruction_set_name((utfz::instruction_set) i)) != 0)
+			continue;
+		if (utfz::use_instruction_set((utfz::instruction_set) i))
+			return true;
+		fprintf(stderr, "%s kernels are not available in this build, or on this CPU\n", name);
+		return false;
+	}
+	fprintf(stderr, "unknown instruction set '%s'\n", name);
+	return false;
+}
+
+static int usage()
+{
+	fprintf(stderr, "usage: utfz-bench [-s size] [-r repetitions] [-t ms] [-b filter] [-c filter] [-i isa] [-j results.json] [file...]\n");
+	fprintf(stderr, "  -s size          Size of each generated corpus, such as 256K or 64M (default 1M)\n");
+	fprintf(stderr, "  -r repetitions   Number of timed samples of each benchmark (default 9)\n");
+	fprintf(stderr, "  -t ms            Minimum duration of each sample (default 10)\n");
+	fprintf(stderr, "  -b filter        Only run the benchmarks whose name contains 'filter'\n");
+	fprintf(stderr, "  -c filter        Only run the corpora whose name contains 'filter'\n");
+	fprintf(stderr, "  -i isa           Use the scalar, sse42, avx2 or avx512 kernels (default: the widest)\n");
+	fprintf(stderr, "  -j results.json  Write the results as JSON\n");
+	fprintf(stderr, "  file...          Benchmark these files instead of the generated corpora\n");
+	return 2;
+}
+
+int main(int argc, char** argv)
+{
+	options                  opt;
+	std::vector<const char*> files;
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (arg[0] != '-' || arg[1] == 0)
+		{
+			files.push_back(arg);
+			continue;
+		}
+		if (arg[2] != 0 || i + 1 >= argc)
+			return usage();
+		const char* val = argv[++i];
+		switch (arg[1])
+		{
+		case 's':
+			if (!parse_size(val, opt.Size))
+				return usage();
+			break;
+		case 'r':
+			opt.Repetitions = atoi(val);
+			if (opt.Repetitions < 1)
+				return usage();
+			break;
+		case 't':
+			opt.MinSampleMs = atof(val);
+			if (opt.MinSampleMs <= 0)
+				return usage();
+			break;
+		case 'b': opt.Benchmarks = val; break;
+		case 'c': opt.Corpora = val; break;
+		case 'i':
+			if (!use_isa(val))
+				return 2;
+			break;
+		case 'j': opt.JSON = val; break;
+		default: return usage();
+		}
+	}
+
+	Pool = utfz::thread_executor();
+
+	printf("utfz-bench: %s, %s\n", isa(), compiler());
+	printf("  %-24s %9s %9s%s\n", "", "GB/s", "ns/cp", cycles() != 0 ? "  cycles/B" : "");
+
+	std::vector<result> results;
+	size_t              ncorpora = files.empty() ? COUNT(corpus_names) : files.size();
+	for (size_t i = 0; i < ncorpora; i++)
+	{
+		// Each corpus is made when it is needed, because the large ones take a lot of memory
+		corpus c;
+		if (files.empty())
+		{
+			c.Name = corpus_names[i];
+			if (opt.Corpora != nullptr && strstr(c.Name.c_str(), opt.Corpora) == nullptr)
+				continue;
+			c.Text = generate((corpus_kind) i, opt.Size);
+		}
+		else
+		{
+			c.Name = files[i];
+			if (!read_file(files[i], c.Text))
+			{
+				fprintf(stderr, "%s: cannot read file\n", files[i]);
+				return 2;
+			}
+		}
+		c.prepare();
+		scratch out;
+		out.prepare(c);
+		printf("%s: %llu bytes, %llu code points, %s\n", c.Name.c_str(), (unsigned long long) c.Text.size(), (unsigned long long) c.CodePoints,
+		       utfz::validate(c.Text.data(), c.Text.data() + c.Text.size()) ? "valid" : "invalid");
+		for (const benchmark& b : benchmarks)
+		{
+			if (opt.Benchmarks != nullptr && strstr(b.Name, opt.Benchmarks) == nullptr)
+				continue;
+			if (b.NullTerminated && c.HasZero)
+				continue;
+			if (input_bytes(c, b.Input) == 0)
+				continue;
+			results.push_back(measure(b, c, out, opt));
+			print_result(results.back());
+		}
+	}
+
+	if (opt.JSON != nullptr && !write_json(opt.JSON, opt, results))
+	{
+		fprintf(stderr, "%s: write failed\n", opt.JSON);
+		return 2;
+	}
+	return 0;
+}
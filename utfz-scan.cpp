@@ -0,0 +1,232 @@
+// -----------------------------------------------------------------------
+// This is free and unencumbered software released into the public domain.
+// -----------------------------------------------------------------------
+
+// utfz-scan: checks whether files are valid UTF-8, and counts their code points.
+//
+// usage: utfz-scan [-o sanitized] file...
+//
+// For each file, this prints whether it is valid, the byte offset of the first error, the
+// number of code points (the same number that iterating over utfz::cp produces), how many
+// sequences there are of each length, and how many invalid sequences there are of each kind.
+// With -o, a copy of the (single) file is written with each invalid sequence replaced by
+// U+FFFD. The copy can't be written over the file itself.
+// The exit code is 0 if every file is valid, 1 if any file is invalid, and 2 on other errors.
+
+#include "utfz.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A read only view of a whole file
+class mapped_file
+{
+public:
+	const char* Data = nullptr;
+	size_t      Size = 0;
+
+	~mapped_file() { close(); }
+
+	bool open(const char* filename)
+	{
+#ifdef _WIN32
+		File = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+			return false;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(File, &size))
+			return false;
+		Size = (size_t) size.QuadPart;
+		if (Size == 0)
+			return true;
+		Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (Mapping == nullptr)
+			return false;
+		Data = (const char*) MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+		return Data != nullptr;
+#else
+		FD = ::open(filename, O_RDONLY);
+		if (FD == -1)
+			return false;
+		struct stat st;
+		if (fstat(FD, &st) != 0)
+			return false;
+		Size = (size_t) st.st_size;
+		if (Size == 0)
+			return true;
+		void* p = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FD, 0);
+		if (p == MAP_FAILED)
+			return false;
+		Data = (const char*) p;
+		// The file is read once, from front to back
+		madvise(p, Size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+		madvise(p, Size, MADV_HUGEPAGE);
+#endif
+		return true;
+#endif
+	}
+
+	// Returns true if 'filename' is this file, under this or another name
+	bool is(const char* filename) const
+	{
+#ifdef _WIN32
+		HANDLE other = CreateFileA(filename, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 0, nullptr);
+		if (other == INVALID_HANDLE_VALUE)
+			return false;
+		BY_HANDLE_FILE_INFORMATION a, b;
+		bool                       same = GetFileInformationByHandle(File, &a) && GetFileInformationByHandle(other, &b);
+		same                            = same && a.dwVolumeSerialNumber == b.dwVolumeSerialNumber && a.nFileIndexHigh == b.nFileIndexHigh && a.nFileIndexLow == b.nFileIndexLow;
+		CloseHandle(other);
+		return same;
+#else
+		struct stat a, b;
+		return fstat(FD, &a) == 0 && stat(filename, &b) == 0 && a.st_dev == b.st_dev && a.st_ino == b.st_ino;
+#endif
+	}
+
+	void close()
+	{
+#ifdef _WIN32
+		if (Data != nullptr)
+			UnmapViewOfFile(Data);
+		if (Mapping != nullptr)
+			CloseHandle(Mapping);
+		if (File != INVALID_HANDLE_VALUE)
+			CloseHandle(File);
+		Mapping = nullptr;
+		File    = INVALID_HANDLE_VALUE;
+#else
+		if (Data != nullptr)
+			munmap((void*) Data, Size);
+		if (FD != -1)
+			::close(FD);
+		FD = -1;
+#endif
+		Data = nullptr;
+		Size = 0;
+	}
+
+private:
+#ifdef _WIN32
+	HANDLE File    = INVALID_HANDLE_VALUE;
+	HANDLE Mapping = nullptr;
+#else
+	int FD = -1;
+#endif
+};
+
+static const char* error_names[utfz::error_kind_count] = {"bad lead byte", "truncated", "overlong", "surrogate", "noncharacter", "too large"};
+
+// Writes a copy of [s, end) to 'out', repaired by utfz::sanitize a piece at a time. Each piece
+// starts on a byte that can start a code point. Nothing that sanitize replaces, or drops after a
+// U+FFFD, reaches over such a byte, so the pieces come out exactly as the whole file would.
+static bool write_sanitized(const char* s, const char* end, FILE* out)
+{
+	const size_t piece = 1 << 20;
+	std::string  fixed;
+	while (s != end)
+	{
+		const char* p = (size_t) (end - s) > piece ? s + piece : end;
+		while (p != end && utfz::seq_len(*p) == utfz::invalid)
+			p++;
+		fixed.clear();
+		bool        valid = utfz::sanitize(s, p, fixed);
+		const char* data  = valid ? s : fixed.data();
+		size_t      size  = valid ? p - s : fixed.size();
+		if (fwrite(data, 1, size, out) != size)
+			return false;
+		s = p;
+	}
+	return true;
+}
+
+static void print_result(const char* filename, size_t size, const utfz::stats& st)
+{
+	printf("%s: %s, %llu bytes, %llu code points\n", filename, st.valid() ? "valid" : "invalid", (unsigned long long) size, (unsigned long long) st.CodePoints);
+	printf("  1 byte: %llu, 2 byte: %llu, 3 byte: %llu, 4 byte: %llu\n",
+	       (unsigned long long) st.Sequences[1], (unsigned long long) st.Sequences[2], (unsigned long long) st.Sequences[3], (unsigned long long) st.Sequences[4]);
+	if (st.valid())
+		return;
+	printf("  %llu errors, the first at byte %llu (%s)\n", (unsigned long long) st.errors(), (unsigned long long) st.FirstError, error_names[st.FirstErrorKind]);
+	printf("  ");
+	for (int i = 0, n = 0; i < utfz::error_kind_count; i++)
+	{
+		if (st.Errors[i] != 0)
+			printf("%s%s: %llu", n++ == 0 ? "" : ", ", error_names[i], (unsigned long long) st.Errors[i]);
+	}
+	printf("\n");
+}
+
+static int usage()
+{
+	fprintf(stderr, "usage: utfz-scan [-o sanitized] file...\n");
+	fprintf(stderr, "  -o sanitized  Write a copy of the file, with invalid sequences replaced by U+FFFD\n");
+	return 2;
+}
+
+int main(int argc, char** argv)
+{
+	const char* sanitized = nullptr;
+	int         first     = 1;
+	if (first < argc && strcmp(argv[first], "-o") == 0)
+	{
+		if (first + 1 >= argc)
+			return usage();
+		sanitized = argv[first + 1];
+		first += 2;
+	}
+	if (first >= argc || (sanitized != nullptr && argc - first != 1))
+		return usage();
+
+	int status = 0;
+	for (int i = first; i < argc; i++)
+	{
+		mapped_file file;
+		if (!file.open(argv[i]))
+		{
+			fprintf(stderr, "%s: cannot read file\n", argv[i]);
+			status = 2;
+			continue;
+		}
+		FILE* out = nullptr;
+		if (sanitized != nullptr)
+		{
+			// Opening the file that is mapped for writing would truncate it under the mapping
+			if (file.is(sanitized))
+			{
+				fprintf(stderr, "%s: cannot write the sanitized copy over the input file\n", sanitized);
+				return 2;
+			}
+			out = fopen(sanitized, "wb");
+			if (out == nullptr)
+			{
+				fprintf(stderr, "%s: cannot create file\n", sanitized);
+				return 2;
+			}
+		}
+		utfz::stats st(file.Data, file.Data + file.Size);
+		if (out != nullptr)
+		{
+			bool ok = st.valid() ? fwrite(file.Data, 1, file.Size, out) == file.Size : write_sanitized(file.Data, file.Data + file.Size, out);
+			if (fclose(out) != 0 || !ok)
+			{
+				fprintf(stderr, "%s: write failed\n", sanitized);
+				return 2;
+			}
+		}
+		print_result(argv[i], file.Size, st);
+		if (!st.valid() && status == 0)
+			status = 1;
+	}
+	return status;
+}
@@ -1,22 +1,90 @@
 // -----------------------------------------------------------------------
 // This is free and unencumbered software released into the public domain.
 // -----------------------------------------------------------------------
+#ifdef UTFZ_NAMESPACE
+// A copy of the library for one instruction set, in a namespace of its own (see UTFZ_DISPATCH)
+#define utfz UTFZ_NAMESPACE
+#endif
 #include "utfz.h"
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 
-namespace utfz {
+// Pick the widest vector instruction set that the compiler is targeting.
+// Only one set of kernels is compiled into each copy of the library; everything else uses the
+// scalar code. See UTFZ_DISPATCH for choosing between copies at run time.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+#define UTFZ_AVX512 1
+#elif defined(__AVX2__)
+#define UTFZ_AVX2 1
+#elif defined(__SSE4_2__) || defined(__AVX__)
+#define UTFZ_SSE42 1
+#endif
+#endif
 
-enum
+#if defined(UTFZ_AVX512) || defined(UTFZ_AVX2) || defined(UTFZ_SSE42)
+#define UTFZ_SIMD 1
+#include <immintrin.h>
+#endif
+
+// With UTFZ_DISPATCH, this file is compiled three more times, for SSE4.2, AVX2 and AVX-512, with
+// UTFZ_NAMESPACE set to utfz_sse42, utfz_avx2 and utfz_avx512. Those copies hold nothing but the
+// vector kernels, and the few scalar helpers that they call. Everything else, including the
+// Unicode tables, and anything that uses the standard library, is left out of them with
+// #ifndef UTFZ_NAMESPACE, so that they don't instantiate any templates that the main copy
+// also instantiates, and that the linker could pick from a copy that the CPU can't run.
+// The main copy hands each kernel over to the one that current_instruction_set() picks,
+// through a table of these, one per copy.
+#if defined(UTFZ_DISPATCH) || defined(UTFZ_NAMESPACE)
+struct utfz_kernels
 {
-	min_cp_2             = 0x80,    // minimum code point that is allowed to be encoded with 2 bytes
-	min_cp_3             = 0x800,   // minimum code point that is allowed to be encoded with 3 bytes
-	min_cp_4             = 0x10000, // minimum code point that is allowed to be encoded with 4 bytes
-	utf16_surrogate_low  = 0xd800,
-	utf16_surrogate_high = 0xdfff,
-	invalid_fffe         = 0xfffe, // this is used for BOM detection
-	invalid_ffff         = 0xffff, // don't know why this is illegal
+	const char* (*first_invalid)(const char* s, const char* end);
+	size_t (*decode_all)(const char* s, const char* end, char32_t* out);
+	size_t (*encoded_length)(const char32_t* cps, size_t n, bool& all_valid);
+	size_t (*encode)(char* buf, const char32_t* cps, size_t n);
+	size_t (*utf16_length_valid)(const char* s, const char* end);
+	char16_t* (*utf8_to_utf16_valid)(const char* s, const char* end, char16_t* out, bool swap);
+	size_t (*utf8_length_of_utf16)(const char16_t* s, size_t n, bool swap);
+	char* (*utf16_to_utf8_any)(const char16_t* s, size_t n, char* out, bool swap, bool& valid);
+	char* (*codepage_to_utf8_any)(const char* s, const char* end, char* out, const uint16_t* table, const uint8_t* identity);
+	void (*utf8_to_codepage_same)(const char*& s, const char* end, char*& out, const uint8_t* identity);
+	size_t (*count_valid)(const char* s, const char* end);
+	size_t (*count_steps)(const char* s, const char* end, size_t& overshoot);
+	void (*count_lengths)(const char* s, const char* end, size_t lengths[5]);
+	size_t (*index_marks)(const char* s, const char* end, size_t k, size_t* marks);
+	const char* (*find_bytes)(const char* s, const char* end, const char* needle, size_t n);
+	size_t (*ascii_case_run)(const char* s, const char* end, char* out, char from);
+	size_t (*simple_run)(const char* s, const char* end, const uint8_t* simple);
+	size_t (*ascii_clusters)(const char*& s, const char* end, const char*& stop);
+	bool (*ascii_width)(const char*& s, const char* end, const char*& stop, size_t max_width, size_t& total);
+	size_t (*decode_block)(const char* s, const char* end, size_t max, char32_t* cps, uint32_t* offsets, const char*& next);
 };
+#endif
+
+#if defined(UTFZ_DISPATCH) && !defined(UTFZ_NAMESPACE)
+#define UTFZ_DISPATCHER 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+namespace utfz_sse42 {
+extern const utfz_kernels kernels;
+}
+namespace utfz_avx2 {
+extern const utfz_kernels kernels;
+}
+namespace utfz_avx512 {
+extern const utfz_kernels kernels;
+}
+#endif
+
+namespace utfz {
 
 // Index from the high 5 bits of the first byte in a sequence to the length of the sequence
 // Imperative that -1 == invalid
@@ -29,6 +97,140 @@ const int8_t seq_len_table[32] = {
     -1,                                             // 31     (11111)
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+#if defined(UTFZ_AVX512)
+static const instruction_set compiled_isa = isa_avx512;
+#elif defined(UTFZ_AVX2)
+static const instruction_set compiled_isa = isa_avx2;
+#elif defined(UTFZ_SSE42)
+static const instruction_set compiled_isa = isa_sse42;
+#else
+static const instruction_set compiled_isa = isa_scalar;
+#endif
+
+#ifdef UTFZ_DISPATCHER
+// The kernels of each instruction set. Those of compiled_isa are the ones in this copy, which is
+// normally compiled without any vector instructions.
+static const utfz_kernels* const kernel_tables[] = {nullptr, &utfz_sse42::kernels, &utfz_avx2::kernels, &utfz_avx512::kernels};
+
+static std::atomic<int> active_isa(-1); // -1 until the first call picks one
+
+// Returns true if the CPU, and the operating system, support 'isa'
+static bool cpu_supports(instruction_set isa)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	int r0[4], r1[4], r7[4] = {0, 0, 0, 0};
+	__cpuid(r0, 0);
+	__cpuid(r1, 1);
+	if (r0[0] >= 7)
+		__cpuidex(r7, 7, 0);
+	// The OS saves the AVX registers (bits 1 and 2), and the AVX-512 registers (bits 5 to 7)
+	uint64_t xcr0 = (r1[2] & (1 << 27)) != 0 ? _xgetbv(0) : 0;
+	switch (isa)
+	{
+	case isa_sse42: return (r1[2] & (1 << 20)) != 0 && (r1[2] & (1 << 23)) != 0; // SSE4.2 and popcnt
+	case isa_avx2: return (xcr0 & 0x6) == 0x6 && (r7[1] & (1 << 5)) != 0;
+	case isa_avx512: return (xcr0 & 0xe6) == 0xe6 && (r7[1] & (1 << 16)) != 0 && (r7[1] & (1 << 30)) != 0 && (r7[1] & (1u << 31)) != 0;
+	default: return true;
+	}
+#else
+	__builtin_cpu_init();
+	switch (isa)
+	{
+	case isa_sse42: return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+	case isa_avx2: return __builtin_cpu_supports("avx2");
+	case isa_avx512: return __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl");
+	default: return true;
+	}
+#endif
+}
+
+// Returns the widest instruction set that the CPU supports, and that UTFZ_ISA allows
+static int choose_isa()
+{
+	int isa = isa_avx512;
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma warning(suppress : 4996)
+#endif
+	const char* env = getenv("UTFZ_ISA");
+	for (int i = isa_scalar; env != nullptr && i <= isa_avx512; i++)
+	{
+		if (strcmp(env, instruction_set_name((instruction_set) i)) == 0)
+			isa = i;
+	}
+	while (isa > compiled_isa && !cpu_supports((instruction_set) isa))
+		isa--;
+	if (isa < compiled_isa)
+		isa = compiled_isa;
+	return isa;
+}
+
+// Returns the kernels to hand over to, or null to run the ones in this copy
+static inline const utfz_kernels* active_kernels()
+{
+	int isa = active_isa.load(std::memory_order_relaxed);
+	if (isa < 0)
+	{
+		int expected = -1;
+		isa          = choose_isa();
+		if (!active_isa.compare_exchange_strong(expected, isa, std::memory_order_relaxed))
+			isa = expected; // use_instruction_set() got there first
+	}
+	return isa == compiled_isa ? nullptr : kernel_tables[isa];
+}
+
+// Returns from the calling function with the result of its copy in the active kernels, unless
+// those are the ones in this copy
+#define UTFZ_DISPATCH_TO(kernel, ...)                          \
+	do                                                         \
+	{                                                          \
+		if (const utfz_kernels* active_ = active_kernels()) \
+			return active_->kernel(__VA_ARGS__);               \
+	} while (0)
+#endif
+
+instruction_set current_instruction_set()
+{
+#ifdef UTFZ_DISPATCHER
+	active_kernels();
+	return (instruction_set) active_isa.load(std::memory_order_relaxed);
+#else
+	return compiled_isa;
+#endif
+}
+
+bool has_instruction_set(instruction_set isa)
+{
+#ifdef UTFZ_DISPATCHER
+	return isa >= compiled_isa && isa <= isa_avx512 && cpu_supports(isa);
+#else
+	return isa == compiled_isa;
+#endif
+}
+
+bool use_instruction_set(instruction_set isa)
+{
+	if (!has_instruction_set(isa))
+		return false;
+#ifdef UTFZ_DISPATCHER
+	active_isa.store(isa, std::memory_order_relaxed);
+#endif
+	return true;
+}
+
+const char* instruction_set_name(instruction_set isa)
+{
+	static const char* names[] = {"scalar", "sse42", "avx2", "avx512"};
+	return isa >= isa_scalar && isa <= isa_avx512 ? names[isa] : "unknown";
+}
+#endif
+
+#ifndef UTFZ_DISPATCHER
+#define UTFZ_DISPATCH_TO(kernel, ...) (void) 0
+#endif
+
 int seq_len(char c)
 {
 	uint8_t high5 = ((uint8_t) c) >> 3;
@@ -63,23 +265,6 @@ const char* restart(const char* s, const char* end)
 	return s;
 }
 
-static bool is_legal_3_byte_code(int cp)
-{
-	// overlong sequence
-	if (cp < min_cp_3)
-		return false;
-
-	// UTF-16 surrogate pairs
-	if (cp >= utf16_surrogate_low && cp <= utf16_surrogate_high)
-		return false;
-
-	// BOM and ffff
-	if (cp == invalid_fffe || cp == invalid_ffff)
-		return false;
-
-	return true;
-}
-
 int decode(const char* s, const char* end)
 {
 	int _seq_len;
@@ -88,46 +273,10 @@ int decode(const char* s, const char* end)
 
 int decode(const char* s, const char* end, int& _seq_len)
 {
-	_seq_len = 0;
-	int slen = seq_len(s[0]);
-	if (slen == invalid)
-		return replace;
-
-	if ((intptr_t)(end - s) < (intptr_t) slen)
-		return replace;
-
-	int cp = 0;
-	switch (slen)
-	{
-	case 1:
-		cp = s[0];
-		break;
-	case 2:
-		if ((s[1] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
-		if (cp < min_cp_2)
-			return replace;
-		break;
-	case 3:
-		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
-		if (!is_legal_3_byte_code(cp))
-			return replace;
-		break;
-	case 4:
-		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
-		if (cp < min_cp_4 || cp > max4)
-			return replace;
-		break;
-	}
-	_seq_len = slen;
-	return cp;
+	return decode<replace_errors>(s, end, _seq_len);
 }
 
+#ifndef UTFZ_NAMESPACE
 int decode(const char* s)
 {
 	int _seq_len;
@@ -136,74 +285,62 @@ int decode(const char* s)
 
 int decode(const char* s, int& _seq_len)
 {
-	_seq_len = 0;
-	int slen = seq_len(s[0]);
-	if (slen == invalid)
-		return replace;
-
-	int cp = 0;
-	switch (slen)
-	{
-	case 1:
-		cp = s[0];
-		break;
-	case 2:
-		if ((s[1] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
-		if (cp < min_cp_2)
-			return replace;
-		break;
-	case 3:
-		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
-		if (!is_legal_3_byte_code(cp))
-			return replace;
-		break;
-	case 4:
-		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80)
-			return replace;
-		cp = ((s[0] & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
-		if (cp < min_cp_4 || cp > max4)
-			return replace;
-		break;
-	}
-	_seq_len = slen;
-	return cp;
+	// A sequence is cut short by the terminator, so it is enough to know the next 4 bytes
+	int len = 0;
+	while (len != 4 && s[len] != 0)
+		len++;
+	return decode<replace_errors>(s, s + len, _seq_len);
 }
 
 bool next(const char*& s, const char* end, int& cp)
 {
-	if (s == end)
+	replace_errors policy;
+	return next(s, end, cp, policy);
+}
+
+bool next(const char*& s, int& cp)
+{
+	if (*s == 0)
 	{
 		cp = replace;
 		return false;
 	}
 	int slen;
-	cp = decode(s, end, slen);
+	cp = decode(s, slen);
 	if (cp == replace)
-		s = restart(s, end);
+		s = restart(s);
 	else
 		s += slen;
 	return true;
 }
 
-bool next(const char*& s, int& cp)
+bool prev(const char*& s, const char* begin, int& cp)
 {
-	if (*s == 0)
+	if (s == begin)
 	{
 		cp = replace;
 		return false;
 	}
+	// next() stops at every plausible start byte, and after each valid sequence, so the code point
+	// before 's' starts at the last plausible start byte, or at the end of the sequence that it starts.
+	const char* p = s - 1;
+	while (p != begin && seq_len(*p) == invalid)
+		p--;
 	int slen;
-	cp = decode(s, slen);
-	if (cp == replace)
-		s = restart(s);
+	cp = decode(p, s, slen);
+	if (cp == replace || p + slen == s)
+	{
+		s = p;
+	}
 	else
-		s += slen;
+	{
+		// stray continuation bytes after a valid sequence
+		cp = replace;
+		s  = p + slen;
+	}
 	return true;
 }
+#endif
 
 int encode(char* buf, int cp)
 {
@@ -242,6 +379,7 @@ int encode(char* buf, int cp)
 	}
 }
 
+#ifndef UTFZ_NAMESPACE
 bool encode(std::string& s, int cp)
 {
 	char buf[4];
@@ -273,103 +411,10244 @@ bool encode(std::string& s, int cp)
 	}
 	return true;
 }
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-cp::cp(const char* str, size_t len)
-    : Str(str)
+// Returns the start of the first sequence that decode() rejects, or 'end' if there is none.
+static const char* first_invalid_scalar(const char* s, const char* end)
 {
-	if (len == -1)
-		End = nullptr;
-	else
-		End = Str + len;
+	while (s != end)
+	{
+		// skip ASCII 8 bytes at a time
+		if (end - s >= 8)
+		{
+			uint64_t w;
+			memcpy(&w, s, 8);
+			if ((w & 0x8080808080808080ull) == 0)
+			{
+				s += 8;
+				continue;
+			}
+		}
+		if ((uint8_t) s[0] <= max1)
+		{
+			s++;
+			continue;
+		}
+		int slen;
+		decode(s, end, slen);
+		if (slen == 0)
+			return s;
+		s += slen;
+	}
+	return end;
 }
 
-cp::cp(const std::string& s)
-    : Str(s.c_str()), End(s.c_str() + s.length())
+#ifdef UTFZ_SIMD
+// Everything in [begin, p) has been validated, except possibly for a sequence that is
+// cut off by 'p'. Returns the start of that sequence, or 'p' if there is none.
+static const char* sequence_start(const char* begin, const char* p)
+{
+	for (int i = 1; i <= 3 && p - i >= begin; i++)
+	{
+		uint8_t c = p[-i];
+		if (c >= 0xc0)
+			return p - i;
+		if (c <= max1)
+			break;
+	}
+	return p;
+}
+
+// The vector validators use the algorithm from "Validating UTF-8 In Less Than One
+// Instruction Per Byte" (Keiser & Lemire, 2021). Every byte is classified together
+// with the byte before it, using three 16 entry nibble lookups, and the AND of the three
+// lookups is non-zero for an illegal pair. Third and fourth bytes of a sequence are
+// checked separately, by looking two and three bytes back.
+// On top of that, we reject EF BF BE and EF BF BF (0xFFFE and 0xFFFF), to match decode().
+enum
+{
+	lut_too_short      = 1 << 0, // 11______ 0_______, or 11______ 11______
+	lut_too_long       = 1 << 1, // 0_______ 10______
+	lut_overlong_3     = 1 << 2, // 11100000 100_____
+	lut_too_large      = 1 << 3, // 11110100 1001____, 11110100 101_____, or 11110101+ 10______
+	lut_surrogate      = 1 << 4, // 11101101 101_____
+	lut_overlong_2     = 1 << 5, // 1100000_ 10______
+	lut_too_large_1000 = 1 << 6, // 11110101+ 1000____
+	lut_overlong_4     = 1 << 6, // 11110000 1000____
+	lut_two_conts      = 1 << 7, // 10______ 10______
+	lut_carry          = lut_too_short | lut_too_long | lut_two_conts,
+};
+
+// Indexed by the high nibble of the previous byte
+static const uint8_t lut_byte_1_high[16] = {
+    lut_too_long, lut_too_long, lut_too_long, lut_too_long, // 0_______
+    lut_too_long, lut_too_long, lut_too_long, lut_too_long,
+    lut_two_conts, lut_two_conts, lut_two_conts, lut_two_conts,              // 10______
+    lut_too_short | lut_overlong_2,                                          // 1100____
+    lut_too_short,                                                           // 1101____
+    lut_too_short | lut_overlong_3 | lut_surrogate,                          // 1110____
+    lut_too_short | lut_too_large | lut_too_large_1000 | lut_overlong_4,     // 1111____
+};
+
+// Indexed by the low nibble of the previous byte
+static const uint8_t lut_byte_1_low[16] = {
+    lut_carry | lut_overlong_3 | lut_overlong_2 | lut_overlong_4, // ____0000
+    lut_carry | lut_overlong_2,                                   // ____0001
+    lut_carry,                                                    // ____001_
+    lut_carry,
+    lut_carry | lut_too_large,                                    // ____0100
+    lut_carry | lut_too_large | lut_too_large_1000,               // ____0101
+    lut_carry | lut_too_large | lut_too_large_1000,               // ____011_
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000, // ____1___
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000 | lut_surrogate, // ____1101
+    lut_carry | lut_too_large | lut_too_large_1000,
+    lut_carry | lut_too_large | lut_too_large_1000,
+};
+
+// Indexed by the high nibble of the current byte
+static const uint8_t lut_byte_2_high[16] = {
+    lut_too_short, lut_too_short, lut_too_short, lut_too_short, // 0_______
+    lut_too_short, lut_too_short, lut_too_short, lut_too_short,
+    lut_too_long | lut_overlong_2 | lut_two_conts | lut_overlong_3 | lut_too_large_1000 | lut_overlong_4, // 1000____
+    lut_too_long | lut_overlong_2 | lut_two_conts | lut_overlong_3 | lut_too_large,                      // 1001____
+    lut_too_long | lut_overlong_2 | lut_two_conts | lut_surrogate | lut_too_large,                       // 101_____
+    lut_too_long | lut_overlong_2 | lut_two_conts | lut_surrogate | lut_too_large,
+    lut_too_short, lut_too_short, lut_too_short, lut_too_short, // 11______
+};
+
+// A block is incomplete if it ends with a lead byte whose continuation bytes are in the
+// next block. Subtracting this (with saturation) from the last bytes of a block is non-zero
+// for such a lead byte. Vectors of 16, 32 and 64 bytes load from the end of this array.
+static const uint8_t incomplete_max[64] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf,
+};
+#endif
+
+#if defined(UTFZ_SSE42)
+static const char* first_invalid_sse42(const char* s, const char* end)
+{
+	const char*   begin      = s;
+	const __m128i b1h        = _mm_loadu_si128((const __m128i*) lut_byte_1_high);
+	const __m128i b1l        = _mm_loadu_si128((const __m128i*) lut_byte_1_low);
+	const __m128i b2h        = _mm_loadu_si128((const __m128i*) lut_byte_2_high);
+	const __m128i inc_max    = _mm_loadu_si128((const __m128i*) (incomplete_max + 48));
+	const __m128i nibble     = _mm_set1_epi8(0x0f);
+	const __m128i ef         = _mm_set1_epi8((char) 0xef);
+	const __m128i bf         = _mm_set1_epi8((char) 0xbf);
+	__m128i       prev_input = _mm_setzero_si128();
+	__m128i       prev_inc   = _mm_setzero_si128();
+	for (; end - s >= 16; s += 16)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*) s);
+		__m128i error;
+		if (_mm_movemask_epi8(input) == 0)
+		{
+			// pure ASCII, so the only possible error is a sequence cut off by the previous block
+			error = prev_inc;
+		}
+		else
+		{
+			__m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+			__m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+			__m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+			__m128i sc    = _mm_shuffle_epi8(b1h, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+			sc            = _mm_and_si128(sc, _mm_shuffle_epi8(b1l, _mm_and_si128(prev1, nibble)));
+			sc            = _mm_and_si128(sc, _mm_shuffle_epi8(b2h, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+			// the high bit is set for bytes that must be a third or fourth byte
+			__m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80)), _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80)));
+			error          = _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char) 0x80)), sc);
+			__m128i nonchar = _mm_and_si128(_mm_cmpeq_epi8(prev2, ef), _mm_cmpeq_epi8(prev1, bf));
+			nonchar         = _mm_and_si128(nonchar, _mm_cmpeq_epi8(_mm_or_si128(input, _mm_set1_epi8(1)), bf));
+			error           = _mm_or_si128(error, nonchar);
+			prev_inc        = _mm_subs_epu8(input, inc_max);
+		}
+		prev_input = input;
+		if (!_mm_testz_si128(error, error))
+			break;
+	}
+	// Find the exact error (if any), and deal with the tail
+	return first_invalid_scalar(sequence_start(begin, s), end);
+}
+#endif
+
+#if defined(UTFZ_AVX2)
+static const char* first_invalid_avx2(const char* s, const char* end)
+{
+	const char*   begin      = s;
+	const __m256i b1h        = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) lut_byte_1_high));
+	const __m256i b1l        = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) lut_byte_1_low));
+	const __m256i b2h        = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) lut_byte_2_high));
+	const __m256i inc_max    = _mm256_loadu_si256((const __m256i*) (incomplete_max + 32));
+	const __m256i nibble     = _mm256_set1_epi8(0x0f);
+	const __m256i ef         = _mm256_set1_epi8((char) 0xef);
+	const __m256i bf         = _mm256_set1_epi8((char) 0xbf);
+	__m256i       prev_input = _mm256_setzero_si256();
+	__m256i       prev_inc   = _mm256_setzero_si256();
+	for (; end - s >= 32; s += 32)
+	{
+		__m256i input = _mm256_loadu_si256((const __m256i*) s);
+		__m256i error;
+		if (_mm256_movemask_epi8(input) == 0)
+		{
+			error = prev_inc;
+		}
+		else
+		{
+			// 'shifted' holds the high half of prev_input, followed by the low half of input
+			__m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+			__m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+			__m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+			__m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+			__m256i sc      = _mm256_shuffle_epi8(b1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+			sc              = _mm256_and_si256(sc, _mm256_shuffle_epi8(b1l, _mm256_and_si256(prev1, nibble)));
+			sc              = _mm256_and_si256(sc, _mm256_shuffle_epi8(b2h, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+			__m256i must23  = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80)), _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80)));
+			error           = _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char) 0x80)), sc);
+			__m256i nonchar = _mm256_and_si256(_mm256_cmpeq_epi8(prev2, ef), _mm256_cmpeq_epi8(prev1, bf));
+			nonchar         = _mm256_and_si256(nonchar, _mm256_cmpeq_epi8(_mm256_or_si256(input, _mm256_set1_epi8(1)), bf));
+			error           = _mm256_or_si256(error, nonchar);
+			prev_inc        = _mm256_subs_epu8(input, inc_max);
+		}
+		prev_input = input;
+		if (!_mm256_testz_si256(error, error))
+			break;
+	}
+	return first_invalid_scalar(sequence_start(begin, s), end);
+}
+#endif
+
+#if defined(UTFZ_AVX512)
+static const char* first_invalid_avx512(const char* s, const char* end)
+{
+	const char*   begin      = s;
+	const __m512i b1h        = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*) lut_byte_1_high));
+	const __m512i b1l        = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*) lut_byte_1_low));
+	const __m512i b2h        = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*) lut_byte_2_high));
+	const __m512i inc_max    = _mm512_loadu_si512((const void*) incomplete_max);
+	const __m512i nibble     = _mm512_set1_epi8(0x0f);
+	const __m512i ef         = _mm512_set1_epi8((char) 0xef);
+	const __m512i bf         = _mm512_set1_epi8((char) 0xbf);
+	__m512i       prev_input = _mm512_setzero_si512();
+	__m512i       prev_inc   = _mm512_setzero_si512();
+	for (; end - s >= 64; s += 64)
+	{
+		__m512i   input = _mm512_loadu_si512((const void*) s);
+		__mmask64 error;
+		if (_mm512_movepi8_mask(input) == 0)
+		{
+			error = _mm512_test_epi8_mask(prev_inc, prev_inc);
+		}
+		else
+		{
+			// 'shifted' holds the last 16 bytes of prev_input, followed by the first 48 bytes of input
+			__m512i   shifted = _mm512_alignr_epi64(input, prev_input, 6);
+			__m512i   prev1   = _mm512_alignr_epi8(input, shifted, 15);
+			__m512i   prev2   = _mm512_alignr_epi8(input, shifted, 14);
+			__m512i   prev3   = _mm512_alignr_epi8(input, shifted, 13);
+			__m512i   sc      = _mm512_shuffle_epi8(b1h, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble));
+			sc                = _mm512_and_si512(sc, _mm512_shuffle_epi8(b1l, _mm512_and_si512(prev1, nibble)));
+			sc                = _mm512_and_si512(sc, _mm512_shuffle_epi8(b2h, _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble)));
+			__m512i   must23  = _mm512_or_si512(_mm512_subs_epu8(prev2, _mm512_set1_epi8(0xe0 - 0x80)), _mm512_subs_epu8(prev3, _mm512_set1_epi8(0xf0 - 0x80)));
+			__m512i   err     = _mm512_xor_si512(_mm512_and_si512(must23, _mm512_set1_epi8((char) 0x80)), sc);
+			__mmask64 nonchar = _mm512_cmpeq_epi8_mask(prev2, ef) & _mm512_cmpeq_epi8_mask(prev1, bf) &
+			                    _mm512_cmpeq_epi8_mask(_mm512_or_si512(input, _mm512_set1_epi8(1)), bf);
+			error    = _mm512_test_epi8_mask(err, err) | nonchar;
+			prev_inc = _mm512_subs_epu8(input, inc_max);
+		}
+		prev_input = input;
+		if (error != 0)
+			break;
+	}
+	return first_invalid_scalar(sequence_start(begin, s), end);
+}
+#endif
+
+// Returns the start of the first sequence that decode() rejects, or 'end' if there is none.
+const char* first_invalid(const char* s, const char* end)
+{
+	UTFZ_DISPATCH_TO(first_invalid, s, end);
+#if defined(UTFZ_AVX512)
+	return first_invalid_avx512(s, end);
+#elif defined(UTFZ_AVX2)
+	return first_invalid_avx2(s, end);
+#elif defined(UTFZ_SSE42)
+	return first_invalid_sse42(s, end);
+#else
+	return first_invalid_scalar(s, end);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+bool validate(const char* s, const char* end)
 {
+	return first_invalid(s, end) == end;
 }
 
+bool validate(const char* s)
+{
+	return validate(s, s + strlen(s));
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-cp::iter::iter(const char* s, const char* end)
-    : S(s), End(end)
+// One step of next(). Writes the code point at 's' to 'out', and returns the start of the
+// next plausible code point.
+static const char* decode_step(const char* s, const char* end, char32_t* out)
 {
-	if (!known_end() && S != nullptr)
+	int slen;
+	int cp = decode(s, end, slen);
+	*out   = (char32_t) cp;
+	if (cp == replace)
+		return restart(s, end);
+	return s + slen;
+}
+
+// Returns the new end of 'out'
+static char32_t* decode_all_scalar(const char* s, const char* end, char32_t* out)
+{
+	while (s != end)
 	{
-		if (S[0] == 0)
-			S = End;
+		if ((uint8_t) s[0] <= max1)
+			*out++ = (char32_t) *s++;
+		else
+			s = decode_step(s, end, out++);
 	}
+	return out;
 }
 
-cp::iter& cp::iter::operator++()
+#ifdef UTFZ_SIMD
+static inline int popcount(uint32_t x)
 {
-	increment();
-	return *this;
+#if defined(_MSC_VER) && !defined(__clang__)
+	return (int) __popcnt(x);
+#else
+	return __builtin_popcount(x);
+#endif
 }
 
-cp::iter& cp::iter::operator++(int)
+static inline int popcount_64(uint64_t x)
 {
-	increment();
-	return *this;
+	return popcount((uint32_t) x) + popcount((uint32_t) (x >> 32));
 }
 
-void cp::iter::increment()
+// packed_indices[m] holds the positions of the set bits of 'm', one per byte, in ascending
+// order. As a shuffle, it moves the lanes that are selected by 'm' to the front. The unused
+// bytes are 0x80, which makes a byte shuffle write zero.
+static const uint64_t packed_indices[256] = {
+    0x8080808080808080ull, 0x8080808080808000ull, 0x8080808080808001ull, 0x8080808080800100ull,
+    0x8080808080808002ull, 0x8080808080800200ull, 0x8080808080800201ull, 0x8080808080020100ull,
+    0x8080808080808003ull, 0x8080808080800300ull, 0x8080808080800301ull, 0x8080808080030100ull,
+    0x8080808080800302ull, 0x8080808080030200ull, 0x8080808080030201ull, 0x8080808003020100ull,
+    0x8080808080808004ull, 0x8080808080800400ull, 0x8080808080800401ull, 0x8080808080040100ull,
+    0x8080808080800402ull, 0x8080808080040200ull, 0x8080808080040201ull, 0x8080808004020100ull,
+    0x8080808080800403ull, 0x8080808080040300ull, 0x8080808080040301ull, 0x8080808004030100ull,
+    0x8080808080040302ull, 0x8080808004030200ull, 0x8080808004030201ull, 0x8080800403020100ull,
+    0x8080808080808005ull, 0x8080808080800500ull, 0x8080808080800501ull, 0x8080808080050100ull,
+    0x8080808080800502ull, 0x8080808080050200ull, 0x8080808080050201ull, 0x8080808005020100ull,
+    0x8080808080800503ull, 0x8080808080050300ull, 0x8080808080050301ull, 0x8080808005030100ull,
+    0x8080808080050302ull, 0x8080808005030200ull, 0x8080808005030201ull, 0x8080800503020100ull,
+    0x8080808080800504ull, 0x8080808080050400ull, 0x8080808080050401ull, 0x8080808005040100ull,
+    0x8080808080050402ull, 0x8080808005040200ull, 0x8080808005040201ull, 0x8080800504020100ull,
+    0x8080808080050403ull, 0x8080808005040300ull, 0x8080808005040301ull, 0x8080800504030100ull,
+    0x8080808005040302ull, 0x8080800504030200ull, 0x8080800504030201ull, 0x8080050403020100ull,
+    0x8080808080808006ull, 0x8080808080800600ull, 0x8080808080800601ull, 0x8080808080060100ull,
+    0x8080808080800602ull, 0x8080808080060200ull, 0x8080808080060201ull, 0x8080808006020100ull,
+    0x8080808080800603ull, 0x8080808080060300ull, 0x8080808080060301ull, 0x8080808006030100ull,
+    0x8080808080060302ull, 0x8080808006030200ull, 0x8080808006030201ull, 0x8080800603020100ull,
+    0x8080808080800604ull, 0x8080808080060400ull, 0x8080808080060401ull, 0x8080808006040100ull,
+    0x8080808080060402ull, 0x8080808006040200ull, 0x8080808006040201ull, 0x8080800604020100ull,
+    0x8080808080060403ull, 0x8080808006040300ull, 0x8080808006040301ull, 0x8080800604030100ull,
+    0x8080808006040302ull, 0x8080800604030200ull, 0x8080800604030201ull, 0x8080060403020100ull,
+    0x8080808080800605ull, 0x8080808080060500ull, 0x8080808080060501ull, 0x8080808006050100ull,
+    0x8080808080060502ull, 0x8080808006050200ull, 0x8080808006050201ull, 0x8080800605020100ull,
+    0x8080808080060503ull, 0x8080808006050300ull, 0x8080808006050301ull, 0x8080800605030100ull,
+    0x8080808006050302ull, 0x8080800605030200ull, 0x8080800605030201ull, 0x8080060503020100ull,
+    0x8080808080060504ull, 0x8080808006050400ull, 0x8080808006050401ull, 0x8080800605040100ull,
+    0x8080808006050402ull, 0x8080800605040200ull, 0x8080800605040201ull, 0x8080060504020100ull,
+    0x8080808006050403ull, 0x8080800605040300ull, 0x8080800605040301ull, 0x8080060504030100ull,
+    0x8080800605040302ull, 0x8080060504030200ull, 0x8080060504030201ull, 0x8006050403020100ull,
+    0x8080808080808007ull, 0x8080808080800700ull, 0x8080808080800701ull, 0x8080808080070100ull,
+    0x8080808080800702ull, 0x8080808080070200ull, 0x8080808080070201ull, 0x8080808007020100ull,
+    0x8080808080800703ull, 0x8080808080070300ull, 0x8080808080070301ull, 0x8080808007030100ull,
+    0x8080808080070302ull, 0x8080808007030200ull, 0x8080808007030201ull, 0x8080800703020100ull,
+    0x8080808080800704ull, 0x8080808080070400ull, 0x8080808080070401ull, 0x8080808007040100ull,
+    0x8080808080070402ull, 0x8080808007040200ull, 0x8080808007040201ull, 0x8080800704020100ull,
+    0x8080808080070403ull, 0x8080808007040300ull, 0x8080808007040301ull, 0x8080800704030100ull,
+    0x8080808007040302ull, 0x8080800704030200ull, 0x8080800704030201ull, 0x8080070403020100ull,
+    0x8080808080800705ull, 0x8080808080070500ull, 0x8080808080070501ull, 0x8080808007050100ull,
+    0x8080808080070502ull, 0x8080808007050200ull, 0x8080808007050201ull, 0x8080800705020100ull,
+    0x8080808080070503ull, 0x8080808007050300ull, 0x8080808007050301ull, 0x8080800705030100ull,
+    0x8080808007050302ull, 0x8080800705030200ull, 0x8080800705030201ull, 0x8080070503020100ull,
+    0x8080808080070504ull, 0x8080808007050400ull, 0x8080808007050401ull, 0x8080800705040100ull,
+    0x8080808007050402ull, 0x8080800705040200ull, 0x8080800705040201ull, 0x8080070504020100ull,
+    0x8080808007050403ull, 0x8080800705040300ull, 0x8080800705040301ull, 0x8080070504030100ull,
+    0x8080800705040302ull, 0x8080070504030200ull, 0x8080070504030201ull, 0x8007050403020100ull,
+    0x8080808080800706ull, 0x8080808080070600ull, 0x8080808080070601ull, 0x8080808007060100ull,
+    0x8080808080070602ull, 0x8080808007060200ull, 0x8080808007060201ull, 0x8080800706020100ull,
+    0x8080808080070603ull, 0x8080808007060300ull, 0x8080808007060301ull, 0x8080800706030100ull,
+    0x8080808007060302ull, 0x8080800706030200ull, 0x8080800706030201ull, 0x8080070603020100ull,
+    0x8080808080070604ull, 0x8080808007060400ull, 0x8080808007060401ull, 0x8080800706040100ull,
+    0x8080808007060402ull, 0x8080800706040200ull, 0x8080800706040201ull, 0x8080070604020100ull,
+    0x8080808007060403ull, 0x8080800706040300ull, 0x8080800706040301ull, 0x8080070604030100ull,
+    0x8080800706040302ull, 0x8080070604030200ull, 0x8080070604030201ull, 0x8007060403020100ull,
+    0x8080808080070605ull, 0x8080808007060500ull, 0x8080808007060501ull, 0x8080800706050100ull,
+    0x8080808007060502ull, 0x8080800706050200ull, 0x8080800706050201ull, 0x8080070605020100ull,
+    0x8080808007060503ull, 0x8080800706050300ull, 0x8080800706050301ull, 0x8080070605030100ull,
+    0x8080800706050302ull, 0x8080070605030200ull, 0x8080070605030201ull, 0x8007060503020100ull,
+    0x8080808007060504ull, 0x8080800706050400ull, 0x8080800706050401ull, 0x8080070605040100ull,
+    0x8080800706050402ull, 0x8080070605040200ull, 0x8080070605040201ull, 0x8007060504020100ull,
+    0x8080800706050403ull, 0x8080070605040300ull, 0x8080070605040301ull, 0x8007060504030100ull,
+    0x8080070605040302ull, 0x8007060504030200ull, 0x8007060504030201ull, 0x0706050403020100ull,
+};
+
+// Moves the 16-bit lanes of 'v' that are selected by the low 8 bits of 'mask' to the front
+static inline __m128i compact_epi16(__m128i v, unsigned mask)
 {
-	// Guard against iteration after having reached the end.
-	if (S == End)
-		return;
+	__m128i idx = _mm_loadl_epi64((const __m128i*) &packed_indices[mask]);
+	idx         = _mm_unpacklo_epi8(idx, idx);
+	idx         = _mm_add_epi8(_mm_add_epi8(idx, idx), _mm_set1_epi16(0x0100));
+	return _mm_shuffle_epi8(v, idx);
+}
 
-	if (known_end())
+// Returns 'b' where 'lead' is clear, or the 2 byte code point made of 'b' and 'next' where 'lead' is set
+static inline __m128i combine_2_byte(__m128i b, __m128i next, __m128i lead)
+{
+	__m128i two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b, _mm_set1_epi16(0x1f)), 6), _mm_and_si128(next, _mm_set1_epi16(0x3f)));
+	return _mm_blendv_epi8(b, two, lead);
+}
+
+// Decodes 16 bytes that start on a sequence boundary, and hold nothing but ASCII and valid
+// 2 byte sequences. The code points are placed in the 16-bit lanes of 'lo' (the first 'nlo'
+// code points) and 'hi' (the next 'nhi' code points).
+// Returns the number of bytes consumed, which is 15 if the last byte is a lead byte.
+// Returns 0 if the block holds anything else, including errors.
+static inline int decode_2_byte_block(__m128i in, __m128i& lo, int& nlo, __m128i& hi, int& nhi)
+{
+	// Signed comparisons: 80..BF are continuation bytes, and C2..DF are valid 2 byte lead bytes
+	__m128i  cont = _mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xc0));
+	__m128i  lead = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8((char) 0xc1)), _mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xe0)));
+	unsigned high = _mm_movemask_epi8(in);
+	unsigned cm   = _mm_movemask_epi8(cont);
+	unsigned lm   = _mm_movemask_epi8(lead);
+	if ((high & ~(cm | lm)) != 0 || cm != ((lm << 1) & 0xffff))
+		return 0;
+	unsigned last = lm >> 15; // the continuation byte of the last lead byte is in the next block
+	unsigned keep = ~cm & (0xffff >> last);
+
+	lo  = combine_2_byte(_mm_cvtepu8_epi16(in), _mm_cvtepu8_epi16(_mm_srli_si128(in, 1)), _mm_cvtepi8_epi16(lead));
+	hi  = combine_2_byte(_mm_cvtepu8_epi16(_mm_srli_si128(in, 8)), _mm_cvtepu8_epi16(_mm_srli_si128(in, 9)), _mm_cvtepi8_epi16(_mm_srli_si128(lead, 8)));
+	lo  = compact_epi16(lo, keep & 0xff);
+	hi  = compact_epi16(hi, keep >> 8);
+	nlo = popcount(keep & 0xff);
+	nhi = popcount(keep >> 8);
+	return 16 - last;
+}
+#endif
+
+#if defined(UTFZ_SSE42)
+static size_t decode_all_sse42(const char* s, const char* end, char32_t* out)
+{
+	char32_t* start = out;
+	while (end - s >= 16)
 	{
-		int len = seq_len(S[0]);
-		if (len == invalid)
+		__m128i in = _mm_loadu_si128((const __m128i*) s);
+		if (_mm_movemask_epi8(in) == 0)
 		{
-			S = restart(S, End);
+			_mm_storeu_si128((__m128i*) out, _mm_cvtepu8_epi32(in));
+			_mm_storeu_si128((__m128i*) (out + 4), _mm_cvtepu8_epi32(_mm_srli_si128(in, 4)));
+			_mm_storeu_si128((__m128i*) (out + 8), _mm_cvtepu8_epi32(_mm_srli_si128(in, 8)));
+			_mm_storeu_si128((__m128i*) (out + 12), _mm_cvtepu8_epi32(_mm_srli_si128(in, 12)));
+			s += 16;
+			out += 16;
+			continue;
 		}
-		else
+		__m128i lo, hi;
+		int     nlo, nhi;
+		int     n = decode_2_byte_block(in, lo, nlo, hi, nhi);
+		if (n != 0)
 		{
-			if (S + len > End)
-				S = End;
-			else
-				S += len;
+			_mm_storeu_si128((__m128i*) out, _mm_cvtepu16_epi32(lo));
+			_mm_storeu_si128((__m128i*) (out + 4), _mm_cvtepu16_epi32(_mm_srli_si128(lo, 8)));
+			out += nlo;
+			_mm_storeu_si128((__m128i*) out, _mm_cvtepu16_epi32(hi));
+			_mm_storeu_si128((__m128i*) (out + 4), _mm_cvtepu16_epi32(_mm_srli_si128(hi, 8)));
+			out += nhi;
+			s += n;
+			continue;
 		}
+		// 3 and 4 byte sequences, and errors
+		for (const char* stop = s + 16; s < stop;)
+			s = decode_step(s, end, out++);
 	}
-	else
+	return decode_all_scalar(s, end, out) - start;
+}
+#endif
+
+#if defined(UTFZ_AVX2)
+static size_t decode_all_avx2(const char* s, const char* end, char32_t* out)
+{
+	char32_t* start = out;
+	while (end - s >= 32)
 	{
-		int len = seq_len(S[0]);
-		if (len == invalid)
+		__m256i in = _mm256_loadu_si256((const __m256i*) s);
+		if (_mm256_movemask_epi8(in) == 0)
 		{
-			const char* nextS = restart(S);
-			if (nextS == S || nextS[0] == 0)
-				S = End;
-			else
-				S = nextS;
+			__m128i a = _mm256_castsi256_si128(in);
+			__m128i b = _mm256_extracti128_si256(in, 1);
+			_mm256_storeu_si256((__m256i*) out, _mm256_cvtepu8_epi32(a));
+			_mm256_storeu_si256((__m256i*) (out + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(a, 8)));
+			_mm256_storeu_si256((__m256i*) (out + 16), _mm256_cvtepu8_epi32(b));
+			_mm256_storeu_si256((__m256i*) (out + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(b, 8)));
+			s += 32;
+			out += 32;
+			continue;
 		}
-		else
+		__m128i lo, hi;
+		int     nlo, nhi;
+		int     n = decode_2_byte_block(_mm256_castsi256_si128(in), lo, nlo, hi, nhi);
+		if (n != 0)
 		{
-			S += len;
-			if ((len == 2 && (S[-1] == 0)) ||
-			    (len == 3 && (S[-2] == 0 || S[-1] == 0)) ||
-			    (len == 4 && (S[-3] == 0 || S[-2] == 0 || S[-1] == 0)) ||
-			    (S[0] == 0))
-			{
-				S = End;
-			}
+			_mm256_storeu_si256((__m256i*) out, _mm256_cvtepu16_epi32(lo));
+			out += nlo;
+			_mm256_storeu_si256((__m256i*) out, _mm256_cvtepu16_epi32(hi));
+			out += nhi;
+			s += n;
+			continue;
 		}
+		for (const char* stop = s + 16; s < stop;)
+			s = decode_step(s, end, out++);
 	}
+	return decode_all_scalar(s, end, out) - start;
 }
+#endif
 
-int cp::iter::operator*() const
+#if defined(UTFZ_AVX512)
+static size_t decode_all_avx512(const char* s, const char* end, char32_t* out)
 {
-	if (known_end())
-		return decode(S, End);
-	else
-		return decode(S);
-}
-
-bool cp::iter::known_end() const
+	char32_t* start = out;
+	while (end - s >= 64)
+	{
+		__m512i in = _mm512_loadu_si512((const void*) s);
+		if (_mm512_movepi8_mask(in) == 0)
+		{
+			_mm512_storeu_si512((void*) out, _mm512_cvtepu8_epi32(_mm512_castsi512_si128(in)));
+			_mm512_storeu_si512((void*) (out + 16), _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(in, 1)));
+			_mm512_storeu_si512((void*) (out + 32), _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(in, 2)));
+			_mm512_storeu_si512((void*) (out + 48), _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(in, 3)));
+			s += 64;
+			out += 64;
+			continue;
+		}
+		// ASCII and 2 byte sequences, 16 bytes at a time
+		__m128i   in16 = _mm512_castsi512_si128(in);
+		__mmask16 cm   = _mm_cmplt_epi8_mask(in16, _mm_set1_epi8((char) 0xc0));
+		__mmask16 lm   = _mm_cmpgt_epi8_mask(in16, _mm_set1_epi8((char) 0xc1)) & _mm_cmplt_epi8_mask(in16, _mm_set1_epi8((char) 0xe0));
+		__mmask16 high = _mm_movepi8_mask(in16);
+		if ((high & ~(cm | lm)) == 0 && cm == (__mmask16) (lm << 1))
+		{
+			unsigned  last = lm >> 15;
+			__mmask16 keep = ~cm & (0xffff >> last);
+			__m512i   b    = _mm512_cvtepu8_epi32(in16);
+			__m512i   next = _mm512_cvtepu8_epi32(_mm_srli_si128(in16, 1));
+			__m512i   two  = _mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(b, _mm512_set1_epi32(0x1f)), 6), _mm512_and_si512(next, _mm512_set1_epi32(0x3f)));
+			__m512i   cps  = _mm512_mask_blend_epi32(lm, b, two);
+			_mm512_storeu_si512((void*) out, _mm512_maskz_compress_epi32(keep, cps));
+			out += popcount(keep);
+			s += 16 - last;
+			continue;
+		}
+		for (const char* stop = s + 16; s < stop;)
+			s = decode_step(s, end, out++);
+	}
+	return decode_all_scalar(s, end, out) - start;
+}
+#endif
+
+size_t decode_all(const char* s, const char* end, char32_t* out)
+{
+	UTFZ_DISPATCH_TO(decode_all, s, end, out);
+#if defined(UTFZ_AVX512)
+	return decode_all_avx512(s, end, out);
+#elif defined(UTFZ_AVX2)
+	return decode_all_avx2(s, end, out);
+#elif defined(UTFZ_SSE42)
+	return decode_all_sse42(s, end, out);
+#else
+	return decode_all_scalar(s, end, out) - out;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// The number of bytes that encode(char*, int) produces for 'cp'
+static inline int encoded_size(char32_t cp)
+{
+	if (cp <= max1)
+		return 1;
+	if (cp <= max2)
+		return 2;
+	if (cp <= max3)
+		return is_legal_3_byte_code((int) cp) ? 3 : 0;
+	return cp <= max4 ? 4 : 0;
+}
+
+static size_t encoded_length_scalar(const char32_t* cps, size_t n, bool& all_valid)
+{
+	size_t len = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		int size = encoded_size(cps[i]);
+		if (size == 0)
+			all_valid = false;
+		len += size;
+	}
+	return len;
+}
+
+static size_t encode_scalar(char* buf, const char32_t* cps, size_t n)
+{
+	char* out = buf;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (cps[i] <= max1)
+			*out++ = (char) cps[i];
+		else
+			out += encode(out, (int) cps[i]);
+	}
+	return out - buf;
+}
+
+#ifdef UTFZ_SIMD
+// Returns the UTF-8 length of each 32-bit lane in 'v', or 0 for invalid code points, which
+// are also flagged in 'invalid'
+static inline __m128i encoded_size_epi32(__m128i v, __m128i& invalid)
+{
+	// cmpgt is a signed comparison, but anything that is negative is also too large
+	__m128i hi16  = _mm_srli_epi32(v, 16);
+	__m128i size  = _mm_set1_epi32(1);
+	size          = _mm_sub_epi32(size, _mm_cmpgt_epi32(v, _mm_set1_epi32(max1)));
+	size          = _mm_sub_epi32(size, _mm_cmpgt_epi32(v, _mm_set1_epi32(max2)));
+	size          = _mm_sub_epi32(size, _mm_cmpgt_epi32(hi16, _mm_setzero_si128()));
+	__m128i large = _mm_cmpgt_epi32(hi16, _mm_set1_epi32(max4 >> 16));
+	__m128i surr  = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32((int) 0xfffff800)), _mm_set1_epi32(utf16_surrogate_low));
+	__m128i ffff  = _mm_cmpeq_epi32(_mm_or_si128(v, _mm_set1_epi32(1)), _mm_set1_epi32(invalid_ffff));
+	invalid       = _mm_or_si128(large, _mm_or_si128(surr, ffff));
+	return _mm_andnot_si128(invalid, size);
+}
+
+static size_t encoded_length_simd(const char32_t* cps, size_t n, bool& all_valid)
+{
+	size_t  i           = 0;
+	size_t  len         = 0;
+	__m128i invalid_any = _mm_setzero_si128();
+	while (n - i >= 4)
+	{
+		// Flush the per lane sums often enough that they can't overflow
+		size_t  blocks = (n - i) / 4 < (1 << 24) ? (n - i) / 4 : (1 << 24);
+		size_t  stop   = i + blocks * 4;
+		__m128i sum    = _mm_setzero_si128();
+		for (; i < stop; i += 4)
+		{
+			__m128i invalid;
+			sum         = _mm_add_epi32(sum, encoded_size_epi32(_mm_loadu_si128((const __m128i*) (cps + i)), invalid));
+			invalid_any = _mm_or_si128(invalid_any, invalid);
+		}
+		uint32_t lanes[4];
+		_mm_storeu_si128((__m128i*) lanes, sum);
+		len += (size_t) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+	if (!_mm_testz_si128(invalid_any, invalid_any))
+		all_valid = false;
+	return len + encoded_length_scalar(cps + i, n - i, all_valid);
+}
+
+// Writes the first 'k' bytes of 'v' to 'out', where 4 <= k <= 16, without touching anything
+// after out + k. This is two stores that overlap, instead of a store per byte.
+static inline void store_exact(char* out, __m128i v, int k)
+{
+	const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	if (k >= 8)
+	{
+		_mm_storel_epi64((__m128i*) out, v);
+		_mm_storel_epi64((__m128i*) (out + k - 8), _mm_shuffle_epi8(v, _mm_add_epi8(iota, _mm_set1_epi8((char) (k - 8)))));
+	}
+	else
+	{
+		int32_t w = _mm_cvtsi128_si32(v);
+		memcpy(out, &w, 4);
+		w = _mm_cvtsi128_si32(_mm_shuffle_epi8(v, _mm_add_epi8(iota, _mm_set1_epi8((char) (k - 4)))));
+		memcpy(out + k - 4, &w, 4);
+	}
+}
+
+// Writes the bytes of 'v' that are selected by the bits of 'keep' to 'out', without touching
+// anything after them. At least 4 bytes must be selected. Returns the number of bytes written.
+static inline int store_compact(char* out, __m128i v, unsigned keep)
+{
+	const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m128i       zero = _mm_set1_epi8((char) 0x80); // the high 8 bytes of each shuffle must write zero
+	__m128i       lo   = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) &packed_indices[keep & 0xff]), zero);
+	__m128i       hi   = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) &packed_indices[keep >> 8]), zero);
+	lo                 = _mm_shuffle_epi8(v, lo);
+	hi                 = _mm_shuffle_epi8(v, _mm_add_epi8(hi, _mm_set1_epi8(8)));
+	int nlo            = popcount(keep & 0xff);
+	int nhi            = popcount(keep >> 8);
+	// append 'hi' to 'lo'
+	hi = _mm_shuffle_epi8(hi, _mm_sub_epi8(iota, _mm_set1_epi8((char) nlo)));
+	store_exact(out, _mm_or_si128(lo, hi), nlo + nhi);
+	return nlo + nhi;
+}
+
+// Encodes 4 code points that are all valid, and below 0x10000. Each code point is first
+// encoded into its own 32-bit lane, and then the unused bytes are squeezed out.
+// Returns the number of bytes written, or 0 if the code points are anything else.
+static inline int encode_block_4(__m128i v, char* out)
+{
+	__m128i bad = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(0xf800)), _mm_set1_epi32(utf16_surrogate_low));
+	bad         = _mm_or_si128(bad, _mm_cmpeq_epi32(_mm_or_si128(v, _mm_set1_epi32(1)), _mm_set1_epi32(invalid_ffff)));
+	bad         = _mm_or_si128(bad, _mm_and_si128(v, _mm_set1_epi32((int) 0xffff0000)));
+	if (!_mm_testz_si128(bad, bad))
+		return 0;
+	__m128i gt1   = _mm_cmpgt_epi32(v, _mm_set1_epi32(max1));
+	__m128i gt2   = _mm_cmpgt_epi32(v, _mm_set1_epi32(max2));
+	__m128i cont0 = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi32(0x3f)), _mm_set1_epi32(0x80));                    // last continuation byte
+	__m128i cont1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 6), _mm_set1_epi32(0x3f)), _mm_set1_epi32(0x80)); // middle byte of 3
+	__m128i two   = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(v, 6), _mm_set1_epi32(0xc0)), _mm_slli_epi32(cont0, 8));
+	__m128i three = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(v, 12), _mm_set1_epi32(0xe0)), _mm_slli_epi32(cont1, 8));
+	three         = _mm_or_si128(three, _mm_slli_epi32(cont0, 16));
+	__m128i enc   = _mm_blendv_epi8(_mm_blendv_epi8(v, two, gt1), three, gt2);
+
+	// bit i of 'keep' is set if byte i of 'enc' is part of the output
+	__m128i keep = _mm_or_si128(_mm_and_si128(gt1, _mm_set1_epi32(0xff00)), _mm_and_si128(gt2, _mm_set1_epi32(0xff0000)));
+	return store_compact(out, enc, _mm_movemask_epi8(_mm_or_si128(keep, _mm_set1_epi32(0xff))));
+}
+
+// Encodes 'n' code points, 4 at a time, and returns the new end of 'out'
+static inline char* encode_blocks_4(char* out, const char32_t* cps, size_t n)
+{
+	for (size_t i = 0; i + 4 <= n; i += 4)
+	{
+		int len = encode_block_4(_mm_loadu_si128((const __m128i*) (cps + i)), out);
+		if (len == 0)
+			len = (int) encode_scalar(out, cps + i, 4);
+		out += len;
+	}
+	return out;
+}
+
+// Encodes the tail of 'cps', which is too short for the main loop
+static inline size_t encode_tail(char* out, const char32_t* cps, size_t n)
+{
+	char* end = encode_blocks_4(out, cps, n);
+	return (end - out) + encode_scalar(end, cps + (n & ~(size_t) 3), n & 3);
+}
+#endif
+
+#if defined(UTFZ_SSE42)
+static size_t encode_sse42(char* buf, const char32_t* cps, size_t n)
+{
+	char*  out = buf;
+	size_t i   = 0;
+	for (; n - i >= 16; i += 16)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*) (cps + i));
+		__m128i b = _mm_loadu_si128((const __m128i*) (cps + i + 4));
+		__m128i c = _mm_loadu_si128((const __m128i*) (cps + i + 8));
+		__m128i d = _mm_loadu_si128((const __m128i*) (cps + i + 12));
+		if (_mm_testz_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), _mm_set1_epi32(~max1)))
+		{
+			_mm_storeu_si128((__m128i*) out, _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+			out += 16;
+		}
+		else
+		{
+			out = encode_blocks_4(out, cps + i, 16);
+		}
+	}
+	return (out - buf) + encode_tail(out, cps + i, n - i);
+}
+#endif
+
+#if defined(UTFZ_AVX2)
+static size_t encode_avx2(char* buf, const char32_t* cps, size_t n)
+{
+	char*  out = buf;
+	size_t i   = 0;
+	for (; n - i >= 32; i += 32)
+	{
+		__m256i a = _mm256_loadu_si256((const __m256i*) (cps + i));
+		__m256i b = _mm256_loadu_si256((const __m256i*) (cps + i + 8));
+		__m256i c = _mm256_loadu_si256((const __m256i*) (cps + i + 16));
+		__m256i d = _mm256_loadu_si256((const __m256i*) (cps + i + 24));
+		if (_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), _mm256_set1_epi32(~max1)))
+		{
+			// The packs work inside each 128-bit lane, so the 4 byte groups come out of order
+			__m256i bytes = _mm256_packus_epi16(_mm256_packus_epi32(a, b), _mm256_packus_epi32(c, d));
+			bytes         = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+			_mm256_storeu_si256((__m256i*) out, bytes);
+			out += 32;
+		}
+		else
+		{
+			out = encode_blocks_4(out, cps + i, 32);
+		}
+	}
+	return (out - buf) + encode_tail(out, cps + i, n - i);
+}
+#endif
+
+#if defined(UTFZ_AVX512)
+static size_t encode_avx512(char* buf, const char32_t* cps, size_t n)
+{
+	char*  out = buf;
+	size_t i   = 0;
+	for (; n - i >= 16; i += 16)
+	{
+		__m512i v = _mm512_loadu_si512((const void*) (cps + i));
+		if (_mm512_test_epi32_mask(v, _mm512_set1_epi32(~max1)) == 0)
+		{
+			_mm_storeu_si128((__m128i*) out, _mm512_cvtepi32_epi8(v));
+			out += 16;
+		}
+		else
+		{
+			out = encode_blocks_4(out, cps + i, 16);
+		}
+	}
+	return (out - buf) + encode_tail(out, cps + i, n - i);
+}
+#endif
+
+#ifndef UTFZ_NAMESPACE
+size_t encoded_length(const char32_t* cps, size_t n)
+{
+	bool all_valid = true;
+	return encoded_length(cps, n, all_valid);
+}
+#endif
+
+size_t encoded_length(const char32_t* cps, size_t n, bool& all_valid)
+{
+	UTFZ_DISPATCH_TO(encoded_length, cps, n, all_valid);
+#ifdef UTFZ_SIMD
+	return encoded_length_simd(cps, n, all_valid);
+#else
+	return encoded_length_scalar(cps, n, all_valid);
+#endif
+}
+
+size_t encode(char* buf, const char32_t* cps, size_t n)
+{
+	UTFZ_DISPATCH_TO(encode, buf, cps, n);
+#if defined(UTFZ_AVX512)
+	return encode_avx512(buf, cps, n);
+#elif defined(UTFZ_AVX2)
+	return encode_avx2(buf, cps, n);
+#elif defined(UTFZ_SSE42)
+	return encode_sse42(buf, cps, n);
+#else
+	return encode_scalar(buf, cps, n);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+bool encode(std::string& s, const char32_t* cps, size_t n)
+{
+	bool   all_valid = true;
+	size_t len       = encoded_length(cps, n, all_valid);
+	if (len == 0)
+		return all_valid;
+	size_t pos = s.size();
+	s.resize(pos + len);
+	encode(&s[pos], cps, n);
+	return all_valid;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+enum
+{
+	utf16_surrogate_trail = 0xdc00, // first code unit of the second half of a surrogate pair
+	transcode_chunk       = 65536,  // UTF-8 is validated and then transcoded in chunks of this size, which stay in cache
+};
+
+// True if UTF-16 code units in 'order' are byte swapped relative to this machine
+static inline bool must_swap(byte_order order)
+{
+	const uint16_t one = 1;
+	uint8_t        first;
+	memcpy(&first, &one, 1);
+	return (order == little_endian) != (first == 1);
+}
+
+static inline unsigned order_unit(unsigned u, bool swap)
+{
+	return swap ? ((u >> 8) | (u << 8)) & 0xffff : u;
+}
+
+// Writes 'cp' as one code unit, or as a surrogate pair, and returns the new end of 'out'
+static inline char16_t* put_utf16(char16_t* out, int cp, bool swap)
+{
+	if (cp <= max3)
+	{
+		*out = (char16_t) order_unit(cp, swap);
+		return out + 1;
+	}
+	cp -= min_cp_4;
+	out[0] = (char16_t) order_unit(utf16_surrogate_low + (cp >> 10), swap);
+	out[1] = (char16_t) order_unit(utf16_surrogate_trail + (cp & 0x3ff), swap);
+	return out + 2;
+}
+
+// Decodes the code point at the front of the 'n' code units in 's', and returns the number of
+// code units that it uses. Unpaired surrogates, 0xFFFE and 0xFFFF are decoded as 'replace',
+// just like their UTF-8 encodings are, and clear 'valid'.
+static inline int decode_utf16(const char16_t* s, size_t n, bool swap, int& cp, bool& valid)
+{
+	unsigned u = order_unit(s[0], swap);
+	if (u - utf16_surrogate_low > utf16_surrogate_high - utf16_surrogate_low)
+	{
+		cp = (int) u;
+		if (u == invalid_fffe || u == invalid_ffff)
+		{
+			cp    = replace;
+			valid = false;
+		}
+		return 1;
+	}
+	if (u < utf16_surrogate_trail && n >= 2)
+	{
+		unsigned v = order_unit(s[1], swap);
+		if (v - utf16_surrogate_trail <= (unsigned) utf16_surrogate_high - utf16_surrogate_trail)
+		{
+			cp = min_cp_4 + (((u - utf16_surrogate_low) << 10) | (v - utf16_surrogate_trail));
+			return 2;
+		}
+	}
+	cp    = replace;
+	valid = false;
+	return 1;
+}
+
+// Returns the end of the next chunk of [s, end). A chunk never ends inside a valid sequence,
+// so validating a chunk on its own finds the same errors as validating all of [s, end).
+static const char* chunk_end(const char* s, const char* end)
+{
+	if (end - s <= transcode_chunk)
+		return end;
+	// a valid sequence that crosses 'stop' starts in one of the 3 bytes before it
+	const char* stop = s + transcode_chunk;
+	for (const char* p = stop; p != stop - 4; p--)
+	{
+		if (((uint8_t) *p & 0xc0) != 0x80)
+			return p;
+	}
+	return stop;
+}
+
+// True if the error at 'bad' is a byte that can't start a sequence, right after a genuine
+// U+FFFD. next() can't tell a genuine U+FFFD from an error, so it restarts after one, which
+// swallows the continuation bytes and 0xF8 to 0xFF bytes without a replacement of their own.
+static inline bool follows_fffd(const char* begin, const char* bad)
+{
+	return bad - begin >= 3 && memcmp(bad - 3, "\xEF\xBF\xBD", 3) == 0 && seq_len(*bad) == invalid;
+}
+
+// The number of UTF-16 code units in [s, end), which must be valid UTF-8. Every byte that is
+// not a continuation byte starts a code point, and 4 byte sequences become surrogate pairs.
+static size_t utf16_length_valid(const char* s, const char* end)
+{
+	UTFZ_DISPATCH_TO(utf16_length_valid, s, end);
+	size_t len = 0;
+#ifdef UTFZ_SIMD
+	for (; end - s >= 16; s += 16)
+	{
+		__m128i  in   = _mm_loadu_si128((const __m128i*) s);
+		unsigned high = _mm_movemask_epi8(in);
+		unsigned cont = _mm_movemask_epi8(_mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xc0)));
+		unsigned four = _mm_movemask_epi8(_mm_cmpgt_epi8(in, _mm_set1_epi8((char) 0xef))) & high;
+		len += 16 - popcount(cont) + popcount(four);
+	}
+#endif
+	for (; s != end; s++)
+		len += (((uint8_t) *s & 0xc0) != 0x80) + ((uint8_t) *s >= 0xf0);
+	return len;
+}
+
+// Transcodes [s, end), which must be valid UTF-8, and returns the new end of 'out'
+static char16_t* utf8_to_utf16_scalar(const char* s, const char* end, char16_t* out, bool swap)
+{
+	while (s != end)
+	{
+		if ((uint8_t) s[0] <= max1)
+		{
+			*out++ = (char16_t) order_unit((uint8_t) *s++, swap);
+			continue;
+		}
+		int slen;
+		int cp = decode(s, end, slen);
+		s += slen;
+		out = put_utf16(out, cp, swap);
+	}
+	return out;
+}
+
+#ifdef UTFZ_SIMD
+static inline __m128i swap_epi16(__m128i v)
+{
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+// Decodes each of the first 8 bytes of 'in' into a 16-bit lane, as though it were the lead
+// byte of a valid sequence of up to 3 bytes. Lanes of continuation bytes hold garbage.
+static inline __m128i decode_valid_8(__m128i in)
+{
+	__m128i b0    = _mm_cvtepu8_epi16(in);
+	__m128i b1    = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(in, 1)), _mm_set1_epi16(0x3f));
+	__m128i b2    = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(in, 2)), _mm_set1_epi16(0x3f));
+	__m128i two   = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1f)), 6), b1);
+	__m128i three = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(b1, 6)), b2);
+	__m128i cp    = _mm_blendv_epi8(b0, two, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xbf)));
+	return _mm_blendv_epi8(cp, three, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xdf)));
+}
+
+// Decodes 16 bytes of valid UTF-8 that start on a sequence boundary, and hold no 4 byte
+// sequences. The code points are placed like decode_2_byte_block() places them.
+// Returns the number of bytes consumed, which is less than 16 when the last sequence is cut
+// off, or 0 if the block holds a 4 byte sequence.
+static inline int decode_valid_block(__m128i in, __m128i& lo, int& nlo, __m128i& hi, int& nhi)
+{
+	// Signed comparisons: continuation bytes are below C0, and 3 and 4 byte lead bytes are above DF and EF
+	unsigned high  = _mm_movemask_epi8(in);
+	unsigned cont  = _mm_movemask_epi8(_mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xc0)));
+	unsigned lead3 = _mm_movemask_epi8(_mm_cmpgt_epi8(in, _mm_set1_epi8((char) 0xdf))) & high;
+	unsigned lead4 = _mm_movemask_epi8(_mm_cmpgt_epi8(in, _mm_set1_epi8((char) 0xef))) & high;
+	if (lead4 != 0)
+		return 0;
+	int used = 16;
+	if ((high & ~cont) & 0x8000)
+		used = 15;
+	else if (lead3 & 0x4000)
+		used = 14;
+	unsigned keep = ~cont & ((1u << used) - 1);
+
+	lo  = compact_epi16(decode_valid_8(in), keep & 0xff);
+	hi  = compact_epi16(decode_valid_8(_mm_srli_si128(in, 8)), keep >> 8);
+	nlo = popcount(keep & 0xff);
+	nhi = popcount(keep >> 8);
+	return used;
+}
+
+// Transcodes at least 16 bytes from the front of [s, end), which must be valid UTF-8.
+// 'out' must have room for 16 code units.
+static inline void utf8_to_utf16_block(const char*& s, const char* end, char16_t*& out, bool swap)
+{
+	__m128i in = _mm_loadu_si128((const __m128i*) s);
+	if (_mm_movemask_epi8(in) == 0)
+	{
+		__m128i a = _mm_cvtepu8_epi16(in);
+		__m128i b = _mm_cvtepu8_epi16(_mm_srli_si128(in, 8));
+		if (swap)
+		{
+			a = _mm_slli_epi16(a, 8);
+			b = _mm_slli_epi16(b, 8);
+		}
+		_mm_storeu_si128((__m128i*) out, a);
+		_mm_storeu_si128((__m128i*) (out + 8), b);
+		s += 16;
+		out += 16;
+		return;
+	}
+	__m128i lo, hi;
+	int     nlo, nhi;
+	int     n = decode_valid_block(in, lo, nlo, hi, nhi);
+	if (n == 0)
+	{
+		// 4 byte sequences
+		for (const char* stop = s + 16; s < stop;)
+		{
+			int slen;
+			int cp = decode(s, end, slen);
+			s += slen;
+			out = put_utf16(out, cp, swap);
+		}
+		return;
+	}
+	if (swap)
+	{
+		lo = swap_epi16(lo);
+		hi = swap_epi16(hi);
+	}
+	_mm_storeu_si128((__m128i*) out, lo);
+	out += nlo;
+	_mm_storeu_si128((__m128i*) out, hi);
+	out += nhi;
+	s += n;
+}
+
+// Every 3 bytes of valid UTF-8 produce at least one code unit, so while 3 * W bytes remain,
+// a store of W code units can't go past the end of the output.
+static char16_t* utf8_to_utf16_128(const char* s, const char* end, char16_t* out, bool swap)
+{
+	while (end - s >= 48)
+		utf8_to_utf16_block(s, end, out, swap);
+	return utf8_to_utf16_scalar(s, end, out, swap);
+}
+#endif
+
+#if defined(UTFZ_AVX2)
+static char16_t* utf8_to_utf16_avx2(const char* s, const char* end, char16_t* out, bool swap)
+{
+	while (end - s >= 96)
+	{
+		__m256i in = _mm256_loadu_si256((const __m256i*) s);
+		if (_mm256_movemask_epi8(in) != 0)
+		{
+			utf8_to_utf16_block(s, end, out, swap);
+			continue;
+		}
+		__m256i a = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(in));
+		__m256i b = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(in, 1));
+		if (swap)
+		{
+			a = _mm256_slli_epi16(a, 8);
+			b = _mm256_slli_epi16(b, 8);
+		}
+		_mm256_storeu_si256((__m256i*) out, a);
+		_mm256_storeu_si256((__m256i*) (out + 16), b);
+		s += 32;
+		out += 32;
+	}
+	return utf8_to_utf16_128(s, end, out, swap);
+}
+#endif
+
+#if defined(UTFZ_AVX512)
+static char16_t* utf8_to_utf16_avx512(const char* s, const char* end, char16_t* out, bool swap)
+{
+	while (end - s >= 192)
+	{
+		__m512i in = _mm512_loadu_si512((const void*) s);
+		if (_mm512_movepi8_mask(in) != 0)
+		{
+			utf8_to_utf16_block(s, end, out, swap);
+			continue;
+		}
+		__m512i a = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(in));
+		__m512i b = _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(in, 1));
+		if (swap)
+		{
+			a = _mm512_slli_epi16(a, 8);
+			b = _mm512_slli_epi16(b, 8);
+		}
+		_mm512_storeu_si512((void*) out, a);
+		_mm512_storeu_si512((void*) (out + 32), b);
+		s += 64;
+		out += 64;
+	}
+	return utf8_to_utf16_128(s, end, out, swap);
+}
+#endif
+
+static char16_t* utf8_to_utf16_valid(const char* s, const char* end, char16_t* out, bool swap)
+{
+	UTFZ_DISPATCH_TO(utf8_to_utf16_valid, s, end, out, swap);
+#if defined(UTFZ_AVX512)
+	return utf8_to_utf16_avx512(s, end, out, swap);
+#elif defined(UTFZ_AVX2)
+	return utf8_to_utf16_avx2(s, end, out, swap);
+#elif defined(UTFZ_SSE42)
+	return utf8_to_utf16_128(s, end, out, swap);
+#else
+	return utf8_to_utf16_scalar(s, end, out, swap);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+// Transcodes [s, end) one chunk at a time. Each chunk is validated first, so that the
+// transcoding kernels only ever see valid UTF-8. Errors are replaced and then skipped with
+// restart(), exactly like next() does.
+static char16_t* utf8_to_utf16_chunks(const char* s, const char* end, char16_t* out, bool swap, bool& valid)
+{
+	const char* begin = s;
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		out              = utf8_to_utf16_valid(s, bad, out, swap);
+		s                = bad;
+		if (bad != stop)
+		{
+			if (!follows_fffd(begin, bad))
+				*out++ = (char16_t) order_unit(replace, swap);
+			s     = restart(bad, end);
+			valid = false;
+		}
+	}
+	return out;
+}
+
+size_t utf16_length(const char* s, const char* end)
+{
+	const char* begin = s;
+	size_t      len   = 0;
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		len += utf16_length_valid(s, bad);
+		s = bad;
+		if (bad != stop)
+		{
+			if (!follows_fffd(begin, bad))
+				len++;
+			s = restart(bad, end);
+		}
+	}
+	return len;
+}
+
+size_t utf8_to_utf16(const char* s, const char* end, char16_t* out, byte_order order)
+{
+	bool valid = true;
+	return utf8_to_utf16_chunks(s, end, out, must_swap(order), valid) - out;
+}
+
+bool utf8_to_utf16(std::u16string& u, const char* s, const char* end, byte_order order)
+{
+	bool   valid = true;
+	size_t len   = utf16_length(s, end);
+	if (len == 0)
+		return valid;
+	size_t pos = u.size();
+	u.resize(pos + len);
+	utf8_to_utf16_chunks(s, end, &u[pos], must_swap(order), valid);
+	return valid;
+}
+#endif
+
+static size_t utf8_length_scalar(const char16_t* s, size_t n, bool swap)
+{
+	size_t len   = 0;
+	bool   valid = true;
+	for (size_t i = 0; i < n;)
+	{
+		int cp;
+		i += decode_utf16(s + i, n - i, swap, cp, valid);
+		len += encoded_size(cp);
+	}
+	return len;
+}
+
+// Transcodes the 'n' code units in 's', and returns the new end of 'out'
+static char* utf16_to_utf8_scalar(const char16_t* s, size_t n, char* out, bool swap, bool& valid)
+{
+	for (size_t i = 0; i < n;)
+	{
+		int cp;
+		i += decode_utf16(s + i, n - i, swap, cp, valid);
+		out += encode(out, cp);
+	}
+	return out;
+}
+
+#ifdef UTFZ_SIMD
+static size_t utf8_length_simd(const char16_t* s, size_t n, bool swap)
+{
+	size_t len = 0;
+	size_t i   = 0;
+	while (n - i >= 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+		if (swap)
+			v = swap_epi16(v);
+		__m128i surr = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short) 0xf800)), _mm_set1_epi16((short) utf16_surrogate_low));
+		if (_mm_movemask_epi8(surr) != 0)
+		{
+			bool valid;
+			for (size_t stop = i + 8; i < stop;)
+			{
+				int cp;
+				i += decode_utf16(s + i, n - i, swap, cp, valid);
+				len += encoded_size(cp);
+			}
+			continue;
+		}
+		// 3 bytes per code unit, less one for each that fits in 2 bytes, and another for each that fits in 1.
+		// 0xFFFE and 0xFFFF are replaced with U+FFFD, which is also 3 bytes.
+		unsigned fit1 = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short) 0xff80)), _mm_setzero_si128()));
+		unsigned fit2 = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short) 0xf800)), _mm_setzero_si128()));
+		len += 24 - (popcount(fit1) + popcount(fit2)) / 2;
+		i += 8;
+	}
+	return len + utf8_length_scalar(s + i, n - i, swap);
+}
+
+// Encodes 8 code units that are all below 0x800, and returns the number of bytes written
+static inline int encode_2_byte_block_8(__m128i v, char* out)
+{
+	__m128i gt1  = _mm_cmpgt_epi16(v, _mm_set1_epi16(max1));
+	__m128i cont = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80));
+	__m128i two  = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(v, 6), _mm_set1_epi16(0xc0)), _mm_slli_epi16(cont, 8));
+	__m128i enc  = _mm_blendv_epi8(v, two, gt1);
+	return store_compact(out, enc, _mm_movemask_epi8(_mm_or_si128(gt1, _mm_set1_epi16(0xff))));
+}
+
+// Transcodes some of the 'n' code units in 's', where n >= 16, and returns how many it used
+static inline size_t utf16_to_utf8_block(const char16_t* s, size_t n, char*& out, bool swap, bool& valid)
+{
+	__m128i a = _mm_loadu_si128((const __m128i*) s);
+	__m128i b = _mm_loadu_si128((const __m128i*) (s + 8));
+	if (swap)
+	{
+		a = swap_epi16(a);
+		b = swap_epi16(b);
+	}
+	if (_mm_testz_si128(_mm_or_si128(a, b), _mm_set1_epi16((short) 0xff80)))
+	{
+		_mm_storeu_si128((__m128i*) out, _mm_packus_epi16(a, b));
+		out += 16;
+		return 16;
+	}
+	if (_mm_testz_si128(a, _mm_set1_epi16((short) 0xf800)))
+	{
+		out += encode_2_byte_block_8(a, out);
+		return 8;
+	}
+	int len = encode_block_4(_mm_cvtepu16_epi32(a), out);
+	if (len != 0)
+	{
+		out += len;
+		len = encode_block_4(_mm_cvtepu16_epi32(_mm_srli_si128(a, 8)), out);
+		out += len;
+		return len != 0 ? 8 : 4;
+	}
+	// surrogates, 0xFFFE and 0xFFFF
+	size_t i = 0;
+	while (i < 4)
+	{
+		int cp;
+		i += decode_utf16(s + i, n - i, swap, cp, valid);
+		out += encode(out, cp);
+	}
+	return i;
+}
+
+static char* utf16_to_utf8_128(const char16_t* s, size_t n, char* out, bool swap, bool& valid)
+{
+	size_t i = 0;
+	while (n - i >= 16)
+		i += utf16_to_utf8_block(s + i, n - i, out, swap, valid);
+	return utf16_to_utf8_scalar(s + i, n - i, out, swap, valid);
+}
+#endif
+
+#if defined(UTFZ_AVX2)
+static char* utf16_to_utf8_avx2(const char16_t* s, size_t n, char* out, bool swap, bool& valid)
+{
+	size_t i = 0;
+	while (n - i >= 32)
+	{
+		__m256i a = _mm256_loadu_si256((const __m256i*) (s + i));
+		__m256i b = _mm256_loadu_si256((const __m256i*) (s + i + 16));
+		if (swap)
+		{
+			a = _mm256_or_si256(_mm256_slli_epi16(a, 8), _mm256_srli_epi16(a, 8));
+			b = _mm256_or_si256(_mm256_slli_epi16(b, 8), _mm256_srli_epi16(b, 8));
+		}
+		if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi16((short) 0xff80)))
+		{
+			i += utf16_to_utf8_block(s + i, n - i, out, swap, valid);
+			continue;
+		}
+		// The pack works inside each 128-bit lane, so the 8 byte groups come out of order
+		__m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+		_mm256_storeu_si256((__m256i*) out, bytes);
+		out += 32;
+		i += 32;
+	}
+	return utf16_to_utf8_128(s + i, n - i, out, swap, valid);
+}
+#endif
+
+#if defined(UTFZ_AVX512)
+static char* utf16_to_utf8_avx512(const char16_t* s, size_t n, char* out, bool swap, bool& valid)
+{
+	size_t i = 0;
+	while (n - i >= 32)
+	{
+		__m512i v = _mm512_loadu_si512((const void*) (s + i));
+		if (swap)
+			v = _mm512_or_si512(_mm512_slli_epi16(v, 8), _mm512_srli_epi16(v, 8));
+		if (_mm512_test_epi16_mask(v, _mm512_set1_epi16((short) 0xff80)) != 0)
+		{
+			i += utf16_to_utf8_block(s + i, n - i, out, swap, valid);
+			continue;
+		}
+		_mm256_storeu_si256((__m256i*) out, _mm512_cvtepi16_epi8(v));
+		out += 32;
+		i += 32;
+	}
+	return utf16_to_utf8_128(s + i, n - i, out, swap, valid);
+}
+#endif
+
+static char* utf16_to_utf8_any(const char16_t* s, size_t n, char* out, bool swap, bool& valid)
+{
+	UTFZ_DISPATCH_TO(utf16_to_utf8_any, s, n, out, swap, valid);
+#if defined(UTFZ_AVX512)
+	return utf16_to_utf8_avx512(s, n, out, swap, valid);
+#elif defined(UTFZ_AVX2)
+	return utf16_to_utf8_avx2(s, n, out, swap, valid);
+#elif defined(UTFZ_SSE42)
+	return utf16_to_utf8_128(s, n, out, swap, valid);
+#else
+	return utf16_to_utf8_scalar(s, n, out, swap, valid);
+#endif
+}
+
+static size_t utf8_length_of_utf16(const char16_t* s, size_t n, bool swap)
+{
+	UTFZ_DISPATCH_TO(utf8_length_of_utf16, s, n, swap);
+#ifdef UTFZ_SIMD
+	return utf8_length_simd(s, n, swap);
+#else
+	return utf8_length_scalar(s, n, swap);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+size_t utf8_length(const char16_t* s, size_t n, byte_order order)
+{
+	return utf8_length_of_utf16(s, n, must_swap(order));
+}
+
+size_t utf16_to_utf8(const char16_t* s, size_t n, char* out, byte_order order)
+{
+	bool valid = true;
+	return utf16_to_utf8_any(s, n, out, must_swap(order), valid) - out;
+}
+
+bool utf16_to_utf8(std::string& s, const char16_t* u, size_t n, byte_order order)
+{
+	bool   valid = true;
+	size_t len   = utf8_length(u, n, order);
+	if (len == 0)
+		return valid;
+	size_t pos = s.size();
+	s.resize(pos + len);
+	utf16_to_utf8_any(u, n, &s[pos], must_swap(order), valid);
+	return valid;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+// Code points of the bytes 0x80..0xFF in each code page, in the order of enum codepage.
+// Bytes that a code page doesn't define are 'replace'. Generated from the Unicode
+// consortium mapping tables (ISO8859 and VENDORS/MICSFT/WINDOWS/CP1252.TXT).
+static const uint16_t codepage_table[16][128] = {
+    // iso_8859_1
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+        0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+        0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+        0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+        0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+        0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    },
+    // iso_8859_2
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0104, 0x02d8, 0x0141, 0x00a4, 0x013d, 0x015a, 0x00a7,
+        0x00a8, 0x0160, 0x015e, 0x0164, 0x0179, 0x00ad, 0x017d, 0x017b,
+        0x00b0, 0x0105, 0x02db, 0x0142, 0x00b4, 0x013e, 0x015b, 0x02c7,
+        0x00b8, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+        0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+        0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+        0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+        0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+        0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+        0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+        0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+        0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+    },
+    // iso_8859_3
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0126, 0x02d8, 0x00a3, 0x00a4, 0xfffd, 0x0124, 0x00a7,
+        0x00a8, 0x0130, 0x015e, 0x011e, 0x0134, 0x00ad, 0xfffd, 0x017b,
+        0x00b0, 0x0127, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x0125, 0x00b7,
+        0x00b8, 0x0131, 0x015f, 0x011f, 0x0135, 0x00bd, 0xfffd, 0x017c,
+        0x00c0, 0x00c1, 0x00c2, 0xfffd, 0x00c4, 0x010a, 0x0108, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0xfffd, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x0120, 0x00d6, 0x00d7,
+        0x011c, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x016c, 0x015c, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0xfffd, 0x00e4, 0x010b, 0x0109, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0xfffd, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x0121, 0x00f6, 0x00f7,
+        0x011d, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x016d, 0x015d, 0x02d9,
+    },
+    // iso_8859_4
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0104, 0x0138, 0x0156, 0x00a4, 0x0128, 0x013b, 0x00a7,
+        0x00a8, 0x0160, 0x0112, 0x0122, 0x0166, 0x00ad, 0x017d, 0x00af,
+        0x00b0, 0x0105, 0x02db, 0x0157, 0x00b4, 0x0129, 0x013c, 0x02c7,
+        0x00b8, 0x0161, 0x0113, 0x0123, 0x0167, 0x014a, 0x017e, 0x014b,
+        0x0100, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x012e,
+        0x010c, 0x00c9, 0x0118, 0x00cb, 0x0116, 0x00cd, 0x00ce, 0x012a,
+        0x0110, 0x0145, 0x014c, 0x0136, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+        0x00d8, 0x0172, 0x00da, 0x00db, 0x00dc, 0x0168, 0x016a, 0x00df,
+        0x0101, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x012f,
+        0x010d, 0x00e9, 0x0119, 0x00eb, 0x0117, 0x00ed, 0x00ee, 0x012b,
+        0x0111, 0x0146, 0x014d, 0x0137, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+        0x00f8, 0x0173, 0x00fa, 0x00fb, 0x00fc, 0x0169, 0x016b, 0x02d9,
+    },
+    // iso_8859_5
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407,
+        0x0408, 0x0409, 0x040a, 0x040b, 0x040c, 0x00ad, 0x040e, 0x040f,
+        0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+        0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+        0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+        0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+        0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+        0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+        0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+        0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+        0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+        0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x00a7, 0x045e, 0x045f,
+    },
+    // iso_8859_6
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0xfffd, 0xfffd, 0xfffd, 0x00a4, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x060c, 0x00ad, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0x061b, 0xfffd, 0xfffd, 0xfffd, 0x061f,
+        0xfffd, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+        0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d, 0x062e, 0x062f,
+        0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+        0x0638, 0x0639, 0x063a, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+        0x0648, 0x0649, 0x064a, 0x064b, 0x064c, 0x064d, 0x064e, 0x064f,
+        0x0650, 0x0651, 0x0652, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+    },
+    // iso_8859_7
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x2018, 0x2019, 0x00a3, 0x20ac, 0x20af, 0x00a6, 0x00a7,
+        0x00a8, 0x00a9, 0x037a, 0x00ab, 0x00ac, 0x00ad, 0xfffd, 0x2015,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0384, 0x0385, 0x0386, 0x00b7,
+        0x0388, 0x0389, 0x038a, 0x00bb, 0x038c, 0x00bd, 0x038e, 0x038f,
+        0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+        0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+        0x03a0, 0x03a1, 0xfffd, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+        0x03a8, 0x03a9, 0x03aa, 0x03ab, 0x03ac, 0x03ad, 0x03ae, 0x03af,
+        0x03b0, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+        0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+        0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+        0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03cc, 0x03cd, 0x03ce, 0xfffd,
+    },
+    // iso_8859_8
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0xfffd, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+        0x00a8, 0x00a9, 0x00d7, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+        0x00b8, 0x00b9, 0x00f7, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+        0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x2017,
+        0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x05d4, 0x05d5, 0x05d6, 0x05d7,
+        0x05d8, 0x05d9, 0x05da, 0x05db, 0x05dc, 0x05dd, 0x05de, 0x05df,
+        0x05e0, 0x05e1, 0x05e2, 0x05e3, 0x05e4, 0x05e5, 0x05e6, 0x05e7,
+        0x05e8, 0x05e9, 0x05ea, 0xfffd, 0xfffd, 0x200e, 0x200f, 0xfffd,
+    },
+    // iso_8859_9
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+        0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+        0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+        0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x011e, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+        0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x0130, 0x015e, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x011f, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+        0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x0131, 0x015f, 0x00ff,
+    },
+    // iso_8859_10
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0104, 0x0112, 0x0122, 0x012a, 0x0128, 0x0136, 0x00a7,
+        0x013b, 0x0110, 0x0160, 0x0166, 0x017d, 0x00ad, 0x016a, 0x014a,
+        0x00b0, 0x0105, 0x0113, 0x0123, 0x012b, 0x0129, 0x0137, 0x00b7,
+        0x013c, 0x0111, 0x0161, 0x0167, 0x017e, 0x2015, 0x016b, 0x014b,
+        0x0100, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x012e,
+        0x010c, 0x00c9, 0x0118, 0x00cb, 0x0116, 0x00cd, 0x00ce, 0x00cf,
+        0x00d0, 0x0145, 0x014c, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x0168,
+        0x00d8, 0x0172, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+        0x0101, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x012f,
+        0x010d, 0x00e9, 0x0119, 0x00eb, 0x0117, 0x00ed, 0x00ee, 0x00ef,
+        0x00f0, 0x0146, 0x014d, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x0169,
+        0x00f8, 0x0173, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x0138,
+    },
+    // iso_8859_11
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0e01, 0x0e02, 0x0e03, 0x0e04, 0x0e05, 0x0e06, 0x0e07,
+        0x0e08, 0x0e09, 0x0e0a, 0x0e0b, 0x0e0c, 0x0e0d, 0x0e0e, 0x0e0f,
+        0x0e10, 0x0e11, 0x0e12, 0x0e13, 0x0e14, 0x0e15, 0x0e16, 0x0e17,
+        0x0e18, 0x0e19, 0x0e1a, 0x0e1b, 0x0e1c, 0x0e1d, 0x0e1e, 0x0e1f,
+        0x0e20, 0x0e21, 0x0e22, 0x0e23, 0x0e24, 0x0e25, 0x0e26, 0x0e27,
+        0x0e28, 0x0e29, 0x0e2a, 0x0e2b, 0x0e2c, 0x0e2d, 0x0e2e, 0x0e2f,
+        0x0e30, 0x0e31, 0x0e32, 0x0e33, 0x0e34, 0x0e35, 0x0e36, 0x0e37,
+        0x0e38, 0x0e39, 0x0e3a, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x0e3f,
+        0x0e40, 0x0e41, 0x0e42, 0x0e43, 0x0e44, 0x0e45, 0x0e46, 0x0e47,
+        0x0e48, 0x0e49, 0x0e4a, 0x0e4b, 0x0e4c, 0x0e4d, 0x0e4e, 0x0e4f,
+        0x0e50, 0x0e51, 0x0e52, 0x0e53, 0x0e54, 0x0e55, 0x0e56, 0x0e57,
+        0x0e58, 0x0e59, 0x0e5a, 0x0e5b, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+    },
+    // iso_8859_13
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x201d, 0x00a2, 0x00a3, 0x00a4, 0x201e, 0x00a6, 0x00a7,
+        0x00d8, 0x00a9, 0x0156, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00c6,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x201c, 0x00b5, 0x00b6, 0x00b7,
+        0x00f8, 0x00b9, 0x0157, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00e6,
+        0x0104, 0x012e, 0x0100, 0x0106, 0x00c4, 0x00c5, 0x0118, 0x0112,
+        0x010c, 0x00c9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012a, 0x013b,
+        0x0160, 0x0143, 0x0145, 0x00d3, 0x014c, 0x00d5, 0x00d6, 0x00d7,
+        0x0172, 0x0141, 0x015a, 0x016a, 0x00dc, 0x017b, 0x017d, 0x00df,
+        0x0105, 0x012f, 0x0101, 0x0107, 0x00e4, 0x00e5, 0x0119, 0x0113,
+        0x010d, 0x00e9, 0x017a, 0x0117, 0x0123, 0x0137, 0x012b, 0x013c,
+        0x0161, 0x0144, 0x0146, 0x00f3, 0x014d, 0x00f5, 0x00f6, 0x00f7,
+        0x0173, 0x0142, 0x015b, 0x016b, 0x00fc, 0x017c, 0x017e, 0x2019,
+    },
+    // iso_8859_14
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x1e02, 0x1e03, 0x00a3, 0x010a, 0x010b, 0x1e0a, 0x00a7,
+        0x1e80, 0x00a9, 0x1e82, 0x1e0b, 0x1ef2, 0x00ad, 0x00ae, 0x0178,
+        0x1e1e, 0x1e1f, 0x0120, 0x0121, 0x1e40, 0x1e41, 0x00b6, 0x1e56,
+        0x1e81, 0x1e57, 0x1e83, 0x1e60, 0x1ef3, 0x1e84, 0x1e85, 0x1e61,
+        0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x0174, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x1e6a,
+        0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x0176, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x0175, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x1e6b,
+        0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x0177, 0x00ff,
+    },
+    // iso_8859_15
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20ac, 0x00a5, 0x0160, 0x00a7,
+        0x0161, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x017d, 0x00b5, 0x00b6, 0x00b7,
+        0x017e, 0x00b9, 0x00ba, 0x00bb, 0x0152, 0x0153, 0x0178, 0x00bf,
+        0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+        0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+        0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    },
+    // iso_8859_16
+    {
+        0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+        0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+        0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+        0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+        0x00a0, 0x0104, 0x0105, 0x0141, 0x20ac, 0x201e, 0x0160, 0x00a7,
+        0x0161, 0x00a9, 0x0218, 0x00ab, 0x0179, 0x00ad, 0x017a, 0x017b,
+        0x00b0, 0x00b1, 0x010c, 0x0142, 0x017d, 0x201d, 0x00b6, 0x00b7,
+        0x017e, 0x010d, 0x0219, 0x00bb, 0x0152, 0x0153, 0x0178, 0x017c,
+        0x00c0, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0106, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x0110, 0x0143, 0x00d2, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x015a,
+        0x0170, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x0118, 0x021a, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x0107, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x0111, 0x0144, 0x00f2, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x015b,
+        0x0171, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x0119, 0x021b, 0x00ff,
+    },
+    // windows_1252
+    {
+        0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+        0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xfffd, 0x017d, 0xfffd,
+        0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+        0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xfffd, 0x017e, 0x0178,
+        0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+        0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+        0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+        0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+        0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+        0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+        0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+        0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+        0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+        0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+        0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+        0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    },
+};
+
+// The mappings of codepage_table that are not the identity, as (code point << 8) | byte,
+// sorted by code point. The entries of code page p are at [codepage_reverse_start[p],
+// codepage_reverse_start[p + 1]).
+static const uint32_t codepage_reverse[687] = {
+    0x0102c3, 0x0103e3, 0x0104a1, 0x0105b1, 0x0106c6, 0x0107e6, 0x010cc8, 0x010de8,
+    0x010ecf, 0x010fef, 0x0110d0, 0x0111f0, 0x0118ca, 0x0119ea, 0x011acc, 0x011bec,
+    0x0139c5, 0x013ae5, 0x013da5, 0x013eb5, 0x0141a3, 0x0142b3, 0x0143d1, 0x0144f1,
+    0x0147d2, 0x0148f2, 0x0150d5, 0x0151f5, 0x0154c0, 0x0155e0, 0x0158d8, 0x0159f8,
+    0x015aa6, 0x015bb6, 0x015eaa, 0x015fba, 0x0160a9, 0x0161b9, 0x0162de, 0x0163fe,
+    0x0164ab, 0x0165bb, 0x016ed9, 0x016ff9, 0x0170db, 0x0171fb, 0x0179ac, 0x017abc,
+    0x017baf, 0x017cbf, 0x017dae, 0x017ebe, 0x02c7b7, 0x02d8a2, 0x02d9ff, 0x02dbb2,
+    0x02ddbd, 0x0108c6, 0x0109e6, 0x010ac5, 0x010be5, 0x011cd8, 0x011df8, 0x011eab,
+    0x011fbb, 0x0120d5, 0x0121f5, 0x0124a6, 0x0125b6, 0x0126a1, 0x0127b1, 0x0130a9,
+    0x0131b9, 0x0134ac, 0x0135bc, 0x015cde, 0x015dfe, 0x015eaa, 0x015fba, 0x016cdd,
+    0x016dfd, 0x017baf, 0x017cbf, 0x02d8a2, 0x02d9ff, 0x0100c0, 0x0101e0, 0x0104a1,
+    0x0105b1, 0x010cc8, 0x010de8, 0x0110d0, 0x0111f0, 0x0112aa, 0x0113ba, 0x0116cc,
+    0x0117ec, 0x0118ca, 0x0119ea, 0x0122ab, 0x0123bb, 0x0128a5, 0x0129b5, 0x012acf,
+    0x012bef, 0x012ec7, 0x012fe7, 0x0136d3, 0x0137f3, 0x0138a2, 0x013ba6, 0x013cb6,
+    0x0145d1, 0x0146f1, 0x014abd, 0x014bbf, 0x014cd2, 0x014df2, 0x0156a3, 0x0157b3,
+    0x0160a9, 0x0161b9, 0x0166ac, 0x0167bc, 0x0168dd, 0x0169fd, 0x016ade, 0x016bfe,
+    0x0172d9, 0x0173f9, 0x017dae, 0x017ebe, 0x02c7b7, 0x02d9ff, 0x02dbb2, 0x00a7fd,
+    0x0401a1, 0x0402a2, 0x0403a3, 0x0404a4, 0x0405a5, 0x0406a6, 0x0407a7, 0x0408a8,
+    0x0409a9, 0x040aaa, 0x040bab, 0x040cac, 0x040eae, 0x040faf, 0x0410b0, 0x0411b1,
+    0x0412b2, 0x0413b3, 0x0414b4, 0x0415b5, 0x0416b6, 0x0417b7, 0x0418b8, 0x0419b9,
+    0x041aba, 0x041bbb, 0x041cbc, 0x041dbd, 0x041ebe, 0x041fbf, 0x0420c0, 0x0421c1,
+    0x0422c2, 0x0423c3, 0x0424c4, 0x0425c5, 0x0426c6, 0x0427c7, 0x0428c8, 0x0429c9,
+    0x042aca, 0x042bcb, 0x042ccc, 0x042dcd, 0x042ece, 0x042fcf, 0x0430d0, 0x0431d1,
+    0x0432d2, 0x0433d3, 0x0434d4, 0x0435d5, 0x0436d6, 0x0437d7, 0x0438d8, 0x0439d9,
+    0x043ada, 0x043bdb, 0x043cdc, 0x043ddd, 0x043ede, 0x043fdf, 0x0440e0, 0x0441e1,
+    0x0442e2, 0x0443e3, 0x0444e4, 0x0445e5, 0x0446e6, 0x0447e7, 0x0448e8, 0x0449e9,
+    0x044aea, 0x044beb, 0x044cec, 0x044ded, 0x044eee, 0x044fef, 0x0451f1, 0x0452f2,
+    0x0453f3, 0x0454f4, 0x0455f5, 0x0456f6, 0x0457f7, 0x0458f8, 0x0459f9, 0x045afa,
+    0x045bfb, 0x045cfc, 0x045efe, 0x045fff, 0x2116f0, 0x060cac, 0x061bbb, 0x061fbf,
+    0x0621c1, 0x0622c2, 0x0623c3, 0x0624c4, 0x0625c5, 0x0626c6, 0x0627c7, 0x0628c8,
+    0x0629c9, 0x062aca, 0x062bcb, 0x062ccc, 0x062dcd, 0x062ece, 0x062fcf, 0x0630d0,
+    0x0631d1, 0x0632d2, 0x0633d3, 0x0634d4, 0x0635d5, 0x0636d6, 0x0637d7, 0x0638d8,
+    0x0639d9, 0x063ada, 0x0640e0, 0x0641e1, 0x0642e2, 0x0643e3, 0x0644e4, 0x0645e5,
+    0x0646e6, 0x0647e7, 0x0648e8, 0x0649e9, 0x064aea, 0x064beb, 0x064cec, 0x064ded,
+    0x064eee, 0x064fef, 0x0650f0, 0x0651f1, 0x0652f2, 0x037aaa, 0x0384b4, 0x0385b5,
+    0x0386b6, 0x0388b8, 0x0389b9, 0x038aba, 0x038cbc, 0x038ebe, 0x038fbf, 0x0390c0,
+    0x0391c1, 0x0392c2, 0x0393c3, 0x0394c4, 0x0395c5, 0x0396c6, 0x0397c7, 0x0398c8,
+    0x0399c9, 0x039aca, 0x039bcb, 0x039ccc, 0x039dcd, 0x039ece, 0x039fcf, 0x03a0d0,
+    0x03a1d1, 0x03a3d3, 0x03a4d4, 0x03a5d5, 0x03a6d6, 0x03a7d7, 0x03a8d8, 0x03a9d9,
+    0x03aada, 0x03abdb, 0x03acdc, 0x03addd, 0x03aede, 0x03afdf, 0x03b0e0, 0x03b1e1,
+    0x03b2e2, 0x03b3e3, 0x03b4e4, 0x03b5e5, 0x03b6e6, 0x03b7e7, 0x03b8e8, 0x03b9e9,
+    0x03baea, 0x03bbeb, 0x03bcec, 0x03bded, 0x03beee, 0x03bfef, 0x03c0f0, 0x03c1f1,
+    0x03c2f2, 0x03c3f3, 0x03c4f4, 0x03c5f5, 0x03c6f6, 0x03c7f7, 0x03c8f8, 0x03c9f9,
+    0x03cafa, 0x03cbfb, 0x03ccfc, 0x03cdfd, 0x03cefe, 0x2015af, 0x2018a1, 0x2019a2,
+    0x20aca4, 0x20afa5, 0x00d7aa, 0x00f7ba, 0x05d0e0, 0x05d1e1, 0x05d2e2, 0x05d3e3,
+    0x05d4e4, 0x05d5e5, 0x05d6e6, 0x05d7e7, 0x05d8e8, 0x05d9e9, 0x05daea, 0x05dbeb,
+    0x05dcec, 0x05dded, 0x05deee, 0x05dfef, 0x05e0f0, 0x05e1f1, 0x05e2f2, 0x05e3f3,
+    0x05e4f4, 0x05e5f5, 0x05e6f6, 0x05e7f7, 0x05e8f8, 0x05e9f9, 0x05eafa, 0x200efd,
+    0x200ffe, 0x2017df, 0x011ed0, 0x011ff0, 0x0130dd, 0x0131fd, 0x015ede, 0x015ffe,
+    0x0100c0, 0x0101e0, 0x0104a1, 0x0105b1, 0x010cc8, 0x010de8, 0x0110a9, 0x0111b9,
+    0x0112a2, 0x0113b2, 0x0116cc, 0x0117ec, 0x0118ca, 0x0119ea, 0x0122a3, 0x0123b3,
+    0x0128a5, 0x0129b5, 0x012aa4, 0x012bb4, 0x012ec7, 0x012fe7, 0x0136a6, 0x0137b6,
+    0x0138ff, 0x013ba8, 0x013cb8, 0x0145d1, 0x0146f1, 0x014aaf, 0x014bbf, 0x014cd2,
+    0x014df2, 0x0160aa, 0x0161ba, 0x0166ab, 0x0167bb, 0x0168d7, 0x0169f7, 0x016aae,
+    0x016bbe, 0x0172d9, 0x0173f9, 0x017dac, 0x017ebc, 0x2015bd, 0x0e01a1, 0x0e02a2,
+    0x0e03a3, 0x0e04a4, 0x0e05a5, 0x0e06a6, 0x0e07a7, 0x0e08a8, 0x0e09a9, 0x0e0aaa,
+    0x0e0bab, 0x0e0cac, 0x0e0dad, 0x0e0eae, 0x0e0faf, 0x0e10b0, 0x0e11b1, 0x0e12b2,
+    0x0e13b3, 0x0e14b4, 0x0e15b5, 0x0e16b6, 0x0e17b7, 0x0e18b8, 0x0e19b9, 0x0e1aba,
+    0x0e1bbb, 0x0e1cbc, 0x0e1dbd, 0x0e1ebe, 0x0e1fbf, 0x0e20c0, 0x0e21c1, 0x0e22c2,
+    0x0e23c3, 0x0e24c4, 0x0e25c5, 0x0e26c6, 0x0e27c7, 0x0e28c8, 0x0e29c9, 0x0e2aca,
+    0x0e2bcb, 0x0e2ccc, 0x0e2dcd, 0x0e2ece, 0x0e2fcf, 0x0e30d0, 0x0e31d1, 0x0e32d2,
+    0x0e33d3, 0x0e34d4, 0x0e35d5, 0x0e36d6, 0x0e37d7, 0x0e38d8, 0x0e39d9, 0x0e3ada,
+    0x0e3fdf, 0x0e40e0, 0x0e41e1, 0x0e42e2, 0x0e43e3, 0x0e44e4, 0x0e45e5, 0x0e46e6,
+    0x0e47e7, 0x0e48e8, 0x0e49e9, 0x0e4aea, 0x0e4beb, 0x0e4cec, 0x0e4ded, 0x0e4eee,
+    0x0e4fef, 0x0e50f0, 0x0e51f1, 0x0e52f2, 0x0e53f3, 0x0e54f4, 0x0e55f5, 0x0e56f6,
+    0x0e57f7, 0x0e58f8, 0x0e59f9, 0x0e5afa, 0x0e5bfb, 0x00c6af, 0x00d8a8, 0x00e6bf,
+    0x00f8b8, 0x0100c2, 0x0101e2, 0x0104c0, 0x0105e0, 0x0106c3, 0x0107e3, 0x010cc8,
+    0x010de8, 0x0112c7, 0x0113e7, 0x0116cb, 0x0117eb, 0x0118c6, 0x0119e6, 0x0122cc,
+    0x0123ec, 0x012ace, 0x012bee, 0x012ec1, 0x012fe1, 0x0136cd, 0x0137ed, 0x013bcf,
+    0x013cef, 0x0141d9, 0x0142f9, 0x0143d1, 0x0144f1, 0x0145d2, 0x0146f2, 0x014cd4,
+    0x014df4, 0x0156aa, 0x0157ba, 0x015ada, 0x015bfa, 0x0160d0, 0x0161f0, 0x016adb,
+    0x016bfb, 0x0172d8, 0x0173f8, 0x0179ca, 0x017aea, 0x017bdd, 0x017cfd, 0x017dde,
+    0x017efe, 0x2019ff, 0x201cb4, 0x201da1, 0x201ea5, 0x010aa4, 0x010ba5, 0x0120b2,
+    0x0121b3, 0x0174d0, 0x0175f0, 0x0176de, 0x0177fe, 0x0178af, 0x1e02a1, 0x1e03a2,
+    0x1e0aa6, 0x1e0bab, 0x1e1eb0, 0x1e1fb1, 0x1e40b4, 0x1e41b5, 0x1e56b7, 0x1e57b9,
+    0x1e60bb, 0x1e61bf, 0x1e6ad7, 0x1e6bf7, 0x1e80a8, 0x1e81b8, 0x1e82aa, 0x1e83ba,
+    0x1e84bd, 0x1e85be, 0x1ef2ac, 0x1ef3bc, 0x0152bc, 0x0153bd, 0x0160a6, 0x0161a8,
+    0x0178be, 0x017db4, 0x017eb8, 0x20aca4, 0x0102c3, 0x0103e3, 0x0104a1, 0x0105a2,
+    0x0106c5, 0x0107e5, 0x010cb2, 0x010db9, 0x0110d0, 0x0111f0, 0x0118dd, 0x0119fd,
+    0x0141a3, 0x0142b3, 0x0143d1, 0x0144f1, 0x0150d5, 0x0151f5, 0x0152bc, 0x0153bd,
+    0x015ad7, 0x015bf7, 0x0160a6, 0x0161a8, 0x0170d8, 0x0171f8, 0x0178be, 0x0179ac,
+    0x017aae, 0x017baf, 0x017cbf, 0x017db4, 0x017eb8, 0x0218aa, 0x0219ba, 0x021ade,
+    0x021bfe, 0x201db5, 0x201ea5, 0x20aca4, 0x01528c, 0x01539c, 0x01608a, 0x01619a,
+    0x01789f, 0x017d8e, 0x017e9e, 0x019283, 0x02c688, 0x02dc98, 0x201396, 0x201497,
+    0x201891, 0x201992, 0x201a82, 0x201c93, 0x201d94, 0x201e84, 0x202086, 0x202187,
+    0x202295, 0x202685, 0x203089, 0x20398b, 0x203a9b, 0x20ac80, 0x212299,
+};
+
+static const uint16_t codepage_reverse_start[17] = {
+    0, 0, 57, 85, 135, 229, 277, 354, 386, 392, 438, 525, 581, 612, 620, 660, 687,
+};
+
+// Bit (b & 7) of codepage_identity[p][(b - 0x80) >> 3] is set if byte b maps to the code point
+// with the same value in code page p
+static const uint8_t codepage_identity[16][16] = {
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, // iso_8859_1
+    {0xff, 0xff, 0xff, 0xff, 0x91, 0x21, 0x11, 0x01, 0x96, 0x6a, 0xd8, 0xb4, 0x96, 0x6a, 0xd8, 0x34}, // iso_8859_2
+    {0xff, 0xff, 0xff, 0xff, 0x99, 0x21, 0xbd, 0x21, 0x97, 0xff, 0xde, 0x9e, 0x97, 0xff, 0xde, 0x1e}, // iso_8859_3
+    {0xff, 0xff, 0xff, 0xff, 0x91, 0xa1, 0x11, 0x01, 0x7e, 0x6a, 0xf0, 0x9d, 0x7e, 0x6a, 0xf0, 0x1d}, // iso_8859_4
+    {0xff, 0xff, 0xff, 0xff, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // iso_8859_5
+    {0xff, 0xff, 0xff, 0xff, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // iso_8859_6
+    {0xff, 0xff, 0xff, 0xff, 0xc9, 0x3b, 0x8f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // iso_8859_7
+    {0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // iso_8859_8
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xfe, 0x9f}, // iso_8859_9
+    {0xff, 0xff, 0xff, 0xff, 0x81, 0x20, 0x81, 0x00, 0x7e, 0xea, 0x79, 0xfd, 0x7e, 0xea, 0x79, 0x7d}, // iso_8859_10
+    {0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // iso_8859_11
+    {0xff, 0xff, 0xff, 0xff, 0xdd, 0x7a, 0xef, 0x7a, 0x30, 0x02, 0xe8, 0x90, 0x30, 0x02, 0xe8, 0x10}, // iso_8859_13
+    {0xff, 0xff, 0xff, 0xff, 0x89, 0x62, 0x40, 0x00, 0xff, 0xff, 0x7e, 0xbf, 0xff, 0xff, 0x7e, 0xbf}, // iso_8859_14
+    {0xff, 0xff, 0xff, 0xff, 0xaf, 0xfe, 0xef, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, // iso_8859_15
+    {0xff, 0xff, 0xff, 0xff, 0x81, 0x2a, 0xc3, 0x08, 0xd7, 0xff, 0x5c, 0x9e, 0xd7, 0xff, 0x5c, 0x9e}, // iso_8859_16
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, // windows_1252
+};
+
+int decode(char c, codepage page)
+{
+	uint8_t b = (uint8_t) c;
+	if (b <= max1)
+		return b;
+	return codepage_table[page][b - 0x80];
+}
+
+int encode(int cp, codepage page)
+{
+	if (cp < 0 || cp > max3)
+		return invalid;
+	if (cp <= max1)
+		return cp;
+	if (cp <= 0xff && codepage_table[page][cp - 0x80] == cp)
+		return cp;
+
+	// binary search through the rest of the code page
+	uint32_t key = (uint32_t) cp << 8;
+	unsigned lo  = codepage_reverse_start[page];
+	unsigned hi  = codepage_reverse_start[page + 1];
+	while (lo < hi)
+	{
+		unsigned mid = (lo + hi) / 2;
+		if (codepage_reverse[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < codepage_reverse_start[page + 1] && (codepage_reverse[lo] >> 8) == (uint32_t) cp)
+		return codepage_reverse[lo] & 0xff;
+	return invalid;
+}
+#endif
+
+// Returns true if the 8 bytes at 's' are all ASCII
+static inline bool is_ascii_8(const char* s)
+{
+	uint64_t w;
+	memcpy(&w, s, 8);
+	return (w & 0x8080808080808080ull) == 0;
+}
+
+static char* codepage_to_utf8_scalar(const char* s, const char* end, char* out, const uint16_t* table)
+{
+	while (s != end)
+	{
+		if (end - s >= 8 && is_ascii_8(s))
+		{
+			memcpy(out, s, 8);
+			s += 8;
+			out += 8;
+			continue;
+		}
+		uint8_t b = (uint8_t) *s++;
+		if (b <= max1)
+			*out++ = (char) b;
+		else
+			out += encode(out, table[b - 0x80]);
+	}
+	return out;
+}
+
+#ifdef UTFZ_SIMD
+// True if every byte of 'v' that is above max1 maps to the code point with the same value,
+// according to 'identity', which is a row of codepage_identity
+static inline bool all_identity(__m128i v, __m128i identity)
+{
+	const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	__m128i       idx  = _mm_and_si128(_mm_srli_epi16(v, 3), _mm_set1_epi8(0x0f));
+	__m128i       bit  = _mm_shuffle_epi8(bits, _mm_and_si128(v, _mm_set1_epi8(7)));
+	__m128i       miss = _mm_cmpeq_epi8(_mm_and_si128(_mm_shuffle_epi8(identity, idx), bit), _mm_setzero_si128());
+	return (_mm_movemask_epi8(miss) & _mm_movemask_epi8(v)) == 0;
+}
+
+static char* codepage_to_utf8_simd(const char* s, const char* end, char* out, const uint16_t* table, const uint8_t* identity_row)
+{
+	__m128i identity = _mm_loadu_si128((const __m128i*) identity_row);
+	while (end - s >= 16)
+	{
+		__m128i in = _mm_loadu_si128((const __m128i*) s);
+		if (_mm_movemask_epi8(in) == 0)
+		{
+			_mm_storeu_si128((__m128i*) out, in);
+		}
+		else if (all_identity(in, identity))
+		{
+			out += encode_2_byte_block_8(_mm_cvtepu8_epi16(in), out);
+			out += encode_2_byte_block_8(_mm_cvtepu8_epi16(_mm_srli_si128(in, 8)), out);
+			s += 16;
+			continue;
+		}
+		else
+		{
+			for (const char* stop = s + 16; s != stop; s++)
+			{
+				uint8_t b = (uint8_t) *s;
+				if (b <= max1)
+					*out++ = (char) b;
+				else
+					out += encode(out, table[b - 0x80]);
+			}
+			continue;
+		}
+		s += 16;
+		out += 16;
+	}
+	return codepage_to_utf8_scalar(s, end, out, table);
+}
+#endif
+
+// Transcodes [s, end) with a row of codepage_table, and the same row of codepage_identity, and
+// returns the new end of 'out'
+static char* codepage_to_utf8_any(const char* s, const char* end, char* out, const uint16_t* table, const uint8_t* identity)
+{
+	UTFZ_DISPATCH_TO(codepage_to_utf8_any, s, end, out, table, identity);
+#ifdef UTFZ_SIMD
+	return codepage_to_utf8_simd(s, end, out, table, identity);
+#else
+	(void) identity;
+	return codepage_to_utf8_scalar(s, end, out, table);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+// Returns the UTF-8 length of [s, end), and clears 'defined' if the code page doesn't define all of it
+static size_t codepage_utf8_length(const char* s, const char* end, const uint16_t* table, bool& defined)
+{
+	size_t len = end - s;
+	while (s != end)
+	{
+		if (end - s >= 8 && is_ascii_8(s))
+		{
+			s += 8;
+			continue;
+		}
+		uint8_t b = (uint8_t) *s++;
+		if (b > max1)
+		{
+			int cp = table[b - 0x80];
+			len += cp <= max2 ? 1 : 2;
+			if (cp == replace)
+				defined = false;
+		}
+	}
+	return len;
+}
+
+size_t utf8_length(const char* s, const char* end, codepage page)
+{
+	bool defined = true;
+	return codepage_utf8_length(s, end, codepage_table[page], defined);
+}
+
+size_t codepage_to_utf8(const char* s, const char* end, char* out, codepage page)
+{
+	return codepage_to_utf8_any(s, end, out, codepage_table[page], codepage_identity[page]) - out;
+}
+
+bool codepage_to_utf8(std::string& out, const char* s, const char* end, codepage page)
+{
+	bool   defined = true;
+	size_t len     = codepage_utf8_length(s, end, codepage_table[page], defined);
+	if (len == 0)
+		return defined;
+	size_t pos = out.size();
+	out.resize(pos + len);
+	codepage_to_utf8(s, end, &out[pos], page);
+	return defined;
+}
+
+// Transcodes the code point at the front of [s, end), with the same rules as next(), and
+// returns the start of the next one
+static const char* utf8_to_codepage_step(const char* s, const char* end, char*& out, codepage page, unmappable policy, char fallback, bool& mapped)
+{
+	char32_t cp;
+	s     = decode_step(s, end, &cp);
+	int b = encode((int) cp, page);
+	if (b != invalid)
+	{
+		*out++ = (char) b;
+	}
+	else
+	{
+		mapped = false;
+		if (policy == unmappable_replace)
+			*out++ = fallback;
+	}
+	return s;
+}
+#endif
+
+// Copies the blocks at the front of [s, end) that hold nothing but ASCII, and 2 byte sequences
+// of code points below 0x100 that map onto the same byte according to 'identity', which is a
+// row of codepage_identity. Moves 's' and 'out' to the first block that holds anything else.
+static void utf8_to_codepage_same(const char*& s, const char* end, char*& out, const uint8_t* identity)
+{
+	UTFZ_DISPATCH_TO(utf8_to_codepage_same, s, end, out, identity);
+#ifdef UTFZ_SIMD
+	__m128i same = _mm_loadu_si128((const __m128i*) identity);
+	while (end - s >= 16)
+	{
+		__m128i in = _mm_loadu_si128((const __m128i*) s);
+		if (_mm_movemask_epi8(in) == 0)
+		{
+			_mm_storeu_si128((__m128i*) out, in);
+			s += 16;
+			out += 16;
+			continue;
+		}
+		// The stores can write past the output, but not past the space that [s, end) needs
+		__m128i lo, hi;
+		int     nlo, nhi;
+		int     n = decode_2_byte_block(in, lo, nlo, hi, nhi);
+		if (n == 0 || !_mm_testz_si128(_mm_or_si128(lo, hi), _mm_set1_epi16((short) 0xff00)))
+			return;
+		__m128i bytes = _mm_packus_epi16(lo, hi);
+		if (!all_identity(bytes, same))
+			return;
+		_mm_storel_epi64((__m128i*) out, bytes);
+		_mm_storel_epi64((__m128i*) (out + nlo), _mm_srli_si128(bytes, 8));
+		out += nlo + nhi;
+		s += n;
+	}
+#else
+	(void) identity;
+	for (; end - s >= 8 && is_ascii_8(s); s += 8, out += 8)
+		memcpy(out, s, 8);
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+static char* utf8_to_codepage_any(const char* s, const char* end, char* out, codepage page, unmappable policy, char fallback, bool& mapped)
+{
+	while (s != end)
+	{
+		utf8_to_codepage_same(s, end, out, codepage_identity[page]);
+		// the block that stopped it, one code point at a time
+		for (const char* stop = end - s >= 16 ? s + 16 : end; s < stop;)
+		{
+			if ((uint8_t) *s <= max1)
+				*out++ = *s++;
+			else
+				s = utf8_to_codepage_step(s, end, out, page, policy, fallback, mapped);
+		}
+	}
+	return out;
+}
+
+size_t utf8_to_codepage(const char* s, const char* end, char* out, codepage page, unmappable policy, char fallback)
+{
+	bool mapped = true;
+	return utf8_to_codepage_any(s, end, out, page, policy, fallback, mapped) - out;
+}
+
+bool utf8_to_codepage(std::string& out, const char* s, const char* end, codepage page, unmappable policy, char fallback)
+{
+	bool mapped = true;
+	if (s == end)
+		return mapped;
+	size_t pos = out.size();
+	out.resize(pos + (end - s));
+	char* last = utf8_to_codepage_any(s, end, &out[pos], page, policy, fallback, mapped);
+	out.resize(last - &out[0]);
+	return mapped;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+bool sanitize(const char* s, const char* end, std::string& out)
+{
+	const char* bad = first_invalid(s, end);
+	if (bad == end)
+		return true;
+	const char* begin = s;
+	out.reserve(out.size() + (end - s) + 3);
+	while (true)
+	{
+		out.append(s, bad - s);
+		if (bad == end)
+			break;
+		// next() restarts after a genuine U+FFFD, which swallows the continuation bytes after it
+		if (!follows_fffd(begin, bad))
+			out.append("\xEF\xBF\xBD", 3);
+		s   = restart(bad, end);
+		bad = first_invalid(s, end);
+	}
+	return false;
+}
+
+bool sanitize(std::string& s)
+{
+	const char* begin = s.data();
+	const char* end   = begin + s.size();
+	const char* bad   = first_invalid(begin, end);
+	if (bad == end)
+		return true;
+
+	// The string is repaired from front to back. A replacement can be longer than the bytes that
+	// it replaces, so the rest of the string is first moved up by the most that any part of it
+	// grows, and then the repaired text never overtakes the text that is still to be read.
+	bool      fffd  = follows_fffd(begin, bad);
+	ptrdiff_t grow  = 0;
+	ptrdiff_t shift = 0;
+	for (const char* p = bad; p != end;)
+	{
+		const char* next = restart(p, end);
+		grow += (follows_fffd(begin, p) ? 0 : 3) - (next - p);
+		shift = grow > shift ? grow : shift;
+		p     = first_invalid(next, end);
+	}
+	size_t first = bad - begin;
+	size_t size  = s.size();
+	s.resize(size + shift);
+	char*       out  = &s[first];
+	const char* stop = &s[0] + size + shift;
+	bad              = out + shift;
+	memmove((char*) bad, out, size - first);
+	while (true)
+	{
+		const char* next = restart(bad, stop);
+		if (!fffd)
+		{
+			memcpy(out, "\xEF\xBF\xBD", 3);
+			out += 3;
+		}
+		bad  = first_invalid(next, stop);
+		fffd = bad != stop && follows_fffd(next, bad);
+		memmove(out, next, bad - next);
+		out += bad - next;
+		if (bad == stop)
+			break;
+	}
+	s.resize(out - &s[0]);
+	return false;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// Returns the position that cp::iter moves to from 's', over a string of known length
+static const char* iter_next(const char* s, const char* end)
+{
+	int len = seq_len(s[0]);
+	if (len == invalid)
+		return restart(s, end);
+	return end - s < len ? end : s + len;
+}
+
+#ifndef UTFZ_NAMESPACE
+// Returns the last position in [begin, s] that cp::iter, stepping from 'begin', can't step over,
+// whatever came before it: 'begin', or a plausible start byte that no lead byte in the 3 bytes
+// before it reaches past. The stops of cp::iter after an invalid lead byte depend on everything
+// before them, so this is where to step forward from, to find out whether it stops somewhere.
+static const char* iter_sync(const char* begin, const char* s)
+{
+	for (; s != begin; s--)
+	{
+		if (seq_len(s[0]) == invalid)
+			continue;
+		if (seq_len(s[-1]) > 1 || (s - begin >= 2 && seq_len(s[-2]) > 2) || (s - begin >= 3 && seq_len(s[-3]) > 3))
+			continue;
+		break;
+	}
+	return s;
+}
+
+// Returns the position of the code point before 's', where cp::iter steps from 'begin'. 's' must
+// be a position that cp::iter steps to.
+static const char* iter_prev(const char* begin, const char* s)
+{
+	const char* p    = iter_sync(begin, s - 1);
+	const char* prev = p;
+	while (p != s)
+	{
+		prev = p;
+		p    = iter_next(p, s);
+	}
+	return prev;
+}
+#endif
+
+// A variant of iter_next that also reports how many bytes a sequence that is cut off by 'end'
+// reaches past it
+static const char* iter_next(const char* s, const char* end, size_t& overshoot)
+{
+	int len = seq_len(s[0]);
+	if (len != invalid && end - s < len)
+		overshoot = len - (end - s);
+	return iter_next(s, end);
+}
+
+// One step of cp::iter, over a string of known length. Writes the code point at 's' to 'out',
+// and returns the position that cp::iter moves to.
+static const char* iter_step(const char* s, const char* end, char32_t* out)
+{
+	*out = (char32_t) decode(s, end);
+	return iter_next(s, end);
+}
+
+// Returns the number of bytes in [s, end) that are not continuation bytes, which is the
+// number of code points when [s, end) is valid.
+static size_t count_valid(const char* s, const char* end)
+{
+	UTFZ_DISPATCH_TO(count_valid, s, end);
+	size_t n = 0;
+#if defined(UTFZ_AVX512)
+	for (; end - s >= 64; s += 64)
+	{
+		__mmask64 cont = _mm512_cmplt_epi8_mask(_mm512_loadu_si512((const void*) s), _mm512_set1_epi8((char) 0xc0));
+		n += 64 - popcount((uint32_t) cont) - popcount((uint32_t) (cont >> 32));
+	}
+#elif defined(UTFZ_AVX2)
+	for (; end - s >= 32; s += 32)
+		n += 32 - popcount(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8((char) 0xc0), _mm256_loadu_si256((const __m256i*) s))));
+#endif
+#ifdef UTFZ_SIMD
+	for (; end - s >= 16; s += 16)
+		n += 16 - popcount(_mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*) s), _mm_set1_epi8((char) 0xc0))));
+#endif
+	for (; s != end; s++)
+		n += ((uint8_t) *s & 0xc0) != 0x80;
+	return n;
+}
+
+// Counts the cp::iter steps over [s, end). If the last step is cut short by 'end', then
+// 'overshoot' is set to the number of bytes that it would have gone past 'end'.
+static size_t count_steps(const char* s, const char* end, size_t& overshoot)
+{
+	UTFZ_DISPATCH_TO(count_steps, s, end, overshoot);
+	size_t n  = 0;
+	overshoot = 0;
+#ifndef UTFZ_SIMD
+	// Without vectors, validating first costs more than simply taking the steps
+	while (s != end)
+	{
+		if (end - s >= 8)
+		{
+			uint64_t w;
+			memcpy(&w, s, 8);
+			if ((w & 0x8080808080808080ull) == 0)
+			{
+				s += 8;
+				n += 8;
+				continue;
+			}
+		}
+		s = iter_next(s, end, overshoot);
+		n++;
+	}
+#else
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		n += count_valid(s, bad);
+		s = bad;
+		if (bad != stop)
+		{
+			n++;
+			s = iter_next(bad, end, overshoot);
+		}
+	}
+#endif
+	return n;
+}
+
+#ifndef UTFZ_NAMESPACE
+size_t count(const char* s, const char* end)
+{
+	size_t overshoot;
+	return count_steps(s, end, overshoot);
+}
+
+size_t count(const char* s)
+{
+	return count(s, s + strlen(s));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+// Returns the reason that decode() rejects the sequence at 's', which must be invalid
+static error_kind classify_error(const char* s, const char* end)
+{
+	int slen = seq_len(s[0]);
+	if (slen == invalid)
+		return error_bad_lead;
+	if ((intptr_t) (end - s) < (intptr_t) slen)
+		return error_truncated;
+	for (int i = 1; i < slen; i++)
+	{
+		if ((s[i] & 0xc0) != 0x80)
+			return error_truncated;
+	}
+	int cp;
+	switch (slen)
+	{
+	case 2:
+		return error_overlong;
+	case 3:
+		cp = ((s[0] & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+		if (cp < min_cp_3)
+			return error_overlong;
+		if (cp >= utf16_surrogate_low && cp <= utf16_surrogate_high)
+			return error_surrogate;
+		return error_noncharacter;
+	default:
+		cp = ((s[0] & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+		return cp < min_cp_4 ? error_overlong : error_too_large;
+	}
+}
+#endif
+
+#ifndef UTFZ_SIMD
+// Returns the sum of the bytes in 'x'
+static inline uint64_t sum_bytes(uint64_t x)
+{
+	x = (x & 0x00ff00ff00ff00ffull) + ((x >> 8) & 0x00ff00ff00ff00ffull);
+	return (x * 0x0001000100010001ull) >> 48;
+}
+#endif
+
+// Adds the number of sequences in [s, end), which must be valid, to lengths[1..4], by the
+// length that their lead bytes give
+static void count_lengths(const char* s, const char* end, size_t lengths[5])
+{
+	UTFZ_DISPATCH_TO(count_lengths, s, end, lengths);
+	// below[i] counts the bytes from 0x80 up to 0xC0, 0xE0, 0xF0 and 0x100, so the difference
+	// between two neighbours is the number of lead bytes of one length. Valid text has no 11111xxx.
+	size_t len      = end - s;
+	size_t below[4] = {0, 0, 0, 0};
+#if defined(UTFZ_AVX512)
+	const __m512i c0 = _mm512_set1_epi8((char) 0xc0);
+	const __m512i e0 = _mm512_set1_epi8((char) 0xe0);
+	const __m512i f0 = _mm512_set1_epi8((char) 0xf0);
+	for (; end - s >= 64; s += 64)
+	{
+		__m512i v = _mm512_loadu_si512((const void*) s);
+		below[0] += popcount_64(_mm512_cmplt_epi8_mask(v, c0));
+		below[1] += popcount_64(_mm512_cmplt_epi8_mask(v, e0));
+		below[2] += popcount_64(_mm512_cmplt_epi8_mask(v, f0));
+		below[3] += popcount_64(_mm512_movepi8_mask(v));
+	}
+#elif defined(UTFZ_AVX2)
+	// One counter in each byte, added up with sad before they reach 256
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i c0   = _mm256_set1_epi8((char) 0xc0);
+	const __m256i e0   = _mm256_set1_epi8((char) 0xe0);
+	const __m256i f0   = _mm256_set1_epi8((char) 0xf0);
+	while (end - s >= 32)
+	{
+		__m256i a0 = zero, a1 = zero, a2 = zero, a3 = zero;
+		for (int n = 0; n < 255 && end - s >= 32; n++, s += 32)
+		{
+			__m256i v = _mm256_loadu_si256((const __m256i*) s);
+			a0        = _mm256_sub_epi8(a0, _mm256_cmpgt_epi8(c0, v));
+			a1        = _mm256_sub_epi8(a1, _mm256_cmpgt_epi8(e0, v));
+			a2        = _mm256_sub_epi8(a2, _mm256_cmpgt_epi8(f0, v));
+			a3        = _mm256_sub_epi8(a3, _mm256_cmpgt_epi8(zero, v));
+		}
+		__m256i  acc[4] = {a0, a1, a2, a3};
+		uint64_t sums[4];
+		for (int i = 0; i < 4; i++)
+		{
+			_mm256_storeu_si256((__m256i*) sums, _mm256_sad_epu8(acc[i], zero));
+			below[i] += (size_t) (sums[0] + sums[1] + sums[2] + sums[3]);
+		}
+	}
+#elif defined(UTFZ_SIMD)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i c0   = _mm_set1_epi8((char) 0xc0);
+	const __m128i e0   = _mm_set1_epi8((char) 0xe0);
+	const __m128i f0   = _mm_set1_epi8((char) 0xf0);
+	while (end - s >= 16)
+	{
+		__m128i a0 = zero, a1 = zero, a2 = zero, a3 = zero;
+		for (int n = 0; n < 255 && end - s >= 16; n++, s += 16)
+		{
+			__m128i v = _mm_loadu_si128((const __m128i*) s);
+			a0        = _mm_sub_epi8(a0, _mm_cmpgt_epi8(c0, v));
+			a1        = _mm_sub_epi8(a1, _mm_cmpgt_epi8(e0, v));
+			a2        = _mm_sub_epi8(a2, _mm_cmpgt_epi8(f0, v));
+			a3        = _mm_sub_epi8(a3, _mm_cmpgt_epi8(zero, v));
+		}
+		__m128i  acc[4] = {a0, a1, a2, a3};
+		uint64_t sums[2];
+		for (int i = 0; i < 4; i++)
+		{
+			_mm_storeu_si128((__m128i*) sums, _mm_sad_epu8(acc[i], zero));
+			below[i] += (size_t) (sums[0] + sums[1]);
+		}
+	}
+#else
+	// The same, 8 bytes at a time, with at_least[i] counting the bytes whose top i bits are set
+	const uint64_t high = 0x8080808080808080ull;
+	while (end - s >= 8)
+	{
+		uint64_t a1 = 0, a2 = 0, a3 = 0, a4 = 0;
+		for (int n = 0; n < 255 && end - s >= 8; n++, s += 8)
+		{
+			uint64_t w;
+			memcpy(&w, s, 8);
+			uint64_t t1 = w & high;
+			uint64_t t2 = t1 & (w << 1);
+			uint64_t t3 = t2 & (w << 2);
+			uint64_t t4 = t3 & (w << 3);
+			a1 += t1 >> 7;
+			a2 += t2 >> 7;
+			a3 += t3 >> 7;
+			a4 += t4 >> 7;
+		}
+		below[0] += sum_bytes(a1) - sum_bytes(a2);
+		below[1] += sum_bytes(a1) - sum_bytes(a3);
+		below[2] += sum_bytes(a1) - sum_bytes(a4);
+		below[3] += sum_bytes(a1);
+	}
+#endif
+	for (; s != end; s++)
+	{
+		uint8_t c = (uint8_t) *s;
+		below[0] += c >= 0x80 && c < 0xc0;
+		below[1] += c >= 0x80 && c < 0xe0;
+		below[2] += c >= 0x80 && c < 0xf0;
+		below[3] += c >= 0x80;
+	}
+	lengths[1] += len - below[3];
+	lengths[2] += below[1] - below[0];
+	lengths[3] += below[2] - below[1];
+	lengths[4] += below[3] - below[2];
+}
+
+#ifndef UTFZ_NAMESPACE
+stats::stats(const char* s, const char* end)
+{
+	scan(s, end);
+}
+
+stats::stats(const std::string& s)
+{
+	scan(s.data(), s.data() + s.size());
+}
+
+void stats::scan(const char* s, const char* end)
+{
+	const char* begin = s;
+	const char* it    = s; // where cp::iter is, which steps over errors differently from next()
+	memset(Sequences, 0, sizeof(Sequences));
+	memset(Errors, 0, sizeof(Errors));
+	FirstError     = -1;
+	FirstErrorKind = error_bad_lead;
+	CodePoints     = 0;
+	while (s != end)
+	{
+		// The lengths of a valid stretch are counted while it is still in cache from validating it
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		// After an error, cp::iter can be behind 's', on the invalid bytes that restart() skips,
+		// or ahead of it, in the middle of this stretch, where it restarts at the next lead byte
+		for (; it < bad && (it < s || ((uint8_t) *it & 0xc0) == 0x80); CodePoints++)
+			it = iter_next(it, end);
+		const char* steps = it < bad ? it : bad;
+		count_lengths(s, steps, Sequences);
+		size_t before = Sequences[1] + Sequences[2] + Sequences[3] + Sequences[4];
+		count_lengths(steps, bad, Sequences);
+		CodePoints += Sequences[1] + Sequences[2] + Sequences[3] + Sequences[4] - before;
+		if (it < bad)
+			it = bad;
+		s = bad;
+		if (bad == stop)
+			continue;
+		error_kind kind = classify_error(bad, end);
+		if (valid())
+		{
+			FirstError     = bad - begin;
+			FirstErrorKind = kind;
+		}
+		Errors[kind]++;
+		if (it == bad)
+		{
+			it = iter_next(bad, end);
+			CodePoints++;
+		}
+		s = restart(bad, end);
+	}
+	for (; it < end; CodePoints++)
+		it = iter_next(it, end);
+}
+
+size_t stats::errors() const
+{
+	size_t n = 0;
+	for (size_t e : Errors)
+		n += e;
+	return n;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef UTFZ_SIMD
+static inline int ctz64(uint64_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long i;
+	_BitScanForward64(&i, x);
+	return (int) i;
+#else
+	return __builtin_ctzll(x);
+#endif
+}
+
+// Returns the position of set bit number 'j' (counting from 0) in 'x'
+static inline int nth_bit(uint64_t x, size_t j)
+{
+	uint64_t run = x >> ctz64(x);
+	if ((run & (run + 1)) == 0)
+		return ctz64(x) + (int) j; // the set bits are consecutive, as they are in ASCII text
+	for (; j != 0; j--)
+		x &= x - 1;
+	return ctz64(x);
+}
+
+// Returns a mask of the bytes in [s, s + 64) that are not continuation bytes
+static inline uint64_t lead_mask_64(const char* s)
+{
+#if defined(UTFZ_AVX512)
+	return ~(uint64_t) _mm512_cmplt_epi8_mask(_mm512_loadu_si512((const void*) s), _mm512_set1_epi8((char) 0xc0));
+#elif defined(UTFZ_AVX2)
+	__m256i  c80 = _mm256_set1_epi8((char) 0xc0);
+	uint64_t lo  = (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(c80, _mm256_loadu_si256((const __m256i*) s)));
+	uint64_t hi  = (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(c80, _mm256_loadu_si256((const __m256i*) (s + 32))));
+	return ~(lo | (hi << 32));
+#else
+	uint64_t cont = 0;
+	for (int i = 0; i < 64; i += 16)
+		cont |= (uint64_t) _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*) (s + i)), _mm_set1_epi8((char) 0xc0))) << i;
+	return ~cont;
+#endif
+}
+#endif
+
+#ifndef UTFZ_NAMESPACE
+index::index(const char* str, const char* end, size_t k)
+    : Str(str), End(end), K(k == 0 ? 1 : k)
+{
+	build();
+}
+
+index::index(const std::string& s, size_t k)
+    : Str(s.c_str()), End(s.c_str() + s.length()), K(k == 0 ? 1 : k)
+{
+	build();
+}
+#endif
+
+// Writes the position of every k-th code point of [str, end) to 'marks', which must have room for
+// one per k bytes, rounded up, and returns the number of code points
+static size_t index_marks(const char* str, const char* end, size_t k, size_t* marks)
+{
+	UTFZ_DISPATCH_TO(index_marks, str, end, k, marks);
+	size_t      n    = 0; // code points so far
+	size_t      mark = 0; // number of the next code point to record
+	const char* s    = str;
+#ifndef UTFZ_SIMD
+	for (; s != end; n++)
+	{
+		if (end - s >= 8 && mark - n >= 8)
+		{
+			uint64_t w;
+			memcpy(&w, s, 8);
+			if ((w & 0x8080808080808080ull) == 0)
+			{
+				s += 8;
+				n += 7;
+				continue;
+			}
+		}
+		if (n == mark)
+		{
+			*marks++ = s - str;
+			mark += k;
+		}
+		s = iter_next(s, end);
+	}
+#else
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		// In valid text, each byte that is not a continuation byte starts a code point
+		for (; bad - s >= 64; s += 64)
+		{
+			uint64_t lead = lead_mask_64(s);
+			size_t   c    = popcount((uint32_t) lead) + popcount((uint32_t) (lead >> 32));
+			for (; n + c > mark; mark += k)
+			{
+				int p = nth_bit(lead, mark - n);
+				*marks++ = s + p - str;
+				// drop the lead bytes up to and including the mark
+				c    = n + c - (mark + 1);
+				n    = mark + 1;
+				lead = p == 63 ? 0 : lead & (~(uint64_t) 0 << (p + 1));
+			}
+			n += c;
+		}
+		for (; s != bad; s++)
+		{
+			if (((uint8_t) *s & 0xc0) == 0x80)
+				continue;
+			if (n == mark)
+			{
+				*marks++ = s - str;
+				mark += k;
+			}
+			n++;
+		}
+		if (bad != stop)
+		{
+			if (n == mark)
+			{
+				*marks++ = bad - str;
+				mark += k;
+			}
+			n++;
+			s = iter_next(bad, end);
+		}
+	}
+#endif
+	return n;
+}
+
+#ifndef UTFZ_NAMESPACE
+void index::build()
+{
+	// There are no more code points than bytes, so this is room enough
+	Marks.resize((End - Str + K - 1) / K);
+	Size = index_marks(Str, End, K, Marks.data());
+	Marks.resize((Size + K - 1) / K);
+	if (Marks.capacity() > 2 * Marks.size())
+		Marks.shrink_to_fit();
+}
+
+const char* index::pos(size_t cp) const
+{
+	if (cp >= Size)
+		return End;
+	const char* s = Str + Marks[cp / K];
+	for (size_t i = cp % K; i != 0; i--)
+		s = iter_next(s, End);
+	return s;
+}
+
+size_t index::code_point(size_t offset) const
+{
+	if (offset >= (size_t) (End - Str))
+		return Size;
+	// Find the last mark at or before 'offset'
+	size_t lo = 0;
+	size_t hi = Marks.size();
+	while (hi - lo > 1)
+	{
+		size_t mid = (lo + hi) / 2;
+		if (Marks[mid] <= offset)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	size_t      cp     = lo * K;
+	const char* s      = Str + Marks[lo];
+	const char* target = Str + offset;
+	for (const char* next = iter_next(s, End); next <= target; next = iter_next(s, End))
+	{
+		s = next;
+		cp++;
+	}
+	return cp;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef UTFZ_SIMD
+// Returns a mask of the positions in [s, s + 64) that hold 'first', with 'last' at 'gap' bytes
+// after them
+static inline uint64_t pair_mask_64(const char* s, size_t gap, char first, char last)
+{
+#if defined(UTFZ_AVX512)
+	uint64_t a = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*) s), _mm512_set1_epi8(first));
+	uint64_t b = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*) (s + gap)), _mm512_set1_epi8(last));
+	return a & b;
+#elif defined(UTFZ_AVX2)
+	__m256i  f  = _mm256_set1_epi8(first);
+	__m256i  l  = _mm256_set1_epi8(last);
+	__m256i  lo = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) s), f), _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (s + gap)), l));
+	__m256i  hi = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (s + 32)), f), _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (s + gap + 32)), l));
+	uint64_t m  = (uint32_t) _mm256_movemask_epi8(lo);
+	return m | ((uint64_t) (uint32_t) _mm256_movemask_epi8(hi) << 32);
+#else
+	__m128i  f = _mm_set1_epi8(first);
+	__m128i  l = _mm_set1_epi8(last);
+	uint64_t m = 0;
+	for (int i = 0; i < 64; i += 16)
+	{
+		__m128i a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (s + i)), f);
+		__m128i b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (s + gap + i)), l);
+		m |= (uint64_t) _mm_movemask_epi8(_mm_and_si128(a, b)) << i;
+	}
+	return m;
+#endif
+}
+#endif
+
+// Returns the first position in [s, end) where the 'n' bytes of 'needle' occur, or 'end'
+static const char* find_bytes(const char* s, const char* end, const char* needle, size_t n)
+{
+	UTFZ_DISPATCH_TO(find_bytes, s, end, needle, n);
+	if ((size_t) (end - s) < n)
+		return end;
+	const char* last = end - n; // the last position where the needle fits
+#ifdef UTFZ_SIMD
+	// Only compare the whole needle where its first and last bytes both match
+	for (; last - s >= 63; s += 64)
+	{
+		for (uint64_t m = pair_mask_64(s, n - 1, needle[0], needle[n - 1]); m != 0; m &= m - 1)
+		{
+			const char* p = s + ctz64(m);
+			if (memcmp(p + 1, needle + 1, n - 1) == 0)
+				return p;
+		}
+	}
+#endif
+	for (; s <= last; s++)
+	{
+		s = (const char*) memchr(s, needle[0], last - s + 1);
+		if (s == nullptr)
+			return end;
+		if (memcmp(s + 1, needle + 1, n - 1) == 0)
+			return s;
+	}
+	return end;
+}
+
+#ifndef UTFZ_NAMESPACE
+// Returns true if cp::iter stops at 's'. 'known' is a position at or before 's' that cp::iter
+// stops at. It is moved forward, so that the next call doesn't go over the same bytes again.
+static bool iter_stops_at(const char* s, const char*& known, const char* end)
+{
+	if (s < known)
+		return false; // inside the code point that was stepped over last time
+	const char* p = iter_sync(known, s);
+	while (p < s)
+		p = iter_next(p, end);
+	known = p;
+	return p == s;
+}
+
+const char* find(const char* s, const char* end, const char* needle, const char* needle_end)
+{
+	size_t n = needle_end - needle;
+	if (n == 0)
+		return s;
+	if (!validate(needle, needle_end))
+		return end;
+	const char* known = s;
+	for (const char* p = find_bytes(s, end, needle, n); p != end; p = find_bytes(p + 1, end, needle, n))
+	{
+		if (iter_stops_at(p, known, end))
+			return p;
+	}
+	return end;
+}
+
+const char* find_cp(const char* s, const char* end, int cp)
+{
+	char buf[4];
+	int  n = encode(buf, cp);
+	if (n == 0)
+		return end;
+	return find(s, end, buf, buf + n);
+}
+
+const char* truncate(const char* s, const char* end, size_t max_bytes)
+{
+	if ((size_t) (end - s) <= max_bytes)
+		return end;
+	// A sequence that crosses the cut starts in one of the 3 bytes before it
+	const char* cut  = s + max_bytes;
+	const char* stop = cut - std::min(max_bytes, (size_t) 3);
+	const char* lead = cut;
+	for (; lead != stop && ((uint8_t) *lead & 0xc0) == 0x80; lead--)
+	{
+	}
+	if (((uint8_t) *lead & 0xc0) == 0x80)
+		return cut; // the middle of a run of continuation bytes, which is invalid
+	int len = seq_len(*lead);
+	if (len != invalid && cut - lead < len)
+		return lead;
+	return cut;
+}
+
+bool truncate(std::string& s, size_t max_bytes)
+{
+	const char* cut = truncate(s.data(), s.data() + s.size(), max_bytes);
+	if (cut == s.data() + s.size())
+		return true;
+	s.resize(cut - s.data());
+	return false;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+enum case_target
+{
+	case_to_lower,
+	case_to_upper,
+	case_to_fold,
+};
+
+struct case_record
+{
+	int32_t Delta[3]; // added to the code point, in the order of enum case_target
+	bool    Special;  // true if case_special has a full mapping for the code point
+};
+
+struct full_case_mapping
+{
+	int32_t     CP;
+	const char* Map[3]; // UTF-8, in the order of enum case_target
+};
+
+// Case mappings of the Unicode Character Database 14.0, generated from UnicodeData.txt,
+// SpecialCasing.txt (without the conditional mappings) and CaseFolding.txt (the C, S and F
+// entries). Each code point finds its record through two stages of blocks of 64.
+static const int case_shift = 6;
+static const int case_max   = 0x1e943; // the last code point that has a mapping
+
+// Changes to the code point, in the order of enum case_target, and whether case_special has
+// a full mapping for it
+static const case_record case_records[185] = {
+    {{0, 0, 0}, false},
+    {{-42319, 0, -42319}, false},
+    {{-42315, 0, -42315}, false},
+    {{-42308, 0, -42308}, false},
+    {{-42307, 0, -42307}, false},
+    {{-42305, 0, -42305}, false},
+    {{-42282, 0, -42282}, false},
+    {{-42280, 0, -42280}, false},
+    {{-42261, 0, -42261}, false},
+    {{-42258, 0, -42258}, false},
+    {{-35384, 0, -35384}, false},
+    {{-35332, 0, -35332}, false},
+    {{-10815, 0, -10815}, false},
+    {{-10783, 0, -10783}, false},
+    {{-10782, 0, -10782}, false},
+    {{-10780, 0, -10780}, false},
+    {{-10749, 0, -10749}, false},
+    {{-10743, 0, -10743}, false},
+    {{-10727, 0, -10727}, false},
+    {{-8383, 0, -8383}, false},
+    {{-8262, 0, -8262}, false},
+    {{-7615, 0, -7615}, true},
+    {{-7517, 0, -7517}, false},
+    {{-3814, 0, -3814}, false},
+    {{-3008, 0, -3008}, false},
+    {{-199, 0, 0}, true},
+    {{-195, 0, -195}, false},
+    {{-163, 0, -163}, false},
+    {{-130, 0, -130}, false},
+    {{-128, 0, -128}, false},
+    {{-126, 0, -126}, false},
+    {{-121, 0, -121}, false},
+    {{-112, 0, -112}, false},
+    {{-100, 0, -100}, false},
+    {{-97, 0, -97}, false},
+    {{-86, 0, -86}, false},
+    {{-74, 0, -74}, false},
+    {{-60, 0, -60}, false},
+    {{-56, 0, -56}, false},
+    {{-48, 0, -48}, false},
+    {{-9, 0, -9}, true},
+    {{-8, 0, -8}, false},
+    {{-8, 0, -8}, true},
+    {{-7, 0, -7}, false},
+    {{0, -38864, -38864}, false},
+    {{0, -10795, 0}, false},
+    {{0, -10792, 0}, false},
+    {{0, -7264, 0}, false},
+    {{0, -7205, -7173}, false},
+    {{0, -6254, -6222}, false},
+    {{0, -6253, -6221}, false},
+    {{0, -6244, -6212}, false},
+    {{0, -6243, -6211}, false},
+    {{0, -6242, -6210}, false},
+    {{0, -6236, -6204}, false},
+    {{0, -6181, -6180}, false},
+    {{0, -928, 0}, false},
+    {{0, -300, -268}, false},
+    {{0, -232, 0}, false},
+    {{0, -219, 0}, false},
+    {{0, -218, 0}, false},
+    {{0, -217, 0}, false},
+    {{0, -214, 0}, false},
+    {{0, -213, 0}, false},
+    {{0, -211, 0}, false},
+    {{0, -210, 0}, false},
+    {{0, -209, 0}, false},
+    {{0, -207, 0}, false},
+    {{0, -206, 0}, false},
+    {{0, -205, 0}, false},
+    {{0, -203, 0}, false},
+    {{0, -202, 0}, false},
+    {{0, -116, 0}, false},
+    {{0, -96, -64}, false},
+    {{0, -86, -54}, false},
+    {{0, -80, -48}, false},
+    {{0, -80, 0}, false},
+    {{0, -79, 0}, false},
+    {{0, -71, 0}, false},
+    {{0, -69, 0}, false},
+    {{0, -64, 0}, false},
+    {{0, -63, 0}, false},
+    {{0, -62, -30}, false},
+    {{0, -59, -58}, false},
+    {{0, -57, -25}, false},
+    {{0, -54, -22}, false},
+    {{0, -48, 0}, false},
+    {{0, -47, -15}, false},
+    {{0, -40, 0}, false},
+    {{0, -39, 0}, false},
+    {{0, -38, 0}, false},
+    {{0, -37, 0}, false},
+    {{0, -34, 0}, false},
+    {{0, -32, 0}, false},
+    {{0, -31, 1}, false},
+    {{0, -28, 0}, false},
+    {{0, -26, 0}, false},
+    {{0, -16, 0}, false},
+    {{0, -15, 0}, false},
+    {{0, -8, -8}, false},
+    {{0, -8, 0}, false},
+    {{0, -2, 0}, false},
+    {{0, -1, 0}, false},
+    {{0, 0, 0}, true},
+    {{0, 7, 0}, false},
+    {{0, 8, 0}, false},
+    {{0, 8, 0}, true},
+    {{0, 9, 0}, true},
+    {{0, 48, 0}, false},
+    {{0, 56, 0}, false},
+    {{0, 74, 0}, false},
+    {{0, 84, 116}, false},
+    {{0, 86, 0}, false},
+    {{0, 97, 0}, false},
+    {{0, 100, 0}, false},
+    {{0, 112, 0}, false},
+    {{0, 121, 0}, false},
+    {{0, 126, 0}, false},
+    {{0, 128, 0}, false},
+    {{0, 130, 0}, false},
+    {{0, 163, 0}, false},
+    {{0, 195, 0}, false},
+    {{0, 743, 775}, false},
+    {{0, 3008, 0}, false},
+    {{0, 3814, 0}, false},
+    {{0, 10727, 0}, false},
+    {{0, 10743, 0}, false},
+    {{0, 10749, 0}, false},
+    {{0, 10780, 0}, false},
+    {{0, 10782, 0}, false},
+    {{0, 10783, 0}, false},
+    {{0, 10815, 0}, false},
+    {{0, 35266, 35267}, false},
+    {{0, 35332, 0}, false},
+    {{0, 35384, 0}, false},
+    {{0, 42258, 0}, false},
+    {{0, 42261, 0}, false},
+    {{0, 42280, 0}, false},
+    {{0, 42282, 0}, false},
+    {{0, 42305, 0}, false},
+    {{0, 42307, 0}, false},
+    {{0, 42308, 0}, false},
+    {{0, 42315, 0}, false},
+    {{0, 42319, 0}, false},
+    {{1, -1, 1}, false},
+    {{1, 0, 1}, false},
+    {{2, 0, 2}, false},
+    {{8, 0, 0}, false},
+    {{8, 0, 8}, false},
+    {{15, 0, 15}, false},
+    {{16, 0, 16}, false},
+    {{26, 0, 26}, false},
+    {{28, 0, 28}, false},
+    {{32, 0, 32}, false},
+    {{34, 0, 34}, false},
+    {{37, 0, 37}, false},
+    {{38, 0, 38}, false},
+    {{39, 0, 39}, false},
+    {{40, 0, 40}, false},
+    {{48, 0, 48}, false},
+    {{63, 0, 63}, false},
+    {{64, 0, 64}, false},
+    {{69, 0, 69}, false},
+    {{71, 0, 71}, false},
+    {{79, 0, 79}, false},
+    {{80, 0, 80}, false},
+    {{116, 0, 116}, false},
+    {{202, 0, 202}, false},
+    {{203, 0, 203}, false},
+    {{205, 0, 205}, false},
+    {{206, 0, 206}, false},
+    {{207, 0, 207}, false},
+    {{209, 0, 209}, false},
+    {{210, 0, 210}, false},
+    {{211, 0, 211}, false},
+    {{213, 0, 213}, false},
+    {{214, 0, 214}, false},
+    {{217, 0, 217}, false},
+    {{218, 0, 218}, false},
+    {{219, 0, 219}, false},
+    {{928, 0, 928}, false},
+    {{7264, 0, 7264}, false},
+    {{10792, 0, 10792}, false},
+    {{10795, 0, 10795}, false},
+    {{38864, 0, 0}, false},
+};
+
+// The block of case_blocks for each group of 64 code points, up to case_max
+static const uint8_t case_stage1[1958] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 25, 0, 0, 26, 27, 0, 28, 28, 29, 28, 30, 31, 32, 33,
+    0, 0, 0, 0, 34, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 40, 28, 41, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 45, 46, 47, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 55, 56, 57, 0, 58, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 65, 66,
+};
+
+// The index into case_records of each code point in a block
+static const uint8_t case_blocks[67][64] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0,
+        0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 103,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 0, 93, 93, 93, 93, 93, 93, 93, 116,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        25, 58, 145, 102, 145, 102, 145, 102, 0, 145, 102, 145, 102, 145, 102, 145,
+    },
+    {
+        102, 145, 102, 145, 102, 145, 102, 145, 102, 103, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 31, 145, 102, 145, 102, 145, 102, 57,
+    },
+    {
+        121, 173, 145, 102, 145, 102, 170, 145, 102, 169, 169, 145, 102, 0, 164, 167,
+        168, 145, 102, 169, 171, 113, 174, 172, 145, 102, 120, 0, 174, 175, 119, 176,
+        145, 102, 145, 102, 145, 102, 178, 145, 102, 178, 0, 0, 145, 102, 178, 145,
+        102, 177, 177, 145, 102, 145, 102, 179, 145, 102, 0, 0, 145, 102, 0, 109,
+    },
+    {
+        0, 0, 0, 0, 146, 144, 101, 146, 144, 101, 146, 144, 101, 145, 102, 145,
+        102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 77, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        103, 146, 144, 101, 145, 102, 34, 38, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        28, 0, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 0, 0, 0, 0, 0, 0, 183, 145, 102, 27, 182, 131,
+    },
+    {
+        131, 145, 102, 26, 162, 163, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        130, 128, 129, 65, 68, 0, 69, 69, 0, 71, 0, 70, 143, 0, 0, 0,
+        69, 142, 0, 67, 0, 137, 141, 0, 66, 64, 141, 126, 139, 0, 0, 64,
+        0, 127, 63, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0,
+    },
+    {
+        60, 0, 140, 60, 0, 0, 0, 138, 60, 79, 61, 61, 78, 0, 0, 0,
+        0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 135, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        145, 102, 145, 102, 0, 0, 145, 102, 0, 0, 0, 119, 119, 119, 0, 166,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 156, 0, 155, 155, 155, 0, 161, 0, 160, 160,
+        103, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 0, 153, 153, 153, 153, 153, 153, 153, 153, 153, 90, 91, 91, 91,
+        103, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    },
+    {
+        93, 93, 94, 93, 93, 93, 93, 93, 93, 93, 93, 93, 80, 81, 81, 148,
+        82, 84, 0, 0, 0, 87, 85, 100, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        74, 75, 104, 72, 37, 73, 0, 145, 102, 43, 145, 102, 0, 28, 28, 28,
+    },
+    {
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    },
+    {
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 0, 0, 0, 0, 0, 0, 0, 0, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        149, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 98,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        0, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    },
+    {
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+        159, 159, 159, 159, 159, 159, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    },
+    {
+        86, 86, 86, 86, 86, 86, 86, 103, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    },
+    {
+        181, 181, 181, 181, 181, 181, 0, 181, 0, 0, 0, 0, 0, 181, 0, 0,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 123, 123, 123,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    },
+    {
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+        184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+        147, 147, 147, 147, 147, 147, 0, 0, 99, 99, 99, 99, 99, 99, 0, 0,
+    },
+    {
+        49, 50, 51, 53, 53, 52, 54, 55, 132, 0, 0, 0, 0, 0, 0, 0,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 24, 24,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0, 0, 124, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 103, 103, 103, 103, 103, 83, 0, 0, 21, 0,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        105, 105, 105, 105, 105, 105, 105, 105, 41, 41, 41, 41, 41, 41, 41, 41,
+        105, 105, 105, 105, 105, 105, 0, 0, 41, 41, 41, 41, 41, 41, 0, 0,
+        105, 105, 105, 105, 105, 105, 105, 105, 41, 41, 41, 41, 41, 41, 41, 41,
+        105, 105, 105, 105, 105, 105, 105, 105, 41, 41, 41, 41, 41, 41, 41, 41,
+    },
+    {
+        105, 105, 105, 105, 105, 105, 0, 0, 41, 41, 41, 41, 41, 41, 0, 0,
+        103, 105, 103, 105, 103, 105, 103, 105, 0, 41, 0, 41, 0, 41, 0, 41,
+        105, 105, 105, 105, 105, 105, 105, 105, 41, 41, 41, 41, 41, 41, 41, 41,
+        110, 110, 112, 112, 112, 112, 114, 114, 118, 118, 115, 115, 117, 117, 0, 0,
+    },
+    {
+        106, 106, 106, 106, 106, 106, 106, 106, 42, 42, 42, 42, 42, 42, 42, 42,
+        106, 106, 106, 106, 106, 106, 106, 106, 42, 42, 42, 42, 42, 42, 42, 42,
+        106, 106, 106, 106, 106, 106, 106, 106, 42, 42, 42, 42, 42, 42, 42, 42,
+        105, 105, 103, 107, 103, 0, 103, 103, 41, 41, 36, 36, 40, 0, 48, 0,
+    },
+    {
+        0, 0, 103, 107, 103, 0, 103, 103, 35, 35, 35, 35, 40, 0, 0, 0,
+        105, 105, 103, 103, 0, 0, 103, 103, 41, 41, 33, 33, 0, 0, 0, 0,
+        105, 105, 103, 103, 103, 104, 103, 103, 41, 41, 32, 32, 43, 0, 0, 0,
+        0, 0, 103, 107, 103, 0, 103, 103, 29, 29, 30, 30, 40, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+        0, 0, 152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    },
+    {
+        0, 0, 0, 145, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+    },
+    {
+        151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+        159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    },
+    {
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        145, 102, 17, 23, 18, 45, 46, 145, 102, 145, 102, 145, 102, 15, 16, 13,
+        14, 0, 145, 102, 0, 145, 102, 0, 0, 0, 0, 0, 0, 0, 12, 12,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 0, 0, 0, 0, 0, 0, 0, 145, 102, 145, 102, 0,
+        0, 0, 145, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 0, 47, 0, 0, 0, 0, 0, 47, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        0, 0, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 102, 145, 102, 11, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 145, 102, 145, 102, 0, 0, 0, 145, 102, 7, 0, 0,
+        145, 102, 145, 102, 108, 0, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+        145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 3, 1, 2, 5, 3, 0,
+        9, 6, 8, 180, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102, 145, 102,
+    },
+    {
+        145, 102, 145, 102, 39, 4, 10, 145, 102, 145, 102, 0, 0, 0, 0, 0,
+        145, 102, 0, 0, 0, 0, 145, 102, 145, 102, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 145, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    },
+    {
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    },
+    {
+        103, 103, 103, 103, 103, 103, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 103, 103, 103, 103, 103, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 158, 158, 158, 158, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    },
+    {
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    },
+    {
+        158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+        158, 158, 158, 158, 0, 0, 0, 0, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 0, 157, 157, 157, 157,
+    },
+    {
+        157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 0, 157, 157, 157, 157,
+        157, 157, 157, 0, 157, 157, 0, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+        89, 89, 0, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+        89, 89, 0, 89, 89, 89, 89, 89, 89, 89, 0, 89, 89, 0, 0, 0,
+    },
+    {
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        161, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    },
+    {
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+        93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    },
+    {
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    },
+    {
+        92, 92, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+// The full mappings that are not a single code point, sorted by code point
+static const full_case_mapping case_special[104] = {
+    {0x00df, {"\xc3\x9f", "\x53\x53", "\x73\x73"}},
+    {0x0130, {"\x69\xcc\x87", "\xc4\xb0", "\x69\xcc\x87"}},
+    {0x0149, {"\xc5\x89", "\xca\xbc\x4e", "\xca\xbc\x6e"}},
+    {0x01f0, {"\xc7\xb0", "\x4a\xcc\x8c", "\x6a\xcc\x8c"}},
+    {0x0390, {"\xce\x90", "\xce\x99\xcc\x88\xcc\x81", "\xce\xb9\xcc\x88\xcc\x81"}},
+    {0x03b0, {"\xce\xb0", "\xce\xa5\xcc\x88\xcc\x81", "\xcf\x85\xcc\x88\xcc\x81"}},
+    {0x0587, {"\xd6\x87", "\xd4\xb5\xd5\x92", "\xd5\xa5\xd6\x82"}},
+    {0x1e96, {"\xe1\xba\x96", "\x48\xcc\xb1", "\x68\xcc\xb1"}},
+    {0x1e97, {"\xe1\xba\x97", "\x54\xcc\x88", "\x74\xcc\x88"}},
+    {0x1e98, {"\xe1\xba\x98", "\x57\xcc\x8a", "\x77\xcc\x8a"}},
+    {0x1e99, {"\xe1\xba\x99", "\x59\xcc\x8a", "\x79\xcc\x8a"}},
+    {0x1e9a, {"\xe1\xba\x9a", "\x41\xca\xbe", "\x61\xca\xbe"}},
+    {0x1e9e, {"\xc3\x9f", "\xe1\xba\x9e", "\x73\x73"}},
+    {0x1f50, {"\xe1\xbd\x90", "\xce\xa5\xcc\x93", "\xcf\x85\xcc\x93"}},
+    {0x1f52, {"\xe1\xbd\x92", "\xce\xa5\xcc\x93\xcc\x80", "\xcf\x85\xcc\x93\xcc\x80"}},
+    {0x1f54, {"\xe1\xbd\x94", "\xce\xa5\xcc\x93\xcc\x81", "\xcf\x85\xcc\x93\xcc\x81"}},
+    {0x1f56, {"\xe1\xbd\x96", "\xce\xa5\xcc\x93\xcd\x82", "\xcf\x85\xcc\x93\xcd\x82"}},
+    {0x1f80, {"\xe1\xbe\x80", "\xe1\xbc\x88\xce\x99", "\xe1\xbc\x80\xce\xb9"}},
+    {0x1f81, {"\xe1\xbe\x81", "\xe1\xbc\x89\xce\x99", "\xe1\xbc\x81\xce\xb9"}},
+    {0x1f82, {"\xe1\xbe\x82", "\xe1\xbc\x8a\xce\x99", "\xe1\xbc\x82\xce\xb9"}},
+    {0x1f83, {"\xe1\xbe\x83", "\xe1\xbc\x8b\xce\x99", "\xe1\xbc\x83\xce\xb9"}},
+    {0x1f84, {"\xe1\xbe\x84", "\xe1\xbc\x8c\xce\x99", "\xe1\xbc\x84\xce\xb9"}},
+    {0x1f85, {"\xe1\xbe\x85", "\xe1\xbc\x8d\xce\x99", "\xe1\xbc\x85\xce\xb9"}},
+    {0x1f86, {"\xe1\xbe\x86", "\xe1\xbc\x8e\xce\x99", "\xe1\xbc\x86\xce\xb9"}},
+    {0x1f87, {"\xe1\xbe\x87", "\xe1\xbc\x8f\xce\x99", "\xe1\xbc\x87\xce\xb9"}},
+    {0x1f88, {"\xe1\xbe\x80", "\xe1\xbc\x88\xce\x99", "\xe1\xbc\x80\xce\xb9"}},
+    {0x1f89, {"\xe1\xbe\x81", "\xe1\xbc\x89\xce\x99", "\xe1\xbc\x81\xce\xb9"}},
+    {0x1f8a, {"\xe1\xbe\x82", "\xe1\xbc\x8a\xce\x99", "\xe1\xbc\x82\xce\xb9"}},
+    {0x1f8b, {"\xe1\xbe\x83", "\xe1\xbc\x8b\xce\x99", "\xe1\xbc\x83\xce\xb9"}},
+    {0x1f8c, {"\xe1\xbe\x84", "\xe1\xbc\x8c\xce\x99", "\xe1\xbc\x84\xce\xb9"}},
+    {0x1f8d, {"\xe1\xbe\x85", "\xe1\xbc\x8d\xce\x99", "\xe1\xbc\x85\xce\xb9"}},
+    {0x1f8e, {"\xe1\xbe\x86", "\xe1\xbc\x8e\xce\x99", "\xe1\xbc\x86\xce\xb9"}},
+    {0x1f8f, {"\xe1\xbe\x87", "\xe1\xbc\x8f\xce\x99", "\xe1\xbc\x87\xce\xb9"}},
+    {0x1f90, {"\xe1\xbe\x90", "\xe1\xbc\xa8\xce\x99", "\xe1\xbc\xa0\xce\xb9"}},
+    {0x1f91, {"\xe1\xbe\x91", "\xe1\xbc\xa9\xce\x99", "\xe1\xbc\xa1\xce\xb9"}},
+    {0x1f92, {"\xe1\xbe\x92", "\xe1\xbc\xaa\xce\x99", "\xe1\xbc\xa2\xce\xb9"}},
+    {0x1f93, {"\xe1\xbe\x93", "\xe1\xbc\xab\xce\x99", "\xe1\xbc\xa3\xce\xb9"}},
+    {0x1f94, {"\xe1\xbe\x94", "\xe1\xbc\xac\xce\x99", "\xe1\xbc\xa4\xce\xb9"}},
+    {0x1f95, {"\xe1\xbe\x95", "\xe1\xbc\xad\xce\x99", "\xe1\xbc\xa5\xce\xb9"}},
+    {0x1f96, {"\xe1\xbe\x96", "\xe1\xbc\xae\xce\x99", "\xe1\xbc\xa6\xce\xb9"}},
+    {0x1f97, {"\xe1\xbe\x97", "\xe1\xbc\xaf\xce\x99", "\xe1\xbc\xa7\xce\xb9"}},
+    {0x1f98, {"\xe1\xbe\x90", "\xe1\xbc\xa8\xce\x99", "\xe1\xbc\xa0\xce\xb9"}},
+    {0x1f99, {"\xe1\xbe\x91", "\xe1\xbc\xa9\xce\x99", "\xe1\xbc\xa1\xce\xb9"}},
+    {0x1f9a, {"\xe1\xbe\x92", "\xe1\xbc\xaa\xce\x99", "\xe1\xbc\xa2\xce\xb9"}},
+    {0x1f9b, {"\xe1\xbe\x93", "\xe1\xbc\xab\xce\x99", "\xe1\xbc\xa3\xce\xb9"}},
+    {0x1f9c, {"\xe1\xbe\x94", "\xe1\xbc\xac\xce\x99", "\xe1\xbc\xa4\xce\xb9"}},
+    {0x1f9d, {"\xe1\xbe\x95", "\xe1\xbc\xad\xce\x99", "\xe1\xbc\xa5\xce\xb9"}},
+    {0x1f9e, {"\xe1\xbe\x96", "\xe1\xbc\xae\xce\x99", "\xe1\xbc\xa6\xce\xb9"}},
+    {0x1f9f, {"\xe1\xbe\x97", "\xe1\xbc\xaf\xce\x99", "\xe1\xbc\xa7\xce\xb9"}},
+    {0x1fa0, {"\xe1\xbe\xa0", "\xe1\xbd\xa8\xce\x99", "\xe1\xbd\xa0\xce\xb9"}},
+    {0x1fa1, {"\xe1\xbe\xa1", "\xe1\xbd\xa9\xce\x99", "\xe1\xbd\xa1\xce\xb9"}},
+    {0x1fa2, {"\xe1\xbe\xa2", "\xe1\xbd\xaa\xce\x99", "\xe1\xbd\xa2\xce\xb9"}},
+    {0x1fa3, {"\xe1\xbe\xa3", "\xe1\xbd\xab\xce\x99", "\xe1\xbd\xa3\xce\xb9"}},
+    {0x1fa4, {"\xe1\xbe\xa4", "\xe1\xbd\xac\xce\x99", "\xe1\xbd\xa4\xce\xb9"}},
+    {0x1fa5, {"\xe1\xbe\xa5", "\xe1\xbd\xad\xce\x99", "\xe1\xbd\xa5\xce\xb9"}},
+    {0x1fa6, {"\xe1\xbe\xa6", "\xe1\xbd\xae\xce\x99", "\xe1\xbd\xa6\xce\xb9"}},
+    {0x1fa7, {"\xe1\xbe\xa7", "\xe1\xbd\xaf\xce\x99", "\xe1\xbd\xa7\xce\xb9"}},
+    {0x1fa8, {"\xe1\xbe\xa0", "\xe1\xbd\xa8\xce\x99", "\xe1\xbd\xa0\xce\xb9"}},
+    {0x1fa9, {"\xe1\xbe\xa1", "\xe1\xbd\xa9\xce\x99", "\xe1\xbd\xa1\xce\xb9"}},
+    {0x1faa, {"\xe1\xbe\xa2", "\xe1\xbd\xaa\xce\x99", "\xe1\xbd\xa2\xce\xb9"}},
+    {0x1fab, {"\xe1\xbe\xa3", "\xe1\xbd\xab\xce\x99", "\xe1\xbd\xa3\xce\xb9"}},
+    {0x1fac, {"\xe1\xbe\xa4", "\xe1\xbd\xac\xce\x99", "\xe1\xbd\xa4\xce\xb9"}},
+    {0x1fad, {"\xe1\xbe\xa5", "\xe1\xbd\xad\xce\x99", "\xe1\xbd\xa5\xce\xb9"}},
+    {0x1fae, {"\xe1\xbe\xa6", "\xe1\xbd\xae\xce\x99", "\xe1\xbd\xa6\xce\xb9"}},
+    {0x1faf, {"\xe1\xbe\xa7", "\xe1\xbd\xaf\xce\x99", "\xe1\xbd\xa7\xce\xb9"}},
+    {0x1fb2, {"\xe1\xbe\xb2", "\xe1\xbe\xba\xce\x99", "\xe1\xbd\xb0\xce\xb9"}},
+    {0x1fb3, {"\xe1\xbe\xb3", "\xce\x91\xce\x99", "\xce\xb1\xce\xb9"}},
+    {0x1fb4, {"\xe1\xbe\xb4", "\xce\x86\xce\x99", "\xce\xac\xce\xb9"}},
+    {0x1fb6, {"\xe1\xbe\xb6", "\xce\x91\xcd\x82", "\xce\xb1\xcd\x82"}},
+    {0x1fb7, {"\xe1\xbe\xb7", "\xce\x91\xcd\x82\xce\x99", "\xce\xb1\xcd\x82\xce\xb9"}},
+    {0x1fbc, {"\xe1\xbe\xb3", "\xce\x91\xce\x99", "\xce\xb1\xce\xb9"}},
+    {0x1fc2, {"\xe1\xbf\x82", "\xe1\xbf\x8a\xce\x99", "\xe1\xbd\xb4\xce\xb9"}},
+    {0x1fc3, {"\xe1\xbf\x83", "\xce\x97\xce\x99", "\xce\xb7\xce\xb9"}},
+    {0x1fc4, {"\xe1\xbf\x84", "\xce\x89\xce\x99", "\xce\xae\xce\xb9"}},
+    {0x1fc6, {"\xe1\xbf\x86", "\xce\x97\xcd\x82", "\xce\xb7\xcd\x82"}},
+    {0x1fc7, {"\xe1\xbf\x87", "\xce\x97\xcd\x82\xce\x99", "\xce\xb7\xcd\x82\xce\xb9"}},
+    {0x1fcc, {"\xe1\xbf\x83", "\xce\x97\xce\x99", "\xce\xb7\xce\xb9"}},
+    {0x1fd2, {"\xe1\xbf\x92", "\xce\x99\xcc\x88\xcc\x80", "\xce\xb9\xcc\x88\xcc\x80"}},
+    {0x1fd3, {"\xe1\xbf\x93", "\xce\x99\xcc\x88\xcc\x81", "\xce\xb9\xcc\x88\xcc\x81"}},
+    {0x1fd6, {"\xe1\xbf\x96", "\xce\x99\xcd\x82", "\xce\xb9\xcd\x82"}},
+    {0x1fd7, {"\xe1\xbf\x97", "\xce\x99\xcc\x88\xcd\x82", "\xce\xb9\xcc\x88\xcd\x82"}},
+    {0x1fe2, {"\xe1\xbf\xa2", "\xce\xa5\xcc\x88\xcc\x80", "\xcf\x85\xcc\x88\xcc\x80"}},
+    {0x1fe3, {"\xe1\xbf\xa3", "\xce\xa5\xcc\x88\xcc\x81", "\xcf\x85\xcc\x88\xcc\x81"}},
+    {0x1fe4, {"\xe1\xbf\xa4", "\xce\xa1\xcc\x93", "\xcf\x81\xcc\x93"}},
+    {0x1fe6, {"\xe1\xbf\xa6", "\xce\xa5\xcd\x82", "\xcf\x85\xcd\x82"}},
+    {0x1fe7, {"\xe1\xbf\xa7", "\xce\xa5\xcc\x88\xcd\x82", "\xcf\x85\xcc\x88\xcd\x82"}},
+    {0x1ff2, {"\xe1\xbf\xb2", "\xe1\xbf\xba\xce\x99", "\xe1\xbd\xbc\xce\xb9"}},
+    {0x1ff3, {"\xe1\xbf\xb3", "\xce\xa9\xce\x99", "\xcf\x89\xce\xb9"}},
+    {0x1ff4, {"\xe1\xbf\xb4", "\xce\x8f\xce\x99", "\xcf\x8e\xce\xb9"}},
+    {0x1ff6, {"\xe1\xbf\xb6", "\xce\xa9\xcd\x82", "\xcf\x89\xcd\x82"}},
+    {0x1ff7, {"\xe1\xbf\xb7", "\xce\xa9\xcd\x82\xce\x99", "\xcf\x89\xcd\x82\xce\xb9"}},
+    {0x1ffc, {"\xe1\xbf\xb3", "\xce\xa9\xce\x99", "\xcf\x89\xce\xb9"}},
+    {0xfb00, {"\xef\xac\x80", "\x46\x46", "\x66\x66"}},
+    {0xfb01, {"\xef\xac\x81", "\x46\x49", "\x66\x69"}},
+    {0xfb02, {"\xef\xac\x82", "\x46\x4c", "\x66\x6c"}},
+    {0xfb03, {"\xef\xac\x83", "\x46\x46\x49", "\x66\x66\x69"}},
+    {0xfb04, {"\xef\xac\x84", "\x46\x46\x4c", "\x66\x66\x6c"}},
+    {0xfb05, {"\xef\xac\x85", "\x53\x54", "\x73\x74"}},
+    {0xfb06, {"\xef\xac\x86", "\x53\x54", "\x73\x74"}},
+    {0xfb13, {"\xef\xac\x93", "\xd5\x84\xd5\x86", "\xd5\xb4\xd5\xb6"}},
+    {0xfb14, {"\xef\xac\x94", "\xd5\x84\xd4\xb5", "\xd5\xb4\xd5\xa5"}},
+    {0xfb15, {"\xef\xac\x95", "\xd5\x84\xd4\xbb", "\xd5\xb4\xd5\xab"}},
+    {0xfb16, {"\xef\xac\x96", "\xd5\x8e\xd5\x86", "\xd5\xbe\xd5\xb6"}},
+    {0xfb17, {"\xef\xac\x97", "\xd5\x84\xd4\xbd", "\xd5\xb4\xd5\xad"}},
+};
+
+
+static inline const case_record& case_lookup(int cp)
+{
+	if ((unsigned) cp > (unsigned) case_max)
+		return case_records[0];
+	return case_records[case_blocks[case_stage1[cp >> case_shift]][cp & ((1 << case_shift) - 1)]];
+}
+
+static inline bool operator<(const full_case_mapping& m, int cp)
+{
+	return m.CP < cp;
+}
+
+int to_lower(int cp)
+{
+	return cp + case_lookup(cp).Delta[case_to_lower];
+}
+
+int to_upper(int cp)
+{
+	return cp + case_lookup(cp).Delta[case_to_upper];
+}
+
+int fold_case(int cp)
+{
+	return cp + case_lookup(cp).Delta[case_to_fold];
+}
+#endif
+
+// Changes the case of an ASCII byte. The letters of the two cases differ only in 0x20, so
+// 'from' is 'A' to make lower case, and 'a' to make upper case.
+static inline char ascii_case(char c, char from)
+{
+	return (uint8_t) (c - from) < 26 ? (char) (c ^ 0x20) : c;
+}
+
+// ascii_case, on 8 bytes that are all ASCII
+static inline uint64_t ascii_case_8(uint64_t w, char from)
+{
+	const uint64_t ones = 0x0101010101010101ull;
+	uint64_t       ge   = w + ones * (uint8_t) (0x80 - from);      // top bit set in bytes >= from
+	uint64_t       gt   = w + ones * (uint8_t) (0x80 - from - 26); // top bit set in bytes >= from + 26
+	return w ^ ((ge & ~gt & (ones * 0x80)) >> 2);
+}
+
+// If the 'case_block' bytes at 's' are all ASCII, writes them to 'out' with ascii_case, and
+// returns true
+#if defined(UTFZ_AVX512)
+static const int case_block = 64;
+
+static inline bool ascii_case_block(const char* s, char* out, char from)
+{
+	__m512i v = _mm512_loadu_si512((const void*) s);
+	if (_mm512_movepi8_mask(v) != 0)
+		return false;
+	// moves the letters to the bottom of the signed range, so that one compare finds them
+	__m512i   x      = _mm512_add_epi8(v, _mm512_set1_epi8((char) (0x80 - from)));
+	__mmask64 letter = _mm512_cmplt_epi8_mask(x, _mm512_set1_epi8(-128 + 26));
+	_mm512_storeu_si512((void*) out, _mm512_mask_blend_epi8(letter, v, _mm512_xor_si512(v, _mm512_set1_epi8(0x20))));
+	return true;
+}
+#elif defined(UTFZ_AVX2)
+static const int case_block = 32;
+
+static inline bool ascii_case_block(const char* s, char* out, char from)
+{
+	__m256i v = _mm256_loadu_si256((const __m256i*) s);
+	if (_mm256_movemask_epi8(v) != 0)
+		return false;
+	__m256i x      = _mm256_add_epi8(v, _mm256_set1_epi8((char) (0x80 - from)));
+	__m256i letter = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), x);
+	_mm256_storeu_si256((__m256i*) out, _mm256_xor_si256(v, _mm256_and_si256(letter, _mm256_set1_epi8(0x20))));
+	return true;
+}
+#elif defined(UTFZ_SSE42)
+static const int case_block = 16;
+
+static inline bool ascii_case_block(const char* s, char* out, char from)
+{
+	__m128i v = _mm_loadu_si128((const __m128i*) s);
+	if (_mm_movemask_epi8(v) != 0)
+		return false;
+	__m128i x      = _mm_add_epi8(v, _mm_set1_epi8((char) (0x80 - from)));
+	__m128i letter = _mm_cmplt_epi8(x, _mm_set1_epi8(-128 + 26));
+	_mm_storeu_si128((__m128i*) out, _mm_xor_si128(v, _mm_and_si128(letter, _mm_set1_epi8(0x20))));
+	return true;
+}
+#else
+static const int case_block = 8;
+
+static inline bool ascii_case_block(const char* s, char* out, char from)
+{
+	uint64_t w;
+	memcpy(&w, s, 8);
+	if ((w & 0x8080808080808080ull) != 0)
+		return false;
+	w = ascii_case_8(w, from);
+	memcpy(out, &w, 8);
+	return true;
+}
+#endif
+
+// Changes the case of the blocks at the front of [s, end) that are all ASCII, and returns the
+// number of bytes that they hold
+static size_t ascii_case_run(const char* s, const char* end, char* out, char from)
+{
+	UTFZ_DISPATCH_TO(ascii_case_run, s, end, out, from);
+	const char* start = s;
+	for (; end - s >= case_block && ascii_case_block(s, out, from); s += case_block)
+		out += case_block;
+	return s - start;
+}
+
+#ifndef UTFZ_NAMESPACE
+// Maps the code point at the front of [s, end), decoded with the same rules as next(), and
+// returns the start of the next one
+static inline const char* case_step(const char* s, const char* end, char*& out, case_target target, case_mapping mapping, bool& valid)
+{
+	char32_t    c;
+	const char* next = decode_step(s, end, &c);
+	int         cp   = (int) c;
+	if (cp == replace && (next - s != 3 || memcmp(s, "\xEF\xBF\xBD", 3) != 0))
+		valid = false;
+	const case_record& r = case_lookup(cp);
+	if (r.Special && mapping == case_full)
+	{
+		const char* m = std::lower_bound(case_special, case_special + sizeof(case_special) / sizeof(case_special[0]), cp)->Map[target];
+		size_t      n = strlen(m);
+		memcpy(out, m, n);
+		out += n;
+	}
+	else
+	{
+		out += encode(out, cp + r.Delta[target]);
+	}
+	return next;
+}
+
+// Returns the new end of 'out'
+static char* change_case(const char* s, const char* end, char* out, case_target target, case_mapping mapping, bool& valid)
+{
+	// ASCII folds to lower case
+	char from = target == case_to_upper ? 'a' : 'A';
+	while (s != end)
+	{
+		size_t done = ascii_case_run(s, end, out, from);
+		s += done;
+		out += done;
+		// the block that stopped it, one code point at a time
+		for (const char* stop = end - s >= case_block ? s + case_block : end; s < stop;)
+		{
+			if ((uint8_t) *s <= max1)
+				*out++ = ascii_case(*s++, from);
+			else
+				s = case_step(s, end, out, target, mapping, valid);
+		}
+	}
+	return out;
+}
+
+// Returns the number of bytes in [s, end) that are not ASCII
+static size_t count_high(const char* s, const char* end)
+{
+	size_t n = 0;
+	for (; end - s >= 8; s += 8)
+	{
+		uint64_t w;
+		memcpy(&w, s, 8);
+		n += (((w >> 7) & 0x0101010101010101ull) * 0x0101010101010101ull) >> 56;
+	}
+	for (; s != end; s++)
+		n += (uint8_t) *s >> 7;
+	return n;
+}
+
+static bool change_case(std::string& out, const char* s, const char* end, case_target target, case_mapping mapping)
+{
+	bool valid = true;
+	if (s == end)
+		return valid;
+	// ASCII stays the same length, and nothing else grows by more than 3 times
+	size_t pos = out.size();
+	out.resize(pos + (end - s) + 2 * count_high(s, end));
+	char* last = change_case(s, end, &out[pos], target, mapping, valid);
+	out.resize(last - &out[0]);
+	return valid;
+}
+
+size_t to_lower(const char* s, const char* end, char* out, case_mapping mapping)
+{
+	bool valid = true;
+	return change_case(s, end, out, case_to_lower, mapping, valid) - out;
+}
+
+size_t to_upper(const char* s, const char* end, char* out, case_mapping mapping)
+{
+	bool valid = true;
+	return change_case(s, end, out, case_to_upper, mapping, valid) - out;
+}
+
+size_t fold_case(const char* s, const char* end, char* out, case_mapping mapping)
+{
+	bool valid = true;
+	return change_case(s, end, out, case_to_fold, mapping, valid) - out;
+}
+
+bool to_lower(std::string& out, const char* s, const char* end, case_mapping mapping)
+{
+	return change_case(out, s, end, case_to_lower, mapping);
+}
+
+bool to_upper(std::string& out, const char* s, const char* end, case_mapping mapping)
+{
+	return change_case(out, s, end, case_to_upper, mapping);
+}
+
+bool fold_case(std::string& out, const char* s, const char* end, case_mapping mapping)
+{
+	return change_case(out, s, end, case_to_fold, mapping);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+struct norm_record
+{
+	uint8_t CCC; // canonical combining class
+	uint8_t QC;  // 2 bits of quick check for each form, in the order of enum normalization_form
+};
+
+struct composition
+{
+	uint32_t First;
+	uint32_t Second;
+	uint32_t Composite;
+};
+
+// Normalization data of the Unicode Character Database 14.0, generated from UnicodeData.txt,
+// DerivedNormalizationProps.txt and CompositionExclusions.txt. Each code point finds its
+// combining class and quick checks through two stages of blocks of 64. The decompositions and
+// compositions are only looked up for code points that fail the quick check.
+static const int norm_shift = 6;
+static const int norm_max   = 0x2fa1d; // the last code point that has a record
+
+// The bytes above ASCII that only start code points that are Yes, with a combining class of 0,
+// and the continuation bytes, for each form in the order of enum normalization_form. The byte
+// b is bit (b & 7) of byte ((b >> 3) & 15).
+static const uint8_t norm_simple_bytes[4][16] = {
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x8f, 0x3b, 0x44, 0xf0, 0x7b, 0x1e, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x0e, 0x30, 0x44, 0xf0, 0x43, 0x1e, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x3b, 0x44, 0xf0, 0x7b, 0x1e, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x30, 0x44, 0xf0, 0x43, 0x1e, 0x00},
+};
+
+static const norm_record norm_records[69] = {
+    {0, 0x00}, {0, 0x22}, {0, 0x44}, {0, 0x50}, {0, 0x54}, {0, 0x55}, {1, 0x00}, {1, 0x22},
+    {6, 0x00}, {7, 0x00}, {7, 0x22}, {8, 0x22}, {9, 0x00}, {9, 0x22}, {10, 0x00}, {11, 0x00},
+    {12, 0x00}, {13, 0x00}, {14, 0x00}, {15, 0x00}, {16, 0x00}, {17, 0x00}, {18, 0x00}, {19, 0x00},
+    {20, 0x00}, {21, 0x00}, {22, 0x00}, {23, 0x00}, {24, 0x00}, {25, 0x00}, {26, 0x00}, {27, 0x00},
+    {28, 0x00}, {29, 0x00}, {30, 0x00}, {31, 0x00}, {32, 0x00}, {33, 0x00}, {34, 0x00}, {35, 0x00},
+    {36, 0x00}, {84, 0x00}, {91, 0x22}, {103, 0x00}, {107, 0x00}, {118, 0x00}, {122, 0x00}, {129, 0x00},
+    {130, 0x00}, {132, 0x00}, {202, 0x00}, {202, 0x22}, {214, 0x00}, {216, 0x00}, {216, 0x22}, {218, 0x00},
+    {220, 0x00}, {220, 0x22}, {222, 0x00}, {224, 0x00}, {226, 0x00}, {228, 0x00}, {230, 0x00}, {230, 0x22},
+    {230, 0x55}, {232, 0x00}, {233, 0x00}, {234, 0x00}, {240, 0x22},
+};
+
+// The block of norm_blocks for each group of 64 code points, up to norm_max
+static const uint8_t norm_stage1[3049] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 0, 0, 18, 19, 20, 21, 0, 22, 23, 24, 0, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40,
+    36, 41, 36, 42, 43, 40, 0, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 0, 54, 55, 0, 56, 57, 58, 0, 0, 0, 0, 0, 59, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61,
+    0, 0, 62, 0, 63, 0, 0, 0, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 0, 0, 73, 74, 75, 76, 77, 78, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0, 0, 0,
+    0, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 101, 102, 0, 103, 0, 0, 0, 0,
+    0, 104, 0, 105, 0, 106, 0, 107, 0, 0, 108, 109, 99, 99, 99, 110,
+    111, 112, 113, 114, 115, 99, 116, 0, 117, 118, 99, 99, 99, 99, 99, 99,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 0, 122, 0, 123,
+    124, 0, 0, 125, 126, 127, 128, 129, 0, 0, 130, 131, 0, 132, 0, 133,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 134, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 135, 135, 135, 135, 136, 137, 135, 138, 139, 140, 141, 142,
+    99, 99, 99, 99, 143, 144, 145, 146, 147, 148, 99, 149, 150, 99, 151, 152,
+    0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 154, 0, 155, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 158, 0, 0, 0, 0,
+    0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 160, 0, 0, 161, 162, 0,
+    0, 163, 164, 0, 165, 128, 0, 166, 167, 0, 0, 168, 169, 170, 0, 0,
+    0, 171, 172, 173, 0, 0, 174, 175, 176, 0, 177, 0, 178, 0, 0, 0,
+    179, 0, 0, 0, 180, 181, 0, 182, 183, 184, 185, 0, 0, 0, 0, 0,
+    176, 0, 0, 0, 0, 186, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 193, 194, 0, 195, 0, 0, 0, 0, 0, 0,
+    99, 196, 197, 198, 199, 200, 99, 99, 99, 99, 201, 99, 99, 99, 99, 202,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    203, 0, 0, 0, 189, 0, 0, 0, 0, 0, 204, 205, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 206, 0, 207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 210, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 211, 212, 213, 0, 214, 215, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    135, 135, 135, 135, 135, 135, 135, 135, 217,
+};
+
+// The index into norm_records of each code point in a block
+static const uint8_t norm_blocks[218][64] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 3, 0, 0, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 3, 3, 3, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+        2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 3, 3, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 3,
+    },
+    {
+        3, 0, 0, 2, 2, 2, 2, 2, 2, 3, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+        2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+        0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        63, 63, 63, 63, 63, 62, 63, 63, 63, 63, 63, 63, 63, 62, 62, 63, 62, 63, 62, 63, 63, 65, 56, 56, 56, 56, 65, 54, 56, 56, 56, 56,
+        56, 50, 50, 57, 57, 57, 57, 51, 51, 56, 56, 56, 56, 57, 57, 56, 57, 57, 56, 56, 6, 6, 6, 6, 7, 56, 56, 56, 56, 62, 62, 62,
+    },
+    {
+        64, 64, 63, 64, 64, 68, 62, 56, 56, 56, 62, 62, 62, 56, 56, 0, 62, 62, 62, 56, 56, 56, 56, 62, 65, 56, 56, 62, 66, 67, 67, 66,
+        67, 67, 66, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 3, 0, 0, 0, 5, 0,
+    },
+    {
+        0, 0, 0, 0, 3, 4, 2, 5, 2, 2, 2, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 3, 3, 3, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+        0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 62, 62, 62, 62, 56, 62, 62, 62, 58, 56, 62, 62, 62, 62,
+        62, 62, 56, 56, 56, 56, 56, 56, 62, 62, 56, 62, 62, 58, 61, 62, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 23, 24, 25, 26, 0, 27,
+    },
+    {
+        0, 28, 29, 0, 62, 56, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 34, 35, 36, 0, 0, 0, 0, 0,
+        0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 32, 33, 34, 35, 36, 37, 38, 63, 63, 57, 56, 62, 62, 62, 62, 62, 56, 62, 62, 56,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 62, 62, 62, 62, 62, 62, 62, 0, 0, 62,
+        62, 62, 62, 56, 62, 0, 0, 62, 62, 0, 56, 62, 62, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 56, 62, 62, 56, 62, 62, 56, 56, 56, 62, 56, 56, 62, 56, 62,
+    },
+    {
+        62, 62, 56, 62, 56, 62, 56, 62, 56, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 56, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 0, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 0, 62, 62, 62, 0, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 56, 56, 56, 62, 62, 62, 62,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 56, 56, 56, 56, 56, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 0, 56, 62, 62, 56, 62, 62, 56, 62, 62, 62, 56, 56, 56, 31, 32, 33, 62, 62, 62, 56, 62, 62, 56, 56, 62, 62, 62, 62, 62,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 62, 56, 62, 62, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 5, 5, 0, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 0, 0, 5, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 12, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 5, 5, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 0, 1, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 12, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 43, 43, 12, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 45, 45, 12, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 46, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 56, 0, 53, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 47, 48, 5, 49, 5, 5, 3, 5, 3, 48, 48, 48, 48, 0, 0,
+    },
+    {
+        48, 5, 62, 62, 12, 0, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+        0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 12, 12, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 62, 56, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 56, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 56,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 56, 56, 56, 56, 56, 56, 62, 62, 56, 0, 56,
+    },
+    {
+        56, 62, 62, 56, 56, 62, 62, 62, 62, 62, 56, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+    },
+    {
+        2, 2, 0, 2, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 56, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 0, 6, 56, 56, 56, 56, 56, 62, 62, 56, 56, 56, 56,
+        62, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        62, 62, 56, 62, 62, 62, 62, 62, 62, 62, 56, 62, 62, 67, 52, 56, 50, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 65, 61, 61, 56, 55, 62, 66, 56, 62, 56,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 0, 0, 0, 0,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 2, 5, 0, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 5, 2, 3, 5, 3,
+    },
+    {
+        3, 4, 2, 2, 2, 0, 2, 2, 2, 5, 2, 5, 2, 4, 4, 4, 2, 2, 2, 5, 0, 0, 2, 2, 2, 2, 2, 5, 0, 4, 4, 4,
+        2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 5, 2, 4, 5, 5, 0, 0, 2, 2, 2, 0, 2, 2, 2, 5, 2, 5, 2, 5, 3, 0,
+    },
+    {
+        5, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 0, 3, 3, 0, 0, 0, 0, 3, 0, 3, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 6, 6, 62, 62, 62, 62, 6, 6, 6, 62, 62, 0, 0, 0,
+        0, 62, 0, 0, 0, 6, 6, 62, 56, 62, 6, 6, 56, 56, 56, 56, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0,
+        3, 3, 3, 0, 3, 0, 5, 0, 3, 0, 5, 5, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 3, 3, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 2, 0, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 61, 65, 58, 59, 59, 0, 0, 0, 0, 0, 0, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+        2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 11, 11, 3, 3, 0, 2, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    },
+    {
+        2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 3,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 62, 62,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 62, 62, 56, 0, 0, 62, 62, 0, 0, 0, 0, 0, 62, 62,
+    },
+    {
+        0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    },
+    {
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 0, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+        5, 0, 5, 0, 0, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    },
+    {
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    },
+    {
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 5, 30, 5,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 0,
+    },
+    {
+        5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+        62, 62, 62, 62, 62, 62, 62, 56, 56, 56, 56, 56, 56, 56, 62, 62, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+    },
+    {
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    },
+    {
+        0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 6, 56, 0, 0, 0, 0, 12,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 62, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 56, 56, 62, 62, 62, 56, 62, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 62, 56, 62, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 10, 0, 0, 0, 0, 0,
+    },
+    {
+        62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 12, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 1, 2, 0,
+    },
+    {
+        0, 0, 12, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 12,
+    },
+    {
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 9, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 12, 12, 0,
+    },
+    {
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 9, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+        5, 5, 5, 5, 5, 53, 53, 6, 6, 6, 0, 0, 0, 60, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56,
+    },
+    {
+        56, 56, 56, 0, 0, 62, 62, 62, 62, 62, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    },
+    {
+        5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+        0, 0, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 0, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        62, 62, 62, 62, 62, 62, 62, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 62, 62, 62, 62, 62,
+        62, 62, 0, 62, 62, 0, 62, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        0, 3, 3, 0, 3, 0, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 3, 0, 3, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 3, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 3, 3, 0, 3, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+        0, 3, 3, 0, 3, 0, 0, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 3, 3, 3, 3, 0, 3, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+// The code points that have a canonical decomposition, which is already fully decomposed, and
+// is in canonical order
+static const uint32_t canonical_keys[2061] = {
+    0x000c0, 0x000c1, 0x000c2, 0x000c3, 0x000c4, 0x000c5, 0x000c7, 0x000c8, 0x000c9, 0x000ca, 0x000cb, 0x000cc,
+    0x000cd, 0x000ce, 0x000cf, 0x000d1, 0x000d2, 0x000d3, 0x000d4, 0x000d5, 0x000d6, 0x000d9, 0x000da, 0x000db,
+    0x000dc, 0x000dd, 0x000e0, 0x000e1, 0x000e2, 0x000e3, 0x000e4, 0x000e5, 0x000e7, 0x000e8, 0x000e9, 0x000ea,
+    0x000eb, 0x000ec, 0x000ed, 0x000ee, 0x000ef, 0x000f1, 0x000f2, 0x000f3, 0x000f4, 0x000f5, 0x000f6, 0x000f9,
+    0x000fa, 0x000fb, 0x000fc, 0x000fd, 0x000ff, 0x00100, 0x00101, 0x00102, 0x00103, 0x00104, 0x00105, 0x00106,
+    0x00107, 0x00108, 0x00109, 0x0010a, 0x0010b, 0x0010c, 0x0010d, 0x0010e, 0x0010f, 0x00112, 0x00113, 0x00114,
+    0x00115, 0x00116, 0x00117, 0x00118, 0x00119, 0x0011a, 0x0011b, 0x0011c, 0x0011d, 0x0011e, 0x0011f, 0x00120,
+    0x00121, 0x00122, 0x00123, 0x00124, 0x00125, 0x00128, 0x00129, 0x0012a, 0x0012b, 0x0012c, 0x0012d, 0x0012e,
+    0x0012f, 0x00130, 0x00134, 0x00135, 0x00136, 0x00137, 0x00139, 0x0013a, 0x0013b, 0x0013c, 0x0013d, 0x0013e,
+    0x00143, 0x00144, 0x00145, 0x00146, 0x00147, 0x00148, 0x0014c, 0x0014d, 0x0014e, 0x0014f, 0x00150, 0x00151,
+    0x00154, 0x00155, 0x00156, 0x00157, 0x00158, 0x00159, 0x0015a, 0x0015b, 0x0015c, 0x0015d, 0x0015e, 0x0015f,
+    0x00160, 0x00161, 0x00162, 0x00163, 0x00164, 0x00165, 0x00168, 0x00169, 0x0016a, 0x0016b, 0x0016c, 0x0016d,
+    0x0016e, 0x0016f, 0x00170, 0x00171, 0x00172, 0x00173, 0x00174, 0x00175, 0x00176, 0x00177, 0x00178, 0x00179,
+    0x0017a, 0x0017b, 0x0017c, 0x0017d, 0x0017e, 0x001a0, 0x001a1, 0x001af, 0x001b0, 0x001cd, 0x001ce, 0x001cf,
+    0x001d0, 0x001d1, 0x001d2, 0x001d3, 0x001d4, 0x001d5, 0x001d6, 0x001d7, 0x001d8, 0x001d9, 0x001da, 0x001db,
+    0x001dc, 0x001de, 0x001df, 0x001e0, 0x001e1, 0x001e2, 0x001e3, 0x001e6, 0x001e7, 0x001e8, 0x001e9, 0x001ea,
+    0x001eb, 0x001ec, 0x001ed, 0x001ee, 0x001ef, 0x001f0, 0x001f4, 0x001f5, 0x001f8, 0x001f9, 0x001fa, 0x001fb,
+    0x001fc, 0x001fd, 0x001fe, 0x001ff, 0x00200, 0x00201, 0x00202, 0x00203, 0x00204, 0x00205, 0x00206, 0x00207,
+    0x00208, 0x00209, 0x0020a, 0x0020b, 0x0020c, 0x0020d, 0x0020e, 0x0020f, 0x00210, 0x00211, 0x00212, 0x00213,
+    0x00214, 0x00215, 0x00216, 0x00217, 0x00218, 0x00219, 0x0021a, 0x0021b, 0x0021e, 0x0021f, 0x00226, 0x00227,
+    0x00228, 0x00229, 0x0022a, 0x0022b, 0x0022c, 0x0022d, 0x0022e, 0x0022f, 0x00230, 0x00231, 0x00232, 0x00233,
+    0x00340, 0x00341, 0x00343, 0x00344, 0x00374, 0x0037e, 0x00385, 0x00386, 0x00387, 0x00388, 0x00389, 0x0038a,
+    0x0038c, 0x0038e, 0x0038f, 0x00390, 0x003aa, 0x003ab, 0x003ac, 0x003ad, 0x003ae, 0x003af, 0x003b0, 0x003ca,
+    0x003cb, 0x003cc, 0x003cd, 0x003ce, 0x003d3, 0x003d4, 0x00400, 0x00401, 0x00403, 0x00407, 0x0040c, 0x0040d,
+    0x0040e, 0x00419, 0x00439, 0x00450, 0x00451, 0x00453, 0x00457, 0x0045c, 0x0045d, 0x0045e, 0x00476, 0x00477,
+    0x004c1, 0x004c2, 0x004d0, 0x004d1, 0x004d2, 0x004d3, 0x004d6, 0x004d7, 0x004da, 0x004db, 0x004dc, 0x004dd,
+    0x004de, 0x004df, 0x004e2, 0x004e3, 0x004e4, 0x004e5, 0x004e6, 0x004e7, 0x004ea, 0x004eb, 0x004ec, 0x004ed,
+    0x004ee, 0x004ef, 0x004f0, 0x004f1, 0x004f2, 0x004f3, 0x004f4, 0x004f5, 0x004f8, 0x004f9, 0x00622, 0x00623,
+    0x00624, 0x00625, 0x00626, 0x006c0, 0x006c2, 0x006d3, 0x00929, 0x00931, 0x00934, 0x00958, 0x00959, 0x0095a,
+    0x0095b, 0x0095c, 0x0095d, 0x0095e, 0x0095f, 0x009cb, 0x009cc, 0x009dc, 0x009dd, 0x009df, 0x00a33, 0x00a36,
+    0x00a59, 0x00a5a, 0x00a5b, 0x00a5e, 0x00b48, 0x00b4b, 0x00b4c, 0x00b5c, 0x00b5d, 0x00b94, 0x00bca, 0x00bcb,
+    0x00bcc, 0x00c48, 0x00cc0, 0x00cc7, 0x00cc8, 0x00cca, 0x00ccb, 0x00d4a, 0x00d4b, 0x00d4c, 0x00dda, 0x00ddc,
+    0x00ddd, 0x00dde, 0x00f43, 0x00f4d, 0x00f52, 0x00f57, 0x00f5c, 0x00f69, 0x00f73, 0x00f75, 0x00f76, 0x00f78,
+    0x00f81, 0x00f93, 0x00f9d, 0x00fa2, 0x00fa7, 0x00fac, 0x00fb9, 0x01026, 0x01b06, 0x01b08, 0x01b0a, 0x01b0c,
+    0x01b0e, 0x01b12, 0x01b3b, 0x01b3d, 0x01b40, 0x01b41, 0x01b43, 0x01e00, 0x01e01, 0x01e02, 0x01e03, 0x01e04,
+    0x01e05, 0x01e06, 0x01e07, 0x01e08, 0x01e09, 0x01e0a, 0x01e0b, 0x01e0c, 0x01e0d, 0x01e0e, 0x01e0f, 0x01e10,
+    0x01e11, 0x01e12, 0x01e13, 0x01e14, 0x01e15, 0x01e16, 0x01e17, 0x01e18, 0x01e19, 0x01e1a, 0x01e1b, 0x01e1c,
+    0x01e1d, 0x01e1e, 0x01e1f, 0x01e20, 0x01e21, 0x01e22, 0x01e23, 0x01e24, 0x01e25, 0x01e26, 0x01e27, 0x01e28,
+    0x01e29, 0x01e2a, 0x01e2b, 0x01e2c, 0x01e2d, 0x01e2e, 0x01e2f, 0x01e30, 0x01e31, 0x01e32, 0x01e33, 0x01e34,
+    0x01e35, 0x01e36, 0x01e37, 0x01e38, 0x01e39, 0x01e3a, 0x01e3b, 0x01e3c, 0x01e3d, 0x01e3e, 0x01e3f, 0x01e40,
+    0x01e41, 0x01e42, 0x01e43, 0x01e44, 0x01e45, 0x01e46, 0x01e47, 0x01e48, 0x01e49, 0x01e4a, 0x01e4b, 0x01e4c,
+    0x01e4d, 0x01e4e, 0x01e4f, 0x01e50, 0x01e51, 0x01e52, 0x01e53, 0x01e54, 0x01e55, 0x01e56, 0x01e57, 0x01e58,
+    0x01e59, 0x01e5a, 0x01e5b, 0x01e5c, 0x01e5d, 0x01e5e, 0x01e5f, 0x01e60, 0x01e61, 0x01e62, 0x01e63, 0x01e64,
+    0x01e65, 0x01e66, 0x01e67, 0x01e68, 0x01e69, 0x01e6a, 0x01e6b, 0x01e6c, 0x01e6d, 0x01e6e, 0x01e6f, 0x01e70,
+    0x01e71, 0x01e72, 0x01e73, 0x01e74, 0x01e75, 0x01e76, 0x01e77, 0x01e78, 0x01e79, 0x01e7a, 0x01e7b, 0x01e7c,
+    0x01e7d, 0x01e7e, 0x01e7f, 0x01e80, 0x01e81, 0x01e82, 0x01e83, 0x01e84, 0x01e85, 0x01e86, 0x01e87, 0x01e88,
+    0x01e89, 0x01e8a, 0x01e8b, 0x01e8c, 0x01e8d, 0x01e8e, 0x01e8f, 0x01e90, 0x01e91, 0x01e92, 0x01e93, 0x01e94,
+    0x01e95, 0x01e96, 0x01e97, 0x01e98, 0x01e99, 0x01e9b, 0x01ea0, 0x01ea1, 0x01ea2, 0x01ea3, 0x01ea4, 0x01ea5,
+    0x01ea6, 0x01ea7, 0x01ea8, 0x01ea9, 0x01eaa, 0x01eab, 0x01eac, 0x01ead, 0x01eae, 0x01eaf, 0x01eb0, 0x01eb1,
+    0x01eb2, 0x01eb3, 0x01eb4, 0x01eb5, 0x01eb6, 0x01eb7, 0x01eb8, 0x01eb9, 0x01eba, 0x01ebb, 0x01ebc, 0x01ebd,
+    0x01ebe, 0x01ebf, 0x01ec0, 0x01ec1, 0x01ec2, 0x01ec3, 0x01ec4, 0x01ec5, 0x01ec6, 0x01ec7, 0x01ec8, 0x01ec9,
+    0x01eca, 0x01ecb, 0x01ecc, 0x01ecd, 0x01ece, 0x01ecf, 0x01ed0, 0x01ed1, 0x01ed2, 0x01ed3, 0x01ed4, 0x01ed5,
+    0x01ed6, 0x01ed7, 0x01ed8, 0x01ed9, 0x01eda, 0x01edb, 0x01edc, 0x01edd, 0x01ede, 0x01edf, 0x01ee0, 0x01ee1,
+    0x01ee2, 0x01ee3, 0x01ee4, 0x01ee5, 0x01ee6, 0x01ee7, 0x01ee8, 0x01ee9, 0x01eea, 0x01eeb, 0x01eec, 0x01eed,
+    0x01eee, 0x01eef, 0x01ef0, 0x01ef1, 0x01ef2, 0x01ef3, 0x01ef4, 0x01ef5, 0x01ef6, 0x01ef7, 0x01ef8, 0x01ef9,
+    0x01f00, 0x01f01, 0x01f02, 0x01f03, 0x01f04, 0x01f05, 0x01f06, 0x01f07, 0x01f08, 0x01f09, 0x01f0a, 0x01f0b,
+    0x01f0c, 0x01f0d, 0x01f0e, 0x01f0f, 0x01f10, 0x01f11, 0x01f12, 0x01f13, 0x01f14, 0x01f15, 0x01f18, 0x01f19,
+    0x01f1a, 0x01f1b, 0x01f1c, 0x01f1d, 0x01f20, 0x01f21, 0x01f22, 0x01f23, 0x01f24, 0x01f25, 0x01f26, 0x01f27,
+    0x01f28, 0x01f29, 0x01f2a, 0x01f2b, 0x01f2c, 0x01f2d, 0x01f2e, 0x01f2f, 0x01f30, 0x01f31, 0x01f32, 0x01f33,
+    0x01f34, 0x01f35, 0x01f36, 0x01f37, 0x01f38, 0x01f39, 0x01f3a, 0x01f3b, 0x01f3c, 0x01f3d, 0x01f3e, 0x01f3f,
+    0x01f40, 0x01f41, 0x01f42, 0x01f43, 0x01f44, 0x01f45, 0x01f48, 0x01f49, 0x01f4a, 0x01f4b, 0x01f4c, 0x01f4d,
+    0x01f50, 0x01f51, 0x01f52, 0x01f53, 0x01f54, 0x01f55, 0x01f56, 0x01f57, 0x01f59, 0x01f5b, 0x01f5d, 0x01f5f,
+    0x01f60, 0x01f61, 0x01f62, 0x01f63, 0x01f64, 0x01f65, 0x01f66, 0x01f67, 0x01f68, 0x01f69, 0x01f6a, 0x01f6b,
+    0x01f6c, 0x01f6d, 0x01f6e, 0x01f6f, 0x01f70, 0x01f71, 0x01f72, 0x01f73, 0x01f74, 0x01f75, 0x01f76, 0x01f77,
+    0x01f78, 0x01f79, 0x01f7a, 0x01f7b, 0x01f7c, 0x01f7d, 0x01f80, 0x01f81, 0x01f82, 0x01f83, 0x01f84, 0x01f85,
+    0x01f86, 0x01f87, 0x01f88, 0x01f89, 0x01f8a, 0x01f8b, 0x01f8c, 0x01f8d, 0x01f8e, 0x01f8f, 0x01f90, 0x01f91,
+    0x01f92, 0x01f93, 0x01f94, 0x01f95, 0x01f96, 0x01f97, 0x01f98, 0x01f99, 0x01f9a, 0x01f9b, 0x01f9c, 0x01f9d,
+    0x01f9e, 0x01f9f, 0x01fa0, 0x01fa1, 0x01fa2, 0x01fa3, 0x01fa4, 0x01fa5, 0x01fa6, 0x01fa7, 0x01fa8, 0x01fa9,
+    0x01faa, 0x01fab, 0x01fac, 0x01fad, 0x01fae, 0x01faf, 0x01fb0, 0x01fb1, 0x01fb2, 0x01fb3, 0x01fb4, 0x01fb6,
+    0x01fb7, 0x01fb8, 0x01fb9, 0x01fba, 0x01fbb, 0x01fbc, 0x01fbe, 0x01fc1, 0x01fc2, 0x01fc3, 0x01fc4, 0x01fc6,
+    0x01fc7, 0x01fc8, 0x01fc9, 0x01fca, 0x01fcb, 0x01fcc, 0x01fcd, 0x01fce, 0x01fcf, 0x01fd0, 0x01fd1, 0x01fd2,
+    0x01fd3, 0x01fd6, 0x01fd7, 0x01fd8, 0x01fd9, 0x01fda, 0x01fdb, 0x01fdd, 0x01fde, 0x01fdf, 0x01fe0, 0x01fe1,
+    0x01fe2, 0x01fe3, 0x01fe4, 0x01fe5, 0x01fe6, 0x01fe7, 0x01fe8, 0x01fe9, 0x01fea, 0x01feb, 0x01fec, 0x01fed,
+    0x01fee, 0x01fef, 0x01ff2, 0x01ff3, 0x01ff4, 0x01ff6, 0x01ff7, 0x01ff8, 0x01ff9, 0x01ffa, 0x01ffb, 0x01ffc,
+    0x01ffd, 0x02000, 0x02001, 0x02126, 0x0212a, 0x0212b, 0x0219a, 0x0219b, 0x021ae, 0x021cd, 0x021ce, 0x021cf,
+    0x02204, 0x02209, 0x0220c, 0x02224, 0x02226, 0x02241, 0x02244, 0x02247, 0x02249, 0x02260, 0x02262, 0x0226d,
+    0x0226e, 0x0226f, 0x02270, 0x02271, 0x02274, 0x02275, 0x02278, 0x02279, 0x02280, 0x02281, 0x02284, 0x02285,
+    0x02288, 0x02289, 0x022ac, 0x022ad, 0x022ae, 0x022af, 0x022e0, 0x022e1, 0x022e2, 0x022e3, 0x022ea, 0x022eb,
+    0x022ec, 0x022ed, 0x02329, 0x0232a, 0x02adc, 0x0304c, 0x0304e, 0x03050, 0x03052, 0x03054, 0x03056, 0x03058,
+    0x0305a, 0x0305c, 0x0305e, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071, 0x03073, 0x03074,
+    0x03076, 0x03077, 0x03079, 0x0307a, 0x0307c, 0x0307d, 0x03094, 0x0309e, 0x030ac, 0x030ae, 0x030b0, 0x030b2,
+    0x030b4, 0x030b6, 0x030b8, 0x030ba, 0x030bc, 0x030be, 0x030c0, 0x030c2, 0x030c5, 0x030c7, 0x030c9, 0x030d0,
+    0x030d1, 0x030d3, 0x030d4, 0x030d6, 0x030d7, 0x030d9, 0x030da, 0x030dc, 0x030dd, 0x030f4, 0x030f7, 0x030f8,
+    0x030f9, 0x030fa, 0x030fe, 0x0f900, 0x0f901, 0x0f902, 0x0f903, 0x0f904, 0x0f905, 0x0f906, 0x0f907, 0x0f908,
+    0x0f909, 0x0f90a, 0x0f90b, 0x0f90c, 0x0f90d, 0x0f90e, 0x0f90f, 0x0f910, 0x0f911, 0x0f912, 0x0f913, 0x0f914,
+    0x0f915, 0x0f916, 0x0f917, 0x0f918, 0x0f919, 0x0f91a, 0x0f91b, 0x0f91c, 0x0f91d, 0x0f91e, 0x0f91f, 0x0f920,
+    0x0f921, 0x0f922, 0x0f923, 0x0f924, 0x0f925, 0x0f926, 0x0f927, 0x0f928, 0x0f929, 0x0f92a, 0x0f92b, 0x0f92c,
+    0x0f92d, 0x0f92e, 0x0f92f, 0x0f930, 0x0f931, 0x0f932, 0x0f933, 0x0f934, 0x0f935, 0x0f936, 0x0f937, 0x0f938,
+    0x0f939, 0x0f93a, 0x0f93b, 0x0f93c, 0x0f93d, 0x0f93e, 0x0f93f, 0x0f940, 0x0f941, 0x0f942, 0x0f943, 0x0f944,
+    0x0f945, 0x0f946, 0x0f947, 0x0f948, 0x0f949, 0x0f94a, 0x0f94b, 0x0f94c, 0x0f94d, 0x0f94e, 0x0f94f, 0x0f950,
+    0x0f951, 0x0f952, 0x0f953, 0x0f954, 0x0f955, 0x0f956, 0x0f957, 0x0f958, 0x0f959, 0x0f95a, 0x0f95b, 0x0f95c,
+    0x0f95d, 0x0f95e, 0x0f95f, 0x0f960, 0x0f961, 0x0f962, 0x0f963, 0x0f964, 0x0f965, 0x0f966, 0x0f967, 0x0f968,
+    0x0f969, 0x0f96a, 0x0f96b, 0x0f96c, 0x0f96d, 0x0f96e, 0x0f96f, 0x0f970, 0x0f971, 0x0f972, 0x0f973, 0x0f974,
+    0x0f975, 0x0f976, 0x0f977, 0x0f978, 0x0f979, 0x0f97a, 0x0f97b, 0x0f97c, 0x0f97d, 0x0f97e, 0x0f97f, 0x0f980,
+    0x0f981, 0x0f982, 0x0f983, 0x0f984, 0x0f985, 0x0f986, 0x0f987, 0x0f988, 0x0f989, 0x0f98a, 0x0f98b, 0x0f98c,
+    0x0f98d, 0x0f98e, 0x0f98f, 0x0f990, 0x0f991, 0x0f992, 0x0f993, 0x0f994, 0x0f995, 0x0f996, 0x0f997, 0x0f998,
+    0x0f999, 0x0f99a, 0x0f99b, 0x0f99c, 0x0f99d, 0x0f99e, 0x0f99f, 0x0f9a0, 0x0f9a1, 0x0f9a2, 0x0f9a3, 0x0f9a4,
+    0x0f9a5, 0x0f9a6, 0x0f9a7, 0x0f9a8, 0x0f9a9, 0x0f9aa, 0x0f9ab, 0x0f9ac, 0x0f9ad, 0x0f9ae, 0x0f9af, 0x0f9b0,
+    0x0f9b1, 0x0f9b2, 0x0f9b3, 0x0f9b4, 0x0f9b5, 0x0f9b6, 0x0f9b7, 0x0f9b8, 0x0f9b9, 0x0f9ba, 0x0f9bb, 0x0f9bc,
+    0x0f9bd, 0x0f9be, 0x0f9bf, 0x0f9c0, 0x0f9c1, 0x0f9c2, 0x0f9c3, 0x0f9c4, 0x0f9c5, 0x0f9c6, 0x0f9c7, 0x0f9c8,
+    0x0f9c9, 0x0f9ca, 0x0f9cb, 0x0f9cc, 0x0f9cd, 0x0f9ce, 0x0f9cf, 0x0f9d0, 0x0f9d1, 0x0f9d2, 0x0f9d3, 0x0f9d4,
+    0x0f9d5, 0x0f9d6, 0x0f9d7, 0x0f9d8, 0x0f9d9, 0x0f9da, 0x0f9db, 0x0f9dc, 0x0f9dd, 0x0f9de, 0x0f9df, 0x0f9e0,
+    0x0f9e1, 0x0f9e2, 0x0f9e3, 0x0f9e4, 0x0f9e5, 0x0f9e6, 0x0f9e7, 0x0f9e8, 0x0f9e9, 0x0f9ea, 0x0f9eb, 0x0f9ec,
+    0x0f9ed, 0x0f9ee, 0x0f9ef, 0x0f9f0, 0x0f9f1, 0x0f9f2, 0x0f9f3, 0x0f9f4, 0x0f9f5, 0x0f9f6, 0x0f9f7, 0x0f9f8,
+    0x0f9f9, 0x0f9fa, 0x0f9fb, 0x0f9fc, 0x0f9fd, 0x0f9fe, 0x0f9ff, 0x0fa00, 0x0fa01, 0x0fa02, 0x0fa03, 0x0fa04,
+    0x0fa05, 0x0fa06, 0x0fa07, 0x0fa08, 0x0fa09, 0x0fa0a, 0x0fa0b, 0x0fa0c, 0x0fa0d, 0x0fa10, 0x0fa12, 0x0fa15,
+    0x0fa16, 0x0fa17, 0x0fa18, 0x0fa19, 0x0fa1a, 0x0fa1b, 0x0fa1c, 0x0fa1d, 0x0fa1e, 0x0fa20, 0x0fa22, 0x0fa25,
+    0x0fa26, 0x0fa2a, 0x0fa2b, 0x0fa2c, 0x0fa2d, 0x0fa2e, 0x0fa2f, 0x0fa30, 0x0fa31, 0x0fa32, 0x0fa33, 0x0fa34,
+    0x0fa35, 0x0fa36, 0x0fa37, 0x0fa38, 0x0fa39, 0x0fa3a, 0x0fa3b, 0x0fa3c, 0x0fa3d, 0x0fa3e, 0x0fa3f, 0x0fa40,
+    0x0fa41, 0x0fa42, 0x0fa43, 0x0fa44, 0x0fa45, 0x0fa46, 0x0fa47, 0x0fa48, 0x0fa49, 0x0fa4a, 0x0fa4b, 0x0fa4c,
+    0x0fa4d, 0x0fa4e, 0x0fa4f, 0x0fa50, 0x0fa51, 0x0fa52, 0x0fa53, 0x0fa54, 0x0fa55, 0x0fa56, 0x0fa57, 0x0fa58,
+    0x0fa59, 0x0fa5a, 0x0fa5b, 0x0fa5c, 0x0fa5d, 0x0fa5e, 0x0fa5f, 0x0fa60, 0x0fa61, 0x0fa62, 0x0fa63, 0x0fa64,
+    0x0fa65, 0x0fa66, 0x0fa67, 0x0fa68, 0x0fa69, 0x0fa6a, 0x0fa6b, 0x0fa6c, 0x0fa6d, 0x0fa70, 0x0fa71, 0x0fa72,
+    0x0fa73, 0x0fa74, 0x0fa75, 0x0fa76, 0x0fa77, 0x0fa78, 0x0fa79, 0x0fa7a, 0x0fa7b, 0x0fa7c, 0x0fa7d, 0x0fa7e,
+    0x0fa7f, 0x0fa80, 0x0fa81, 0x0fa82, 0x0fa83, 0x0fa84, 0x0fa85, 0x0fa86, 0x0fa87, 0x0fa88, 0x0fa89, 0x0fa8a,
+    0x0fa8b, 0x0fa8c, 0x0fa8d, 0x0fa8e, 0x0fa8f, 0x0fa90, 0x0fa91, 0x0fa92, 0x0fa93, 0x0fa94, 0x0fa95, 0x0fa96,
+    0x0fa97, 0x0fa98, 0x0fa99, 0x0fa9a, 0x0fa9b, 0x0fa9c, 0x0fa9d, 0x0fa9e, 0x0fa9f, 0x0faa0, 0x0faa1, 0x0faa2,
+    0x0faa3, 0x0faa4, 0x0faa5, 0x0faa6, 0x0faa7, 0x0faa8, 0x0faa9, 0x0faaa, 0x0faab, 0x0faac, 0x0faad, 0x0faae,
+    0x0faaf, 0x0fab0, 0x0fab1, 0x0fab2, 0x0fab3, 0x0fab4, 0x0fab5, 0x0fab6, 0x0fab7, 0x0fab8, 0x0fab9, 0x0faba,
+    0x0fabb, 0x0fabc, 0x0fabd, 0x0fabe, 0x0fabf, 0x0fac0, 0x0fac1, 0x0fac2, 0x0fac3, 0x0fac4, 0x0fac5, 0x0fac6,
+    0x0fac7, 0x0fac8, 0x0fac9, 0x0faca, 0x0facb, 0x0facc, 0x0facd, 0x0face, 0x0facf, 0x0fad0, 0x0fad1, 0x0fad2,
+    0x0fad3, 0x0fad4, 0x0fad5, 0x0fad6, 0x0fad7, 0x0fad8, 0x0fad9, 0x0fb1d, 0x0fb1f, 0x0fb2a, 0x0fb2b, 0x0fb2c,
+    0x0fb2d, 0x0fb2e, 0x0fb2f, 0x0fb30, 0x0fb31, 0x0fb32, 0x0fb33, 0x0fb34, 0x0fb35, 0x0fb36, 0x0fb38, 0x0fb39,
+    0x0fb3a, 0x0fb3b, 0x0fb3c, 0x0fb3e, 0x0fb40, 0x0fb41, 0x0fb43, 0x0fb44, 0x0fb46, 0x0fb47, 0x0fb48, 0x0fb49,
+    0x0fb4a, 0x0fb4b, 0x0fb4c, 0x0fb4d, 0x0fb4e, 0x1109a, 0x1109c, 0x110ab, 0x1112e, 0x1112f, 0x1134b, 0x1134c,
+    0x114bb, 0x114bc, 0x114be, 0x115ba, 0x115bb, 0x11938, 0x1d15e, 0x1d15f, 0x1d160, 0x1d161, 0x1d162, 0x1d163,
+    0x1d164, 0x1d1bb, 0x1d1bc, 0x1d1bd, 0x1d1be, 0x1d1bf, 0x1d1c0, 0x2f800, 0x2f801, 0x2f802, 0x2f803, 0x2f804,
+    0x2f805, 0x2f806, 0x2f807, 0x2f808, 0x2f809, 0x2f80a, 0x2f80b, 0x2f80c, 0x2f80d, 0x2f80e, 0x2f80f, 0x2f810,
+    0x2f811, 0x2f812, 0x2f813, 0x2f814, 0x2f815, 0x2f816, 0x2f817, 0x2f818, 0x2f819, 0x2f81a, 0x2f81b, 0x2f81c,
+    0x2f81d, 0x2f81e, 0x2f81f, 0x2f820, 0x2f821, 0x2f822, 0x2f823, 0x2f824, 0x2f825, 0x2f826, 0x2f827, 0x2f828,
+    0x2f829, 0x2f82a, 0x2f82b, 0x2f82c, 0x2f82d, 0x2f82e, 0x2f82f, 0x2f830, 0x2f831, 0x2f832, 0x2f833, 0x2f834,
+    0x2f835, 0x2f836, 0x2f837, 0x2f838, 0x2f839, 0x2f83a, 0x2f83b, 0x2f83c, 0x2f83d, 0x2f83e, 0x2f83f, 0x2f840,
+    0x2f841, 0x2f842, 0x2f843, 0x2f844, 0x2f845, 0x2f846, 0x2f847, 0x2f848, 0x2f849, 0x2f84a, 0x2f84b, 0x2f84c,
+    0x2f84d, 0x2f84e, 0x2f84f, 0x2f850, 0x2f851, 0x2f852, 0x2f853, 0x2f854, 0x2f855, 0x2f856, 0x2f857, 0x2f858,
+    0x2f859, 0x2f85a, 0x2f85b, 0x2f85c, 0x2f85d, 0x2f85e, 0x2f85f, 0x2f860, 0x2f861, 0x2f862, 0x2f863, 0x2f864,
+    0x2f865, 0x2f866, 0x2f867, 0x2f868, 0x2f869, 0x2f86a, 0x2f86b, 0x2f86c, 0x2f86d, 0x2f86e, 0x2f86f, 0x2f870,
+    0x2f871, 0x2f872, 0x2f873, 0x2f874, 0x2f875, 0x2f876, 0x2f877, 0x2f878, 0x2f879, 0x2f87a, 0x2f87b, 0x2f87c,
+    0x2f87d, 0x2f87e, 0x2f87f, 0x2f880, 0x2f881, 0x2f882, 0x2f883, 0x2f884, 0x2f885, 0x2f886, 0x2f887, 0x2f888,
+    0x2f889, 0x2f88a, 0x2f88b, 0x2f88c, 0x2f88d, 0x2f88e, 0x2f88f, 0x2f890, 0x2f891, 0x2f892, 0x2f893, 0x2f894,
+    0x2f895, 0x2f896, 0x2f897, 0x2f898, 0x2f899, 0x2f89a, 0x2f89b, 0x2f89c, 0x2f89d, 0x2f89e, 0x2f89f, 0x2f8a0,
+    0x2f8a1, 0x2f8a2, 0x2f8a3, 0x2f8a4, 0x2f8a5, 0x2f8a6, 0x2f8a7, 0x2f8a8, 0x2f8a9, 0x2f8aa, 0x2f8ab, 0x2f8ac,
+    0x2f8ad, 0x2f8ae, 0x2f8af, 0x2f8b0, 0x2f8b1, 0x2f8b2, 0x2f8b3, 0x2f8b4, 0x2f8b5, 0x2f8b6, 0x2f8b7, 0x2f8b8,
+    0x2f8b9, 0x2f8ba, 0x2f8bb, 0x2f8bc, 0x2f8bd, 0x2f8be, 0x2f8bf, 0x2f8c0, 0x2f8c1, 0x2f8c2, 0x2f8c3, 0x2f8c4,
+    0x2f8c5, 0x2f8c6, 0x2f8c7, 0x2f8c8, 0x2f8c9, 0x2f8ca, 0x2f8cb, 0x2f8cc, 0x2f8cd, 0x2f8ce, 0x2f8cf, 0x2f8d0,
+    0x2f8d1, 0x2f8d2, 0x2f8d3, 0x2f8d4, 0x2f8d5, 0x2f8d6, 0x2f8d7, 0x2f8d8, 0x2f8d9, 0x2f8da, 0x2f8db, 0x2f8dc,
+    0x2f8dd, 0x2f8de, 0x2f8df, 0x2f8e0, 0x2f8e1, 0x2f8e2, 0x2f8e3, 0x2f8e4, 0x2f8e5, 0x2f8e6, 0x2f8e7, 0x2f8e8,
+    0x2f8e9, 0x2f8ea, 0x2f8eb, 0x2f8ec, 0x2f8ed, 0x2f8ee, 0x2f8ef, 0x2f8f0, 0x2f8f1, 0x2f8f2, 0x2f8f3, 0x2f8f4,
+    0x2f8f5, 0x2f8f6, 0x2f8f7, 0x2f8f8, 0x2f8f9, 0x2f8fa, 0x2f8fb, 0x2f8fc, 0x2f8fd, 0x2f8fe, 0x2f8ff, 0x2f900,
+    0x2f901, 0x2f902, 0x2f903, 0x2f904, 0x2f905, 0x2f906, 0x2f907, 0x2f908, 0x2f909, 0x2f90a, 0x2f90b, 0x2f90c,
+    0x2f90d, 0x2f90e, 0x2f90f, 0x2f910, 0x2f911, 0x2f912, 0x2f913, 0x2f914, 0x2f915, 0x2f916, 0x2f917, 0x2f918,
+    0x2f919, 0x2f91a, 0x2f91b, 0x2f91c, 0x2f91d, 0x2f91e, 0x2f91f, 0x2f920, 0x2f921, 0x2f922, 0x2f923, 0x2f924,
+    0x2f925, 0x2f926, 0x2f927, 0x2f928, 0x2f929, 0x2f92a, 0x2f92b, 0x2f92c, 0x2f92d, 0x2f92e, 0x2f92f, 0x2f930,
+    0x2f931, 0x2f932, 0x2f933, 0x2f934, 0x2f935, 0x2f936, 0x2f937, 0x2f938, 0x2f939, 0x2f93a, 0x2f93b, 0x2f93c,
+    0x2f93d, 0x2f93e, 0x2f93f, 0x2f940, 0x2f941, 0x2f942, 0x2f943, 0x2f944, 0x2f945, 0x2f946, 0x2f947, 0x2f948,
+    0x2f949, 0x2f94a, 0x2f94b, 0x2f94c, 0x2f94d, 0x2f94e, 0x2f94f, 0x2f950, 0x2f951, 0x2f952, 0x2f953, 0x2f954,
+    0x2f955, 0x2f956, 0x2f957, 0x2f958, 0x2f959, 0x2f95a, 0x2f95b, 0x2f95c, 0x2f95d, 0x2f95e, 0x2f95f, 0x2f960,
+    0x2f961, 0x2f962, 0x2f963, 0x2f964, 0x2f965, 0x2f966, 0x2f967, 0x2f968, 0x2f969, 0x2f96a, 0x2f96b, 0x2f96c,
+    0x2f96d, 0x2f96e, 0x2f96f, 0x2f970, 0x2f971, 0x2f972, 0x2f973, 0x2f974, 0x2f975, 0x2f976, 0x2f977, 0x2f978,
+    0x2f979, 0x2f97a, 0x2f97b, 0x2f97c, 0x2f97d, 0x2f97e, 0x2f97f, 0x2f980, 0x2f981, 0x2f982, 0x2f983, 0x2f984,
+    0x2f985, 0x2f986, 0x2f987, 0x2f988, 0x2f989, 0x2f98a, 0x2f98b, 0x2f98c, 0x2f98d, 0x2f98e, 0x2f98f, 0x2f990,
+    0x2f991, 0x2f992, 0x2f993, 0x2f994, 0x2f995, 0x2f996, 0x2f997, 0x2f998, 0x2f999, 0x2f99a, 0x2f99b, 0x2f99c,
+    0x2f99d, 0x2f99e, 0x2f99f, 0x2f9a0, 0x2f9a1, 0x2f9a2, 0x2f9a3, 0x2f9a4, 0x2f9a5, 0x2f9a6, 0x2f9a7, 0x2f9a8,
+    0x2f9a9, 0x2f9aa, 0x2f9ab, 0x2f9ac, 0x2f9ad, 0x2f9ae, 0x2f9af, 0x2f9b0, 0x2f9b1, 0x2f9b2, 0x2f9b3, 0x2f9b4,
+    0x2f9b5, 0x2f9b6, 0x2f9b7, 0x2f9b8, 0x2f9b9, 0x2f9ba, 0x2f9bb, 0x2f9bc, 0x2f9bd, 0x2f9be, 0x2f9bf, 0x2f9c0,
+    0x2f9c1, 0x2f9c2, 0x2f9c3, 0x2f9c4, 0x2f9c5, 0x2f9c6, 0x2f9c7, 0x2f9c8, 0x2f9c9, 0x2f9ca, 0x2f9cb, 0x2f9cc,
+    0x2f9cd, 0x2f9ce, 0x2f9cf, 0x2f9d0, 0x2f9d1, 0x2f9d2, 0x2f9d3, 0x2f9d4, 0x2f9d5, 0x2f9d6, 0x2f9d7, 0x2f9d8,
+    0x2f9d9, 0x2f9da, 0x2f9db, 0x2f9dc, 0x2f9dd, 0x2f9de, 0x2f9df, 0x2f9e0, 0x2f9e1, 0x2f9e2, 0x2f9e3, 0x2f9e4,
+    0x2f9e5, 0x2f9e6, 0x2f9e7, 0x2f9e8, 0x2f9e9, 0x2f9ea, 0x2f9eb, 0x2f9ec, 0x2f9ed, 0x2f9ee, 0x2f9ef, 0x2f9f0,
+    0x2f9f1, 0x2f9f2, 0x2f9f3, 0x2f9f4, 0x2f9f5, 0x2f9f6, 0x2f9f7, 0x2f9f8, 0x2f9f9, 0x2f9fa, 0x2f9fb, 0x2f9fc,
+    0x2f9fd, 0x2f9fe, 0x2f9ff, 0x2fa00, 0x2fa01, 0x2fa02, 0x2fa03, 0x2fa04, 0x2fa05, 0x2fa06, 0x2fa07, 0x2fa08,
+    0x2fa09, 0x2fa0a, 0x2fa0b, 0x2fa0c, 0x2fa0d, 0x2fa0e, 0x2fa0f, 0x2fa10, 0x2fa11, 0x2fa12, 0x2fa13, 0x2fa14,
+    0x2fa15, 0x2fa16, 0x2fa17, 0x2fa18, 0x2fa19, 0x2fa1a, 0x2fa1b, 0x2fa1c, 0x2fa1d,
+};
+
+// Where the decomposition of each of canonical_keys starts in canonical_pool, and one more for the end
+static const uint16_t canonical_offsets[2062] = {
+        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,    20,    22,    24,    26,    28,    30,
+       32,    34,    36,    38,    40,    42,    44,    46,    48,    50,    52,    54,    56,    58,    60,    62,
+       64,    66,    68,    70,    72,    74,    76,    78,    80,    82,    84,    86,    88,    90,    92,    94,
+       96,    98,   100,   102,   104,   106,   108,   110,   112,   114,   116,   118,   120,   122,   124,   126,
+      128,   130,   132,   134,   136,   138,   140,   142,   144,   146,   148,   150,   152,   154,   156,   158,
+      160,   162,   164,   166,   168,   170,   172,   174,   176,   178,   180,   182,   184,   186,   188,   190,
+      192,   194,   196,   198,   200,   202,   204,   206,   208,   210,   212,   214,   216,   218,   220,   222,
+      224,   226,   228,   230,   232,   234,   236,   238,   240,   242,   244,   246,   248,   250,   252,   254,
+      256,   258,   260,   262,   264,   266,   268,   270,   272,   274,   276,   278,   280,   282,   284,   286,
+      288,   290,   292,   294,   296,   298,   300,   302,   304,   306,   308,   310,   312,   314,   316,   318,
+      320,   322,   324,   326,   328,   330,   332,   334,   336,   338,   340,   342,   344,   346,   349,   352,
+      355,   358,   361,   364,   367,   370,   373,   376,   379,   382,   384,   386,   388,   390,   392,   394,
+      396,   398,   401,   404,   406,   408,   410,   412,   414,   416,   418,   421,   424,   426,   428,   430,
+      432,   434,   436,   438,   440,   442,   444,   446,   448,   450,   452,   454,   456,   458,   460,   462,
+      464,   466,   468,   470,   472,   474,   476,   478,   480,   482,   484,   486,   488,   490,   492,   494,
+      496,   498,   500,   503,   506,   509,   512,   514,   516,   519,   522,   524,   526,   527,   528,   529,
+      531,   532,   533,   535,   537,   538,   540,   542,   544,   546,   548,   550,   553,   555,   557,   559,
+      561,   563,   565,   568,   570,   572,   574,   576,   578,   580,   582,   584,   586,   588,   590,   592,
+      594,   596,   598,   600,   602,   604,   606,   608,   610,   612,   614,   616,   618,   620,   622,   624,
+      626,   628,   630,   632,   634,   636,   638,   640,   642,   644,   646,   648,   650,   652,   654,   656,
+      658,   660,   662,   664,   666,   668,   670,   672,   674,   676,   678,   680,   682,   684,   686,   688,
+      690,   692,   694,   696,   698,   700,   702,   704,   706,   708,   710,   712,   714,   716,   718,   720,
+      722,   724,   726,   728,   730,   732,   734,   736,   738,   740,   742,   744,   746,   748,   750,   752,
+      754,   756,   758,   760,   762,   764,   766,   768,   770,   772,   774,   777,   779,   781,   783,   785,
+      787,   790,   792,   794,   796,   798,   800,   802,   804,   806,   808,   810,   812,   814,   816,   818,
+      820,   822,   824,   826,   828,   830,   832,   834,   836,   838,   840,   842,   844,   846,   848,   850,
+      852,   854,   856,   858,   860,   862,   864,   866,   869,   872,   874,   876,   878,   880,   882,   884,
+      886,   888,   890,   892,   895,   898,   901,   904,   906,   908,   910,   912,   915,   918,   920,   922,
+      924,   926,   928,   930,   932,   934,   936,   938,   940,   942,   944,   946,   948,   950,   953,   956,
+      958,   960,   962,   964,   966,   968,   970,   972,   975,   978,   980,   982,   984,   986,   988,   990,
+      992,   994,   996,   998,  1000,  1002,  1004,  1006,  1008,  1010,  1012,  1014,  1017,  1020,  1023,  1026,
+     1029,  1032,  1035,  1038,  1040,  1042,  1044,  1046,  1048,  1050,  1052,  1054,  1057,  1060,  1062,  1064,
+     1066,  1068,  1070,  1072,  1075,  1078,  1081,  1084,  1087,  1090,  1092,  1094,  1096,  1098,  1100,  1102,
+     1104,  1106,  1108,  1110,  1112,  1114,  1116,  1118,  1121,  1124,  1127,  1130,  1132,  1134,  1136,  1138,
+     1140,  1142,  1144,  1146,  1148,  1150,  1152,  1154,  1156,  1158,  1160,  1162,  1164,  1166,  1168,  1170,
+     1172,  1174,  1176,  1178,  1180,  1182,  1184,  1186,  1188,  1190,  1192,  1194,  1196,  1198,  1200,  1203,
+     1206,  1209,  1212,  1215,  1218,  1221,  1224,  1227,  1230,  1233,  1236,  1239,  1242,  1245,  1248,  1251,
+     1254,  1257,  1260,  1262,  1264,  1266,  1268,  1270,  1272,  1275,  1278,  1281,  1284,  1287,  1290,  1293,
+     1296,  1299,  1302,  1304,  1306,  1308,  1310,  1312,  1314,  1316,  1318,  1321,  1324,  1327,  1330,  1333,
+     1336,  1339,  1342,  1345,  1348,  1351,  1354,  1357,  1360,  1363,  1366,  1369,  1372,  1375,  1378,  1380,
+     1382,  1384,  1386,  1389,  1392,  1395,  1398,  1401,  1404,  1407,  1410,  1413,  1416,  1418,  1420,  1422,
+     1424,  1426,  1428,  1430,  1432,  1434,  1436,  1439,  1442,  1445,  1448,  1451,  1454,  1456,  1458,  1461,
+     1464,  1467,  1470,  1473,  1476,  1478,  1480,  1483,  1486,  1489,  1492,  1494,  1496,  1499,  1502,  1505,
+     1508,  1510,  1512,  1515,  1518,  1521,  1524,  1527,  1530,  1532,  1534,  1537,  1540,  1543,  1546,  1549,
+     1552,  1554,  1556,  1559,  1562,  1565,  1568,  1571,  1574,  1576,  1578,  1581,  1584,  1587,  1590,  1593,
+     1596,  1598,  1600,  1603,  1606,  1609,  1612,  1614,  1616,  1619,  1622,  1625,  1628,  1630,  1632,  1635,
+     1638,  1641,  1644,  1647,  1650,  1652,  1655,  1658,  1661,  1663,  1665,  1668,  1671,  1674,  1677,  1680,
+     1683,  1685,  1687,  1690,  1693,  1696,  1699,  1702,  1705,  1707,  1709,  1711,  1713,  1715,  1717,  1719,
+     1721,  1723,  1725,  1727,  1729,  1731,  1733,  1736,  1739,  1743,  1747,  1751,  1755,  1759,  1763,  1766,
+     1769,  1773,  1777,  1781,  1785,  1789,  1793,  1796,  1799,  1803,  1807,  1811,  1815,  1819,  1823,  1826,
+     1829,  1833,  1837,  1841,  1845,  1849,  1853,  1856,  1859,  1863,  1867,  1871,  1875,  1879,  1883,  1886,
+     1889,  1893,  1897,  1901,  1905,  1909,  1913,  1915,  1917,  1920,  1922,  1925,  1927,  1930,  1932,  1934,
+     1936,  1938,  1940,  1941,  1943,  1946,  1948,  1951,  1953,  1956,  1958,  1960,  1962,  1964,  1966,  1968,
+     1970,  1972,  1974,  1976,  1979,  1982,  1984,  1987,  1989,  1991,  1993,  1995,  1997,  1999,  2001,  2003,
+     2005,  2008,  2011,  2013,  2015,  2017,  2020,  2022,  2024,  2026,  2028,  2030,  2032,  2034,  2035,  2038,
+     2040,  2043,  2045,  2048,  2050,  2052,  2054,  2056,  2058,  2059,  2060,  2061,  2062,  2063,  2065,  2067,
+     2069,  2071,  2073,  2075,  2077,  2079,  2081,  2083,  2085,  2087,  2089,  2091,  2093,  2095,  2097,  2099,
+     2101,  2103,  2105,  2107,  2109,  2111,  2113,  2115,  2117,  2119,  2121,  2123,  2125,  2127,  2129,  2131,
+     2133,  2135,  2137,  2139,  2141,  2143,  2145,  2147,  2149,  2151,  2153,  2154,  2155,  2157,  2159,  2161,
+     2163,  2165,  2167,  2169,  2171,  2173,  2175,  2177,  2179,  2181,  2183,  2185,  2187,  2189,  2191,  2193,
+     2195,  2197,  2199,  2201,  2203,  2205,  2207,  2209,  2211,  2213,  2215,  2217,  2219,  2221,  2223,  2225,
+     2227,  2229,  2231,  2233,  2235,  2237,  2239,  2241,  2243,  2245,  2247,  2249,  2251,  2253,  2255,  2257,
+     2259,  2261,  2263,  2265,  2267,  2269,  2271,  2273,  2274,  2275,  2276,  2277,  2278,  2279,  2280,  2281,
+     2282,  2283,  2284,  2285,  2286,  2287,  2288,  2289,  2290,  2291,  2292,  2293,  2294,  2295,  2296,  2297,
+     2298,  2299,  2300,  2301,  2302,  2303,  2304,  2305,  2306,  2307,  2308,  2309,  2310,  2311,  2312,  2313,
+     2314,  2315,  2316,  2317,  2318,  2319,  2320,  2321,  2322,  2323,  2324,  2325,  2326,  2327,  2328,  2329,
+     2330,  2331,  2332,  2333,  2334,  2335,  2336,  2337,  2338,  2339,  2340,  2341,  2342,  2343,  2344,  2345,
+     2346,  2347,  2348,  2349,  2350,  2351,  2352,  2353,  2354,  2355,  2356,  2357,  2358,  2359,  2360,  2361,
+     2362,  2363,  2364,  2365,  2366,  2367,  2368,  2369,  2370,  2371,  2372,  2373,  2374,  2375,  2376,  2377,
+     2378,  2379,  2380,  2381,  2382,  2383,  2384,  2385,  2386,  2387,  2388,  2389,  2390,  2391,  2392,  2393,
+     2394,  2395,  2396,  2397,  2398,  2399,  2400,  2401,  2402,  2403,  2404,  2405,  2406,  2407,  2408,  2409,
+     2410,  2411,  2412,  2413,  2414,  2415,  2416,  2417,  2418,  2419,  2420,  2421,  2422,  2423,  2424,  2425,
+     2426,  2427,  2428,  2429,  2430,  2431,  2432,  2433,  2434,  2435,  2436,  2437,  2438,  2439,  2440,  2441,
+     2442,  2443,  2444,  2445,  2446,  2447,  2448,  2449,  2450,  2451,  2452,  2453,  2454,  2455,  2456,  2457,
+     2458,  2459,  2460,  2461,  2462,  2463,  2464,  2465,  2466,  2467,  2468,  2469,  2470,  2471,  2472,  2473,
+     2474,  2475,  2476,  2477,  2478,  2479,  2480,  2481,  2482,  2483,  2484,  2485,  2486,  2487,  2488,  2489,
+     2490,  2491,  2492,  2493,  2494,  2495,  2496,  2497,  2498,  2499,  2500,  2501,  2502,  2503,  2504,  2505,
+     2506,  2507,  2508,  2509,  2510,  2511,  2512,  2513,  2514,  2515,  2516,  2517,  2518,  2519,  2520,  2521,
+     2522,  2523,  2524,  2525,  2526,  2527,  2528,  2529,  2530,  2531,  2532,  2533,  2534,  2535,  2536,  2537,
+     2538,  2539,  2540,  2541,  2542,  2543,  2544,  2545,  2546,  2547,  2548,  2549,  2550,  2551,  2552,  2553,
+     2554,  2555,  2556,  2557,  2558,  2559,  2560,  2561,  2562,  2563,  2564,  2565,  2566,  2567,  2568,  2569,
+     2570,  2571,  2572,  2573,  2574,  2575,  2576,  2577,  2578,  2579,  2580,  2581,  2582,  2583,  2584,  2585,
+     2586,  2587,  2588,  2589,  2590,  2591,  2592,  2593,  2594,  2595,  2596,  2597,  2598,  2599,  2600,  2601,
+     2602,  2603,  2604,  2605,  2606,  2607,  2608,  2609,  2610,  2611,  2612,  2613,  2614,  2615,  2616,  2617,
+     2618,  2619,  2620,  2621,  2622,  2623,  2624,  2625,  2627,  2628,  2629,  2630,  2631,  2632,  2633,  2634,
+     2635,  2636,  2637,  2638,  2639,  2640,  2641,  2642,  2643,  2644,  2645,  2646,  2647,  2648,  2649,  2650,
+     2651,  2652,  2653,  2654,  2655,  2656,  2657,  2658,  2659,  2660,  2661,  2662,  2663,  2664,  2665,  2666,
+     2667,  2668,  2669,  2670,  2671,  2672,  2673,  2674,  2675,  2676,  2677,  2678,  2679,  2680,  2681,  2682,
+     2683,  2684,  2685,  2686,  2687,  2688,  2689,  2690,  2691,  2692,  2693,  2694,  2695,  2696,  2697,  2698,
+     2699,  2700,  2701,  2702,  2703,  2704,  2705,  2706,  2707,  2708,  2709,  2710,  2711,  2712,  2713,  2714,
+     2715,  2716,  2717,  2718,  2719,  2720,  2721,  2722,  2723,  2725,  2727,  2729,  2730,  2731,  2732,  2734,
+     2736,  2738,  2739,  2740,  2742,  2744,  2746,  2748,  2751,  2754,  2756,  2758,  2760,  2762,  2764,  2766,
+     2768,  2770,  2772,  2774,  2776,  2778,  2780,  2782,  2784,  2786,  2788,  2790,  2792,  2794,  2796,  2798,
+     2800,  2802,  2804,  2806,  2808,  2810,  2814,  2818,  2822,  2826,  2830,  2834,  2838,  2842,  2846,  2850,
+     2854,  2858,  2862,  2866,  2870,  2876,  2882,  2888,  2894,  2900,  2904,  2908,  2914,  2920,  2926,  2932,
+     2933,  2934,  2935,  2937,  2938,  2939,  2940,  2941,  2942,  2943,  2944,  2945,  2946,  2948,  2949,  2950,
+     2951,  2952,  2954,  2955,  2956,  2957,  2959,  2960,  2961,  2962,  2963,  2964,  2966,  2967,  2968,  2969,
+     2970,  2971,  2972,  2973,  2974,  2975,  2976,  2977,  2978,  2979,  2980,  2981,  2982,  2983,  2984,  2985,
+     2986,  2987,  2988,  2989,  2991,  2992,  2993,  2994,  2996,  2997,  2998,  2999,  3000,  3001,  3002,  3003,
+     3004,  3005,  3006,  3007,  3008,  3009,  3010,  3011,  3012,  3013,  3014,  3015,  3016,  3017,  3018,  3019,
+     3020,  3021,  3022,  3023,  3024,  3025,  3026,  3027,  3028,  3030,  3031,  3032,  3033,  3034,  3035,  3036,
+     3038,  3040,  3041,  3042,  3043,  3044,  3045,  3046,  3047,  3048,  3049,  3050,  3052,  3053,  3054,  3055,
+     3056,  3058,  3059,  3060,  3061,  3062,  3063,  3064,  3065,  3066,  3067,  3069,  3070,  3072,  3073,  3074,
+     3075,  3076,  3077,  3078,  3079,  3080,  3081,  3082,  3083,  3085,  3086,  3087,  3088,  3089,  3090,  3092,
+     3093,  3095,  3097,  3098,  3099,  3100,  3101,  3103,  3105,  3106,  3107,  3108,  3109,  3110,  3111,  3112,
+     3113,  3114,  3115,  3116,  3118,  3119,  3120,  3121,  3122,  3123,  3124,  3125,  3126,  3127,  3128,  3129,
+     3130,  3131,  3132,  3133,  3134,  3135,  3136,  3137,  3139,  3140,  3141,  3142,  3143,  3144,  3146,  3147,
+     3148,  3149,  3150,  3151,  3152,  3153,  3154,  3155,  3156,  3157,  3159,  3160,  3161,  3162,  3163,  3164,
+     3165,  3166,  3167,  3168,  3169,  3170,  3171,  3172,  3173,  3174,  3175,  3176,  3177,  3179,  3180,  3181,
+     3182,  3183,  3184,  3186,  3187,  3188,  3189,  3190,  3191,  3192,  3193,  3194,  3196,  3197,  3198,  3199,
+     3201,  3202,  3203,  3204,  3205,  3206,  3207,  3209,  3211,  3213,  3214,  3216,  3217,  3218,  3219,  3220,
+     3221,  3222,  3223,  3224,  3225,  3226,  3228,  3229,  3230,  3231,  3232,  3233,  3234,  3236,  3237,  3238,
+     3240,  3242,  3243,  3244,  3245,  3246,  3247,  3248,  3249,  3250,  3251,  3253,  3254,  3256,  3257,  3259,
+     3260,  3261,  3262,  3264,  3265,  3266,  3268,  3270,  3271,  3272,  3273,  3274,  3275,  3276,  3277,  3278,
+     3279,  3280,  3281,  3282,  3283,  3285,  3286,  3288,  3289,  3291,  3292,  3294,  3296,  3298,  3299,  3300,
+     3301,  3303,  3305,  3307,  3309,  3310,  3311,  3312,  3313,  3314,  3315,  3316,  3317,  3319,  3320,  3321,
+     3322,  3323,  3325,  3326,  3328,  3330,  3331,  3332,  3333,  3334,  3335,  3336,  3338,  3340,  3342,  3343,
+     3344,  3346,  3347,  3348,  3349,  3351,  3352,  3353,  3354,  3355,  3356,  3358,  3359,  3360,  3361,  3362,
+     3363,  3364,  3366,  3368,  3369,  3371,  3372,  3374,  3375,  3376,  3377,  3379,  3381,  3382,  3384,  3385,
+     3387,  3388,  3389,  3390,  3391,  3392,  3393,  3395,  3397,  3399,  3401,  3402,  3403,  3404,  3405,  3406,
+     3407,  3408,  3409,  3410,  3411,  3412,  3413,  3415,  3416,  3417,  3418,  3419,  3420,  3421,  3422,  3423,
+     3424,  3425,  3426,  3427,  3429,  3431,  3433,  3434,  3435,  3436,  3437,  3439,  3440,  3442,  3443,  3444,
+     3446,  3448,  3449,  3450,  3451,  3452,  3453,  3454,  3455,  3456,  3457,  3458,  3459,  3460,  3461,  3462,
+     3463,  3464,  3465,  3466,  3467,  3469,  3470,  3471,  3472,  3473,  3474,  3476,  3478,  3479,  3480,  3481,
+     3482,  3483,  3484,  3486,  3487,  3488,  3489,  3490,  3492,  3494,  3495,  3496,  3497,  3499,  3500,  3501,
+     3503,  3505,  3506,  3507,  3508,  3510,  3511,  3512,  3513,  3514,  3515,  3516,  3517,  3519,  3520,  3521,
+     3522,  3524,  3525,  3526,  3527,  3528,  3530,  3532,  3533,  3534,  3535,  3537,  3538,  3540,  3541,  3542,
+     3543,  3545,  3546,  3547,  3548,  3549,  3550,  3551,  3552,  3554,  3555,  3556,  3557,  3558,  3559,  3560,
+     3562,  3563,  3565,  3567,  3569,  3570,  3571,  3572,  3573,  3574,  3575,  3576,  3577,  3579,
+};
+
+// The decompositions, in UTF-16
+static const uint16_t canonical_pool[3579] = {
+    0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303, 0x0041, 0x0308, 0x0041, 0x030a,
+    0x0043, 0x0327, 0x0045, 0x0300, 0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+    0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004e, 0x0303, 0x004f, 0x0300, 0x004f, 0x0301,
+    0x004f, 0x0302, 0x004f, 0x0303, 0x004f, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+    0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302, 0x0061, 0x0303,
+    0x0061, 0x0308, 0x0061, 0x030a, 0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+    0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308, 0x006e, 0x0303,
+    0x006f, 0x0300, 0x006f, 0x0301, 0x006f, 0x0302, 0x006f, 0x0303, 0x006f, 0x0308, 0x0075, 0x0300,
+    0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301, 0x0079, 0x0308, 0x0041, 0x0304,
+    0x0061, 0x0304, 0x0041, 0x0306, 0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+    0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307, 0x0063, 0x0307, 0x0043, 0x030c,
+    0x0063, 0x030c, 0x0044, 0x030c, 0x0064, 0x030c, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+    0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328, 0x0065, 0x0328, 0x0045, 0x030c,
+    0x0065, 0x030c, 0x0047, 0x0302, 0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+    0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302, 0x0068, 0x0302, 0x0049, 0x0303,
+    0x0069, 0x0303, 0x0049, 0x0304, 0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+    0x0069, 0x0328, 0x0049, 0x0307, 0x004a, 0x0302, 0x006a, 0x0302, 0x004b, 0x0327, 0x006b, 0x0327,
+    0x004c, 0x0301, 0x006c, 0x0301, 0x004c, 0x0327, 0x006c, 0x0327, 0x004c, 0x030c, 0x006c, 0x030c,
+    0x004e, 0x0301, 0x006e, 0x0301, 0x004e, 0x0327, 0x006e, 0x0327, 0x004e, 0x030c, 0x006e, 0x030c,
+    0x004f, 0x0304, 0x006f, 0x0304, 0x004f, 0x0306, 0x006f, 0x0306, 0x004f, 0x030b, 0x006f, 0x030b,
+    0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327, 0x0052, 0x030c, 0x0072, 0x030c,
+    0x0053, 0x0301, 0x0073, 0x0301, 0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+    0x0053, 0x030c, 0x0073, 0x030c, 0x0054, 0x0327, 0x0074, 0x0327, 0x0054, 0x030c, 0x0074, 0x030c,
+    0x0055, 0x0303, 0x0075, 0x0303, 0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+    0x0055, 0x030a, 0x0075, 0x030a, 0x0055, 0x030b, 0x0075, 0x030b, 0x0055, 0x0328, 0x0075, 0x0328,
+    0x0057, 0x0302, 0x0077, 0x0302, 0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005a, 0x0301,
+    0x007a, 0x0301, 0x005a, 0x0307, 0x007a, 0x0307, 0x005a, 0x030c, 0x007a, 0x030c, 0x004f, 0x031b,
+    0x006f, 0x031b, 0x0055, 0x031b, 0x0075, 0x031b, 0x0041, 0x030c, 0x0061, 0x030c, 0x0049, 0x030c,
+    0x0069, 0x030c, 0x004f, 0x030c, 0x006f, 0x030c, 0x0055, 0x030c, 0x0075, 0x030c, 0x0055, 0x0308,
+    0x0304, 0x0075, 0x0308, 0x0304, 0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+    0x030c, 0x0075, 0x0308, 0x030c, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300, 0x0041, 0x0308,
+    0x0304, 0x0061, 0x0308, 0x0304, 0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00c6, 0x0304,
+    0x00e6, 0x0304, 0x0047, 0x030c, 0x0067, 0x030c, 0x004b, 0x030c, 0x006b, 0x030c, 0x004f, 0x0328,
+    0x006f, 0x0328, 0x004f, 0x0328, 0x0304, 0x006f, 0x0328, 0x0304, 0x01b7, 0x030c, 0x0292, 0x030c,
+    0x006a, 0x030c, 0x0047, 0x0301, 0x0067, 0x0301, 0x004e, 0x0300, 0x006e, 0x0300, 0x0041, 0x030a,
+    0x0301, 0x0061, 0x030a, 0x0301, 0x00c6, 0x0301, 0x00e6, 0x0301, 0x00d8, 0x0301, 0x00f8, 0x0301,
+    0x0041, 0x030f, 0x0061, 0x030f, 0x0041, 0x0311, 0x0061, 0x0311, 0x0045, 0x030f, 0x0065, 0x030f,
+    0x0045, 0x0311, 0x0065, 0x0311, 0x0049, 0x030f, 0x0069, 0x030f, 0x0049, 0x0311, 0x0069, 0x0311,
+    0x004f, 0x030f, 0x006f, 0x030f, 0x004f, 0x0311, 0x006f, 0x0311, 0x0052, 0x030f, 0x0072, 0x030f,
+    0x0052, 0x0311, 0x0072, 0x0311, 0x0055, 0x030f, 0x0075, 0x030f, 0x0055, 0x0311, 0x0075, 0x0311,
+    0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326, 0x0048, 0x030c, 0x0068, 0x030c,
+    0x0041, 0x0307, 0x0061, 0x0307, 0x0045, 0x0327, 0x0065, 0x0327, 0x004f, 0x0308, 0x0304, 0x006f,
+    0x0308, 0x0304, 0x004f, 0x0303, 0x0304, 0x006f, 0x0303, 0x0304, 0x004f, 0x0307, 0x006f, 0x0307,
+    0x004f, 0x0307, 0x0304, 0x006f, 0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+    0x0313, 0x0308, 0x0301, 0x02b9, 0x003b, 0x00a8, 0x0301, 0x0391, 0x0301, 0x00b7, 0x0395, 0x0301,
+    0x0397, 0x0301, 0x0399, 0x0301, 0x039f, 0x0301, 0x03a5, 0x0301, 0x03a9, 0x0301, 0x03b9, 0x0308,
+    0x0301, 0x0399, 0x0308, 0x03a5, 0x0308, 0x03b1, 0x0301, 0x03b5, 0x0301, 0x03b7, 0x0301, 0x03b9,
+    0x0301, 0x03c5, 0x0308, 0x0301, 0x03b9, 0x0308, 0x03c5, 0x0308, 0x03bf, 0x0301, 0x03c5, 0x0301,
+    0x03c9, 0x0301, 0x03d2, 0x0301, 0x03d2, 0x0308, 0x0415, 0x0300, 0x0415, 0x0308, 0x0413, 0x0301,
+    0x0406, 0x0308, 0x041a, 0x0301, 0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+    0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043a, 0x0301, 0x0438, 0x0300,
+    0x0443, 0x0306, 0x0474, 0x030f, 0x0475, 0x030f, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+    0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306, 0x0435, 0x0306, 0x04d8, 0x0308,
+    0x04d9, 0x0308, 0x0416, 0x0308, 0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+    0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041e, 0x0308, 0x043e, 0x0308, 0x04e8, 0x0308,
+    0x04e9, 0x0308, 0x042d, 0x0308, 0x044d, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+    0x0443, 0x0308, 0x0423, 0x030b, 0x0443, 0x030b, 0x0427, 0x0308, 0x0447, 0x0308, 0x042b, 0x0308,
+    0x044b, 0x0308, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064a, 0x0654,
+    0x06d5, 0x0654, 0x06c1, 0x0654, 0x06d2, 0x0654, 0x0928, 0x093c, 0x0930, 0x093c, 0x0933, 0x093c,
+    0x0915, 0x093c, 0x0916, 0x093c, 0x0917, 0x093c, 0x091c, 0x093c, 0x0921, 0x093c, 0x0922, 0x093c,
+    0x092b, 0x093c, 0x092f, 0x093c, 0x09c7, 0x09be, 0x09c7, 0x09d7, 0x09a1, 0x09bc, 0x09a2, 0x09bc,
+    0x09af, 0x09bc, 0x0a32, 0x0a3c, 0x0a38, 0x0a3c, 0x0a16, 0x0a3c, 0x0a17, 0x0a3c, 0x0a1c, 0x0a3c,
+    0x0a2b, 0x0a3c, 0x0b47, 0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57, 0x0b21, 0x0b3c, 0x0b22, 0x0b3c,
+    0x0b92, 0x0bd7, 0x0bc6, 0x0bbe, 0x0bc7, 0x0bbe, 0x0bc6, 0x0bd7, 0x0c46, 0x0c56, 0x0cbf, 0x0cd5,
+    0x0cc6, 0x0cd5, 0x0cc6, 0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2, 0x0cd5, 0x0d46, 0x0d3e, 0x0d47,
+    0x0d3e, 0x0d46, 0x0d57, 0x0dd9, 0x0dca, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf, 0x0dca, 0x0dd9, 0x0ddf,
+    0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7, 0x0f5b, 0x0fb7, 0x0f40, 0x0fb5,
+    0x0f71, 0x0f72, 0x0f71, 0x0f74, 0x0fb2, 0x0f80, 0x0fb3, 0x0f80, 0x0f71, 0x0f80, 0x0f92, 0x0fb7,
+    0x0f9c, 0x0fb7, 0x0fa1, 0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7, 0x0f90, 0x0fb5, 0x1025, 0x102e,
+    0x1b05, 0x1b35, 0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+    0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35, 0x0041, 0x0325,
+    0x0061, 0x0325, 0x0042, 0x0307, 0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+    0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301, 0x0044, 0x0307, 0x0064, 0x0307,
+    0x0044, 0x0323, 0x0064, 0x0323, 0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+    0x0044, 0x032d, 0x0064, 0x032d, 0x0045, 0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x0045, 0x0304,
+    0x0301, 0x0065, 0x0304, 0x0301, 0x0045, 0x032d, 0x0065, 0x032d, 0x0045, 0x0330, 0x0065, 0x0330,
+    0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307, 0x0066, 0x0307, 0x0047, 0x0304,
+    0x0067, 0x0304, 0x0048, 0x0307, 0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+    0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032e, 0x0068, 0x032e, 0x0049, 0x0330,
+    0x0069, 0x0330, 0x0049, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x004b, 0x0301, 0x006b, 0x0301,
+    0x004b, 0x0323, 0x006b, 0x0323, 0x004b, 0x0331, 0x006b, 0x0331, 0x004c, 0x0323, 0x006c, 0x0323,
+    0x004c, 0x0323, 0x0304, 0x006c, 0x0323, 0x0304, 0x004c, 0x0331, 0x006c, 0x0331, 0x004c, 0x032d,
+    0x006c, 0x032d, 0x004d, 0x0301, 0x006d, 0x0301, 0x004d, 0x0307, 0x006d, 0x0307, 0x004d, 0x0323,
+    0x006d, 0x0323, 0x004e, 0x0307, 0x006e, 0x0307, 0x004e, 0x0323, 0x006e, 0x0323, 0x004e, 0x0331,
+    0x006e, 0x0331, 0x004e, 0x032d, 0x006e, 0x032d, 0x004f, 0x0303, 0x0301, 0x006f, 0x0303, 0x0301,
+    0x004f, 0x0303, 0x0308, 0x006f, 0x0303, 0x0308, 0x004f, 0x0304, 0x0300, 0x006f, 0x0304, 0x0300,
+    0x004f, 0x0304, 0x0301, 0x006f, 0x0304, 0x0301, 0x0050, 0x0301, 0x0070, 0x0301, 0x0050, 0x0307,
+    0x0070, 0x0307, 0x0052, 0x0307, 0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+    0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331, 0x0053, 0x0307, 0x0073, 0x0307,
+    0x0053, 0x0323, 0x0073, 0x0323, 0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030c,
+    0x0307, 0x0073, 0x030c, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073, 0x0323, 0x0307, 0x0054, 0x0307,
+    0x0074, 0x0307, 0x0054, 0x0323, 0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032d,
+    0x0074, 0x032d, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330, 0x0075, 0x0330, 0x0055, 0x032d,
+    0x0075, 0x032d, 0x0055, 0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+    0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323, 0x0076, 0x0323, 0x0057, 0x0300,
+    0x0077, 0x0300, 0x0057, 0x0301, 0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+    0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307, 0x0078, 0x0307, 0x0058, 0x0308,
+    0x0078, 0x0308, 0x0059, 0x0307, 0x0079, 0x0307, 0x005a, 0x0302, 0x007a, 0x0302, 0x005a, 0x0323,
+    0x007a, 0x0323, 0x005a, 0x0331, 0x007a, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030a,
+    0x0079, 0x030a, 0x017f, 0x0307, 0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+    0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302, 0x0300, 0x0061, 0x0302, 0x0300,
+    0x0041, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+    0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301,
+    0x0041, 0x0306, 0x0300, 0x0061, 0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+    0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306,
+    0x0045, 0x0323, 0x0065, 0x0323, 0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+    0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302, 0x0300, 0x0065, 0x0302, 0x0300,
+    0x0045, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+    0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309, 0x0069, 0x0309, 0x0049, 0x0323,
+    0x0069, 0x0323, 0x004f, 0x0323, 0x006f, 0x0323, 0x004f, 0x0309, 0x006f, 0x0309, 0x004f, 0x0302,
+    0x0301, 0x006f, 0x0302, 0x0301, 0x004f, 0x0302, 0x0300, 0x006f, 0x0302, 0x0300, 0x004f, 0x0302,
+    0x0309, 0x006f, 0x0302, 0x0309, 0x004f, 0x0302, 0x0303, 0x006f, 0x0302, 0x0303, 0x004f, 0x0323,
+    0x0302, 0x006f, 0x0323, 0x0302, 0x004f, 0x031b, 0x0301, 0x006f, 0x031b, 0x0301, 0x004f, 0x031b,
+    0x0300, 0x006f, 0x031b, 0x0300, 0x004f, 0x031b, 0x0309, 0x006f, 0x031b, 0x0309, 0x004f, 0x031b,
+    0x0303, 0x006f, 0x031b, 0x0303, 0x004f, 0x031b, 0x0323, 0x006f, 0x031b, 0x0323, 0x0055, 0x0323,
+    0x0075, 0x0323, 0x0055, 0x0309, 0x0075, 0x0309, 0x0055, 0x031b, 0x0301, 0x0075, 0x031b, 0x0301,
+    0x0055, 0x031b, 0x0300, 0x0075, 0x031b, 0x0300, 0x0055, 0x031b, 0x0309, 0x0075, 0x031b, 0x0309,
+    0x0055, 0x031b, 0x0303, 0x0075, 0x031b, 0x0303, 0x0055, 0x031b, 0x0323, 0x0075, 0x031b, 0x0323,
+    0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323, 0x0059, 0x0309, 0x0079, 0x0309,
+    0x0059, 0x0303, 0x0079, 0x0303, 0x03b1, 0x0313, 0x03b1, 0x0314, 0x03b1, 0x0313, 0x0300, 0x03b1,
+    0x0314, 0x0300, 0x03b1, 0x0313, 0x0301, 0x03b1, 0x0314, 0x0301, 0x03b1, 0x0313, 0x0342, 0x03b1,
+    0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+    0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313, 0x0342, 0x0391, 0x0314, 0x0342,
+    0x03b5, 0x0313, 0x03b5, 0x0314, 0x03b5, 0x0313, 0x0300, 0x03b5, 0x0314, 0x0300, 0x03b5, 0x0313,
+    0x0301, 0x03b5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314, 0x0395, 0x0313, 0x0300, 0x0395,
+    0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395, 0x0314, 0x0301, 0x03b7, 0x0313, 0x03b7, 0x0314,
+    0x03b7, 0x0313, 0x0300, 0x03b7, 0x0314, 0x0300, 0x03b7, 0x0313, 0x0301, 0x03b7, 0x0314, 0x0301,
+    0x03b7, 0x0313, 0x0342, 0x03b7, 0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+    0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397, 0x0314, 0x0301, 0x0397, 0x0313,
+    0x0342, 0x0397, 0x0314, 0x0342, 0x03b9, 0x0313, 0x03b9, 0x0314, 0x03b9, 0x0313, 0x0300, 0x03b9,
+    0x0314, 0x0300, 0x03b9, 0x0313, 0x0301, 0x03b9, 0x0314, 0x0301, 0x03b9, 0x0313, 0x0342, 0x03b9,
+    0x0314, 0x0342, 0x0399, 0x0313, 0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+    0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313, 0x0342, 0x0399, 0x0314, 0x0342,
+    0x03bf, 0x0313, 0x03bf, 0x0314, 0x03bf, 0x0313, 0x0300, 0x03bf, 0x0314, 0x0300, 0x03bf, 0x0313,
+    0x0301, 0x03bf, 0x0314, 0x0301, 0x039f, 0x0313, 0x039f, 0x0314, 0x039f, 0x0313, 0x0300, 0x039f,
+    0x0314, 0x0300, 0x039f, 0x0313, 0x0301, 0x039f, 0x0314, 0x0301, 0x03c5, 0x0313, 0x03c5, 0x0314,
+    0x03c5, 0x0313, 0x0300, 0x03c5, 0x0314, 0x0300, 0x03c5, 0x0313, 0x0301, 0x03c5, 0x0314, 0x0301,
+    0x03c5, 0x0313, 0x0342, 0x03c5, 0x0314, 0x0342, 0x03a5, 0x0314, 0x03a5, 0x0314, 0x0300, 0x03a5,
+    0x0314, 0x0301, 0x03a5, 0x0314, 0x0342, 0x03c9, 0x0313, 0x03c9, 0x0314, 0x03c9, 0x0313, 0x0300,
+    0x03c9, 0x0314, 0x0300, 0x03c9, 0x0313, 0x0301, 0x03c9, 0x0314, 0x0301, 0x03c9, 0x0313, 0x0342,
+    0x03c9, 0x0314, 0x0342, 0x03a9, 0x0313, 0x03a9, 0x0314, 0x03a9, 0x0313, 0x0300, 0x03a9, 0x0314,
+    0x0300, 0x03a9, 0x0313, 0x0301, 0x03a9, 0x0314, 0x0301, 0x03a9, 0x0313, 0x0342, 0x03a9, 0x0314,
+    0x0342, 0x03b1, 0x0300, 0x03b1, 0x0301, 0x03b5, 0x0300, 0x03b5, 0x0301, 0x03b7, 0x0300, 0x03b7,
+    0x0301, 0x03b9, 0x0300, 0x03b9, 0x0301, 0x03bf, 0x0300, 0x03bf, 0x0301, 0x03c5, 0x0300, 0x03c5,
+    0x0301, 0x03c9, 0x0300, 0x03c9, 0x0301, 0x03b1, 0x0313, 0x0345, 0x03b1, 0x0314, 0x0345, 0x03b1,
+    0x0313, 0x0300, 0x0345, 0x03b1, 0x0314, 0x0300, 0x0345, 0x03b1, 0x0313, 0x0301, 0x0345, 0x03b1,
+    0x0314, 0x0301, 0x0345, 0x03b1, 0x0313, 0x0342, 0x0345, 0x03b1, 0x0314, 0x0342, 0x0345, 0x0391,
+    0x0313, 0x0345, 0x0391, 0x0314, 0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+    0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301, 0x0345, 0x0391, 0x0313, 0x0342,
+    0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x03b7, 0x0313, 0x0345, 0x03b7, 0x0314, 0x0345, 0x03b7,
+    0x0313, 0x0300, 0x0345, 0x03b7, 0x0314, 0x0300, 0x0345, 0x03b7, 0x0313, 0x0301, 0x0345, 0x03b7,
+    0x0314, 0x0301, 0x0345, 0x03b7, 0x0313, 0x0342, 0x0345, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0397,
+    0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300, 0x0345, 0x0397, 0x0314, 0x0300,
+    0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+    0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03c9, 0x0313, 0x0345, 0x03c9, 0x0314, 0x0345, 0x03c9,
+    0x0313, 0x0300, 0x0345, 0x03c9, 0x0314, 0x0300, 0x0345, 0x03c9, 0x0313, 0x0301, 0x0345, 0x03c9,
+    0x0314, 0x0301, 0x0345, 0x03c9, 0x0313, 0x0342, 0x0345, 0x03c9, 0x0314, 0x0342, 0x0345, 0x03a9,
+    0x0313, 0x0345, 0x03a9, 0x0314, 0x0345, 0x03a9, 0x0313, 0x0300, 0x0345, 0x03a9, 0x0314, 0x0300,
+    0x0345, 0x03a9, 0x0313, 0x0301, 0x0345, 0x03a9, 0x0314, 0x0301, 0x0345, 0x03a9, 0x0313, 0x0342,
+    0x0345, 0x03a9, 0x0314, 0x0342, 0x0345, 0x03b1, 0x0306, 0x03b1, 0x0304, 0x03b1, 0x0300, 0x0345,
+    0x03b1, 0x0345, 0x03b1, 0x0301, 0x0345, 0x03b1, 0x0342, 0x03b1, 0x0342, 0x0345, 0x0391, 0x0306,
+    0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0301, 0x0391, 0x0345, 0x03b9, 0x00a8, 0x0342, 0x03b7,
+    0x0300, 0x0345, 0x03b7, 0x0345, 0x03b7, 0x0301, 0x0345, 0x03b7, 0x0342, 0x03b7, 0x0342, 0x0345,
+    0x0395, 0x0300, 0x0395, 0x0301, 0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1fbf, 0x0300,
+    0x1fbf, 0x0301, 0x1fbf, 0x0342, 0x03b9, 0x0306, 0x03b9, 0x0304, 0x03b9, 0x0308, 0x0300, 0x03b9,
+    0x0308, 0x0301, 0x03b9, 0x0342, 0x03b9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+    0x0300, 0x0399, 0x0301, 0x1ffe, 0x0300, 0x1ffe, 0x0301, 0x1ffe, 0x0342, 0x03c5, 0x0306, 0x03c5,
+    0x0304, 0x03c5, 0x0308, 0x0300, 0x03c5, 0x0308, 0x0301, 0x03c1, 0x0313, 0x03c1, 0x0314, 0x03c5,
+    0x0342, 0x03c5, 0x0308, 0x0342, 0x03a5, 0x0306, 0x03a5, 0x0304, 0x03a5, 0x0300, 0x03a5, 0x0301,
+    0x03a1, 0x0314, 0x00a8, 0x0300, 0x00a8, 0x0301, 0x0060, 0x03c9, 0x0300, 0x0345, 0x03c9, 0x0345,
+    0x03c9, 0x0301, 0x0345, 0x03c9, 0x0342, 0x03c9, 0x0342, 0x0345, 0x039f, 0x0300, 0x039f, 0x0301,
+    0x03a9, 0x0300, 0x03a9, 0x0301, 0x03a9, 0x0345, 0x00b4, 0x2002, 0x2003, 0x03a9, 0x004b, 0x0041,
+    0x030a, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21d0, 0x0338, 0x21d4, 0x0338, 0x21d2,
+    0x0338, 0x2203, 0x0338, 0x2208, 0x0338, 0x220b, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223c,
+    0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003d, 0x0338, 0x2261, 0x0338, 0x224d,
+    0x0338, 0x003c, 0x0338, 0x003e, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+    0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227a, 0x0338, 0x227b, 0x0338, 0x2282, 0x0338, 0x2283,
+    0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22a2, 0x0338, 0x22a8, 0x0338, 0x22a9, 0x0338, 0x22ab,
+    0x0338, 0x227c, 0x0338, 0x227d, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22b2, 0x0338, 0x22b3,
+    0x0338, 0x22b4, 0x0338, 0x22b5, 0x0338, 0x3008, 0x3009, 0x2add, 0x0338, 0x304b, 0x3099, 0x304d,
+    0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059,
+    0x3099, 0x305b, 0x3099, 0x305d, 0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+    0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f, 0x309a, 0x3072, 0x3099, 0x3072, 0x309a, 0x3075,
+    0x3099, 0x3075, 0x309a, 0x3078, 0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046,
+    0x3099, 0x309d, 0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1, 0x3099, 0x30b3,
+    0x3099, 0x30b5, 0x3099, 0x30b7, 0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd, 0x3099, 0x30bf,
+    0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8, 0x3099, 0x30cf, 0x3099, 0x30cf,
+    0x309a, 0x30d2, 0x3099, 0x30d2, 0x309a, 0x30d5, 0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8,
+    0x309a, 0x30db, 0x3099, 0x30db, 0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0, 0x3099, 0x30f1,
+    0x3099, 0x30f2, 0x3099, 0x30fd, 0x3099, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+    0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f, 0x87ba, 0x88f8,
+    0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b,
+    0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f, 0x5eca, 0x6717, 0x6d6a,
+    0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c,
+    0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f, 0x8ad6, 0x58df,
+    0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f,
+    0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1, 0x9675, 0x8b80,
+    0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9,
+    0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa, 0x6bba, 0x8fb0, 0x6c88,
+    0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+    0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97, 0x9ece, 0x529b,
+    0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4,
+    0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8, 0x88c2, 0x8aaa, 0x5ec9,
+    0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469,
+    0x7f9a, 0x8046, 0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8, 0x60e1, 0x4e86,
+    0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e,
+    0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10, 0x985e, 0x516d, 0x622e,
+    0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f,
+    0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1, 0x91cc, 0x96e2,
+    0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+    0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207, 0x5ea6, 0x62d3,
+    0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a,
+    0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe, 0x7fbd, 0x8612,
+    0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d,
+    0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168,
+    0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422,
+    0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d, 0x798e, 0x7a40, 0x7a81, 0x7bc0,
+    0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01,
+    0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075, 0xd850, 0xdeee, 0x8218,
+    0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145, 0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2,
+    0x585a, 0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8, 0x614e,
+    0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c, 0x6452, 0x6556, 0x6674, 0x6717, 0x671b,
+    0x6756, 0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e, 0x77a7, 0x7235, 0x72af,
+    0x732a, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc,
+    0x7ab1, 0x7bc0, 0x7c7b, 0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941, 0x8986,
+    0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072,
+    0x9199, 0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12, 0x9f9c, 0xd84a,
+    0xdc4a, 0xd84a, 0xdc44, 0xd84c, 0xdfd5, 0x3b9d, 0x4018, 0x4039, 0xd854, 0xde49, 0xd857, 0xdcd0,
+    0xd85f, 0xded3, 0x9f43, 0x9f8e, 0x05d9, 0x05b4, 0x05f2, 0x05b7, 0x05e9, 0x05c1, 0x05e9, 0x05c2,
+    0x05e9, 0x05bc, 0x05c1, 0x05e9, 0x05bc, 0x05c2, 0x05d0, 0x05b7, 0x05d0, 0x05b8, 0x05d0, 0x05bc,
+    0x05d1, 0x05bc, 0x05d2, 0x05bc, 0x05d3, 0x05bc, 0x05d4, 0x05bc, 0x05d5, 0x05bc, 0x05d6, 0x05bc,
+    0x05d8, 0x05bc, 0x05d9, 0x05bc, 0x05da, 0x05bc, 0x05db, 0x05bc, 0x05dc, 0x05bc, 0x05de, 0x05bc,
+    0x05e0, 0x05bc, 0x05e1, 0x05bc, 0x05e3, 0x05bc, 0x05e4, 0x05bc, 0x05e6, 0x05bc, 0x05e7, 0x05bc,
+    0x05e8, 0x05bc, 0x05e9, 0x05bc, 0x05ea, 0x05bc, 0x05d5, 0x05b9, 0x05d1, 0x05bf, 0x05db, 0x05bf,
+    0x05e4, 0x05bf, 0xd804, 0xdc99, 0xd804, 0xdcba, 0xd804, 0xdc9b, 0xd804, 0xdcba, 0xd804, 0xdca5,
+    0xd804, 0xdcba, 0xd804, 0xdd31, 0xd804, 0xdd27, 0xd804, 0xdd32, 0xd804, 0xdd27, 0xd804, 0xdf47,
+    0xd804, 0xdf3e, 0xd804, 0xdf47, 0xd804, 0xdf57, 0xd805, 0xdcb9, 0xd805, 0xdcba, 0xd805, 0xdcb9,
+    0xd805, 0xdcb0, 0xd805, 0xdcb9, 0xd805, 0xdcbd, 0xd805, 0xddb8, 0xd805, 0xddaf, 0xd805, 0xddb9,
+    0xd805, 0xddaf, 0xd806, 0xdd35, 0xd806, 0xdd30, 0xd834, 0xdd57, 0xd834, 0xdd65, 0xd834, 0xdd58,
+    0xd834, 0xdd65, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd6e, 0xd834, 0xdd58, 0xd834, 0xdd65,
+    0xd834, 0xdd6f, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd70, 0xd834, 0xdd58, 0xd834, 0xdd65,
+    0xd834, 0xdd71, 0xd834, 0xdd58, 0xd834, 0xdd65, 0xd834, 0xdd72, 0xd834, 0xddb9, 0xd834, 0xdd65,
+    0xd834, 0xddba, 0xd834, 0xdd65, 0xd834, 0xddb9, 0xd834, 0xdd65, 0xd834, 0xdd6e, 0xd834, 0xddba,
+    0xd834, 0xdd65, 0xd834, 0xdd6e, 0xd834, 0xddb9, 0xd834, 0xdd65, 0xd834, 0xdd6f, 0xd834, 0xddba,
+    0xd834, 0xdd65, 0xd834, 0xdd6f, 0x4e3d, 0x4e38, 0x4e41, 0xd840, 0xdd22, 0x4f60, 0x4fae, 0x4fbb,
+    0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0xd841, 0xde3a, 0x514d, 0x5154, 0x5164, 0x5177,
+    0xd841, 0xdd1c, 0x34b9, 0x5167, 0x518d, 0xd841, 0xdd4b, 0x5197, 0x51a4, 0x4ecc, 0x51ac, 0x51b5,
+    0xd864, 0xdddf, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246, 0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9,
+    0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535a, 0x5373, 0x537d, 0x537f, 0x537f,
+    0x537f, 0xd842, 0xde2c, 0x7070, 0x53ca, 0x53df, 0xd842, 0xdf63, 0x53eb, 0x53f1, 0x5406, 0x549e,
+    0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab,
+    0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d,
+    0x578b, 0x5832, 0x5831, 0x58ac, 0xd845, 0xdce4, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962,
+    0xd845, 0xdea8, 0xd845, 0xdeea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08,
+    0x5b3e, 0x5b3e, 0xd846, 0xddc8, 0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0xd846, 0xdf18, 0x5bff, 0x5c06,
+    0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0xd847, 0xdde4, 0x5d43, 0xd847, 0xdde6,
+    0x5d6e, 0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69, 0x3862, 0xd848,
+    0xdd83, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0xd868, 0xdf92, 0x5efe, 0xd848, 0xdf31, 0xd848,
+    0xdf31, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0xd84c, 0xdeb8, 0xd858, 0xddda, 0x5f62, 0x5f6b, 0x38e3,
+    0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c, 0x6094, 0xd849, 0xded4, 0x60c7, 0x6148,
+    0x614c, 0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x61f2, 0x61f6, 0x6210,
+    0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0xd84a, 0xdf0c, 0x633d, 0x62fc, 0x6368, 0x6383, 0x63e4,
+    0xd84a, 0xdff1, 0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477, 0x3a6c, 0x654f,
+    0x656c, 0xd84c, 0xdc0a, 0x65e3, 0x66f8, 0x6649, 0x3b19, 0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195,
+    0x6700, 0x669c, 0x80ad, 0x43d9, 0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0xd84c, 0xdfc3, 0x3b49,
+    0x67fa, 0x6785, 0x6852, 0x6885, 0xd84d, 0xdc6d, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3,
+    0x69ea, 0x6aa8, 0xd84d, 0xdea3, 0x6adb, 0x3c18, 0x6b21, 0xd84e, 0xdca7, 0x6b54, 0x3c4e, 0x6b72,
+    0x6b9f, 0x6bba, 0x6bbb, 0xd84e, 0xde8d, 0xd847, 0xdd0b, 0xd84e, 0xdefa, 0x6c4e, 0xd84f, 0xdcbc,
+    0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd84f, 0xdd1e,
+    0x6d34, 0x6e2f, 0x6e6e, 0x3d33, 0x6ecb, 0x6ec7, 0xd84f, 0xded1, 0x6df9, 0x6f6e, 0xd84f, 0xdf5e,
+    0xd84f, 0xdf8e, 0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad, 0xd841,
+    0xdd25, 0x7145, 0xd850, 0xde63, 0x719c, 0xd850, 0xdfab, 0x7228, 0x7235, 0x7250, 0xd851, 0xde08,
+    0x7280, 0x7295, 0xd851, 0xdf35, 0xd852, 0xdc14, 0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8,
+    0x7447, 0x745c, 0x7471, 0x7485, 0x74ca, 0x3f1b, 0x7524, 0xd853, 0xdc36, 0x753e, 0xd853, 0xdc92,
+    0x7570, 0xd848, 0xdd9f, 0x7610, 0xd853, 0xdfa1, 0xd853, 0xdfb8, 0xd854, 0xdc44, 0x3ffc, 0x4008,
+    0x76f4, 0xd854, 0xdcf3, 0xd854, 0xdcf2, 0xd854, 0xdd19, 0xd854, 0xdd33, 0x771e, 0x771f, 0x771f,
+    0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0xd855, 0xdc1d, 0x784e, 0x788c, 0x78cc, 0x40e3, 0xd855,
+    0xde26, 0x7956, 0xd855, 0xde9a, 0xd855, 0xdec5, 0x798f, 0x79eb, 0x412f, 0x7a40, 0x7a4a, 0x7a4f,
+    0xd856, 0xdd7c, 0xd856, 0xdea7, 0xd856, 0xdea7, 0x7aee, 0x4202, 0xd856, 0xdfab, 0x7bc6, 0x7bc9,
+    0x4227, 0xd857, 0xdc80, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0xd857, 0xdf86, 0x7d63, 0x4301,
+    0x7dc7, 0x7e02, 0x7e45, 0x4334, 0xd858, 0xde28, 0xd858, 0xde47, 0x4359, 0xd858, 0xded9, 0x7f7a,
+    0xd858, 0xdf3e, 0x7f95, 0x7ffa, 0x8005, 0xd859, 0xdcda, 0xd859, 0xdd23, 0x8060, 0xd859, 0xdda8,
+    0x8070, 0xd84c, 0xdf5f, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0xd859, 0xdfa7, 0xd859,
+    0xdfb5, 0xd84c, 0xdf93, 0xd84c, 0xdf9c, 0x8201, 0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d,
+    0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6, 0xd85a, 0xdf3c, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323,
+    0x83bd, 0x83e7, 0x8457, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0xd85b, 0xdc36, 0xd85b, 0xdd6b, 0xd85b,
+    0xdcd5, 0x452b, 0x84f1, 0x84f3, 0x8516, 0xd85c, 0xdfca, 0x8564, 0xd85b, 0xdf2c, 0x455d, 0x4561,
+    0xd85b, 0xdfb1, 0xd85c, 0xdcd2, 0x456b, 0x8650, 0x865c, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e,
+    0x86e2, 0x8779, 0x8728, 0x876b, 0x8786, 0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0xd85d,
+    0xde67, 0x88d7, 0x88de, 0x4635, 0x88fa, 0x34bb, 0xd85e, 0xdcae, 0xd85e, 0xdd66, 0x46be, 0x46c7,
+    0x8aa0, 0x8aed, 0x8b8a, 0x8c55, 0xd85f, 0xdca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0xd85f, 0xdf2f,
+    0xd842, 0xdc04, 0x8dcb, 0x8dbc, 0x8df0, 0xd842, 0xdcde, 0x8ed4, 0x8f38, 0xd861, 0xddd2, 0xd861,
+    0xdded, 0x9094, 0x90f1, 0x9111, 0xd861, 0xdf2e, 0x911b, 0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9,
+    0x9415, 0xd862, 0xdffa, 0x958b, 0x4995, 0x95b7, 0xd863, 0xdd77, 0x49e6, 0x96c3, 0x5db2, 0x9723,
+    0xd864, 0xdd45, 0xd864, 0xde1a, 0x4a6e, 0x4a76, 0x97e0, 0xd865, 0xdc0a, 0x4ab2, 0xd865, 0xdc96,
+    0x980b, 0x980b, 0x9829, 0xd865, 0xddb6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce,
+    0xd866, 0xdf30, 0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0xd868, 0xdcce, 0x4cf8, 0xd868,
+    0xdd05, 0xd868, 0xde0e, 0xd868, 0xde91, 0x9ebb, 0x4d56, 0x9ef9, 0x9efe, 0x9f05, 0x9f0f, 0x9f16,
+    0x9f3b, 0xd869, 0xde00,
+};
+
+// The code points whose full compatibility decomposition is not their canonical decomposition
+static const uint32_t compat_keys[3750] = {
+    0x000a0, 0x000a8, 0x000aa, 0x000af, 0x000b2, 0x000b3, 0x000b4, 0x000b5, 0x000b8, 0x000b9, 0x000ba, 0x000bc,
+    0x000bd, 0x000be, 0x00132, 0x00133, 0x0013f, 0x00140, 0x00149, 0x0017f, 0x001c4, 0x001c5, 0x001c6, 0x001c7,
+    0x001c8, 0x001c9, 0x001ca, 0x001cb, 0x001cc, 0x001f1, 0x001f2, 0x001f3, 0x002b0, 0x002b1, 0x002b2, 0x002b3,
+    0x002b4, 0x002b5, 0x002b6, 0x002b7, 0x002b8, 0x002d8, 0x002d9, 0x002da, 0x002db, 0x002dc, 0x002dd, 0x002e0,
+    0x002e1, 0x002e2, 0x002e3, 0x002e4, 0x0037a, 0x00384, 0x00385, 0x003d0, 0x003d1, 0x003d2, 0x003d3, 0x003d4,
+    0x003d5, 0x003d6, 0x003f0, 0x003f1, 0x003f2, 0x003f4, 0x003f5, 0x003f9, 0x00587, 0x00675, 0x00676, 0x00677,
+    0x00678, 0x00e33, 0x00eb3, 0x00edc, 0x00edd, 0x00f0c, 0x00f77, 0x00f79, 0x010fc, 0x01d2c, 0x01d2d, 0x01d2e,
+    0x01d30, 0x01d31, 0x01d32, 0x01d33, 0x01d34, 0x01d35, 0x01d36, 0x01d37, 0x01d38, 0x01d39, 0x01d3a, 0x01d3c,
+    0x01d3d, 0x01d3e, 0x01d3f, 0x01d40, 0x01d41, 0x01d42, 0x01d43, 0x01d44, 0x01d45, 0x01d46, 0x01d47, 0x01d48,
+    0x01d49, 0x01d4a, 0x01d4b, 0x01d4c, 0x01d4d, 0x01d4f, 0x01d50, 0x01d51, 0x01d52, 0x01d53, 0x01d54, 0x01d55,
+    0x01d56, 0x01d57, 0x01d58, 0x01d59, 0x01d5a, 0x01d5b, 0x01d5c, 0x01d5d, 0x01d5e, 0x01d5f, 0x01d60, 0x01d61,
+    0x01d62, 0x01d63, 0x01d64, 0x01d65, 0x01d66, 0x01d67, 0x01d68, 0x01d69, 0x01d6a, 0x01d78, 0x01d9b, 0x01d9c,
+    0x01d9d, 0x01d9e, 0x01d9f, 0x01da0, 0x01da1, 0x01da2, 0x01da3, 0x01da4, 0x01da5, 0x01da6, 0x01da7, 0x01da8,
+    0x01da9, 0x01daa, 0x01dab, 0x01dac, 0x01dad, 0x01dae, 0x01daf, 0x01db0, 0x01db1, 0x01db2, 0x01db3, 0x01db4,
+    0x01db5, 0x01db6, 0x01db7, 0x01db8, 0x01db9, 0x01dba, 0x01dbb, 0x01dbc, 0x01dbd, 0x01dbe, 0x01dbf, 0x01e9a,
+    0x01e9b, 0x01fbd, 0x01fbf, 0x01fc0, 0x01fc1, 0x01fcd, 0x01fce, 0x01fcf, 0x01fdd, 0x01fde, 0x01fdf, 0x01fed,
+    0x01fee, 0x01ffd, 0x01ffe, 0x02000, 0x02001, 0x02002, 0x02003, 0x02004, 0x02005, 0x02006, 0x02007, 0x02008,
+    0x02009, 0x0200a, 0x02011, 0x02017, 0x02024, 0x02025, 0x02026, 0x0202f, 0x02033, 0x02034, 0x02036, 0x02037,
+    0x0203c, 0x0203e, 0x02047, 0x02048, 0x02049, 0x02057, 0x0205f, 0x02070, 0x02071, 0x02074, 0x02075, 0x02076,
+    0x02077, 0x02078, 0x02079, 0x0207a, 0x0207b, 0x0207c, 0x0207d, 0x0207e, 0x0207f, 0x02080, 0x02081, 0x02082,
+    0x02083, 0x02084, 0x02085, 0x02086, 0x02087, 0x02088, 0x02089, 0x0208a, 0x0208b, 0x0208c, 0x0208d, 0x0208e,
+    0x02090, 0x02091, 0x02092, 0x02093, 0x02094, 0x02095, 0x02096, 0x02097, 0x02098, 0x02099, 0x0209a, 0x0209b,
+    0x0209c, 0x020a8, 0x02100, 0x02101, 0x02102, 0x02103, 0x02105, 0x02106, 0x02107, 0x02109, 0x0210a, 0x0210b,
+    0x0210c, 0x0210d, 0x0210e, 0x0210f, 0x02110, 0x02111, 0x02112, 0x02113, 0x02115, 0x02116, 0x02119, 0x0211a,
+    0x0211b, 0x0211c, 0x0211d, 0x02120, 0x02121, 0x02122, 0x02124, 0x02128, 0x0212c, 0x0212d, 0x0212f, 0x02130,
+    0x02131, 0x02133, 0x02134, 0x02135, 0x02136, 0x02137, 0x02138, 0x02139, 0x0213b, 0x0213c, 0x0213d, 0x0213e,
+    0x0213f, 0x02140, 0x02145, 0x02146, 0x02147, 0x02148, 0x02149, 0x02150, 0x02151, 0x02152, 0x02153, 0x02154,
+    0x02155, 0x02156, 0x02157, 0x02158, 0x02159, 0x0215a, 0x0215b, 0x0215c, 0x0215d, 0x0215e, 0x0215f, 0x02160,
+    0x02161, 0x02162, 0x02163, 0x02164, 0x02165, 0x02166, 0x02167, 0x02168, 0x02169, 0x0216a, 0x0216b, 0x0216c,
+    0x0216d, 0x0216e, 0x0216f, 0x02170, 0x02171, 0x02172, 0x02173, 0x02174, 0x02175, 0x02176, 0x02177, 0x02178,
+    0x02179, 0x0217a, 0x0217b, 0x0217c, 0x0217d, 0x0217e, 0x0217f, 0x02189, 0x0222c, 0x0222d, 0x0222f, 0x02230,
+    0x02460, 0x02461, 0x02462, 0x02463, 0x02464, 0x02465, 0x02466, 0x02467, 0x02468, 0x02469, 0x0246a, 0x0246b,
+    0x0246c, 0x0246d, 0x0246e, 0x0246f, 0x02470, 0x02471, 0x02472, 0x02473, 0x02474, 0x02475, 0x02476, 0x02477,
+    0x02478, 0x02479, 0x0247a, 0x0247b, 0x0247c, 0x0247d, 0x0247e, 0x0247f, 0x02480, 0x02481, 0x02482, 0x02483,
+    0x02484, 0x02485, 0x02486, 0x02487, 0x02488, 0x02489, 0x0248a, 0x0248b, 0x0248c, 0x0248d, 0x0248e, 0x0248f,
+    0x02490, 0x02491, 0x02492, 0x02493, 0x02494, 0x02495, 0x02496, 0x02497, 0x02498, 0x02499, 0x0249a, 0x0249b,
+    0x0249c, 0x0249d, 0x0249e, 0x0249f, 0x024a0, 0x024a1, 0x024a2, 0x024a3, 0x024a4, 0x024a5, 0x024a6, 0x024a7,
+    0x024a8, 0x024a9, 0x024aa, 0x024ab, 0x024ac, 0x024ad, 0x024ae, 0x024af, 0x024b0, 0x024b1, 0x024b2, 0x024b3,
+    0x024b4, 0x024b5, 0x024b6, 0x024b7, 0x024b8, 0x024b9, 0x024ba, 0x024bb, 0x024bc, 0x024bd, 0x024be, 0x024bf,
+    0x024c0, 0x024c1, 0x024c2, 0x024c3, 0x024c4, 0x024c5, 0x024c6, 0x024c7, 0x024c8, 0x024c9, 0x024ca, 0x024cb,
+    0x024cc, 0x024cd, 0x024ce, 0x024cf, 0x024d0, 0x024d1, 0x024d2, 0x024d3, 0x024d4, 0x024d5, 0x024d6, 0x024d7,
+    0x024d8, 0x024d9, 0x024da, 0x024db, 0x024dc, 0x024dd, 0x024de, 0x024df, 0x024e0, 0x024e1, 0x024e2, 0x024e3,
+    0x024e4, 0x024e5, 0x024e6, 0x024e7, 0x024e8, 0x024e9, 0x024ea, 0x02a0c, 0x02a74, 0x02a75, 0x02a76, 0x02c7c,
+    0x02c7d, 0x02d6f, 0x02e9f, 0x02ef3, 0x02f00, 0x02f01, 0x02f02, 0x02f03, 0x02f04, 0x02f05, 0x02f06, 0x02f07,
+    0x02f08, 0x02f09, 0x02f0a, 0x02f0b, 0x02f0c, 0x02f0d, 0x02f0e, 0x02f0f, 0x02f10, 0x02f11, 0x02f12, 0x02f13,
+    0x02f14, 0x02f15, 0x02f16, 0x02f17, 0x02f18, 0x02f19, 0x02f1a, 0x02f1b, 0x02f1c, 0x02f1d, 0x02f1e, 0x02f1f,
+    0x02f20, 0x02f21, 0x02f22, 0x02f23, 0x02f24, 0x02f25, 0x02f26, 0x02f27, 0x02f28, 0x02f29, 0x02f2a, 0x02f2b,
+    0x02f2c, 0x02f2d, 0x02f2e, 0x02f2f, 0x02f30, 0x02f31, 0x02f32, 0x02f33, 0x02f34, 0x02f35, 0x02f36, 0x02f37,
+    0x02f38, 0x02f39, 0x02f3a, 0x02f3b, 0x02f3c, 0x02f3d, 0x02f3e, 0x02f3f, 0x02f40, 0x02f41, 0x02f42, 0x02f43,
+    0x02f44, 0x02f45, 0x02f46, 0x02f47, 0x02f48, 0x02f49, 0x02f4a, 0x02f4b, 0x02f4c, 0x02f4d, 0x02f4e, 0x02f4f,
+    0x02f50, 0x02f51, 0x02f52, 0x02f53, 0x02f54, 0x02f55, 0x02f56, 0x02f57, 0x02f58, 0x02f59, 0x02f5a, 0x02f5b,
+    0x02f5c, 0x02f5d, 0x02f5e, 0x02f5f, 0x02f60, 0x02f61, 0x02f62, 0x02f63, 0x02f64, 0x02f65, 0x02f66, 0x02f67,
+    0x02f68, 0x02f69, 0x02f6a, 0x02f6b, 0x02f6c, 0x02f6d, 0x02f6e, 0x02f6f, 0x02f70, 0x02f71, 0x02f72, 0x02f73,
+    0x02f74, 0x02f75, 0x02f76, 0x02f77, 0x02f78, 0x02f79, 0x02f7a, 0x02f7b, 0x02f7c, 0x02f7d, 0x02f7e, 0x02f7f,
+    0x02f80, 0x02f81, 0x02f82, 0x02f83, 0x02f84, 0x02f85, 0x02f86, 0x02f87, 0x02f88, 0x02f89, 0x02f8a, 0x02f8b,
+    0x02f8c, 0x02f8d, 0x02f8e, 0x02f8f, 0x02f90, 0x02f91, 0x02f92, 0x02f93, 0x02f94, 0x02f95, 0x02f96, 0x02f97,
+    0x02f98, 0x02f99, 0x02f9a, 0x02f9b, 0x02f9c, 0x02f9d, 0x02f9e, 0x02f9f, 0x02fa0, 0x02fa1, 0x02fa2, 0x02fa3,
+    0x02fa4, 0x02fa5, 0x02fa6, 0x02fa7, 0x02fa8, 0x02fa9, 0x02faa, 0x02fab, 0x02fac, 0x02fad, 0x02fae, 0x02faf,
+    0x02fb0, 0x02fb1, 0x02fb2, 0x02fb3, 0x02fb4, 0x02fb5, 0x02fb6, 0x02fb7, 0x02fb8, 0x02fb9, 0x02fba, 0x02fbb,
+    0x02fbc, 0x02fbd, 0x02fbe, 0x02fbf, 0x02fc0, 0x02fc1, 0x02fc2, 0x02fc3, 0x02fc4, 0x02fc5, 0x02fc6, 0x02fc7,
+    0x02fc8, 0x02fc9, 0x02fca, 0x02fcb, 0x02fcc, 0x02fcd, 0x02fce, 0x02fcf, 0x02fd0, 0x02fd1, 0x02fd2, 0x02fd3,
+    0x02fd4, 0x02fd5, 0x03000, 0x03036, 0x03038, 0x03039, 0x0303a, 0x0309b, 0x0309c, 0x0309f, 0x030ff, 0x03131,
+    0x03132, 0x03133, 0x03134, 0x03135, 0x03136, 0x03137, 0x03138, 0x03139, 0x0313a, 0x0313b, 0x0313c, 0x0313d,
+    0x0313e, 0x0313f, 0x03140, 0x03141, 0x03142, 0x03143, 0x03144, 0x03145, 0x03146, 0x03147, 0x03148, 0x03149,
+    0x0314a, 0x0314b, 0x0314c, 0x0314d, 0x0314e, 0x0314f, 0x03150, 0x03151, 0x03152, 0x03153, 0x03154, 0x03155,
+    0x03156, 0x03157, 0x03158, 0x03159, 0x0315a, 0x0315b, 0x0315c, 0x0315d, 0x0315e, 0x0315f, 0x03160, 0x03161,
+    0x03162, 0x03163, 0x03164, 0x03165, 0x03166, 0x03167, 0x03168, 0x03169, 0x0316a, 0x0316b, 0x0316c, 0x0316d,
+    0x0316e, 0x0316f, 0x03170, 0x03171, 0x03172, 0x03173, 0x03174, 0x03175, 0x03176, 0x03177, 0x03178, 0x03179,
+    0x0317a, 0x0317b, 0x0317c, 0x0317d, 0x0317e, 0x0317f, 0x03180, 0x03181, 0x03182, 0x03183, 0x03184, 0x03185,
+    0x03186, 0x03187, 0x03188, 0x03189, 0x0318a, 0x0318b, 0x0318c, 0x0318d, 0x0318e, 0x03192, 0x03193, 0x03194,
+    0x03195, 0x03196, 0x03197, 0x03198, 0x03199, 0x0319a, 0x0319b, 0x0319c, 0x0319d, 0x0319e, 0x0319f, 0x03200,
+    0x03201, 0x03202, 0x03203, 0x03204, 0x03205, 0x03206, 0x03207, 0x03208, 0x03209, 0x0320a, 0x0320b, 0x0320c,
+    0x0320d, 0x0320e, 0x0320f, 0x03210, 0x03211, 0x03212, 0x03213, 0x03214, 0x03215, 0x03216, 0x03217, 0x03218,
+    0x03219, 0x0321a, 0x0321b, 0x0321c, 0x0321d, 0x0321e, 0x03220, 0x03221, 0x03222, 0x03223, 0x03224, 0x03225,
+    0x03226, 0x03227, 0x03228, 0x03229, 0x0322a, 0x0322b, 0x0322c, 0x0322d, 0x0322e, 0x0322f, 0x03230, 0x03231,
+    0x03232, 0x03233, 0x03234, 0x03235, 0x03236, 0x03237, 0x03238, 0x03239, 0x0323a, 0x0323b, 0x0323c, 0x0323d,
+    0x0323e, 0x0323f, 0x03240, 0x03241, 0x03242, 0x03243, 0x03244, 0x03245, 0x03246, 0x03247, 0x03250, 0x03251,
+    0x03252, 0x03253, 0x03254, 0x03255, 0x03256, 0x03257, 0x03258, 0x03259, 0x0325a, 0x0325b, 0x0325c, 0x0325d,
+    0x0325e, 0x0325f, 0x03260, 0x03261, 0x03262, 0x03263, 0x03264, 0x03265, 0x03266, 0x03267, 0x03268, 0x03269,
+    0x0326a, 0x0326b, 0x0326c, 0x0326d, 0x0326e, 0x0326f, 0x03270, 0x03271, 0x03272, 0x03273, 0x03274, 0x03275,
+    0x03276, 0x03277, 0x03278, 0x03279, 0x0327a, 0x0327b, 0x0327c, 0x0327d, 0x0327e, 0x03280, 0x03281, 0x03282,
+    0x03283, 0x03284, 0x03285, 0x03286, 0x03287, 0x03288, 0x03289, 0x0328a, 0x0328b, 0x0328c, 0x0328d, 0x0328e,
+    0x0328f, 0x03290, 0x03291, 0x03292, 0x03293, 0x03294, 0x03295, 0x03296, 0x03297, 0x03298, 0x03299, 0x0329a,
+    0x0329b, 0x0329c, 0x0329d, 0x0329e, 0x0329f, 0x032a0, 0x032a1, 0x032a2, 0x032a3, 0x032a4, 0x032a5, 0x032a6,
+    0x032a7, 0x032a8, 0x032a9, 0x032aa, 0x032ab, 0x032ac, 0x032ad, 0x032ae, 0x032af, 0x032b0, 0x032b1, 0x032b2,
+    0x032b3, 0x032b4, 0x032b5, 0x032b6, 0x032b7, 0x032b8, 0x032b9, 0x032ba, 0x032bb, 0x032bc, 0x032bd, 0x032be,
+    0x032bf, 0x032c0, 0x032c1, 0x032c2, 0x032c3, 0x032c4, 0x032c5, 0x032c6, 0x032c7, 0x032c8, 0x032c9, 0x032ca,
+    0x032cb, 0x032cc, 0x032cd, 0x032ce, 0x032cf, 0x032d0, 0x032d1, 0x032d2, 0x032d3, 0x032d4, 0x032d5, 0x032d6,
+    0x032d7, 0x032d8, 0x032d9, 0x032da, 0x032db, 0x032dc, 0x032dd, 0x032de, 0x032df, 0x032e0, 0x032e1, 0x032e2,
+    0x032e3, 0x032e4, 0x032e5, 0x032e6, 0x032e7, 0x032e8, 0x032e9, 0x032ea, 0x032eb, 0x032ec, 0x032ed, 0x032ee,
+    0x032ef, 0x032f0, 0x032f1, 0x032f2, 0x032f3, 0x032f4, 0x032f5, 0x032f6, 0x032f7, 0x032f8, 0x032f9, 0x032fa,
+    0x032fb, 0x032fc, 0x032fd, 0x032fe, 0x032ff, 0x03300, 0x03301, 0x03302, 0x03303, 0x03304, 0x03305, 0x03306,
+    0x03307, 0x03308, 0x03309, 0x0330a, 0x0330b, 0x0330c, 0x0330d, 0x0330e, 0x0330f, 0x03310, 0x03311, 0x03312,
+    0x03313, 0x03314, 0x03315, 0x03316, 0x03317, 0x03318, 0x03319, 0x0331a, 0x0331b, 0x0331c, 0x0331d, 0x0331e,
+    0x0331f, 0x03320, 0x03321, 0x03322, 0x03323, 0x03324, 0x03325, 0x03326, 0x03327, 0x03328, 0x03329, 0x0332a,
+    0x0332b, 0x0332c, 0x0332d, 0x0332e, 0x0332f, 0x03330, 0x03331, 0x03332, 0x03333, 0x03334, 0x03335, 0x03336,
+    0x03337, 0x03338, 0x03339, 0x0333a, 0x0333b, 0x0333c, 0x0333d, 0x0333e, 0x0333f, 0x03340, 0x03341, 0x03342,
+    0x03343, 0x03344, 0x03345, 0x03346, 0x03347, 0x03348, 0x03349, 0x0334a, 0x0334b, 0x0334c, 0x0334d, 0x0334e,
+    0x0334f, 0x03350, 0x03351, 0x03352, 0x03353, 0x03354, 0x03355, 0x03356, 0x03357, 0x03358, 0x03359, 0x0335a,
+    0x0335b, 0x0335c, 0x0335d, 0x0335e, 0x0335f, 0x03360, 0x03361, 0x03362, 0x03363, 0x03364, 0x03365, 0x03366,
+    0x03367, 0x03368, 0x03369, 0x0336a, 0x0336b, 0x0336c, 0x0336d, 0x0336e, 0x0336f, 0x03370, 0x03371, 0x03372,
+    0x03373, 0x03374, 0x03375, 0x03376, 0x03377, 0x03378, 0x03379, 0x0337a, 0x0337b, 0x0337c, 0x0337d, 0x0337e,
+    0x0337f, 0x03380, 0x03381, 0x03382, 0x03383, 0x03384, 0x03385, 0x03386, 0x03387, 0x03388, 0x03389, 0x0338a,
+    0x0338b, 0x0338c, 0x0338d, 0x0338e, 0x0338f, 0x03390, 0x03391, 0x03392, 0x03393, 0x03394, 0x03395, 0x03396,
+    0x03397, 0x03398, 0x03399, 0x0339a, 0x0339b, 0x0339c, 0x0339d, 0x0339e, 0x0339f, 0x033a0, 0x033a1, 0x033a2,
+    0x033a3, 0x033a4, 0x033a5, 0x033a6, 0x033a7, 0x033a8, 0x033a9, 0x033aa, 0x033ab, 0x033ac, 0x033ad, 0x033ae,
+    0x033af, 0x033b0, 0x033b1, 0x033b2, 0x033b3, 0x033b4, 0x033b5, 0x033b6, 0x033b7, 0x033b8, 0x033b9, 0x033ba,
+    0x033bb, 0x033bc, 0x033bd, 0x033be, 0x033bf, 0x033c0, 0x033c1, 0x033c2, 0x033c3, 0x033c4, 0x033c5, 0x033c6,
+    0x033c7, 0x033c8, 0x033c9, 0x033ca, 0x033cb, 0x033cc, 0x033cd, 0x033ce, 0x033cf, 0x033d0, 0x033d1, 0x033d2,
+    0x033d3, 0x033d4, 0x033d5, 0x033d6, 0x033d7, 0x033d8, 0x033d9, 0x033da, 0x033db, 0x033dc, 0x033dd, 0x033de,
+    0x033df, 0x033e0, 0x033e1, 0x033e2, 0x033e3, 0x033e4, 0x033e5, 0x033e6, 0x033e7, 0x033e8, 0x033e9, 0x033ea,
+    0x033eb, 0x033ec, 0x033ed, 0x033ee, 0x033ef, 0x033f0, 0x033f1, 0x033f2, 0x033f3, 0x033f4, 0x033f5, 0x033f6,
+    0x033f7, 0x033f8, 0x033f9, 0x033fa, 0x033fb, 0x033fc, 0x033fd, 0x033fe, 0x033ff, 0x0a69c, 0x0a69d, 0x0a770,
+    0x0a7f2, 0x0a7f3, 0x0a7f4, 0x0a7f8, 0x0a7f9, 0x0ab5c, 0x0ab5d, 0x0ab5e, 0x0ab5f, 0x0ab69, 0x0fb00, 0x0fb01,
+    0x0fb02, 0x0fb03, 0x0fb04, 0x0fb05, 0x0fb06, 0x0fb13, 0x0fb14, 0x0fb15, 0x0fb16, 0x0fb17, 0x0fb20, 0x0fb21,
+    0x0fb22, 0x0fb23, 0x0fb24, 0x0fb25, 0x0fb26, 0x0fb27, 0x0fb28, 0x0fb29, 0x0fb4f, 0x0fb50, 0x0fb51, 0x0fb52,
+    0x0fb53, 0x0fb54, 0x0fb55, 0x0fb56, 0x0fb57, 0x0fb58, 0x0fb59, 0x0fb5a, 0x0fb5b, 0x0fb5c, 0x0fb5d, 0x0fb5e,
+    0x0fb5f, 0x0fb60, 0x0fb61, 0x0fb62, 0x0fb63, 0x0fb64, 0x0fb65, 0x0fb66, 0x0fb67, 0x0fb68, 0x0fb69, 0x0fb6a,
+    0x0fb6b, 0x0fb6c, 0x0fb6d, 0x0fb6e, 0x0fb6f, 0x0fb70, 0x0fb71, 0x0fb72, 0x0fb73, 0x0fb74, 0x0fb75, 0x0fb76,
+    0x0fb77, 0x0fb78, 0x0fb79, 0x0fb7a, 0x0fb7b, 0x0fb7c, 0x0fb7d, 0x0fb7e, 0x0fb7f, 0x0fb80, 0x0fb81, 0x0fb82,
+    0x0fb83, 0x0fb84, 0x0fb85, 0x0fb86, 0x0fb87, 0x0fb88, 0x0fb89, 0x0fb8a, 0x0fb8b, 0x0fb8c, 0x0fb8d, 0x0fb8e,
+    0x0fb8f, 0x0fb90, 0x0fb91, 0x0fb92, 0x0fb93, 0x0fb94, 0x0fb95, 0x0fb96, 0x0fb97, 0x0fb98, 0x0fb99, 0x0fb9a,
+    0x0fb9b, 0x0fb9c, 0x0fb9d, 0x0fb9e, 0x0fb9f, 0x0fba0, 0x0fba1, 0x0fba2, 0x0fba3, 0x0fba4, 0x0fba5, 0x0fba6,
+    0x0fba7, 0x0fba8, 0x0fba9, 0x0fbaa, 0x0fbab, 0x0fbac, 0x0fbad, 0x0fbae, 0x0fbaf, 0x0fbb0, 0x0fbb1, 0x0fbd3,
+    0x0fbd4, 0x0fbd5, 0x0fbd6, 0x0fbd7, 0x0fbd8, 0x0fbd9, 0x0fbda, 0x0fbdb, 0x0fbdc, 0x0fbdd, 0x0fbde, 0x0fbdf,
+    0x0fbe0, 0x0fbe1, 0x0fbe2, 0x0fbe3, 0x0fbe4, 0x0fbe5, 0x0fbe6, 0x0fbe7, 0x0fbe8, 0x0fbe9, 0x0fbea, 0x0fbeb,
+    0x0fbec, 0x0fbed, 0x0fbee, 0x0fbef, 0x0fbf0, 0x0fbf1, 0x0fbf2, 0x0fbf3, 0x0fbf4, 0x0fbf5, 0x0fbf6, 0x0fbf7,
+    0x0fbf8, 0x0fbf9, 0x0fbfa, 0x0fbfb, 0x0fbfc, 0x0fbfd, 0x0fbfe, 0x0fbff, 0x0fc00, 0x0fc01, 0x0fc02, 0x0fc03,
+    0x0fc04, 0x0fc05, 0x0fc06, 0x0fc07, 0x0fc08, 0x0fc09, 0x0fc0a, 0x0fc0b, 0x0fc0c, 0x0fc0d, 0x0fc0e, 0x0fc0f,
+    0x0fc10, 0x0fc11, 0x0fc12, 0x0fc13, 0x0fc14, 0x0fc15, 0x0fc16, 0x0fc17, 0x0fc18, 0x0fc19, 0x0fc1a, 0x0fc1b,
+    0x0fc1c, 0x0fc1d, 0x0fc1e, 0x0fc1f, 0x0fc20, 0x0fc21, 0x0fc22, 0x0fc23, 0x0fc24, 0x0fc25, 0x0fc26, 0x0fc27,
+    0x0fc28, 0x0fc29, 0x0fc2a, 0x0fc2b, 0x0fc2c, 0x0fc2d, 0x0fc2e, 0x0fc2f, 0x0fc30, 0x0fc31, 0x0fc32, 0x0fc33,
+    0x0fc34, 0x0fc35, 0x0fc36, 0x0fc37, 0x0fc38, 0x0fc39, 0x0fc3a, 0x0fc3b, 0x0fc3c, 0x0fc3d, 0x0fc3e, 0x0fc3f,
+    0x0fc40, 0x0fc41, 0x0fc42, 0x0fc43, 0x0fc44, 0x0fc45, 0x0fc46, 0x0fc47, 0x0fc48, 0x0fc49, 0x0fc4a, 0x0fc4b,
+    0x0fc4c, 0x0fc4d, 0x0fc4e, 0x0fc4f, 0x0fc50, 0x0fc51, 0x0fc52, 0x0fc53, 0x0fc54, 0x0fc55, 0x0fc56, 0x0fc57,
+    0x0fc58, 0x0fc59, 0x0fc5a, 0x0fc5b, 0x0fc5c, 0x0fc5d, 0x0fc5e, 0x0fc5f, 0x0fc60, 0x0fc61, 0x0fc62, 0x0fc63,
+    0x0fc64, 0x0fc65, 0x0fc66, 0x0fc67, 0x0fc68, 0x0fc69, 0x0fc6a, 0x0fc6b, 0x0fc6c, 0x0fc6d, 0x0fc6e, 0x0fc6f,
+    0x0fc70, 0x0fc71, 0x0fc72, 0x0fc73, 0x0fc74, 0x0fc75, 0x0fc76, 0x0fc77, 0x0fc78, 0x0fc79, 0x0fc7a, 0x0fc7b,
+    0x0fc7c, 0x0fc7d, 0x0fc7e, 0x0fc7f, 0x0fc80, 0x0fc81, 0x0fc82, 0x0fc83, 0x0fc84, 0x0fc85, 0x0fc86, 0x0fc87,
+    0x0fc88, 0x0fc89, 0x0fc8a, 0x0fc8b, 0x0fc8c, 0x0fc8d, 0x0fc8e, 0x0fc8f, 0x0fc90, 0x0fc91, 0x0fc92, 0x0fc93,
+    0x0fc94, 0x0fc95, 0x0fc96, 0x0fc97, 0x0fc98, 0x0fc99, 0x0fc9a, 0x0fc9b, 0x0fc9c, 0x0fc9d, 0x0fc9e, 0x0fc9f,
+    0x0fca0, 0x0fca1, 0x0fca2, 0x0fca3, 0x0fca4, 0x0fca5, 0x0fca6, 0x0fca7, 0x0fca8, 0x0fca9, 0x0fcaa, 0x0fcab,
+    0x0fcac, 0x0fcad, 0x0fcae, 0x0fcaf, 0x0fcb0, 0x0fcb1, 0x0fcb2, 0x0fcb3, 0x0fcb4, 0x0fcb5, 0x0fcb6, 0x0fcb7,
+    0x0fcb8, 0x0fcb9, 0x0fcba, 0x0fcbb, 0x0fcbc, 0x0fcbd, 0x0fcbe, 0x0fcbf, 0x0fcc0, 0x0fcc1, 0x0fcc2, 0x0fcc3,
+    0x0fcc4, 0x0fcc5, 0x0fcc6, 0x0fcc7, 0x0fcc8, 0x0fcc9, 0x0fcca, 0x0fccb, 0x0fccc, 0x0fccd, 0x0fcce, 0x0fccf,
+    0x0fcd0, 0x0fcd1, 0x0fcd2, 0x0fcd3, 0x0fcd4, 0x0fcd5, 0x0fcd6, 0x0fcd7, 0x0fcd8, 0x0fcd9, 0x0fcda, 0x0fcdb,
+    0x0fcdc, 0x0fcdd, 0x0fcde, 0x0fcdf, 0x0fce0, 0x0fce1, 0x0fce2, 0x0fce3, 0x0fce4, 0x0fce5, 0x0fce6, 0x0fce7,
+    0x0fce8, 0x0fce9, 0x0fcea, 0x0fceb, 0x0fcec, 0x0fced, 0x0fcee, 0x0fcef, 0x0fcf0, 0x0fcf1, 0x0fcf2, 0x0fcf3,
+    0x0fcf4, 0x0fcf5, 0x0fcf6, 0x0fcf7, 0x0fcf8, 0x0fcf9, 0x0fcfa, 0x0fcfb, 0x0fcfc, 0x0fcfd, 0x0fcfe, 0x0fcff,
+    0x0fd00, 0x0fd01, 0x0fd02, 0x0fd03, 0x0fd04, 0x0fd05, 0x0fd06, 0x0fd07, 0x0fd08, 0x0fd09, 0x0fd0a, 0x0fd0b,
+    0x0fd0c, 0x0fd0d, 0x0fd0e, 0x0fd0f, 0x0fd10, 0x0fd11, 0x0fd12, 0x0fd13, 0x0fd14, 0x0fd15, 0x0fd16, 0x0fd17,
+    0x0fd18, 0x0fd19, 0x0fd1a, 0x0fd1b, 0x0fd1c, 0x0fd1d, 0x0fd1e, 0x0fd1f, 0x0fd20, 0x0fd21, 0x0fd22, 0x0fd23,
+    0x0fd24, 0x0fd25, 0x0fd26, 0x0fd27, 0x0fd28, 0x0fd29, 0x0fd2a, 0x0fd2b, 0x0fd2c, 0x0fd2d, 0x0fd2e, 0x0fd2f,
+    0x0fd30, 0x0fd31, 0x0fd32, 0x0fd33, 0x0fd34, 0x0fd35, 0x0fd36, 0x0fd37, 0x0fd38, 0x0fd39, 0x0fd3a, 0x0fd3b,
+    0x0fd3c, 0x0fd3d, 0x0fd50, 0x0fd51, 0x0fd52, 0x0fd53, 0x0fd54, 0x0fd55, 0x0fd56, 0x0fd57, 0x0fd58, 0x0fd59,
+    0x0fd5a, 0x0fd5b, 0x0fd5c, 0x0fd5d, 0x0fd5e, 0x0fd5f, 0x0fd60, 0x0fd61, 0x0fd62, 0x0fd63, 0x0fd64, 0x0fd65,
+    0x0fd66, 0x0fd67, 0x0fd68, 0x0fd69, 0x0fd6a, 0x0fd6b, 0x0fd6c, 0x0fd6d, 0x0fd6e, 0x0fd6f, 0x0fd70, 0x0fd71,
+    0x0fd72, 0x0fd73, 0x0fd74, 0x0fd75, 0x0fd76, 0x0fd77, 0x0fd78, 0x0fd79, 0x0fd7a, 0x0fd7b, 0x0fd7c, 0x0fd7d,
+    0x0fd7e, 0x0fd7f, 0x0fd80, 0x0fd81, 0x0fd82, 0x0fd83, 0x0fd84, 0x0fd85, 0x0fd86, 0x0fd87, 0x0fd88, 0x0fd89,
+    0x0fd8a, 0x0fd8b, 0x0fd8c, 0x0fd8d, 0x0fd8e, 0x0fd8f, 0x0fd92, 0x0fd93, 0x0fd94, 0x0fd95, 0x0fd96, 0x0fd97,
+    0x0fd98, 0x0fd99, 0x0fd9a, 0x0fd9b, 0x0fd9c, 0x0fd9d, 0x0fd9e, 0x0fd9f, 0x0fda0, 0x0fda1, 0x0fda2, 0x0fda3,
+    0x0fda4, 0x0fda5, 0x0fda6, 0x0fda7, 0x0fda8, 0x0fda9, 0x0fdaa, 0x0fdab, 0x0fdac, 0x0fdad, 0x0fdae, 0x0fdaf,
+    0x0fdb0, 0x0fdb1, 0x0fdb2, 0x0fdb3, 0x0fdb4, 0x0fdb5, 0x0fdb6, 0x0fdb7, 0x0fdb8, 0x0fdb9, 0x0fdba, 0x0fdbb,
+    0x0fdbc, 0x0fdbd, 0x0fdbe, 0x0fdbf, 0x0fdc0, 0x0fdc1, 0x0fdc2, 0x0fdc3, 0x0fdc4, 0x0fdc5, 0x0fdc6, 0x0fdc7,
+    0x0fdf0, 0x0fdf1, 0x0fdf2, 0x0fdf3, 0x0fdf4, 0x0fdf5, 0x0fdf6, 0x0fdf7, 0x0fdf8, 0x0fdf9, 0x0fdfa, 0x0fdfb,
+    0x0fdfc, 0x0fe10, 0x0fe11, 0x0fe12, 0x0fe13, 0x0fe14, 0x0fe15, 0x0fe16, 0x0fe17, 0x0fe18, 0x0fe19, 0x0fe30,
+    0x0fe31, 0x0fe32, 0x0fe33, 0x0fe34, 0x0fe35, 0x0fe36, 0x0fe37, 0x0fe38, 0x0fe39, 0x0fe3a, 0x0fe3b, 0x0fe3c,
+    0x0fe3d, 0x0fe3e, 0x0fe3f, 0x0fe40, 0x0fe41, 0x0fe42, 0x0fe43, 0x0fe44, 0x0fe47, 0x0fe48, 0x0fe49, 0x0fe4a,
+    0x0fe4b, 0x0fe4c, 0x0fe4d, 0x0fe4e, 0x0fe4f, 0x0fe50, 0x0fe51, 0x0fe52, 0x0fe54, 0x0fe55, 0x0fe56, 0x0fe57,
+    0x0fe58, 0x0fe59, 0x0fe5a, 0x0fe5b, 0x0fe5c, 0x0fe5d, 0x0fe5e, 0x0fe5f, 0x0fe60, 0x0fe61, 0x0fe62, 0x0fe63,
+    0x0fe64, 0x0fe65, 0x0fe66, 0x0fe68, 0x0fe69, 0x0fe6a, 0x0fe6b, 0x0fe70, 0x0fe71, 0x0fe72, 0x0fe74, 0x0fe76,
+    0x0fe77, 0x0fe78, 0x0fe79, 0x0fe7a, 0x0fe7b, 0x0fe7c, 0x0fe7d, 0x0fe7e, 0x0fe7f, 0x0fe80, 0x0fe81, 0x0fe82,
+    0x0fe83, 0x0fe84, 0x0fe85, 0x0fe86, 0x0fe87, 0x0fe88, 0x0fe89, 0x0fe8a, 0x0fe8b, 0x0fe8c, 0x0fe8d, 0x0fe8e,
+    0x0fe8f, 0x0fe90, 0x0fe91, 0x0fe92, 0x0fe93, 0x0fe94, 0x0fe95, 0x0fe96, 0x0fe97, 0x0fe98, 0x0fe99, 0x0fe9a,
+    0x0fe9b, 0x0fe9c, 0x0fe9d, 0x0fe9e, 0x0fe9f, 0x0fea0, 0x0fea1, 0x0fea2, 0x0fea3, 0x0fea4, 0x0fea5, 0x0fea6,
+    0x0fea7, 0x0fea8, 0x0fea9, 0x0feaa, 0x0feab, 0x0feac, 0x0fead, 0x0feae, 0x0feaf, 0x0feb0, 0x0feb1, 0x0feb2,
+    0x0feb3, 0x0feb4, 0x0feb5, 0x0feb6, 0x0feb7, 0x0feb8, 0x0feb9, 0x0feba, 0x0febb, 0x0febc, 0x0febd, 0x0febe,
+    0x0febf, 0x0fec0, 0x0fec1, 0x0fec2, 0x0fec3, 0x0fec4, 0x0fec5, 0x0fec6, 0x0fec7, 0x0fec8, 0x0fec9, 0x0feca,
+    0x0fecb, 0x0fecc, 0x0fecd, 0x0fece, 0x0fecf, 0x0fed0, 0x0fed1, 0x0fed2, 0x0fed3, 0x0fed4, 0x0fed5, 0x0fed6,
+    0x0fed7, 0x0fed8, 0x0fed9, 0x0feda, 0x0fedb, 0x0fedc, 0x0fedd, 0x0fede, 0x0fedf, 0x0fee0, 0x0fee1, 0x0fee2,
+    0x0fee3, 0x0fee4, 0x0fee5, 0x0fee6, 0x0fee7, 0x0fee8, 0x0fee9, 0x0feea, 0x0feeb, 0x0feec, 0x0feed, 0x0feee,
+    0x0feef, 0x0fef0, 0x0fef1, 0x0fef2, 0x0fef3, 0x0fef4, 0x0fef5, 0x0fef6, 0x0fef7, 0x0fef8, 0x0fef9, 0x0fefa,
+    0x0fefb, 0x0fefc, 0x0ff01, 0x0ff02, 0x0ff03, 0x0ff04, 0x0ff05, 0x0ff06, 0x0ff07, 0x0ff08, 0x0ff09, 0x0ff0a,
+    0x0ff0b, 0x0ff0c, 0x0ff0d, 0x0ff0e, 0x0ff0f, 0x0ff10, 0x0ff11, 0x0ff12, 0x0ff13, 0x0ff14, 0x0ff15, 0x0ff16,
+    0x0ff17, 0x0ff18, 0x0ff19, 0x0ff1a, 0x0ff1b, 0x0ff1c, 0x0ff1d, 0x0ff1e, 0x0ff1f, 0x0ff20, 0x0ff21, 0x0ff22,
+    0x0ff23, 0x0ff24, 0x0ff25, 0x0ff26, 0x0ff27, 0x0ff28, 0x0ff29, 0x0ff2a, 0x0ff2b, 0x0ff2c, 0x0ff2d, 0x0ff2e,
+    0x0ff2f, 0x0ff30, 0x0ff31, 0x0ff32, 0x0ff33, 0x0ff34, 0x0ff35, 0x0ff36, 0x0ff37, 0x0ff38, 0x0ff39, 0x0ff3a,
+    0x0ff3b, 0x0ff3c, 0x0ff3d, 0x0ff3e, 0x0ff3f, 0x0ff40, 0x0ff41, 0x0ff42, 0x0ff43, 0x0ff44, 0x0ff45, 0x0ff46,
+    0x0ff47, 0x0ff48, 0x0ff49, 0x0ff4a, 0x0ff4b, 0x0ff4c, 0x0ff4d, 0x0ff4e, 0x0ff4f, 0x0ff50, 0x0ff51, 0x0ff52,
+    0x0ff53, 0x0ff54, 0x0ff55, 0x0ff56, 0x0ff57, 0x0ff58, 0x0ff59, 0x0ff5a, 0x0ff5b, 0x0ff5c, 0x0ff5d, 0x0ff5e,
+    0x0ff5f, 0x0ff60, 0x0ff61, 0x0ff62, 0x0ff63, 0x0ff64, 0x0ff65, 0x0ff66, 0x0ff67, 0x0ff68, 0x0ff69, 0x0ff6a,
+    0x0ff6b, 0x0ff6c, 0x0ff6d, 0x0ff6e, 0x0ff6f, 0x0ff70, 0x0ff71, 0x0ff72, 0x0ff73, 0x0ff74, 0x0ff75, 0x0ff76,
+    0x0ff77, 0x0ff78, 0x0ff79, 0x0ff7a, 0x0ff7b, 0x0ff7c, 0x0ff7d, 0x0ff7e, 0x0ff7f, 0x0ff80, 0x0ff81, 0x0ff82,
+    0x0ff83, 0x0ff84, 0x0ff85, 0x0ff86, 0x0ff87, 0x0ff88, 0x0ff89, 0x0ff8a, 0x0ff8b, 0x0ff8c, 0x0ff8d, 0x0ff8e,
+    0x0ff8f, 0x0ff90, 0x0ff91, 0x0ff92, 0x0ff93, 0x0ff94, 0x0ff95, 0x0ff96, 0x0ff97, 0x0ff98, 0x0ff99, 0x0ff9a,
+    0x0ff9b, 0x0ff9c, 0x0ff9d, 0x0ff9e, 0x0ff9f, 0x0ffa0, 0x0ffa1, 0x0ffa2, 0x0ffa3, 0x0ffa4, 0x0ffa5, 0x0ffa6,
+    0x0ffa7, 0x0ffa8, 0x0ffa9, 0x0ffaa, 0x0ffab, 0x0ffac, 0x0ffad, 0x0ffae, 0x0ffaf, 0x0ffb0, 0x0ffb1, 0x0ffb2,
+    0x0ffb3, 0x0ffb4, 0x0ffb5, 0x0ffb6, 0x0ffb7, 0x0ffb8, 0x0ffb9, 0x0ffba, 0x0ffbb, 0x0ffbc, 0x0ffbd, 0x0ffbe,
+    0x0ffc2, 0x0ffc3, 0x0ffc4, 0x0ffc5, 0x0ffc6, 0x0ffc7, 0x0ffca, 0x0ffcb, 0x0ffcc, 0x0ffcd, 0x0ffce, 0x0ffcf,
+    0x0ffd2, 0x0ffd3, 0x0ffd4, 0x0ffd5, 0x0ffd6, 0x0ffd7, 0x0ffda, 0x0ffdb, 0x0ffdc, 0x0ffe0, 0x0ffe1, 0x0ffe2,
+    0x0ffe3, 0x0ffe4, 0x0ffe5, 0x0ffe6, 0x0ffe8, 0x0ffe9, 0x0ffea, 0x0ffeb, 0x0ffec, 0x0ffed, 0x0ffee, 0x10781,
+    0x10782, 0x10783, 0x10784, 0x10785, 0x10787, 0x10788, 0x10789, 0x1078a, 0x1078b, 0x1078c, 0x1078d, 0x1078e,
+    0x1078f, 0x10790, 0x10791, 0x10792, 0x10793, 0x10794, 0x10795, 0x10796, 0x10797, 0x10798, 0x10799, 0x1079a,
+    0x1079b, 0x1079c, 0x1079d, 0x1079e, 0x1079f, 0x107a0, 0x107a1, 0x107a2, 0x107a3, 0x107a4, 0x107a5, 0x107a6,
+    0x107a7, 0x107a8, 0x107a9, 0x107aa, 0x107ab, 0x107ac, 0x107ad, 0x107ae, 0x107af, 0x107b0, 0x107b2, 0x107b3,
+    0x107b4, 0x107b5, 0x107b6, 0x107b7, 0x107b8, 0x107b9, 0x107ba, 0x1d400, 0x1d401, 0x1d402, 0x1d403, 0x1d404,
+    0x1d405, 0x1d406, 0x1d407, 0x1d408, 0x1d409, 0x1d40a, 0x1d40b, 0x1d40c, 0x1d40d, 0x1d40e, 0x1d40f, 0x1d410,
+    0x1d411, 0x1d412, 0x1d413, 0x1d414, 0x1d415, 0x1d416, 0x1d417, 0x1d418, 0x1d419, 0x1d41a, 0x1d41b, 0x1d41c,
+    0x1d41d, 0x1d41e, 0x1d41f, 0x1d420, 0x1d421, 0x1d422, 0x1d423, 0x1d424, 0x1d425, 0x1d426, 0x1d427, 0x1d428,
+    0x1d429, 0x1d42a, 0x1d42b, 0x1d42c, 0x1d42d, 0x1d42e, 0x1d42f, 0x1d430, 0x1d431, 0x1d432, 0x1d433, 0x1d434,
+    0x1d435, 0x1d436, 0x1d437, 0x1d438, 0x1d439, 0x1d43a, 0x1d43b, 0x1d43c, 0x1d43d, 0x1d43e, 0x1d43f, 0x1d440,
+    0x1d441, 0x1d442, 0x1d443, 0x1d444, 0x1d445, 0x1d446, 0x1d447, 0x1d448, 0x1d449, 0x1d44a, 0x1d44b, 0x1d44c,
+    0x1d44d, 0x1d44e, 0x1d44f, 0x1d450, 0x1d451, 0x1d452, 0x1d453, 0x1d454, 0x1d456, 0x1d457, 0x1d458, 0x1d459,
+    0x1d45a, 0x1d45b, 0x1d45c, 0x1d45d, 0x1d45e, 0x1d45f, 0x1d460, 0x1d461, 0x1d462, 0x1d463, 0x1d464, 0x1d465,
+    0x1d466, 0x1d467, 0x1d468, 0x1d469, 0x1d46a, 0x1d46b, 0x1d46c, 0x1d46d, 0x1d46e, 0x1d46f, 0x1d470, 0x1d471,
+    0x1d472, 0x1d473, 0x1d474, 0x1d475, 0x1d476, 0x1d477, 0x1d478, 0x1d479, 0x1d47a, 0x1d47b, 0x1d47c, 0x1d47d,
+    0x1d47e, 0x1d47f, 0x1d480, 0x1d481, 0x1d482, 0x1d483, 0x1d484, 0x1d485, 0x1d486, 0x1d487, 0x1d488, 0x1d489,
+    0x1d48a, 0x1d48b, 0x1d48c, 0x1d48d, 0x1d48e, 0x1d48f, 0x1d490, 0x1d491, 0x1d492, 0x1d493, 0x1d494, 0x1d495,
+    0x1d496, 0x1d497, 0x1d498, 0x1d499, 0x1d49a, 0x1d49b, 0x1d49c, 0x1d49e, 0x1d49f, 0x1d4a2, 0x1d4a5, 0x1d4a6,
+    0x1d4a9, 0x1d4aa, 0x1d4ab, 0x1d4ac, 0x1d4ae, 0x1d4af, 0x1d4b0, 0x1d4b1, 0x1d4b2, 0x1d4b3, 0x1d4b4, 0x1d4b5,
+    0x1d4b6, 0x1d4b7, 0x1d4b8, 0x1d4b9, 0x1d4bb, 0x1d4bd, 0x1d4be, 0x1d4bf, 0x1d4c0, 0x1d4c1, 0x1d4c2, 0x1d4c3,
+    0x1d4c5, 0x1d4c6, 0x1d4c7, 0x1d4c8, 0x1d4c9, 0x1d4ca, 0x1d4cb, 0x1d4cc, 0x1d4cd, 0x1d4ce, 0x1d4cf, 0x1d4d0,
+    0x1d4d1, 0x1d4d2, 0x1d4d3, 0x1d4d4, 0x1d4d5, 0x1d4d6, 0x1d4d7, 0x1d4d8, 0x1d4d9, 0x1d4da, 0x1d4db, 0x1d4dc,
+    0x1d4dd, 0x1d4de, 0x1d4df, 0x1d4e0, 0x1d4e1, 0x1d4e2, 0x1d4e3, 0x1d4e4, 0x1d4e5, 0x1d4e6, 0x1d4e7, 0x1d4e8,
+    0x1d4e9, 0x1d4ea, 0x1d4eb, 0x1d4ec, 0x1d4ed, 0x1d4ee, 0x1d4ef, 0x1d4f0, 0x1d4f1, 0x1d4f2, 0x1d4f3, 0x1d4f4,
+    0x1d4f5, 0x1d4f6, 0x1d4f7, 0x1d4f8, 0x1d4f9, 0x1d4fa, 0x1d4fb, 0x1d4fc, 0x1d4fd, 0x1d4fe, 0x1d4ff, 0x1d500,
+    0x1d501, 0x1d502, 0x1d503, 0x1d504, 0x1d505, 0x1d507, 0x1d508, 0x1d509, 0x1d50a, 0x1d50d, 0x1d50e, 0x1d50f,
+    0x1d510, 0x1d511, 0x1d512, 0x1d513, 0x1d514, 0x1d516, 0x1d517, 0x1d518, 0x1d519, 0x1d51a, 0x1d51b, 0x1d51c,
+    0x1d51e, 0x1d51f, 0x1d520, 0x1d521, 0x1d522, 0x1d523, 0x1d524, 0x1d525, 0x1d526, 0x1d527, 0x1d528, 0x1d529,
+    0x1d52a, 0x1d52b, 0x1d52c, 0x1d52d, 0x1d52e, 0x1d52f, 0x1d530, 0x1d531, 0x1d532, 0x1d533, 0x1d534, 0x1d535,
+    0x1d536, 0x1d537, 0x1d538, 0x1d539, 0x1d53b, 0x1d53c, 0x1d53d, 0x1d53e, 0x1d540, 0x1d541, 0x1d542, 0x1d543,
+    0x1d544, 0x1d546, 0x1d54a, 0x1d54b, 0x1d54c, 0x1d54d, 0x1d54e, 0x1d54f, 0x1d550, 0x1d552, 0x1d553, 0x1d554,
+    0x1d555, 0x1d556, 0x1d557, 0x1d558, 0x1d559, 0x1d55a, 0x1d55b, 0x1d55c, 0x1d55d, 0x1d55e, 0x1d55f, 0x1d560,
+    0x1d561, 0x1d562, 0x1d563, 0x1d564, 0x1d565, 0x1d566, 0x1d567, 0x1d568, 0x1d569, 0x1d56a, 0x1d56b, 0x1d56c,
+    0x1d56d, 0x1d56e, 0x1d56f, 0x1d570, 0x1d571, 0x1d572, 0x1d573, 0x1d574, 0x1d575, 0x1d576, 0x1d577, 0x1d578,
+    0x1d579, 0x1d57a, 0x1d57b, 0x1d57c, 0x1d57d, 0x1d57e, 0x1d57f, 0x1d580, 0x1d581, 0x1d582, 0x1d583, 0x1d584,
+    0x1d585, 0x1d586, 0x1d587, 0x1d588, 0x1d589, 0x1d58a, 0x1d58b, 0x1d58c, 0x1d58d, 0x1d58e, 0x1d58f, 0x1d590,
+    0x1d591, 0x1d592, 0x1d593, 0x1d594, 0x1d595, 0x1d596, 0x1d597, 0x1d598, 0x1d599, 0x1d59a, 0x1d59b, 0x1d59c,
+    0x1d59d, 0x1d59e, 0x1d59f, 0x1d5a0, 0x1d5a1, 0x1d5a2, 0x1d5a3, 0x1d5a4, 0x1d5a5, 0x1d5a6, 0x1d5a7, 0x1d5a8,
+    0x1d5a9, 0x1d5aa, 0x1d5ab, 0x1d5ac, 0x1d5ad, 0x1d5ae, 0x1d5af, 0x1d5b0, 0x1d5b1, 0x1d5b2, 0x1d5b3, 0x1d5b4,
+    0x1d5b5, 0x1d5b6, 0x1d5b7, 0x1d5b8, 0x1d5b9, 0x1d5ba, 0x1d5bb, 0x1d5bc, 0x1d5bd, 0x1d5be, 0x1d5bf, 0x1d5c0,
+    0x1d5c1, 0x1d5c2, 0x1d5c3, 0x1d5c4, 0x1d5c5, 0x1d5c6, 0x1d5c7, 0x1d5c8, 0x1d5c9, 0x1d5ca, 0x1d5cb, 0x1d5cc,
+    0x1d5cd, 0x1d5ce, 0x1d5cf, 0x1d5d0, 0x1d5d1, 0x1d5d2, 0x1d5d3, 0x1d5d4, 0x1d5d5, 0x1d5d6, 0x1d5d7, 0x1d5d8,
+    0x1d5d9, 0x1d5da, 0x1d5db, 0x1d5dc, 0x1d5dd, 0x1d5de, 0x1d5df, 0x1d5e0, 0x1d5e1, 0x1d5e2, 0x1d5e3, 0x1d5e4,
+    0x1d5e5, 0x1d5e6, 0x1d5e7, 0x1d5e8, 0x1d5e9, 0x1d5ea, 0x1d5eb, 0x1d5ec, 0x1d5ed, 0x1d5ee, 0x1d5ef, 0x1d5f0,
+    0x1d5f1, 0x1d5f2, 0x1d5f3, 0x1d5f4, 0x1d5f5, 0x1d5f6, 0x1d5f7, 0x1d5f8, 0x1d5f9, 0x1d5fa, 0x1d5fb, 0x1d5fc,
+    0x1d5fd, 0x1d5fe, 0x1d5ff, 0x1d600, 0x1d601, 0x1d602, 0x1d603, 0x1d604, 0x1d605, 0x1d606, 0x1d607, 0x1d608,
+    0x1d609, 0x1d60a, 0x1d60b, 0x1d60c, 0x1d60d, 0x1d60e, 0x1d60f, 0x1d610, 0x1d611, 0x1d612, 0x1d613, 0x1d614,
+    0x1d615, 0x1d616, 0x1d617, 0x1d618, 0x1d619, 0x1d61a, 0x1d61b, 0x1d61c, 0x1d61d, 0x1d61e, 0x1d61f, 0x1d620,
+    0x1d621, 0x1d622, 0x1d623, 0x1d624, 0x1d625, 0x1d626, 0x1d627, 0x1d628, 0x1d629, 0x1d62a, 0x1d62b, 0x1d62c,
+    0x1d62d, 0x1d62e, 0x1d62f, 0x1d630, 0x1d631, 0x1d632, 0x1d633, 0x1d634, 0x1d635, 0x1d636, 0x1d637, 0x1d638,
+    0x1d639, 0x1d63a, 0x1d63b, 0x1d63c, 0x1d63d, 0x1d63e, 0x1d63f, 0x1d640, 0x1d641, 0x1d642, 0x1d643, 0x1d644,
+    0x1d645, 0x1d646, 0x1d647, 0x1d648, 0x1d649, 0x1d64a, 0x1d64b, 0x1d64c, 0x1d64d, 0x1d64e, 0x1d64f, 0x1d650,
+    0x1d651, 0x1d652, 0x1d653, 0x1d654, 0x1d655, 0x1d656, 0x1d657, 0x1d658, 0x1d659, 0x1d65a, 0x1d65b, 0x1d65c,
+    0x1d65d, 0x1d65e, 0x1d65f, 0x1d660, 0x1d661, 0x1d662, 0x1d663, 0x1d664, 0x1d665, 0x1d666, 0x1d667, 0x1d668,
+    0x1d669, 0x1d66a, 0x1d66b, 0x1d66c, 0x1d66d, 0x1d66e, 0x1d66f, 0x1d670, 0x1d671, 0x1d672, 0x1d673, 0x1d674,
+    0x1d675, 0x1d676, 0x1d677, 0x1d678, 0x1d679, 0x1d67a, 0x1d67b, 0x1d67c, 0x1d67d, 0x1d67e, 0x1d67f, 0x1d680,
+    0x1d681, 0x1d682, 0x1d683, 0x1d684, 0x1d685, 0x1d686, 0x1d687, 0x1d688, 0x1d689, 0x1d68a, 0x1d68b, 0x1d68c,
+    0x1d68d, 0x1d68e, 0x1d68f, 0x1d690, 0x1d691, 0x1d692, 0x1d693, 0x1d694, 0x1d695, 0x1d696, 0x1d697, 0x1d698,
+    0x1d699, 0x1d69a, 0x1d69b, 0x1d69c, 0x1d69d, 0x1d69e, 0x1d69f, 0x1d6a0, 0x1d6a1, 0x1d6a2, 0x1d6a3, 0x1d6a4,
+    0x1d6a5, 0x1d6a8, 0x1d6a9, 0x1d6aa, 0x1d6ab, 0x1d6ac, 0x1d6ad, 0x1d6ae, 0x1d6af, 0x1d6b0, 0x1d6b1, 0x1d6b2,
+    0x1d6b3, 0x1d6b4, 0x1d6b5, 0x1d6b6, 0x1d6b7, 0x1d6b8, 0x1d6b9, 0x1d6ba, 0x1d6bb, 0x1d6bc, 0x1d6bd, 0x1d6be,
+    0x1d6bf, 0x1d6c0, 0x1d6c1, 0x1d6c2, 0x1d6c3, 0x1d6c4, 0x1d6c5, 0x1d6c6, 0x1d6c7, 0x1d6c8, 0x1d6c9, 0x1d6ca,
+    0x1d6cb, 0x1d6cc, 0x1d6cd, 0x1d6ce, 0x1d6cf, 0x1d6d0, 0x1d6d1, 0x1d6d2, 0x1d6d3, 0x1d6d4, 0x1d6d5, 0x1d6d6,
+    0x1d6d7, 0x1d6d8, 0x1d6d9, 0x1d6da, 0x1d6db, 0x1d6dc, 0x1d6dd, 0x1d6de, 0x1d6df, 0x1d6e0, 0x1d6e1, 0x1d6e2,
+    0x1d6e3, 0x1d6e4, 0x1d6e5, 0x1d6e6, 0x1d6e7, 0x1d6e8, 0x1d6e9, 0x1d6ea, 0x1d6eb, 0x1d6ec, 0x1d6ed, 0x1d6ee,
+    0x1d6ef, 0x1d6f0, 0x1d6f1, 0x1d6f2, 0x1d6f3, 0x1d6f4, 0x1d6f5, 0x1d6f6, 0x1d6f7, 0x1d6f8, 0x1d6f9, 0x1d6fa,
+    0x1d6fb, 0x1d6fc, 0x1d6fd, 0x1d6fe, 0x1d6ff, 0x1d700, 0x1d701, 0x1d702, 0x1d703, 0x1d704, 0x1d705, 0x1d706,
+    0x1d707, 0x1d708, 0x1d709, 0x1d70a, 0x1d70b, 0x1d70c, 0x1d70d, 0x1d70e, 0x1d70f, 0x1d710, 0x1d711, 0x1d712,
+    0x1d713, 0x1d714, 0x1d715, 0x1d716, 0x1d717, 0x1d718, 0x1d719, 0x1d71a, 0x1d71b, 0x1d71c, 0x1d71d, 0x1d71e,
+    0x1d71f, 0x1d720, 0x1d721, 0x1d722, 0x1d723, 0x1d724, 0x1d725, 0x1d726, 0x1d727, 0x1d728, 0x1d729, 0x1d72a,
+    0x1d72b, 0x1d72c, 0x1d72d, 0x1d72e, 0x1d72f, 0x1d730, 0x1d731, 0x1d732, 0x1d733, 0x1d734, 0x1d735, 0x1d736,
+    0x1d737, 0x1d738, 0x1d739, 0x1d73a, 0x1d73b, 0x1d73c, 0x1d73d, 0x1d73e, 0x1d73f, 0x1d740, 0x1d741, 0x1d742,
+    0x1d743, 0x1d744, 0x1d745, 0x1d746, 0x1d747, 0x1d748, 0x1d749, 0x1d74a, 0x1d74b, 0x1d74c, 0x1d74d, 0x1d74e,
+    0x1d74f, 0x1d750, 0x1d751, 0x1d752, 0x1d753, 0x1d754, 0x1d755, 0x1d756, 0x1d757, 0x1d758, 0x1d759, 0x1d75a,
+    0x1d75b, 0x1d75c, 0x1d75d, 0x1d75e, 0x1d75f, 0x1d760, 0x1d761, 0x1d762, 0x1d763, 0x1d764, 0x1d765, 0x1d766,
+    0x1d767, 0x1d768, 0x1d769, 0x1d76a, 0x1d76b, 0x1d76c, 0x1d76d, 0x1d76e, 0x1d76f, 0x1d770, 0x1d771, 0x1d772,
+    0x1d773, 0x1d774, 0x1d775, 0x1d776, 0x1d777, 0x1d778, 0x1d779, 0x1d77a, 0x1d77b, 0x1d77c, 0x1d77d, 0x1d77e,
+    0x1d77f, 0x1d780, 0x1d781, 0x1d782, 0x1d783, 0x1d784, 0x1d785, 0x1d786, 0x1d787, 0x1d788, 0x1d789, 0x1d78a,
+    0x1d78b, 0x1d78c, 0x1d78d, 0x1d78e, 0x1d78f, 0x1d790, 0x1d791, 0x1d792, 0x1d793, 0x1d794, 0x1d795, 0x1d796,
+    0x1d797, 0x1d798, 0x1d799, 0x1d79a, 0x1d79b, 0x1d79c, 0x1d79d, 0x1d79e, 0x1d79f, 0x1d7a0, 0x1d7a1, 0x1d7a2,
+    0x1d7a3, 0x1d7a4, 0x1d7a5, 0x1d7a6, 0x1d7a7, 0x1d7a8, 0x1d7a9, 0x1d7aa, 0x1d7ab, 0x1d7ac, 0x1d7ad, 0x1d7ae,
+    0x1d7af, 0x1d7b0, 0x1d7b1, 0x1d7b2, 0x1d7b3, 0x1d7b4, 0x1d7b5, 0x1d7b6, 0x1d7b7, 0x1d7b8, 0x1d7b9, 0x1d7ba,
+    0x1d7bb, 0x1d7bc, 0x1d7bd, 0x1d7be, 0x1d7bf, 0x1d7c0, 0x1d7c1, 0x1d7c2, 0x1d7c3, 0x1d7c4, 0x1d7c5, 0x1d7c6,
+    0x1d7c7, 0x1d7c8, 0x1d7c9, 0x1d7ca, 0x1d7cb, 0x1d7ce, 0x1d7cf, 0x1d7d0, 0x1d7d1, 0x1d7d2, 0x1d7d3, 0x1d7d4,
+    0x1d7d5, 0x1d7d6, 0x1d7d7, 0x1d7d8, 0x1d7d9, 0x1d7da, 0x1d7db, 0x1d7dc, 0x1d7dd, 0x1d7de, 0x1d7df, 0x1d7e0,
+    0x1d7e1, 0x1d7e2, 0x1d7e3, 0x1d7e4, 0x1d7e5, 0x1d7e6, 0x1d7e7, 0x1d7e8, 0x1d7e9, 0x1d7ea, 0x1d7eb, 0x1d7ec,
+    0x1d7ed, 0x1d7ee, 0x1d7ef, 0x1d7f0, 0x1d7f1, 0x1d7f2, 0x1d7f3, 0x1d7f4, 0x1d7f5, 0x1d7f6, 0x1d7f7, 0x1d7f8,
+    0x1d7f9, 0x1d7fa, 0x1d7fb, 0x1d7fc, 0x1d7fd, 0x1d7fe, 0x1d7ff, 0x1ee00, 0x1ee01, 0x1ee02, 0x1ee03, 0x1ee05,
+    0x1ee06, 0x1ee07, 0x1ee08, 0x1ee09, 0x1ee0a, 0x1ee0b, 0x1ee0c, 0x1ee0d, 0x1ee0e, 0x1ee0f, 0x1ee10, 0x1ee11,
+    0x1ee12, 0x1ee13, 0x1ee14, 0x1ee15, 0x1ee16, 0x1ee17, 0x1ee18, 0x1ee19, 0x1ee1a, 0x1ee1b, 0x1ee1c, 0x1ee1d,
+    0x1ee1e, 0x1ee1f, 0x1ee21, 0x1ee22, 0x1ee24, 0x1ee27, 0x1ee29, 0x1ee2a, 0x1ee2b, 0x1ee2c, 0x1ee2d, 0x1ee2e,
+    0x1ee2f, 0x1ee30, 0x1ee31, 0x1ee32, 0x1ee34, 0x1ee35, 0x1ee36, 0x1ee37, 0x1ee39, 0x1ee3b, 0x1ee42, 0x1ee47,
+    0x1ee49, 0x1ee4b, 0x1ee4d, 0x1ee4e, 0x1ee4f, 0x1ee51, 0x1ee52, 0x1ee54, 0x1ee57, 0x1ee59, 0x1ee5b, 0x1ee5d,
+    0x1ee5f, 0x1ee61, 0x1ee62, 0x1ee64, 0x1ee67, 0x1ee68, 0x1ee69, 0x1ee6a, 0x1ee6c, 0x1ee6d, 0x1ee6e, 0x1ee6f,
+    0x1ee70, 0x1ee71, 0x1ee72, 0x1ee74, 0x1ee75, 0x1ee76, 0x1ee77, 0x1ee79, 0x1ee7a, 0x1ee7b, 0x1ee7c, 0x1ee7e,
+    0x1ee80, 0x1ee81, 0x1ee82, 0x1ee83, 0x1ee84, 0x1ee85, 0x1ee86, 0x1ee87, 0x1ee88, 0x1ee89, 0x1ee8b, 0x1ee8c,
+    0x1ee8d, 0x1ee8e, 0x1ee8f, 0x1ee90, 0x1ee91, 0x1ee92, 0x1ee93, 0x1ee94, 0x1ee95, 0x1ee96, 0x1ee97, 0x1ee98,
+    0x1ee99, 0x1ee9a, 0x1ee9b, 0x1eea1, 0x1eea2, 0x1eea3, 0x1eea5, 0x1eea6, 0x1eea7, 0x1eea8, 0x1eea9, 0x1eeab,
+    0x1eeac, 0x1eead, 0x1eeae, 0x1eeaf, 0x1eeb0, 0x1eeb1, 0x1eeb2, 0x1eeb3, 0x1eeb4, 0x1eeb5, 0x1eeb6, 0x1eeb7,
+    0x1eeb8, 0x1eeb9, 0x1eeba, 0x1eebb, 0x1f100, 0x1f101, 0x1f102, 0x1f103, 0x1f104, 0x1f105, 0x1f106, 0x1f107,
+    0x1f108, 0x1f109, 0x1f10a, 0x1f110, 0x1f111, 0x1f112, 0x1f113, 0x1f114, 0x1f115, 0x1f116, 0x1f117, 0x1f118,
+    0x1f119, 0x1f11a, 0x1f11b, 0x1f11c, 0x1f11d, 0x1f11e, 0x1f11f, 0x1f120, 0x1f121, 0x1f122, 0x1f123, 0x1f124,
+    0x1f125, 0x1f126, 0x1f127, 0x1f128, 0x1f129, 0x1f12a, 0x1f12b, 0x1f12c, 0x1f12d, 0x1f12e, 0x1f130, 0x1f131,
+    0x1f132, 0x1f133, 0x1f134, 0x1f135, 0x1f136, 0x1f137, 0x1f138, 0x1f139, 0x1f13a, 0x1f13b, 0x1f13c, 0x1f13d,
+    0x1f13e, 0x1f13f, 0x1f140, 0x1f141, 0x1f142, 0x1f143, 0x1f144, 0x1f145, 0x1f146, 0x1f147, 0x1f148, 0x1f149,
+    0x1f14a, 0x1f14b, 0x1f14c, 0x1f14d, 0x1f14e, 0x1f14f, 0x1f16a, 0x1f16b, 0x1f16c, 0x1f190, 0x1f200, 0x1f201,
+    0x1f202, 0x1f210, 0x1f211, 0x1f212, 0x1f213, 0x1f214, 0x1f215, 0x1f216, 0x1f217, 0x1f218, 0x1f219, 0x1f21a,
+    0x1f21b, 0x1f21c, 0x1f21d, 0x1f21e, 0x1f21f, 0x1f220, 0x1f221, 0x1f222, 0x1f223, 0x1f224, 0x1f225, 0x1f226,
+    0x1f227, 0x1f228, 0x1f229, 0x1f22a, 0x1f22b, 0x1f22c, 0x1f22d, 0x1f22e, 0x1f22f, 0x1f230, 0x1f231, 0x1f232,
+    0x1f233, 0x1f234, 0x1f235, 0x1f236, 0x1f237, 0x1f238, 0x1f239, 0x1f23a, 0x1f23b, 0x1f240, 0x1f241, 0x1f242,
+    0x1f243, 0x1f244, 0x1f245, 0x1f246, 0x1f247, 0x1f248, 0x1f250, 0x1f251, 0x1fbf0, 0x1fbf1, 0x1fbf2, 0x1fbf3,
+    0x1fbf4, 0x1fbf5, 0x1fbf6, 0x1fbf7, 0x1fbf8, 0x1fbf9,
+};
+
+// Where the decomposition of each of compat_keys starts in compat_pool, and one more for the end
+static const uint16_t compat_offsets[3751] = {
+        0,     1,     3,     4,     6,     7,     8,    10,    11,    13,    14,    15,    18,    21,    24,    26,
+       28,    30,    32,    34,    35,    38,    41,    44,    46,    48,    50,    52,    54,    56,    58,    60,
+       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,    73,    75,    77,    79,    81,    83,
+       84,    85,    86,    87,    88,    90,    92,    95,    96,    97,    98,   100,   102,   103,   104,   105,
+      106,   107,   108,   109,   110,   112,   114,   116,   118,   120,   122,   124,   126,   128,   129,   132,
+      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      151,   152,   153,   154,   155,   156,   157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      167,   168,   169,   170,   171,   172,   173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+      183,   184,   185,   186,   187,   188,   189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+      199,   200,   201,   202,   203,   204,   205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+      231,   232,   233,   234,   236,   238,   240,   242,   244,   247,   250,   253,   256,   259,   262,   265,
+      268,   271,   273,   275,   276,   277,   278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+      289,   290,   292,   295,   296,   298,   301,   303,   306,   308,   310,   312,   314,   316,   320,   321,
+      322,   323,   324,   325,   326,   327,   328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+      338,   339,   340,   341,   342,   343,   344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+      354,   355,   356,   357,   358,   359,   360,   361,   362,   363,   365,   368,   371,   372,   374,   377,
+      380,   381,   383,   384,   385,   386,   387,   388,   389,   390,   391,   392,   393,   394,   396,   397,
+      398,   399,   400,   401,   403,   406,   408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+      418,   419,   420,   421,   422,   425,   426,   427,   428,   429,   430,   431,   432,   433,   434,   435,
+      438,   441,   445,   448,   451,   454,   457,   460,   463,   466,   469,   472,   475,   478,   481,   483,
+      484,   486,   489,   491,   492,   494,   497,   501,   503,   504,   506,   509,   510,   511,   512,   513,
+      514,   516,   519,   521,   522,   524,   527,   531,   533,   534,   536,   539,   540,   541,   542,   543,
+      546,   548,   551,   553,   556,   557,   558,   559,   560,   561,   562,   563,   564,   565,   567,   569,
+      571,   573,   575,   577,   579,   581,   583,   585,   587,   590,   593,   596,   599,   602,   605,   608,
+      611,   614,   618,   622,   626,   630,   634,   638,   642,   646,   650,   654,   658,   660,   662,   664,
+      666,   668,   670,   672,   674,   676,   679,   682,   685,   688,   691,   694,   697,   700,   703,   706,
+      709,   712,   715,   718,   721,   724,   727,   730,   733,   736,   739,   742,   745,   748,   751,   754,
+      757,   760,   763,   766,   769,   772,   775,   778,   781,   784,   787,   788,   789,   790,   791,   792,
+      793,   794,   795,   796,   797,   798,   799,   800,   801,   802,   803,   804,   805,   806,   807,   808,
+      809,   810,   811,   812,   813,   814,   815,   816,   817,   818,   819,   820,   821,   822,   823,   824,
+      825,   826,   827,   828,   829,   830,   831,   832,   833,   834,   835,   836,   837,   838,   839,   840,
+      844,   847,   849,   852,   853,   854,   855,   856,   857,   858,   859,   860,   861,   862,   863,   864,
+      865,   866,   867,   868,   869,   870,   871,   872,   873,   874,   875,   876,   877,   878,   879,   880,
+      881,   882,   883,   884,   885,   886,   887,   888,   889,   890,   891,   892,   893,   894,   895,   896,
+      897,   898,   899,   900,   901,   902,   903,   904,   905,   906,   907,   908,   909,   910,   911,   912,
+      913,   914,   915,   916,   917,   918,   919,   920,   921,   922,   923,   924,   925,   926,   927,   928,
+      929,   930,   931,   932,   933,   934,   935,   936,   937,   938,   939,   940,   941,   942,   943,   944,
+      945,   946,   947,   948,   949,   950,   951,   952,   953,   954,   955,   956,   957,   958,   959,   960,
+      961,   962,   963,   964,   965,   966,   967,   968,   969,   970,   971,   972,   973,   974,   975,   976,
+      977,   978,   979,   980,   981,   982,   983,   984,   985,   986,   987,   988,   989,   990,   991,   992,
+      993,   994,   995,   996,   997,   998,   999,  1000,  1001,  1002,  1003,  1004,  1005,  1006,  1007,  1008,
+     1009,  1010,  1011,  1012,  1013,  1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,  1024,
+     1025,  1026,  1027,  1028,  1029,  1030,  1031,  1032,  1033,  1034,  1035,  1036,  1037,  1038,  1039,  1040,
+     1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,  1050,  1051,  1052,  1053,  1054,  1055,  1056,
+     1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,
+     1073,  1074,  1075,  1076,  1078,  1080,  1082,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,
+     1093,  1094,  1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,  1105,  1106,  1107,  1108,
+     1109,  1110,  1111,  1112,  1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,
+     1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,  1136,  1137,  1138,  1139,  1140,
+     1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,  1149,  1150,  1151,  1152,  1153,  1154,  1155,  1156,
+     1157,  1158,  1159,  1160,  1161,  1162,  1163,  1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,  1172,
+     1173,  1174,  1175,  1176,  1177,  1178,  1179,  1180,  1181,  1182,  1183,  1184,  1185,  1186,  1187,  1188,
+     1189,  1190,  1191,  1192,  1195,  1198,  1201,  1204,  1207,  1210,  1213,  1216,  1219,  1222,  1225,  1228,
+     1231,  1234,  1238,  1242,  1246,  1250,  1254,  1258,  1262,  1266,  1270,  1274,  1278,  1282,  1286,  1290,
+     1294,  1301,  1307,  1310,  1313,  1316,  1319,  1322,  1325,  1328,  1331,  1334,  1337,  1340,  1343,  1346,
+     1349,  1352,  1355,  1358,  1361,  1364,  1367,  1370,  1373,  1376,  1379,  1382,  1385,  1388,  1391,  1394,
+     1397,  1400,  1403,  1406,  1409,  1412,  1415,  1416,  1417,  1418,  1419,  1422,  1424,  1426,  1428,  1430,
+     1432,  1434,  1436,  1438,  1440,  1442,  1444,  1446,  1448,  1450,  1452,  1453,  1454,  1455,  1456,  1457,
+     1458,  1459,  1460,  1461,  1462,  1463,  1464,  1465,  1466,  1468,  1470,  1472,  1474,  1476,  1478,  1480,
+     1482,  1484,  1486,  1488,  1490,  1492,  1494,  1499,  1503,  1505,  1506,  1507,  1508,  1509,  1510,  1511,
+     1512,  1513,  1514,  1515,  1516,  1517,  1518,  1519,  1520,  1521,  1522,  1523,  1524,  1525,  1526,  1527,
+     1528,  1529,  1530,  1531,  1532,  1533,  1534,  1535,  1536,  1537,  1538,  1539,  1540,  1541,  1542,  1543,
+     1544,  1545,  1546,  1547,  1548,  1549,  1550,  1551,  1552,  1553,  1554,  1556,  1558,  1560,  1562,  1564,
+     1566,  1568,  1570,  1572,  1574,  1576,  1578,  1580,  1582,  1584,  1586,  1588,  1590,  1592,  1594,  1596,
+     1598,  1600,  1602,  1605,  1608,  1611,  1613,  1616,  1618,  1621,  1622,  1623,  1624,  1625,  1626,  1627,
+     1628,  1629,  1630,  1631,  1632,  1633,  1634,  1635,  1636,  1637,  1638,  1639,  1640,  1641,  1642,  1643,
+     1644,  1645,  1646,  1647,  1648,  1649,  1650,  1651,  1652,  1653,  1654,  1655,  1656,  1657,  1658,  1659,
+     1660,  1661,  1662,  1663,  1664,  1665,  1666,  1667,  1668,  1670,  1675,  1679,  1684,  1687,  1692,  1695,
+     1698,  1704,  1708,  1711,  1714,  1717,  1721,  1725,  1729,  1733,  1737,  1741,  1745,  1751,  1753,  1759,
+     1765,  1770,  1774,  1780,  1786,  1790,  1793,  1796,  1800,  1804,  1809,  1814,  1817,  1820,  1824,  1827,
+     1830,  1832,  1834,  1837,  1840,  1846,  1850,  1855,  1861,  1865,  1868,  1871,  1877,  1881,  1887,  1890,
+     1895,  1898,  1902,  1905,  1909,  1914,  1918,  1923,  1927,  1929,  1934,  1937,  1940,  1944,  1947,  1950,
+     1953,  1958,  1962,  1964,  1970,  1973,  1978,  1982,  1986,  1989,  1992,  1996,  1998,  2002,  2007,  2009,
+     2015,  2018,  2020,  2022,  2024,  2026,  2028,  2030,  2032,  2034,  2036,  2038,  2041,  2044,  2047,  2050,
+     2053,  2056,  2059,  2062,  2065,  2068,  2071,  2074,  2077,  2080,  2083,  2086,  2088,  2090,  2093,  2095,
+     2097,  2099,  2102,  2105,  2107,  2109,  2111,  2113,  2115,  2119,  2121,  2123,  2125,  2127,  2129,  2131,
+     2133,  2135,  2138,  2142,  2144,  2146,  2148,  2150,  2152,  2154,  2156,  2159,  2162,  2165,  2168,  2170,
+     2172,  2174,  2176,  2178,  2180,  2182,  2184,  2186,  2188,  2191,  2194,  2196,  2199,  2202,  2205,  2207,
+     2210,  2213,  2217,  2219,  2222,  2225,  2228,  2231,  2236,  2242,  2244,  2246,  2248,  2250,  2252,  2254,
+     2256,  2258,  2260,  2262,  2264,  2266,  2268,  2270,  2272,  2274,  2276,  2278,  2282,  2284,  2286,  2288,
+     2292,  2295,  2297,  2299,  2301,  2303,  2305,  2307,  2309,  2311,  2313,  2315,  2318,  2320,  2322,  2325,
+     2328,  2330,  2334,  2337,  2339,  2341,  2343,  2345,  2348,  2351,  2353,  2355,  2357,  2359,  2361,  2363,
+     2365,  2367,  2369,  2372,  2375,  2378,  2381,  2384,  2387,  2390,  2393,  2396,  2399,  2402,  2405,  2408,
+     2411,  2414,  2417,  2420,  2423,  2426,  2429,  2432,  2435,  2438,  2439,  2440,  2441,  2442,  2443,  2444,
+     2445,  2446,  2447,  2448,  2449,  2450,  2451,  2453,  2455,  2457,  2460,  2463,  2465,  2467,  2469,  2471,
+     2473,  2475,  2477,  2478,  2479,  2480,  2481,  2482,  2483,  2484,  2485,  2486,  2487,  2489,  2490,  2491,
+     2492,  2493,  2494,  2495,  2496,  2497,  2498,  2499,  2500,  2501,  2502,  2503,  2504,  2505,  2506,  2507,
+     2508,  2509,  2510,  2511,  2512,  2513,  2514,  2515,  2516,  2517,  2518,  2519,  2520,  2521,  2522,  2523,
+     2524,  2525,  2526,  2527,  2528,  2529,  2530,  2531,  2532,  2533,  2534,  2535,  2536,  2537,  2538,  2539,
+     2540,  2541,  2542,  2543,  2544,  2545,  2546,  2547,  2548,  2549,  2550,  2551,  2552,  2553,  2554,  2555,
+     2556,  2557,  2558,  2559,  2560,  2561,  2562,  2563,  2564,  2565,  2566,  2567,  2568,  2569,  2570,  2571,
+     2572,  2573,  2575,  2577,  2578,  2579,  2580,  2581,  2582,  2583,  2584,  2585,  2586,  2587,  2589,  2591,
+     2592,  2593,  2594,  2595,  2596,  2597,  2598,  2599,  2600,  2601,  2603,  2604,  2605,  2606,  2607,  2608,
+     2609,  2610,  2611,  2612,  2613,  2614,  2615,  2618,  2621,  2624,  2627,  2630,  2633,  2636,  2639,  2642,
+     2645,  2648,  2651,  2654,  2657,  2660,  2663,  2666,  2669,  2670,  2671,  2672,  2673,  2676,  2679,  2682,
+     2685,  2688,  2690,  2692,  2694,  2696,  2698,  2700,  2702,  2704,  2706,  2708,  2710,  2712,  2714,  2716,
+     2718,  2720,  2722,  2724,  2726,  2728,  2730,  2732,  2734,  2736,  2738,  2740,  2742,  2744,  2746,  2748,
+     2750,  2752,  2754,  2756,  2758,  2760,  2762,  2764,  2766,  2768,  2770,  2772,  2774,  2776,  2778,  2780,
+     2782,  2784,  2786,  2788,  2790,  2792,  2794,  2796,  2798,  2800,  2802,  2804,  2806,  2808,  2810,  2812,
+     2814,  2816,  2818,  2820,  2822,  2824,  2826,  2828,  2830,  2832,  2834,  2836,  2838,  2840,  2842,  2844,
+     2846,  2848,  2850,  2852,  2854,  2856,  2858,  2860,  2862,  2864,  2866,  2869,  2872,  2875,  2878,  2881,
+     2884,  2887,  2890,  2893,  2896,  2899,  2902,  2904,  2906,  2908,  2910,  2912,  2914,  2916,  2918,  2920,
+     2922,  2924,  2926,  2928,  2930,  2932,  2934,  2936,  2938,  2940,  2942,  2944,  2946,  2948,  2950,  2952,
+     2954,  2956,  2958,  2960,  2962,  2964,  2966,  2968,  2970,  2972,  2974,  2976,  2978,  2980,  2982,  2984,
+     2986,  2988,  2990,  2992,  2995,  2998,  3001,  3004,  3007,  3009,  3011,  3013,  3015,  3017,  3019,  3021,
+     3023,  3025,  3027,  3029,  3031,  3033,  3035,  3037,  3039,  3041,  3043,  3045,  3047,  3049,  3051,  3053,
+     3055,  3057,  3059,  3061,  3063,  3065,  3067,  3069,  3071,  3073,  3075,  3077,  3079,  3081,  3083,  3085,
+     3087,  3089,  3091,  3093,  3095,  3097,  3099,  3101,  3103,  3105,  3107,  3109,  3111,  3113,  3115,  3117,
+     3119,  3121,  3123,  3125,  3127,  3129,  3131,  3133,  3135,  3137,  3139,  3141,  3144,  3147,  3149,  3151,
+     3153,  3155,  3157,  3159,  3161,  3163,  3165,  3167,  3169,  3171,  3173,  3175,  3177,  3179,  3181,  3184,
+     3187,  3190,  3192,  3194,  3196,  3198,  3200,  3202,  3204,  3206,  3208,  3210,  3212,  3214,  3216,  3218,
+     3220,  3222,  3224,  3226,  3228,  3230,  3232,  3234,  3236,  3238,  3240,  3242,  3244,  3246,  3248,  3250,
+     3252,  3254,  3256,  3258,  3260,  3262,  3264,  3266,  3268,  3270,  3272,  3274,  3276,  3278,  3280,  3282,
+     3284,  3286,  3288,  3290,  3292,  3294,  3296,  3298,  3300,  3302,  3304,  3306,  3308,  3310,  3312,  3314,
+     3316,  3318,  3320,  3322,  3324,  3326,  3328,  3330,  3332,  3334,  3336,  3339,  3342,  3345,  3348,  3351,
+     3354,  3357,  3360,  3363,  3366,  3369,  3372,  3375,  3378,  3381,  3384,  3387,  3390,  3393,  3396,  3399,
+     3402,  3405,  3408,  3411,  3414,  3417,  3420,  3423,  3426,  3429,  3432,  3435,  3438,  3441,  3444,  3447,
+     3450,  3453,  3456,  3459,  3462,  3465,  3468,  3471,  3474,  3477,  3480,  3483,  3486,  3489,  3492,  3495,
+     3498,  3501,  3504,  3507,  3510,  3513,  3516,  3519,  3522,  3525,  3528,  3531,  3534,  3537,  3540,  3543,
+     3546,  3549,  3552,  3555,  3558,  3561,  3564,  3567,  3570,  3573,  3576,  3579,  3582,  3585,  3588,  3591,
+     3594,  3597,  3600,  3603,  3606,  3609,  3612,  3615,  3618,  3621,  3624,  3627,  3630,  3633,  3636,  3639,
+     3642,  3645,  3648,  3651,  3654,  3657,  3660,  3663,  3666,  3669,  3672,  3675,  3678,  3681,  3684,  3687,
+     3690,  3693,  3696,  3700,  3704,  3708,  3712,  3716,  3720,  3724,  3727,  3745,  3753,  3757,  3758,  3759,
+     3760,  3761,  3762,  3763,  3764,  3765,  3766,  3769,  3771,  3772,  3773,  3774,  3775,  3776,  3777,  3778,
+     3779,  3780,  3781,  3782,  3783,  3784,  3785,  3786,  3787,  3788,  3789,  3790,  3791,  3792,  3793,  3795,
+     3797,  3799,  3801,  3802,  3803,  3804,  3805,  3806,  3807,  3808,  3809,  3810,  3811,  3812,  3813,  3814,
+     3815,  3816,  3817,  3818,  3819,  3820,  3821,  3822,  3823,  3824,  3825,  3826,  3827,  3828,  3829,  3830,
+     3832,  3834,  3836,  3838,  3840,  3842,  3844,  3846,  3848,  3850,  3852,  3854,  3856,  3858,  3859,  3861,
+     3863,  3865,  3867,  3869,  3871,  3873,  3875,  3877,  3879,  3881,  3883,  3884,  3885,  3886,  3887,  3888,
+     3889,  3890,  3891,  3892,  3893,  3894,  3895,  3896,  3897,  3898,  3899,  3900,  3901,  3902,  3903,  3904,
+     3905,  3906,  3907,  3908,  3909,  3910,  3911,  3912,  3913,  3914,  3915,  3916,  3917,  3918,  3919,  3920,
+     3921,  3922,  3923,  3924,  3925,  3926,  3927,  3928,  3929,  3930,  3931,  3932,  3933,  3934,  3935,  3936,
+     3937,  3938,  3939,  3940,  3941,  3942,  3943,  3944,  3945,  3946,  3947,  3948,  3949,  3950,  3951,  3952,
+     3953,  3954,  3955,  3956,  3957,  3958,  3959,  3960,  3961,  3962,  3963,  3964,  3965,  3966,  3967,  3968,
+     3969,  3970,  3971,  3972,  3973,  3974,  3975,  3976,  3977,  3978,  3979,  3980,  3981,  3982,  3983,  3984,
+     3985,  3986,  3987,  3990,  3993,  3996,  3999,  4002,  4005,  4007,  4009,  4010,  4011,  4012,  4013,  4014,
+     4015,  4016,  4017,  4018,  4019,  4020,  4021,  4022,  4023,  4024,  4025,  4026,  4027,  4028,  4029,  4030,
+     4031,  4032,  4033,  4034,  4035,  4036,  4037,  4038,  4039,  4040,  4041,  4042,  4043,  4044,  4045,  4046,
+     4047,  4048,  4049,  4050,  4051,  4052,  4053,  4054,  4055,  4056,  4057,  4058,  4059,  4060,  4061,  4062,
+     4063,  4064,  4065,  4066,  4067,  4068,  4069,  4070,  4071,  4072,  4073,  4074,  4075,  4076,  4077,  4078,
+     4079,  4080,  4081,  4082,  4083,  4084,  4085,  4086,  4087,  4088,  4089,  4090,  4091,  4092,  4093,  4094,
+     4095,  4096,  4097,  4098,  4099,  4100,  4101,  4102,  4103,  4104,  4105,  4106,  4107,  4108,  4109,  4110,
+     4111,  4112,  4113,  4114,  4115,  4116,  4117,  4118,  4119,  4120,  4121,  4122,  4123,  4124,  4125,  4126,
+     4127,  4128,  4129,  4130,  4131,  4132,  4133,  4134,  4135,  4136,  4137,  4138,  4139,  4140,  4141,  4142,
+     4143,  4144,  4145,  4146,  4147,  4148,  4149,  4150,  4151,  4152,  4153,  4154,  4155,  4156,  4157,  4158,
+     4159,  4160,  4161,  4162,  4163,  4164,  4165,  4166,  4167,  4168,  4169,  4170,  4171,  4172,  4173,  4174,
+     4175,  4176,  4177,  4178,  4179,  4180,  4181,  4182,  4183,  4184,  4185,  4186,  4187,  4188,  4189,  4190,
+     4191,  4192,  4193,  4194,  4195,  4196,  4197,  4198,  4199,  4200,  4201,  4202,  4203,  4204,  4205,  4206,
+     4207,  4208,  4209,  4210,  4211,  4212,  4213,  4214,  4215,  4216,  4217,  4218,  4219,  4220,  4221,  4222,
+     4223,  4225,  4226,  4227,  4228,  4229,  4230,  4231,  4232,  4233,  4234,  4235,  4236,  4237,  4238,  4239,
+     4240,  4241,  4242,  4243,  4244,  4245,  4246,  4247,  4248,  4249,  4250,  4251,  4252,  4253,  4254,  4255,
+     4256,  4257,  4258,  4259,  4260,  4261,  4263,  4264,  4265,  4267,  4268,  4270,  4271,  4272,  4273,  4274,
+     4275,  4277,  4278,  4279,  4280,  4281,  4282,  4283,  4284,  4285,  4286,  4287,  4288,  4289,  4290,  4291,
+     4292,  4293,  4295,  4297,  4298,  4299,  4300,  4301,  4302,  4303,  4304,  4305,  4306,  4307,  4308,  4309,
+     4310,  4311,  4312,  4313,  4314,  4315,  4316,  4317,  4318,  4319,  4320,  4321,  4322,  4323,  4324,  4325,
+     4326,  4327,  4328,  4329,  4330,  4331,  4332,  4333,  4334,  4335,  4336,  4337,  4338,  4339,  4340,  4341,
+     4342,  4343,  4344,  4345,  4346,  4347,  4348,  4349,  4350,  4351,  4352,  4353,  4354,  4355,  4356,  4357,
+     4358,  4359,  4360,  4361,  4362,  4363,  4364,  4365,  4366,  4367,  4368,  4369,  4370,  4371,  4372,  4373,
+     4374,  4375,  4376,  4377,  4378,  4379,  4380,  4381,  4382,  4383,  4384,  4385,  4386,  4387,  4388,  4389,
+     4390,  4391,  4392,  4393,  4394,  4395,  4396,  4397,  4398,  4399,  4400,  4401,  4402,  4403,  4404,  4405,
+     4406,  4407,  4408,  4409,  4410,  4411,  4412,  4413,  4414,  4415,  4416,  4417,  4418,  4419,  4420,  4421,
+     4422,  4423,  4424,  4425,  4426,  4427,  4428,  4429,  4430,  4431,  4432,  4433,  4434,  4435,  4436,  4437,
+     4438,  4439,  4440,  4441,  4442,  4443,  4444,  4445,  4446,  4447,  4448,  4449,  4450,  4451,  4452,  4453,
+     4454,  4455,  4456,  4457,  4458,  4459,  4460,  4461,  4462,  4463,  4464,  4465,  4466,  4467,  4468,  4469,
+     4470,  4471,  4472,  4473,  4474,  4475,  4476,  4477,  4478,  4479,  4480,  4481,  4482,  4483,  4484,  4485,
+     4486,  4487,  4488,  4489,  4490,  4491,  4492,  4493,  4494,  4495,  4496,  4497,  4498,  4499,  4500,  4501,
+     4502,  4503,  4504,  4505,  4506,  4507,  4508,  4509,  4510,  4511,  4512,  4513,  4514,  4515,  4516,  4517,
+     4518,  4519,  4520,  4521,  4522,  4523,  4524,  4525,  4526,  4527,  4528,  4529,  4530,  4531,  4532,  4533,
+     4534,  4535,  4536,  4537,  4538,  4539,  4540,  4541,  4542,  4543,  4544,  4545,  4546,  4547,  4548,  4549,
+     4550,  4551,  4552,  4553,  4554,  4555,  4556,  4557,  4558,  4559,  4560,  4561,  4562,  4563,  4564,  4565,
+     4566,  4567,  4568,  4569,  4570,  4571,  4572,  4573,  4574,  4575,  4576,  4577,  4578,  4579,  4580,  4581,
+     4582,  4583,  4584,  4585,  4586,  4587,  4588,  4589,  4590,  4591,  4592,  4593,  4594,  4595,  4596,  4597,
+     4598,  4599,  4600,  4601,  4602,  4603,  4604,  4605,  4606,  4607,  4608,  4609,  4610,  4611,  4612,  4613,
+     4614,  4615,  4616,  4617,  4618,  4619,  4620,  4621,  4622,  4623,  4624,  4625,  4626,  4627,  4628,  4629,
+     4630,  4631,  4632,  4633,  4634,  4635,  4636,  4637,  4638,  4639,  4640,  4641,  4642,  4643,  4644,  4645,
+     4646,  4647,  4648,  4649,  4650,  4651,  4652,  4653,  4654,  4655,  4656,  4657,  4658,  4659,  4660,  4661,
+     4662,  4663,  4664,  4665,  4666,  4667,  4668,  4669,  4670,  4671,  4672,  4673,  4674,  4675,  4676,  4677,
+     4678,  4679,  4680,  4681,  4682,  4683,  4684,  4685,  4686,  4687,  4688,  4689,  4690,  4691,  4692,  4693,
+     4694,  4695,  4696,  4697,  4698,  4699,  4700,  4701,  4702,  4703,  4704,  4705,  4706,  4707,  4708,  4709,
+     4710,  4711,  4712,  4713,  4714,  4715,  4716,  4717,  4718,  4719,  4720,  4721,  4722,  4723,  4724,  4725,
+     4726,  4727,  4728,  4729,  4730,  4731,  4732,  4733,  4734,  4735,  4736,  4737,  4738,  4739,  4740,  4741,
+     4742,  4743,  4744,  4745,  4746,  4747,  4748,  4749,  4750,  4751,  4752,  4753,  4754,  4755,  4756,  4757,
+     4758,  4759,  4760,  4761,  4762,  4763,  4764,  4765,  4766,  4767,  4768,  4769,  4770,  4771,  4772,  4773,
+     4774,  4775,  4776,  4777,  4778,  4779,  4780,  4781,  4782,  4783,  4784,  4785,  4786,  4787,  4788,  4789,
+     4790,  4791,  4792,  4793,  4794,  4795,  4796,  4797,  4798,  4799,  4800,  4801,  4802,  4803,  4804,  4805,
+     4806,  4807,  4808,  4809,  4810,  4811,  4812,  4813,  4814,  4815,  4816,  4817,  4818,  4819,  4820,  4821,
+     4822,  4823,  4824,  4825,  4826,  4827,  4828,  4829,  4830,  4831,  4832,  4833,  4834,  4835,  4836,  4837,
+     4838,  4839,  4840,  4841,  4842,  4843,  4844,  4845,  4846,  4847,  4848,  4849,  4850,  4851,  4852,  4853,
+     4854,  4855,  4856,  4857,  4858,  4859,  4860,  4861,  4862,  4863,  4864,  4865,  4866,  4867,  4868,  4869,
+     4870,  4871,  4872,  4873,  4874,  4875,  4876,  4877,  4878,  4879,  4880,  4881,  4882,  4883,  4884,  4885,
+     4886,  4887,  4888,  4889,  4890,  4891,  4892,  4893,  4894,  4895,  4896,  4897,  4898,  4899,  4900,  4901,
+     4902,  4903,  4904,  4905,  4906,  4907,  4908,  4909,  4910,  4911,  4912,  4913,  4914,  4915,  4916,  4917,
+     4918,  4919,  4920,  4921,  4922,  4923,  4924,  4925,  4926,  4927,  4928,  4929,  4930,  4931,  4932,  4933,
+     4934,  4935,  4936,  4937,  4938,  4939,  4940,  4941,  4942,  4943,  4944,  4945,  4946,  4947,  4948,  4949,
+     4950,  4951,  4952,  4953,  4954,  4955,  4956,  4957,  4958,  4959,  4960,  4961,  4962,  4963,  4964,  4965,
+     4966,  4967,  4968,  4969,  4970,  4971,  4972,  4973,  4974,  4975,  4976,  4977,  4978,  4979,  4980,  4981,
+     4982,  4983,  4984,  4985,  4986,  4987,  4988,  4989,  4990,  4991,  4992,  4993,  4994,  4995,  4996,  4997,
+     4998,  4999,  5000,  5001,  5002,  5003,  5004,  5005,  5006,  5007,  5008,  5009,  5010,  5011,  5012,  5013,
+     5014,  5015,  5016,  5017,  5018,  5019,  5020,  5021,  5022,  5023,  5024,  5025,  5026,  5027,  5028,  5029,
+     5030,  5031,  5032,  5033,  5034,  5035,  5036,  5037,  5038,  5039,  5040,  5041,  5042,  5043,  5044,  5045,
+     5046,  5047,  5048,  5049,  5050,  5051,  5052,  5053,  5054,  5055,  5056,  5057,  5058,  5059,  5060,  5061,
+     5062,  5063,  5064,  5065,  5066,  5067,  5068,  5069,  5070,  5071,  5072,  5073,  5074,  5075,  5076,  5077,
+     5078,  5079,  5080,  5081,  5082,  5083,  5084,  5085,  5086,  5087,  5088,  5089,  5090,  5091,  5092,  5093,
+     5094,  5095,  5096,  5097,  5098,  5099,  5100,  5101,  5102,  5103,  5104,  5105,  5106,  5107,  5108,  5109,
+     5110,  5111,  5112,  5113,  5114,  5115,  5116,  5117,  5118,  5119,  5120,  5121,  5122,  5123,  5124,  5125,
+     5126,  5127,  5128,  5129,  5130,  5131,  5132,  5133,  5134,  5135,  5136,  5137,  5138,  5139,  5140,  5141,
+     5142,  5143,  5144,  5145,  5146,  5147,  5148,  5149,  5150,  5151,  5152,  5153,  5154,  5155,  5156,  5157,
+     5158,  5159,  5160,  5161,  5162,  5163,  5164,  5165,  5166,  5167,  5168,  5169,  5170,  5171,  5172,  5173,
+     5174,  5175,  5176,  5177,  5178,  5179,  5180,  5181,  5182,  5183,  5184,  5185,  5186,  5187,  5188,  5189,
+     5190,  5191,  5192,  5193,  5194,  5195,  5196,  5197,  5198,  5199,  5200,  5201,  5202,  5203,  5204,  5205,
+     5206,  5207,  5208,  5209,  5210,  5211,  5212,  5213,  5214,  5215,  5216,  5217,  5218,  5219,  5220,  5221,
+     5222,  5223,  5224,  5225,  5226,  5227,  5228,  5229,  5230,  5231,  5232,  5233,  5234,  5235,  5236,  5237,
+     5238,  5239,  5240,  5241,  5242,  5243,  5244,  5245,  5246,  5247,  5248,  5249,  5250,  5251,  5252,  5253,
+     5254,  5255,  5256,  5257,  5258,  5259,  5260,  5261,  5262,  5263,  5264,  5265,  5266,  5267,  5268,  5269,
+     5270,  5271,  5272,  5273,  5274,  5275,  5276,  5277,  5278,  5279,  5280,  5281,  5282,  5283,  5284,  5285,
+     5286,  5287,  5288,  5289,  5290,  5291,  5292,  5293,  5294,  5295,  5296,  5297,  5298,  5299,  5300,  5301,
+     5302,  5303,  5304,  5305,  5306,  5307,  5308,  5309,  5310,  5311,  5312,  5313,  5314,  5315,  5316,  5317,
+     5318,  5319,  5320,  5321,  5322,  5323,  5324,  5325,  5326,  5327,  5328,  5329,  5330,  5331,  5332,  5333,
+     5334,  5335,  5336,  5337,  5338,  5339,  5340,  5341,  5342,  5343,  5344,  5345,  5346,  5347,  5348,  5349,
+     5350,  5351,  5352,  5353,  5354,  5355,  5356,  5357,  5358,  5359,  5360,  5361,  5362,  5363,  5364,  5365,
+     5366,  5367,  5368,  5369,  5370,  5371,  5372,  5373,  5374,  5375,  5376,  5377,  5378,  5379,  5380,  5381,
+     5382,  5383,  5384,  5385,  5386,  5387,  5388,  5389,  5390,  5391,  5392,  5393,  5394,  5395,  5396,  5397,
+     5398,  5399,  5400,  5401,  5402,  5403,  5404,  5405,  5406,  5407,  5408,  5409,  5410,  5411,  5412,  5413,
+     5414,  5415,  5416,  5417,  5418,  5419,  5420,  5421,  5422,  5423,  5424,  5425,  5426,  5427,  5428,  5429,
+     5430,  5431,  5432,  5433,  5434,  5436,  5438,  5440,  5442,  5444,  5446,  5448,  5450,  5452,  5454,  5456,
+     5459,  5462,  5465,  5468,  5471,  5474,  5477,  5480,  5483,  5486,  5489,  5492,  5495,  5498,  5501,  5504,
+     5507,  5510,  5513,  5516,  5519,  5522,  5525,  5528,  5531,  5534,  5537,  5538,  5539,  5541,  5543,  5544,
+     5545,  5546,  5547,  5548,  5549,  5550,  5551,  5552,  5553,  5554,  5555,  5556,  5557,  5558,  5559,  5560,
+     5561,  5562,  5563,  5564,  5565,  5566,  5567,  5568,  5569,  5571,  5573,  5575,  5577,  5580,  5582,  5584,
+     5586,  5588,  5590,  5592,  5594,  5595,  5596,  5597,  5598,  5600,  5601,  5602,  5603,  5604,  5605,  5606,
+     5607,  5608,  5609,  5610,  5611,  5612,  5613,  5614,  5615,  5616,  5617,  5618,  5619,  5620,  5621,  5622,
+     5623,  5624,  5625,  5626,  5627,  5628,  5629,  5630,  5631,  5632,  5633,  5634,  5635,  5636,  5637,  5638,
+     5639,  5640,  5643,  5646,  5649,  5652,  5655,  5658,  5661,  5664,  5667,  5668,  5669,  5670,  5671,  5672,
+     5673,  5674,  5675,  5676,  5677,  5678,  5679,
+};
+
+// The decompositions, in UTF-16
+static const uint16_t compat_pool[5679] = {
+    0x0020, 0x0020, 0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301, 0x03bc, 0x0020,
+    0x0327, 0x0031, 0x006f, 0x0031, 0x2044, 0x0034, 0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034,
+    0x0049, 0x004a, 0x0069, 0x006a, 0x004c, 0x00b7, 0x006c, 0x00b7, 0x02bc, 0x006e, 0x0073, 0x0044,
+    0x005a, 0x030c, 0x0044, 0x007a, 0x030c, 0x0064, 0x007a, 0x030c, 0x004c, 0x004a, 0x004c, 0x006a,
+    0x006c, 0x006a, 0x004e, 0x004a, 0x004e, 0x006a, 0x006e, 0x006a, 0x0044, 0x005a, 0x0044, 0x007a,
+    0x0064, 0x007a, 0x0068, 0x0266, 0x006a, 0x0072, 0x0279, 0x027b, 0x0281, 0x0077, 0x0079, 0x0020,
+    0x0306, 0x0020, 0x0307, 0x0020, 0x030a, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020, 0x030b, 0x0263,
+    0x006c, 0x0073, 0x0078, 0x0295, 0x0020, 0x0345, 0x0020, 0x0301, 0x0020, 0x0308, 0x0301, 0x03b2,
+    0x03b8, 0x03a5, 0x03a5, 0x0301, 0x03a5, 0x0308, 0x03c6, 0x03c0, 0x03ba, 0x03c1, 0x03c2, 0x0398,
+    0x03b5, 0x03a3, 0x0565, 0x0582, 0x0627, 0x0674, 0x0648, 0x0674, 0x06c7, 0x0674, 0x064a, 0x0674,
+    0x0e4d, 0x0e32, 0x0ecd, 0x0eb2, 0x0eab, 0x0e99, 0x0eab, 0x0ea1, 0x0f0b, 0x0fb2, 0x0f71, 0x0f80,
+    0x0fb3, 0x0f71, 0x0f80, 0x10dc, 0x0041, 0x00c6, 0x0042, 0x0044, 0x0045, 0x018e, 0x0047, 0x0048,
+    0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055,
+    0x0057, 0x0061, 0x0250, 0x0251, 0x1d02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025b, 0x025c, 0x0067,
+    0x006b, 0x006d, 0x014b, 0x006f, 0x0254, 0x1d16, 0x1d17, 0x0070, 0x0074, 0x0075, 0x1d1d, 0x026f,
+    0x0076, 0x1d25, 0x03b2, 0x03b3, 0x03b4, 0x03c6, 0x03c7, 0x0069, 0x0072, 0x0075, 0x0076, 0x03b2,
+    0x03b3, 0x03c1, 0x03c6, 0x03c7, 0x043d, 0x0252, 0x0063, 0x0255, 0x00f0, 0x025c, 0x0066, 0x025f,
+    0x0261, 0x0265, 0x0268, 0x0269, 0x026a, 0x1d7b, 0x029d, 0x026d, 0x1d85, 0x029f, 0x0271, 0x0270,
+    0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01ab, 0x0289, 0x028a, 0x1d1c, 0x028b,
+    0x028c, 0x007a, 0x0290, 0x0291, 0x0292, 0x03b8, 0x0061, 0x02be, 0x0073, 0x0307, 0x0020, 0x0313,
+    0x0020, 0x0313, 0x0020, 0x0342, 0x0020, 0x0308, 0x0342, 0x0020, 0x0313, 0x0300, 0x0020, 0x0313,
+    0x0301, 0x0020, 0x0313, 0x0342, 0x0020, 0x0314, 0x0300, 0x0020, 0x0314, 0x0301, 0x0020, 0x0314,
+    0x0342, 0x0020, 0x0308, 0x0300, 0x0020, 0x0308, 0x0301, 0x0020, 0x0301, 0x0020, 0x0314, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x2010, 0x0020,
+    0x0333, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x0020, 0x2032, 0x2032, 0x2032, 0x2032,
+    0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035, 0x0021, 0x0021, 0x0020, 0x0305, 0x003f, 0x003f,
+    0x003f, 0x0021, 0x0021, 0x003f, 0x2032, 0x2032, 0x2032, 0x2032, 0x0020, 0x0030, 0x0069, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002b, 0x2212, 0x003d, 0x0028, 0x0029, 0x006e, 0x0030,
+    0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002b, 0x2212, 0x003d,
+    0x0028, 0x0029, 0x0061, 0x0065, 0x006f, 0x0078, 0x0259, 0x0068, 0x006b, 0x006c, 0x006d, 0x006e,
+    0x0070, 0x0073, 0x0074, 0x0052, 0x0073, 0x0061, 0x002f, 0x0063, 0x0061, 0x002f, 0x0073, 0x0043,
+    0x00b0, 0x0043, 0x0063, 0x002f, 0x006f, 0x0063, 0x002f, 0x0075, 0x0190, 0x00b0, 0x0046, 0x0067,
+    0x0048, 0x0048, 0x0048, 0x0068, 0x0127, 0x0049, 0x0049, 0x004c, 0x006c, 0x004e, 0x004e, 0x006f,
+    0x0050, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053, 0x004d, 0x0054, 0x0045, 0x004c, 0x0054, 0x004d,
+    0x005a, 0x005a, 0x0042, 0x0043, 0x0065, 0x0045, 0x0046, 0x004d, 0x006f, 0x05d0, 0x05d1, 0x05d2,
+    0x05d3, 0x0069, 0x0046, 0x0041, 0x0058, 0x03c0, 0x03b3, 0x0393, 0x03a0, 0x2211, 0x0044, 0x0064,
+    0x0065, 0x0069, 0x006a, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044, 0x0039, 0x0031, 0x2044, 0x0031,
+    0x0030, 0x0031, 0x2044, 0x0033, 0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044,
+    0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035, 0x0031, 0x2044, 0x0036, 0x0035, 0x2044,
+    0x0036, 0x0031, 0x2044, 0x0038, 0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038, 0x0037, 0x2044,
+    0x0038, 0x0031, 0x2044, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0056, 0x0056,
+    0x0056, 0x0049, 0x0056, 0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058,
+    0x0058, 0x0049, 0x0058, 0x0049, 0x0049, 0x004c, 0x0043, 0x0044, 0x004d, 0x0069, 0x0069, 0x0069,
+    0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076,
+    0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0078, 0x0069, 0x0078, 0x0069, 0x0069, 0x006c,
+    0x0063, 0x0064, 0x006d, 0x0030, 0x2044, 0x0033, 0x222b, 0x222b, 0x222b, 0x222b, 0x222b, 0x222e,
+    0x222e, 0x222e, 0x222e, 0x222e, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x0031, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031,
+    0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031, 0x0039, 0x0032, 0x0030, 0x0028,
+    0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028, 0x0034, 0x0029, 0x0028,
+    0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029, 0x0028,
+    0x0039, 0x0029, 0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031, 0x0031, 0x0029, 0x0028, 0x0031,
+    0x0032, 0x0029, 0x0028, 0x0031, 0x0033, 0x0029, 0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031,
+    0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029, 0x0028, 0x0031,
+    0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029, 0x0031, 0x002e,
+    0x0032, 0x002e, 0x0033, 0x002e, 0x0034, 0x002e, 0x0035, 0x002e, 0x0036, 0x002e, 0x0037, 0x002e,
+    0x0038, 0x002e, 0x0039, 0x002e, 0x0031, 0x0030, 0x002e, 0x0031, 0x0031, 0x002e, 0x0031, 0x0032,
+    0x002e, 0x0031, 0x0033, 0x002e, 0x0031, 0x0034, 0x002e, 0x0031, 0x0035, 0x002e, 0x0031, 0x0036,
+    0x002e, 0x0031, 0x0037, 0x002e, 0x0031, 0x0038, 0x002e, 0x0031, 0x0039, 0x002e, 0x0032, 0x0030,
+    0x002e, 0x0028, 0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064,
+    0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028, 0x0067, 0x0029, 0x0028, 0x0068,
+    0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006a, 0x0029, 0x0028, 0x006b, 0x0029, 0x0028, 0x006c,
+    0x0029, 0x0028, 0x006d, 0x0029, 0x0028, 0x006e, 0x0029, 0x0028, 0x006f, 0x0029, 0x0028, 0x0070,
+    0x0029, 0x0028, 0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074,
+    0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076, 0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078,
+    0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007a, 0x0029, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0030,
+    0x222b, 0x222b, 0x222b, 0x222b, 0x003a, 0x003a, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d,
+    0x006a, 0x0056, 0x2d61, 0x6bcd, 0x9f9f, 0x4e00, 0x4e28, 0x4e36, 0x4e3f, 0x4e59, 0x4e85, 0x4e8c,
+    0x4ea0, 0x4eba, 0x513f, 0x5165, 0x516b, 0x5182, 0x5196, 0x51ab, 0x51e0, 0x51f5, 0x5200, 0x529b,
+    0x52f9, 0x5315, 0x531a, 0x5338, 0x5341, 0x535c, 0x5369, 0x5382, 0x53b6, 0x53c8, 0x53e3, 0x56d7,
+    0x571f, 0x58eb, 0x5902, 0x590a, 0x5915, 0x5927, 0x5973, 0x5b50, 0x5b80, 0x5bf8, 0x5c0f, 0x5c22,
+    0x5c38, 0x5c6e, 0x5c71, 0x5ddb, 0x5de5, 0x5df1, 0x5dfe, 0x5e72, 0x5e7a, 0x5e7f, 0x5ef4, 0x5efe,
+    0x5f0b, 0x5f13, 0x5f50, 0x5f61, 0x5f73, 0x5fc3, 0x6208, 0x6236, 0x624b, 0x652f, 0x6534, 0x6587,
+    0x6597, 0x65a4, 0x65b9, 0x65e0, 0x65e5, 0x66f0, 0x6708, 0x6728, 0x6b20, 0x6b62, 0x6b79, 0x6bb3,
+    0x6bcb, 0x6bd4, 0x6bdb, 0x6c0f, 0x6c14, 0x6c34, 0x706b, 0x722a, 0x7236, 0x723b, 0x723f, 0x7247,
+    0x7259, 0x725b, 0x72ac, 0x7384, 0x7389, 0x74dc, 0x74e6, 0x7518, 0x751f, 0x7528, 0x7530, 0x758b,
+    0x7592, 0x7676, 0x767d, 0x76ae, 0x76bf, 0x76ee, 0x77db, 0x77e2, 0x77f3, 0x793a, 0x79b8, 0x79be,
+    0x7a74, 0x7acb, 0x7af9, 0x7c73, 0x7cf8, 0x7f36, 0x7f51, 0x7f8a, 0x7fbd, 0x8001, 0x800c, 0x8012,
+    0x8033, 0x807f, 0x8089, 0x81e3, 0x81ea, 0x81f3, 0x81fc, 0x820c, 0x821b, 0x821f, 0x826e, 0x8272,
+    0x8278, 0x864d, 0x866b, 0x8840, 0x884c, 0x8863, 0x897e, 0x898b, 0x89d2, 0x8a00, 0x8c37, 0x8c46,
+    0x8c55, 0x8c78, 0x8c9d, 0x8d64, 0x8d70, 0x8db3, 0x8eab, 0x8eca, 0x8f9b, 0x8fb0, 0x8fb5, 0x9091,
+    0x9149, 0x91c6, 0x91cc, 0x91d1, 0x9577, 0x9580, 0x961c, 0x96b6, 0x96b9, 0x96e8, 0x9751, 0x975e,
+    0x9762, 0x9769, 0x97cb, 0x97ed, 0x97f3, 0x9801, 0x98a8, 0x98db, 0x98df, 0x9996, 0x9999, 0x99ac,
+    0x9aa8, 0x9ad8, 0x9adf, 0x9b25, 0x9b2f, 0x9b32, 0x9b3c, 0x9b5a, 0x9ce5, 0x9e75, 0x9e7f, 0x9ea5,
+    0x9ebb, 0x9ec3, 0x9ecd, 0x9ed1, 0x9ef9, 0x9efd, 0x9f0e, 0x9f13, 0x9f20, 0x9f3b, 0x9f4a, 0x9f52,
+    0x9f8d, 0x9f9c, 0x9fa0, 0x0020, 0x3012, 0x5341, 0x5344, 0x5345, 0x0020, 0x3099, 0x0020, 0x309a,
+    0x3088, 0x308a, 0x30b3, 0x30c8, 0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103, 0x1104,
+    0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107, 0x1108, 0x1121,
+    0x1109, 0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162,
+    0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116a, 0x116b, 0x116c, 0x116d, 0x116e,
+    0x116f, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11c7, 0x11c8,
+    0x11cc, 0x11ce, 0x11d3, 0x11d7, 0x11d9, 0x111c, 0x11dd, 0x11df, 0x111d, 0x111e, 0x1120, 0x1122,
+    0x1123, 0x1127, 0x1129, 0x112b, 0x112c, 0x112d, 0x112e, 0x112f, 0x1132, 0x1136, 0x1140, 0x1147,
+    0x114c, 0x11f1, 0x11f2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194,
+    0x119e, 0x11a1, 0x4e00, 0x4e8c, 0x4e09, 0x56db, 0x4e0a, 0x4e2d, 0x4e0b, 0x7532, 0x4e59, 0x4e19,
+    0x4e01, 0x5929, 0x5730, 0x4eba, 0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029, 0x0028, 0x1103,
+    0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107, 0x0029, 0x0028, 0x1109,
+    0x0029, 0x0028, 0x110b, 0x0029, 0x0028, 0x110c, 0x0029, 0x0028, 0x110e, 0x0029, 0x0028, 0x110f,
+    0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112, 0x0029, 0x0028, 0x1100,
+    0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105,
+    0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107, 0x1161, 0x0029, 0x0028, 0x1109,
+    0x1161, 0x0029, 0x0028, 0x110b, 0x1161, 0x0029, 0x0028, 0x110c, 0x1161, 0x0029, 0x0028, 0x110e,
+    0x1161, 0x0029, 0x0028, 0x110f, 0x1161, 0x0029, 0x0028, 0x1110, 0x1161, 0x0029, 0x0028, 0x1111,
+    0x1161, 0x0029, 0x0028, 0x1112, 0x1161, 0x0029, 0x0028, 0x110c, 0x116e, 0x0029, 0x0028, 0x110b,
+    0x1169, 0x110c, 0x1165, 0x11ab, 0x0029, 0x0028, 0x110b, 0x1169, 0x1112, 0x116e, 0x0029, 0x0028,
+    0x4e00, 0x0029, 0x0028, 0x4e8c, 0x0029, 0x0028, 0x4e09, 0x0029, 0x0028, 0x56db, 0x0029, 0x0028,
+    0x4e94, 0x0029, 0x0028, 0x516d, 0x0029, 0x0028, 0x4e03, 0x0029, 0x0028, 0x516b, 0x0029, 0x0028,
+    0x4e5d, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028, 0x6708, 0x0029, 0x0028, 0x706b, 0x0029, 0x0028,
+    0x6c34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028, 0x91d1, 0x0029, 0x0028, 0x571f, 0x0029, 0x0028,
+    0x65e5, 0x0029, 0x0028, 0x682a, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793e, 0x0029, 0x0028,
+    0x540d, 0x0029, 0x0028, 0x7279, 0x0029, 0x0028, 0x8ca1, 0x0029, 0x0028, 0x795d, 0x0029, 0x0028,
+    0x52b4, 0x0029, 0x0028, 0x4ee3, 0x0029, 0x0028, 0x547c, 0x0029, 0x0028, 0x5b66, 0x0029, 0x0028,
+    0x76e3, 0x0029, 0x0028, 0x4f01, 0x0029, 0x0028, 0x8cc7, 0x0029, 0x0028, 0x5354, 0x0029, 0x0028,
+    0x796d, 0x0029, 0x0028, 0x4f11, 0x0029, 0x0028, 0x81ea, 0x0029, 0x0028, 0x81f3, 0x0029, 0x554f,
+    0x5e7c, 0x6587, 0x7b8f, 0x0050, 0x0054, 0x0045, 0x0032, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033,
+    0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038, 0x0032, 0x0039,
+    0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0035,
+    0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110b, 0x110c, 0x110e, 0x110f, 0x1110,
+    0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161,
+    0x1107, 0x1161, 0x1109, 0x1161, 0x110b, 0x1161, 0x110c, 0x1161, 0x110e, 0x1161, 0x110f, 0x1161,
+    0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110e, 0x1161, 0x11b7, 0x1100, 0x1169, 0x110c,
+    0x116e, 0x110b, 0x1174, 0x110b, 0x116e, 0x4e00, 0x4e8c, 0x4e09, 0x56db, 0x4e94, 0x516d, 0x4e03,
+    0x516b, 0x4e5d, 0x5341, 0x6708, 0x706b, 0x6c34, 0x6728, 0x91d1, 0x571f, 0x65e5, 0x682a, 0x6709,
+    0x793e, 0x540d, 0x7279, 0x8ca1, 0x795d, 0x52b4, 0x79d8, 0x7537, 0x5973, 0x9069, 0x512a, 0x5370,
+    0x6ce8, 0x9805, 0x4f11, 0x5199, 0x6b63, 0x4e0a, 0x4e2d, 0x4e0b, 0x5de6, 0x53f3, 0x533b, 0x5b97,
+    0x5b66, 0x76e3, 0x4f01, 0x8cc7, 0x5354, 0x591c, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038,
+    0x0033, 0x0039, 0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032, 0x0034, 0x0033, 0x0034, 0x0034,
+    0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037, 0x0034, 0x0038, 0x0034, 0x0039, 0x0035, 0x0030,
+    0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708, 0x0035, 0x6708, 0x0036, 0x6708,
+    0x0037, 0x6708, 0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708,
+    0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067, 0x0065, 0x0056, 0x004c, 0x0054,
+    0x0044, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5,
+    0x30b7, 0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc,
+    0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2,
+    0x30e4, 0x30e6, 0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f0, 0x30f1, 0x30f2,
+    0x4ee4, 0x548c, 0x30a2, 0x30cf, 0x309a, 0x30fc, 0x30c8, 0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x30a2,
+    0x30f3, 0x30d8, 0x309a, 0x30a2, 0x30a2, 0x30fc, 0x30eb, 0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099,
+    0x30a4, 0x30f3, 0x30c1, 0x30a6, 0x30a9, 0x30f3, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099,
+    0x30a8, 0x30fc, 0x30ab, 0x30fc, 0x30aa, 0x30f3, 0x30b9, 0x30aa, 0x30fc, 0x30e0, 0x30ab, 0x30a4,
+    0x30ea, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x30ab, 0x30ed, 0x30ea, 0x30fc, 0x30ab, 0x3099, 0x30ed,
+    0x30f3, 0x30ab, 0x3099, 0x30f3, 0x30de, 0x30ad, 0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30cb,
+    0x30fc, 0x30ad, 0x30e5, 0x30ea, 0x30fc, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc, 0x30ad,
+    0x30ed, 0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8,
+    0x30eb, 0x30ad, 0x30ed, 0x30ef, 0x30c3, 0x30c8, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30af, 0x3099,
+    0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x30af, 0x30eb, 0x30bb, 0x3099, 0x30a4, 0x30ed, 0x30af, 0x30ed,
+    0x30fc, 0x30cd, 0x30b1, 0x30fc, 0x30b9, 0x30b3, 0x30eb, 0x30ca, 0x30b3, 0x30fc, 0x30db, 0x309a,
+    0x30b5, 0x30a4, 0x30af, 0x30eb, 0x30b5, 0x30f3, 0x30c1, 0x30fc, 0x30e0, 0x30b7, 0x30ea, 0x30f3,
+    0x30af, 0x3099, 0x30bb, 0x30f3, 0x30c1, 0x30bb, 0x30f3, 0x30c8, 0x30bf, 0x3099, 0x30fc, 0x30b9,
+    0x30c6, 0x3099, 0x30b7, 0x30c8, 0x3099, 0x30eb, 0x30c8, 0x30f3, 0x30ca, 0x30ce, 0x30ce, 0x30c3,
+    0x30c8, 0x30cf, 0x30a4, 0x30c4, 0x30cf, 0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8, 0x30cf, 0x309a,
+    0x30fc, 0x30c4, 0x30cf, 0x3099, 0x30fc, 0x30ec, 0x30eb, 0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8,
+    0x30eb, 0x30d2, 0x309a, 0x30af, 0x30eb, 0x30d2, 0x309a, 0x30b3, 0x30d2, 0x3099, 0x30eb, 0x30d5,
+    0x30a1, 0x30e9, 0x30c3, 0x30c8, 0x3099, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x30d5, 0x3099, 0x30c3,
+    0x30b7, 0x30a7, 0x30eb, 0x30d5, 0x30e9, 0x30f3, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb, 0x30d8,
+    0x309a, 0x30bd, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x30d8, 0x30eb, 0x30c4, 0x30d8, 0x309a, 0x30f3,
+    0x30b9, 0x30d8, 0x309a, 0x30fc, 0x30b7, 0x3099, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x30db, 0x309a,
+    0x30a4, 0x30f3, 0x30c8, 0x30db, 0x3099, 0x30eb, 0x30c8, 0x30db, 0x30f3, 0x30db, 0x309a, 0x30f3,
+    0x30c8, 0x3099, 0x30db, 0x30fc, 0x30eb, 0x30db, 0x30fc, 0x30f3, 0x30de, 0x30a4, 0x30af, 0x30ed,
+    0x30de, 0x30a4, 0x30eb, 0x30de, 0x30c3, 0x30cf, 0x30de, 0x30eb, 0x30af, 0x30de, 0x30f3, 0x30b7,
+    0x30e7, 0x30f3, 0x30df, 0x30af, 0x30ed, 0x30f3, 0x30df, 0x30ea, 0x30df, 0x30ea, 0x30cf, 0x3099,
+    0x30fc, 0x30eb, 0x30e1, 0x30ab, 0x3099, 0x30e1, 0x30ab, 0x3099, 0x30c8, 0x30f3, 0x30e1, 0x30fc,
+    0x30c8, 0x30eb, 0x30e4, 0x30fc, 0x30c8, 0x3099, 0x30e4, 0x30fc, 0x30eb, 0x30e6, 0x30a2, 0x30f3,
+    0x30ea, 0x30c3, 0x30c8, 0x30eb, 0x30ea, 0x30e9, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x30eb, 0x30fc,
+    0x30d5, 0x3099, 0x30eb, 0x30ec, 0x30e0, 0x30ec, 0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x30ef,
+    0x30c3, 0x30c8, 0x0030, 0x70b9, 0x0031, 0x70b9, 0x0032, 0x70b9, 0x0033, 0x70b9, 0x0034, 0x70b9,
+    0x0035, 0x70b9, 0x0036, 0x70b9, 0x0037, 0x70b9, 0x0038, 0x70b9, 0x0039, 0x70b9, 0x0031, 0x0030,
+    0x70b9, 0x0031, 0x0031, 0x70b9, 0x0031, 0x0032, 0x70b9, 0x0031, 0x0033, 0x70b9, 0x0031, 0x0034,
+    0x70b9, 0x0031, 0x0035, 0x70b9, 0x0031, 0x0036, 0x70b9, 0x0031, 0x0037, 0x70b9, 0x0031, 0x0038,
+    0x70b9, 0x0031, 0x0039, 0x70b9, 0x0032, 0x0030, 0x70b9, 0x0032, 0x0031, 0x70b9, 0x0032, 0x0032,
+    0x70b9, 0x0032, 0x0033, 0x70b9, 0x0032, 0x0034, 0x70b9, 0x0068, 0x0050, 0x0061, 0x0064, 0x0061,
+    0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006f, 0x0056, 0x0070, 0x0063, 0x0064, 0x006d, 0x0064,
+    0x006d, 0x0032, 0x0064, 0x006d, 0x0033, 0x0049, 0x0055, 0x5e73, 0x6210, 0x662d, 0x548c, 0x5927,
+    0x6b63, 0x660e, 0x6cbb, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x0070, 0x0041, 0x006e, 0x0041, 0x03bc,
+    0x0041, 0x006d, 0x0041, 0x006b, 0x0041, 0x004b, 0x0042, 0x004d, 0x0042, 0x0047, 0x0042, 0x0063,
+    0x0061, 0x006c, 0x006b, 0x0063, 0x0061, 0x006c, 0x0070, 0x0046, 0x006e, 0x0046, 0x03bc, 0x0046,
+    0x03bc, 0x0067, 0x006d, 0x0067, 0x006b, 0x0067, 0x0048, 0x007a, 0x006b, 0x0048, 0x007a, 0x004d,
+    0x0048, 0x007a, 0x0047, 0x0048, 0x007a, 0x0054, 0x0048, 0x007a, 0x03bc, 0x006c, 0x006d, 0x006c,
+    0x0064, 0x006c, 0x006b, 0x006c, 0x0066, 0x006d, 0x006e, 0x006d, 0x03bc, 0x006d, 0x006d, 0x006d,
+    0x0063, 0x006d, 0x006b, 0x006d, 0x006d, 0x006d, 0x0032, 0x0063, 0x006d, 0x0032, 0x006d, 0x0032,
+    0x006b, 0x006d, 0x0032, 0x006d, 0x006d, 0x0033, 0x0063, 0x006d, 0x0033, 0x006d, 0x0033, 0x006b,
+    0x006d, 0x0033, 0x006d, 0x2215, 0x0073, 0x006d, 0x2215, 0x0073, 0x0032, 0x0050, 0x0061, 0x006b,
+    0x0050, 0x0061, 0x004d, 0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072,
+    0x0061, 0x0064, 0x2215, 0x0073, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073,
+    0x006e, 0x0073, 0x03bc, 0x0073, 0x006d, 0x0073, 0x0070, 0x0056, 0x006e, 0x0056, 0x03bc, 0x0056,
+    0x006d, 0x0056, 0x006b, 0x0056, 0x004d, 0x0056, 0x0070, 0x0057, 0x006e, 0x0057, 0x03bc, 0x0057,
+    0x006d, 0x0057, 0x006b, 0x0057, 0x004d, 0x0057, 0x006b, 0x03a9, 0x004d, 0x03a9, 0x0061, 0x002e,
+    0x006d, 0x002e, 0x0042, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064, 0x0043, 0x2215, 0x006b, 0x0067,
+    0x0043, 0x006f, 0x002e, 0x0064, 0x0042, 0x0047, 0x0079, 0x0068, 0x0061, 0x0048, 0x0050, 0x0069,
+    0x006e, 0x004b, 0x004b, 0x004b, 0x004d, 0x006b, 0x0074, 0x006c, 0x006d, 0x006c, 0x006e, 0x006c,
+    0x006f, 0x0067, 0x006c, 0x0078, 0x006d, 0x0062, 0x006d, 0x0069, 0x006c, 0x006d, 0x006f, 0x006c,
+    0x0050, 0x0048, 0x0070, 0x002e, 0x006d, 0x002e, 0x0050, 0x0050, 0x004d, 0x0050, 0x0052, 0x0073,
+    0x0072, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056, 0x2215, 0x006d, 0x0041, 0x2215, 0x006d, 0x0031,
+    0x65e5, 0x0032, 0x65e5, 0x0033, 0x65e5, 0x0034, 0x65e5, 0x0035, 0x65e5, 0x0036, 0x65e5, 0x0037,
+    0x65e5, 0x0038, 0x65e5, 0x0039, 0x65e5, 0x0031, 0x0030, 0x65e5, 0x0031, 0x0031, 0x65e5, 0x0031,
+    0x0032, 0x65e5, 0x0031, 0x0033, 0x65e5, 0x0031, 0x0034, 0x65e5, 0x0031, 0x0035, 0x65e5, 0x0031,
+    0x0036, 0x65e5, 0x0031, 0x0037, 0x65e5, 0x0031, 0x0038, 0x65e5, 0x0031, 0x0039, 0x65e5, 0x0032,
+    0x0030, 0x65e5, 0x0032, 0x0031, 0x65e5, 0x0032, 0x0032, 0x65e5, 0x0032, 0x0033, 0x65e5, 0x0032,
+    0x0034, 0x65e5, 0x0032, 0x0035, 0x65e5, 0x0032, 0x0036, 0x65e5, 0x0032, 0x0037, 0x65e5, 0x0032,
+    0x0038, 0x65e5, 0x0032, 0x0039, 0x65e5, 0x0033, 0x0030, 0x65e5, 0x0033, 0x0031, 0x65e5, 0x0067,
+    0x0061, 0x006c, 0x044a, 0x044c, 0xa76f, 0x0043, 0x0046, 0x0051, 0x0126, 0x0153, 0xa727, 0xab37,
+    0x026b, 0xab52, 0x028d, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006c, 0x0066, 0x0066, 0x0069,
+    0x0066, 0x0066, 0x006c, 0x0073, 0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574,
+    0x056b, 0x057e, 0x0576, 0x0574, 0x056d, 0x05e2, 0x05d0, 0x05d3, 0x05d4, 0x05db, 0x05dc, 0x05dd,
+    0x05e8, 0x05ea, 0x002b, 0x05d0, 0x05dc, 0x0671, 0x0671, 0x067b, 0x067b, 0x067b, 0x067b, 0x067e,
+    0x067e, 0x067e, 0x067e, 0x0680, 0x0680, 0x0680, 0x0680, 0x067a, 0x067a, 0x067a, 0x067a, 0x067f,
+    0x067f, 0x067f, 0x067f, 0x0679, 0x0679, 0x0679, 0x0679, 0x06a4, 0x06a4, 0x06a4, 0x06a4, 0x06a6,
+    0x06a6, 0x06a6, 0x06a6, 0x0684, 0x0684, 0x0684, 0x0684, 0x0683, 0x0683, 0x0683, 0x0683, 0x0686,
+    0x0686, 0x0686, 0x0686, 0x0687, 0x0687, 0x0687, 0x0687, 0x068d, 0x068d, 0x068c, 0x068c, 0x068e,
+    0x068e, 0x0688, 0x0688, 0x0698, 0x0698, 0x0691, 0x0691, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06af,
+    0x06af, 0x06af, 0x06af, 0x06b3, 0x06b3, 0x06b3, 0x06b3, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06ba,
+    0x06ba, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06d5, 0x0654, 0x06d5, 0x0654, 0x06c1, 0x06c1, 0x06c1,
+    0x06c1, 0x06be, 0x06be, 0x06be, 0x06be, 0x06d2, 0x06d2, 0x06d2, 0x0654, 0x06d2, 0x0654, 0x06ad,
+    0x06ad, 0x06ad, 0x06ad, 0x06c7, 0x06c7, 0x06c6, 0x06c6, 0x06c8, 0x06c8, 0x06c7, 0x0674, 0x06cb,
+    0x06cb, 0x06c5, 0x06c5, 0x06c9, 0x06c9, 0x06d0, 0x06d0, 0x06d0, 0x06d0, 0x0649, 0x0649, 0x064a,
+    0x0654, 0x0627, 0x064a, 0x0654, 0x0627, 0x064a, 0x0654, 0x06d5, 0x064a, 0x0654, 0x06d5, 0x064a,
+    0x0654, 0x0648, 0x064a, 0x0654, 0x0648, 0x064a, 0x0654, 0x06c7, 0x064a, 0x0654, 0x06c7, 0x064a,
+    0x0654, 0x06c6, 0x064a, 0x0654, 0x06c6, 0x064a, 0x0654, 0x06c8, 0x064a, 0x0654, 0x06c8, 0x064a,
+    0x0654, 0x06d0, 0x064a, 0x0654, 0x06d0, 0x064a, 0x0654, 0x06d0, 0x064a, 0x0654, 0x0649, 0x064a,
+    0x0654, 0x0649, 0x064a, 0x0654, 0x0649, 0x06cc, 0x06cc, 0x06cc, 0x06cc, 0x064a, 0x0654, 0x062c,
+    0x064a, 0x0654, 0x062d, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x0649, 0x064a, 0x0654, 0x064a,
+    0x0628, 0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064a,
+    0x062a, 0x062c, 0x062a, 0x062d, 0x062a, 0x062e, 0x062a, 0x0645, 0x062a, 0x0649, 0x062a, 0x064a,
+    0x062b, 0x062c, 0x062b, 0x0645, 0x062b, 0x0649, 0x062b, 0x064a, 0x062c, 0x062d, 0x062c, 0x0645,
+    0x062d, 0x062c, 0x062d, 0x0645, 0x062e, 0x062c, 0x062e, 0x062d, 0x062e, 0x0645, 0x0633, 0x062c,
+    0x0633, 0x062d, 0x0633, 0x062e, 0x0633, 0x0645, 0x0635, 0x062d, 0x0635, 0x0645, 0x0636, 0x062c,
+    0x0636, 0x062d, 0x0636, 0x062e, 0x0636, 0x0645, 0x0637, 0x062d, 0x0637, 0x0645, 0x0638, 0x0645,
+    0x0639, 0x062c, 0x0639, 0x0645, 0x063a, 0x062c, 0x063a, 0x0645, 0x0641, 0x062c, 0x0641, 0x062d,
+    0x0641, 0x062e, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064a, 0x0642, 0x062d, 0x0642, 0x0645,
+    0x0642, 0x0649, 0x0642, 0x064a, 0x0643, 0x0627, 0x0643, 0x062c, 0x0643, 0x062d, 0x0643, 0x062e,
+    0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064a, 0x0644, 0x062c, 0x0644, 0x062d,
+    0x0644, 0x062e, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064a, 0x0645, 0x062c, 0x0645, 0x062d,
+    0x0645, 0x062e, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064a, 0x0646, 0x062c, 0x0646, 0x062d,
+    0x0646, 0x062e, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064a, 0x0647, 0x062c, 0x0647, 0x0645,
+    0x0647, 0x0649, 0x0647, 0x064a, 0x064a, 0x062c, 0x064a, 0x062d, 0x064a, 0x062e, 0x064a, 0x0645,
+    0x064a, 0x0649, 0x064a, 0x064a, 0x0630, 0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064c,
+    0x0651, 0x0020, 0x064d, 0x0651, 0x0020, 0x064e, 0x0651, 0x0020, 0x064f, 0x0651, 0x0020, 0x0650,
+    0x0651, 0x0020, 0x0651, 0x0670, 0x064a, 0x0654, 0x0631, 0x064a, 0x0654, 0x0632, 0x064a, 0x0654,
+    0x0645, 0x064a, 0x0654, 0x0646, 0x064a, 0x0654, 0x0649, 0x064a, 0x0654, 0x064a, 0x0628, 0x0631,
+    0x0628, 0x0632, 0x0628, 0x0645, 0x0628, 0x0646, 0x0628, 0x0649, 0x0628, 0x064a, 0x062a, 0x0631,
+    0x062a, 0x0632, 0x062a, 0x0645, 0x062a, 0x0646, 0x062a, 0x0649, 0x062a, 0x064a, 0x062b, 0x0631,
+    0x062b, 0x0632, 0x062b, 0x0645, 0x062b, 0x0646, 0x062b, 0x0649, 0x062b, 0x064a, 0x0641, 0x0649,
+    0x0641, 0x064a, 0x0642, 0x0649, 0x0642, 0x064a, 0x0643, 0x0627, 0x0643, 0x0644, 0x0643, 0x0645,
+    0x0643, 0x0649, 0x0643, 0x064a, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064a, 0x0645, 0x0627,
+    0x0645, 0x0645, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0645, 0x0646, 0x0646, 0x0646, 0x0649,
+    0x0646, 0x064a, 0x0649, 0x0670, 0x064a, 0x0631, 0x064a, 0x0632, 0x064a, 0x0645, 0x064a, 0x0646,
+    0x064a, 0x0649, 0x064a, 0x064a, 0x064a, 0x0654, 0x062c, 0x064a, 0x0654, 0x062d, 0x064a, 0x0654,
+    0x062e, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x0647, 0x0628, 0x062c, 0x0628, 0x062d, 0x0628,
+    0x062e, 0x0628, 0x0645, 0x0628, 0x0647, 0x062a, 0x062c, 0x062a, 0x062d, 0x062a, 0x062e, 0x062a,
+    0x0645, 0x062a, 0x0647, 0x062b, 0x0645, 0x062c, 0x062d, 0x062c, 0x0645, 0x062d, 0x062c, 0x062d,
+    0x0645, 0x062e, 0x062c, 0x062e, 0x0645, 0x0633, 0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0633,
+    0x0645, 0x0635, 0x062d, 0x0635, 0x062e, 0x0635, 0x0645, 0x0636, 0x062c, 0x0636, 0x062d, 0x0636,
+    0x062e, 0x0636, 0x0645, 0x0637, 0x062d, 0x0638, 0x0645, 0x0639, 0x062c, 0x0639, 0x0645, 0x063a,
+    0x062c, 0x063a, 0x0645, 0x0641, 0x062c, 0x0641, 0x062d, 0x0641, 0x062e, 0x0641, 0x0645, 0x0642,
+    0x062d, 0x0642, 0x0645, 0x0643, 0x062c, 0x0643, 0x062d, 0x0643, 0x062e, 0x0643, 0x0644, 0x0643,
+    0x0645, 0x0644, 0x062c, 0x0644, 0x062d, 0x0644, 0x062e, 0x0644, 0x0645, 0x0644, 0x0647, 0x0645,
+    0x062c, 0x0645, 0x062d, 0x0645, 0x062e, 0x0645, 0x0645, 0x0646, 0x062c, 0x0646, 0x062d, 0x0646,
+    0x062e, 0x0646, 0x0645, 0x0646, 0x0647, 0x0647, 0x062c, 0x0647, 0x0645, 0x0647, 0x0670, 0x064a,
+    0x062c, 0x064a, 0x062d, 0x064a, 0x062e, 0x064a, 0x0645, 0x064a, 0x0647, 0x064a, 0x0654, 0x0645,
+    0x064a, 0x0654, 0x0647, 0x0628, 0x0645, 0x0628, 0x0647, 0x062a, 0x0645, 0x062a, 0x0647, 0x062b,
+    0x0645, 0x062b, 0x0647, 0x0633, 0x0645, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634, 0x0647, 0x0643,
+    0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646, 0x0645, 0x0646, 0x0647, 0x064a, 0x0645, 0x064a,
+    0x0647, 0x0640, 0x064e, 0x0651, 0x0640, 0x064f, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649,
+    0x0637, 0x064a, 0x0639, 0x0649, 0x0639, 0x064a, 0x063a, 0x0649, 0x063a, 0x064a, 0x0633, 0x0649,
+    0x0633, 0x064a, 0x0634, 0x0649, 0x0634, 0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c, 0x0649,
+    0x062c, 0x064a, 0x062e, 0x0649, 0x062e, 0x064a, 0x0635, 0x0649, 0x0635, 0x064a, 0x0636, 0x0649,
+    0x0636, 0x064a, 0x0634, 0x062c, 0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0634, 0x0631,
+    0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0637, 0x0649, 0x0637, 0x064a, 0x0639, 0x0649,
+    0x0639, 0x064a, 0x063a, 0x0649, 0x063a, 0x064a, 0x0633, 0x0649, 0x0633, 0x064a, 0x0634, 0x0649,
+    0x0634, 0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c, 0x0649, 0x062c, 0x064a, 0x062e, 0x0649,
+    0x062e, 0x064a, 0x0635, 0x0649, 0x0635, 0x064a, 0x0636, 0x0649, 0x0636, 0x064a, 0x0634, 0x062c,
+    0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631,
+    0x0636, 0x0631, 0x0634, 0x062c, 0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0633, 0x0647,
+    0x0634, 0x0647, 0x0637, 0x0645, 0x0633, 0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0634, 0x062c,
+    0x0634, 0x062d, 0x0634, 0x062e, 0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x064b, 0x0627, 0x064b,
+    0x062a, 0x062c, 0x0645, 0x062a, 0x062d, 0x062c, 0x062a, 0x062d, 0x062c, 0x062a, 0x062d, 0x0645,
+    0x062a, 0x062e, 0x0645, 0x062a, 0x0645, 0x062c, 0x062a, 0x0645, 0x062d, 0x062a, 0x0645, 0x062e,
+    0x062c, 0x0645, 0x062d, 0x062c, 0x0645, 0x062d, 0x062d, 0x0645, 0x064a, 0x062d, 0x0645, 0x0649,
+    0x0633, 0x062d, 0x062c, 0x0633, 0x062c, 0x062d, 0x0633, 0x062c, 0x0649, 0x0633, 0x0645, 0x062d,
+    0x0633, 0x0645, 0x062d, 0x0633, 0x0645, 0x062c, 0x0633, 0x0645, 0x0645, 0x0633, 0x0645, 0x0645,
+    0x0635, 0x062d, 0x062d, 0x0635, 0x062d, 0x062d, 0x0635, 0x0645, 0x0645, 0x0634, 0x062d, 0x0645,
+    0x0634, 0x062d, 0x0645, 0x0634, 0x062c, 0x064a, 0x0634, 0x0645, 0x062e, 0x0634, 0x0645, 0x062e,
+    0x0634, 0x0645, 0x0645, 0x0634, 0x0645, 0x0645, 0x0636, 0x062d, 0x0649, 0x0636, 0x062e, 0x0645,
+    0x0636, 0x062e, 0x0645, 0x0637, 0x0645, 0x062d, 0x0637, 0x0645, 0x062d, 0x0637, 0x0645, 0x0645,
+    0x0637, 0x0645, 0x064a, 0x0639, 0x062c, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0645,
+    0x0639, 0x0645, 0x0649, 0x063a, 0x0645, 0x0645, 0x063a, 0x0645, 0x064a, 0x063a, 0x0645, 0x0649,
+    0x0641, 0x062e, 0x0645, 0x0641, 0x062e, 0x0645, 0x0642, 0x0645, 0x062d, 0x0642, 0x0645, 0x0645,
+    0x0644, 0x062d, 0x0645, 0x0644, 0x062d, 0x064a, 0x0644, 0x062d, 0x0649, 0x0644, 0x062c, 0x062c,
+    0x0644, 0x062c, 0x062c, 0x0644, 0x062e, 0x0645, 0x0644, 0x062e, 0x0645, 0x0644, 0x0645, 0x062d,
+    0x0644, 0x0645, 0x062d, 0x0645, 0x062d, 0x062c, 0x0645, 0x062d, 0x0645, 0x0645, 0x062d, 0x064a,
+    0x0645, 0x062c, 0x062d, 0x0645, 0x062c, 0x0645, 0x0645, 0x062e, 0x062c, 0x0645, 0x062e, 0x0645,
+    0x0645, 0x062c, 0x062e, 0x0647, 0x0645, 0x062c, 0x0647, 0x0645, 0x0645, 0x0646, 0x062d, 0x0645,
+    0x0646, 0x062d, 0x0649, 0x0646, 0x062c, 0x0645, 0x0646, 0x062c, 0x0645, 0x0646, 0x062c, 0x0649,
+    0x0646, 0x0645, 0x064a, 0x0646, 0x0645, 0x0649, 0x064a, 0x0645, 0x0645, 0x064a, 0x0645, 0x0645,
+    0x0628, 0x062e, 0x064a, 0x062a, 0x062c, 0x064a, 0x062a, 0x062c, 0x0649, 0x062a, 0x062e, 0x064a,
+    0x062a, 0x062e, 0x0649, 0x062a, 0x0645, 0x064a, 0x062a, 0x0645, 0x0649, 0x062c, 0x0645, 0x064a,
+    0x062c, 0x062d, 0x0649, 0x062c, 0x0645, 0x0649, 0x0633, 0x062e, 0x0649, 0x0635, 0x062d, 0x064a,
+    0x0634, 0x062d, 0x064a, 0x0636, 0x062d, 0x064a, 0x0644, 0x062c, 0x064a, 0x0644, 0x0645, 0x064a,
+    0x064a, 0x062d, 0x064a, 0x064a, 0x062c, 0x064a, 0x064a, 0x0645, 0x064a, 0x0645, 0x0645, 0x064a,
+    0x0642, 0x0645, 0x064a, 0x0646, 0x062d, 0x064a, 0x0642, 0x0645, 0x062d, 0x0644, 0x062d, 0x0645,
+    0x0639, 0x0645, 0x064a, 0x0643, 0x0645, 0x064a, 0x0646, 0x062c, 0x062d, 0x0645, 0x062e, 0x064a,
+    0x0644, 0x062c, 0x0645, 0x0643, 0x0645, 0x0645, 0x0644, 0x062c, 0x0645, 0x0646, 0x062c, 0x062d,
+    0x062c, 0x062d, 0x064a, 0x062d, 0x062c, 0x064a, 0x0645, 0x062c, 0x064a, 0x0641, 0x0645, 0x064a,
+    0x0628, 0x062d, 0x064a, 0x0643, 0x0645, 0x0645, 0x0639, 0x062c, 0x0645, 0x0635, 0x0645, 0x0645,
+    0x0633, 0x062e, 0x064a, 0x0646, 0x062c, 0x064a, 0x0635, 0x0644, 0x06d2, 0x0642, 0x0644, 0x06d2,
+    0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062d, 0x0645, 0x062f,
+    0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644, 0x064a, 0x0647,
+    0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649, 0x0020, 0x0627,
+    0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064a, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644,
+    0x0645, 0x062c, 0x0644, 0x0020, 0x062c, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06cc, 0x0627,
+    0x0644, 0x002c, 0x3001, 0x3002, 0x003a, 0x003b, 0x0021, 0x003f, 0x3016, 0x3017, 0x002e, 0x002e,
+    0x002e, 0x002e, 0x002e, 0x2014, 0x2013, 0x005f, 0x005f, 0x0028, 0x0029, 0x007b, 0x007d, 0x3014,
+    0x3015, 0x3010, 0x3011, 0x300a, 0x300b, 0x3008, 0x3009, 0x300c, 0x300d, 0x300e, 0x300f, 0x005b,
+    0x005d, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x005f, 0x005f, 0x005f,
+    0x002c, 0x3001, 0x002e, 0x003b, 0x003a, 0x003f, 0x0021, 0x2014, 0x0028, 0x0029, 0x007b, 0x007d,
+    0x3014, 0x3015, 0x0023, 0x0026, 0x002a, 0x002b, 0x002d, 0x003c, 0x003e, 0x003d, 0x005c, 0x0024,
+    0x0025, 0x0040, 0x0020, 0x064b, 0x0640, 0x064b, 0x0020, 0x064c, 0x0020, 0x064d, 0x0020, 0x064e,
+    0x0640, 0x064e, 0x0020, 0x064f, 0x0640, 0x064f, 0x0020, 0x0650, 0x0640, 0x0650, 0x0020, 0x0651,
+    0x0640, 0x0651, 0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0653, 0x0627, 0x0653, 0x0627,
+    0x0654, 0x0627, 0x0654, 0x0648, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x0627, 0x0655, 0x064a,
+    0x0654, 0x064a, 0x0654, 0x064a, 0x0654, 0x064a, 0x0654, 0x0627, 0x0627, 0x0628, 0x0628, 0x0628,
+    0x0628, 0x0629, 0x0629, 0x062a, 0x062a, 0x062a, 0x062a, 0x062b, 0x062b, 0x062b, 0x062b, 0x062c,
+    0x062c, 0x062c, 0x062c, 0x062d, 0x062d, 0x062d, 0x062d, 0x062e, 0x062e, 0x062e, 0x062e, 0x062f,
+    0x062f, 0x0630, 0x0630, 0x0631, 0x0631, 0x0632, 0x0632, 0x0633, 0x0633, 0x0633, 0x0633, 0x0634,
+    0x0634, 0x0634, 0x0634, 0x0635, 0x0635, 0x0635, 0x0635, 0x0636, 0x0636, 0x0636, 0x0636, 0x0637,
+    0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638, 0x0638, 0x0639, 0x0639, 0x0639, 0x0639, 0x063a,
+    0x063a, 0x063a, 0x063a, 0x0641, 0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642, 0x0642, 0x0643,
+    0x0643, 0x0643, 0x0643, 0x0644, 0x0644, 0x0644, 0x0644, 0x0645, 0x0645, 0x0645, 0x0645, 0x0646,
+    0x0646, 0x0646, 0x0646, 0x0647, 0x0647, 0x0647, 0x0647, 0x0648, 0x0648, 0x0649, 0x0649, 0x064a,
+    0x064a, 0x064a, 0x064a, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654,
+    0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0644,
+    0x0627, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b,
+    0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x2985,
+    0x2986, 0x3002, 0x300c, 0x300d, 0x3001, 0x30fb, 0x30f2, 0x30a1, 0x30a3, 0x30a5, 0x30a7, 0x30a9,
+    0x30e3, 0x30e5, 0x30e7, 0x30c3, 0x30fc, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad,
+    0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6,
+    0x30c8, 0x30ca, 0x30cb, 0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de,
+    0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec, 0x30ed,
+    0x30ef, 0x30f3, 0x3099, 0x309a, 0x1160, 0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103,
+    0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107, 0x1108,
+    0x1121, 0x1109, 0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161,
+    0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116a, 0x116b, 0x116c, 0x116d,
+    0x116e, 0x116f, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x00a2, 0x00a3, 0x00ac, 0x0020,
+    0x0304, 0x00a6, 0x00a5, 0x20a9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25a0, 0x25cb, 0x02d0,
+    0x02d1, 0x00e6, 0x0299, 0x0253, 0x02a3, 0xab66, 0x02a5, 0x02a4, 0x0256, 0x0257, 0x1d91, 0x0258,
+    0x025e, 0x02a9, 0x0264, 0x0262, 0x0260, 0x029b, 0x0127, 0x029c, 0x0267, 0x0284, 0x02aa, 0x02ab,
+    0x026c, 0xd837, 0xdf04, 0xa78e, 0x026e, 0xd837, 0xdf05, 0x028e, 0xd837, 0xdf06, 0x00f8, 0x0276,
+    0x0277, 0x0071, 0x027a, 0xd837, 0xdf08, 0x027d, 0x027e, 0x0280, 0x02a8, 0x02a6, 0xab67, 0x02a7,
+    0x0288, 0x2c71, 0x028f, 0x02a1, 0x02a2, 0x0298, 0x01c0, 0x01c1, 0x01c2, 0xd837, 0xdf0a, 0xd837,
+    0xdf1e, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+    0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050,
+    0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062,
+    0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e,
+    0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a,
+    0x0041, 0x0043, 0x0044, 0x0047, 0x004a, 0x004b, 0x004e, 0x004f, 0x0050, 0x0051, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0068,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+    0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+    0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004f, 0x0053, 0x0054, 0x0055, 0x0056,
+    0x0057, 0x0058, 0x0059, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+    0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+    0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+    0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+    0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+    0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b,
+    0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0131, 0x0237, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+    0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1,
+    0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3,
+    0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+    0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5,
+    0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+    0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3,
+    0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5,
+    0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1,
+    0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba,
+    0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399,
+    0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5,
+    0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+    0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3,
+    0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1,
+    0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b,
+    0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+    0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9,
+    0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5,
+    0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391,
+    0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d,
+    0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9,
+    0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb,
+    0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+    0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x03dc, 0x03dd, 0x0030,
+    0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032,
+    0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+    0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x0627, 0x0628, 0x062c, 0x062f, 0x0648, 0x0632, 0x062d, 0x0637, 0x064a, 0x0643, 0x0644,
+    0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e,
+    0x0630, 0x0636, 0x0638, 0x063a, 0x066e, 0x06ba, 0x06a1, 0x066f, 0x0628, 0x062c, 0x0647, 0x062d,
+    0x064a, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062a,
+    0x062b, 0x062e, 0x0636, 0x063a, 0x062c, 0x062d, 0x064a, 0x0644, 0x0646, 0x0633, 0x0639, 0x0635,
+    0x0642, 0x0634, 0x062e, 0x0636, 0x063a, 0x06ba, 0x066f, 0x0628, 0x062c, 0x0647, 0x062d, 0x0637,
+    0x064a, 0x0643, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062a, 0x062b,
+    0x062e, 0x0636, 0x0638, 0x063a, 0x066e, 0x06a1, 0x0627, 0x0628, 0x062c, 0x062f, 0x0647, 0x0648,
+    0x0632, 0x062d, 0x0637, 0x064a, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642,
+    0x0631, 0x0634, 0x062a, 0x062b, 0x062e, 0x0630, 0x0636, 0x0638, 0x063a, 0x0628, 0x062c, 0x062f,
+    0x0648, 0x0632, 0x062d, 0x0637, 0x064a, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635,
+    0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e, 0x0630, 0x0636, 0x0638, 0x063a, 0x0030, 0x002e,
+    0x0030, 0x002c, 0x0031, 0x002c, 0x0032, 0x002c, 0x0033, 0x002c, 0x0034, 0x002c, 0x0035, 0x002c,
+    0x0036, 0x002c, 0x0037, 0x002c, 0x0038, 0x002c, 0x0039, 0x002c, 0x0028, 0x0041, 0x0029, 0x0028,
+    0x0042, 0x0029, 0x0028, 0x0043, 0x0029, 0x0028, 0x0044, 0x0029, 0x0028, 0x0045, 0x0029, 0x0028,
+    0x0046, 0x0029, 0x0028, 0x0047, 0x0029, 0x0028, 0x0048, 0x0029, 0x0028, 0x0049, 0x0029, 0x0028,
+    0x004a, 0x0029, 0x0028, 0x004b, 0x0029, 0x0028, 0x004c, 0x0029, 0x0028, 0x004d, 0x0029, 0x0028,
+    0x004e, 0x0029, 0x0028, 0x004f, 0x0029, 0x0028, 0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028,
+    0x0052, 0x0029, 0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029, 0x0028, 0x0055, 0x0029, 0x0028,
+    0x0056, 0x0029, 0x0028, 0x0057, 0x0029, 0x0028, 0x0058, 0x0029, 0x0028, 0x0059, 0x0029, 0x0028,
+    0x005a, 0x0029, 0x3014, 0x0053, 0x3015, 0x0043, 0x0052, 0x0043, 0x0044, 0x0057, 0x005a, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+    0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+    0x005a, 0x0048, 0x0056, 0x004d, 0x0056, 0x0053, 0x0044, 0x0053, 0x0053, 0x0050, 0x0050, 0x0056,
+    0x0057, 0x0043, 0x004d, 0x0043, 0x004d, 0x0044, 0x004d, 0x0052, 0x0044, 0x004a, 0x307b, 0x304b,
+    0x30b3, 0x30b3, 0x30b5, 0x624b, 0x5b57, 0x53cc, 0x30c6, 0x3099, 0x4e8c, 0x591a, 0x89e3, 0x5929,
+    0x4ea4, 0x6620, 0x7121, 0x6599, 0x524d, 0x5f8c, 0x518d, 0x65b0, 0x521d, 0x7d42, 0x751f, 0x8ca9,
+    0x58f0, 0x5439, 0x6f14, 0x6295, 0x6355, 0x4e00, 0x4e09, 0x904a, 0x5de6, 0x4e2d, 0x53f3, 0x6307,
+    0x8d70, 0x6253, 0x7981, 0x7a7a, 0x5408, 0x6e80, 0x6709, 0x6708, 0x7533, 0x5272, 0x55b6, 0x914d,
+    0x3014, 0x672c, 0x3015, 0x3014, 0x4e09, 0x3015, 0x3014, 0x4e8c, 0x3015, 0x3014, 0x5b89, 0x3015,
+    0x3014, 0x70b9, 0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76d7, 0x3015, 0x3014, 0x52dd, 0x3015,
+    0x3014, 0x6557, 0x3015, 0x5f97, 0x53ef, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+    0x0037, 0x0038, 0x0039,
+};
+
+// The primary composites, sorted by their two code points. The second code point of each has
+// an NFC quick check of Maybe.
+static const composition compositions[941] = {
+    {0x003c, 0x0338, 0x226e}, {0x003d, 0x0338, 0x2260}, {0x003e, 0x0338, 0x226f}, {0x0041, 0x0300, 0x00c0},
+    {0x0041, 0x0301, 0x00c1}, {0x0041, 0x0302, 0x00c2}, {0x0041, 0x0303, 0x00c3}, {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102}, {0x0041, 0x0307, 0x0226}, {0x0041, 0x0308, 0x00c4}, {0x0041, 0x0309, 0x1ea2},
+    {0x0041, 0x030a, 0x00c5}, {0x0041, 0x030c, 0x01cd}, {0x0041, 0x030f, 0x0200}, {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1ea0}, {0x0041, 0x0325, 0x1e00}, {0x0041, 0x0328, 0x0104}, {0x0042, 0x0307, 0x1e02},
+    {0x0042, 0x0323, 0x1e04}, {0x0042, 0x0331, 0x1e06}, {0x0043, 0x0301, 0x0106}, {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010a}, {0x0043, 0x030c, 0x010c}, {0x0043, 0x0327, 0x00c7}, {0x0044, 0x0307, 0x1e0a},
+    {0x0044, 0x030c, 0x010e}, {0x0044, 0x0323, 0x1e0c}, {0x0044, 0x0327, 0x1e10}, {0x0044, 0x032d, 0x1e12},
+    {0x0044, 0x0331, 0x1e0e}, {0x0045, 0x0300, 0x00c8}, {0x0045, 0x0301, 0x00c9}, {0x0045, 0x0302, 0x00ca},
+    {0x0045, 0x0303, 0x1ebc}, {0x0045, 0x0304, 0x0112}, {0x0045, 0x0306, 0x0114}, {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00cb}, {0x0045, 0x0309, 0x1eba}, {0x0045, 0x030c, 0x011a}, {0x0045, 0x030f, 0x0204},
+    {0x0045, 0x0311, 0x0206}, {0x0045, 0x0323, 0x1eb8}, {0x0045, 0x0327, 0x0228}, {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032d, 0x1e18}, {0x0045, 0x0330, 0x1e1a}, {0x0046, 0x0307, 0x1e1e}, {0x0047, 0x0301, 0x01f4},
+    {0x0047, 0x0302, 0x011c}, {0x0047, 0x0304, 0x1e20}, {0x0047, 0x0306, 0x011e}, {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030c, 0x01e6}, {0x0047, 0x0327, 0x0122}, {0x0048, 0x0302, 0x0124}, {0x0048, 0x0307, 0x1e22},
+    {0x0048, 0x0308, 0x1e26}, {0x0048, 0x030c, 0x021e}, {0x0048, 0x0323, 0x1e24}, {0x0048, 0x0327, 0x1e28},
+    {0x0048, 0x032e, 0x1e2a}, {0x0049, 0x0300, 0x00cc}, {0x0049, 0x0301, 0x00cd}, {0x0049, 0x0302, 0x00ce},
+    {0x0049, 0x0303, 0x0128}, {0x0049, 0x0304, 0x012a}, {0x0049, 0x0306, 0x012c}, {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00cf}, {0x0049, 0x0309, 0x1ec8}, {0x0049, 0x030c, 0x01cf}, {0x0049, 0x030f, 0x0208},
+    {0x0049, 0x0311, 0x020a}, {0x0049, 0x0323, 0x1eca}, {0x0049, 0x0328, 0x012e}, {0x0049, 0x0330, 0x1e2c},
+    {0x004a, 0x0302, 0x0134}, {0x004b, 0x0301, 0x1e30}, {0x004b, 0x030c, 0x01e8}, {0x004b, 0x0323, 0x1e32},
+    {0x004b, 0x0327, 0x0136}, {0x004b, 0x0331, 0x1e34}, {0x004c, 0x0301, 0x0139}, {0x004c, 0x030c, 0x013d},
+    {0x004c, 0x0323, 0x1e36}, {0x004c, 0x0327, 0x013b}, {0x004c, 0x032d, 0x1e3c}, {0x004c, 0x0331, 0x1e3a},
+    {0x004d, 0x0301, 0x1e3e}, {0x004d, 0x0307, 0x1e40}, {0x004d, 0x0323, 0x1e42}, {0x004e, 0x0300, 0x01f8},
+    {0x004e, 0x0301, 0x0143}, {0x004e, 0x0303, 0x00d1}, {0x004e, 0x0307, 0x1e44}, {0x004e, 0x030c, 0x0147},
+    {0x004e, 0x0323, 0x1e46}, {0x004e, 0x0327, 0x0145}, {0x004e, 0x032d, 0x1e4a}, {0x004e, 0x0331, 0x1e48},
+    {0x004f, 0x0300, 0x00d2}, {0x004f, 0x0301, 0x00d3}, {0x004f, 0x0302, 0x00d4}, {0x004f, 0x0303, 0x00d5},
+    {0x004f, 0x0304, 0x014c}, {0x004f, 0x0306, 0x014e}, {0x004f, 0x0307, 0x022e}, {0x004f, 0x0308, 0x00d6},
+    {0x004f, 0x0309, 0x1ece}, {0x004f, 0x030b, 0x0150}, {0x004f, 0x030c, 0x01d1}, {0x004f, 0x030f, 0x020c},
+    {0x004f, 0x0311, 0x020e}, {0x004f, 0x031b, 0x01a0}, {0x004f, 0x0323, 0x1ecc}, {0x004f, 0x0328, 0x01ea},
+    {0x0050, 0x0301, 0x1e54}, {0x0050, 0x0307, 0x1e56}, {0x0052, 0x0301, 0x0154}, {0x0052, 0x0307, 0x1e58},
+    {0x0052, 0x030c, 0x0158}, {0x0052, 0x030f, 0x0210}, {0x0052, 0x0311, 0x0212}, {0x0052, 0x0323, 0x1e5a},
+    {0x0052, 0x0327, 0x0156}, {0x0052, 0x0331, 0x1e5e}, {0x0053, 0x0301, 0x015a}, {0x0053, 0x0302, 0x015c},
+    {0x0053, 0x0307, 0x1e60}, {0x0053, 0x030c, 0x0160}, {0x0053, 0x0323, 0x1e62}, {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015e}, {0x0054, 0x0307, 0x1e6a}, {0x0054, 0x030c, 0x0164}, {0x0054, 0x0323, 0x1e6c},
+    {0x0054, 0x0326, 0x021a}, {0x0054, 0x0327, 0x0162}, {0x0054, 0x032d, 0x1e70}, {0x0054, 0x0331, 0x1e6e},
+    {0x0055, 0x0300, 0x00d9}, {0x0055, 0x0301, 0x00da}, {0x0055, 0x0302, 0x00db}, {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016a}, {0x0055, 0x0306, 0x016c}, {0x0055, 0x0308, 0x00dc}, {0x0055, 0x0309, 0x1ee6},
+    {0x0055, 0x030a, 0x016e}, {0x0055, 0x030b, 0x0170}, {0x0055, 0x030c, 0x01d3}, {0x0055, 0x030f, 0x0214},
+    {0x0055, 0x0311, 0x0216}, {0x0055, 0x031b, 0x01af}, {0x0055, 0x0323, 0x1ee4}, {0x0055, 0x0324, 0x1e72},
+    {0x0055, 0x0328, 0x0172}, {0x0055, 0x032d, 0x1e76}, {0x0055, 0x0330, 0x1e74}, {0x0056, 0x0303, 0x1e7c},
+    {0x0056, 0x0323, 0x1e7e}, {0x0057, 0x0300, 0x1e80}, {0x0057, 0x0301, 0x1e82}, {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1e86}, {0x0057, 0x0308, 0x1e84}, {0x0057, 0x0323, 0x1e88}, {0x0058, 0x0307, 0x1e8a},
+    {0x0058, 0x0308, 0x1e8c}, {0x0059, 0x0300, 0x1ef2}, {0x0059, 0x0301, 0x00dd}, {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1ef8}, {0x0059, 0x0304, 0x0232}, {0x0059, 0x0307, 0x1e8e}, {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1ef6}, {0x0059, 0x0323, 0x1ef4}, {0x005a, 0x0301, 0x0179}, {0x005a, 0x0302, 0x1e90},
+    {0x005a, 0x0307, 0x017b}, {0x005a, 0x030c, 0x017d}, {0x005a, 0x0323, 0x1e92}, {0x005a, 0x0331, 0x1e94},
+    {0x0061, 0x0300, 0x00e0}, {0x0061, 0x0301, 0x00e1}, {0x0061, 0x0302, 0x00e2}, {0x0061, 0x0303, 0x00e3},
+    {0x0061, 0x0304, 0x0101}, {0x0061, 0x0306, 0x0103}, {0x0061, 0x0307, 0x0227}, {0x0061, 0x0308, 0x00e4},
+    {0x0061, 0x0309, 0x1ea3}, {0x0061, 0x030a, 0x00e5}, {0x0061, 0x030c, 0x01ce}, {0x0061, 0x030f, 0x0201},
+    {0x0061, 0x0311, 0x0203}, {0x0061, 0x0323, 0x1ea1}, {0x0061, 0x0325, 0x1e01}, {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1e03}, {0x0062, 0x0323, 0x1e05}, {0x0062, 0x0331, 0x1e07}, {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109}, {0x0063, 0x0307, 0x010b}, {0x0063, 0x030c, 0x010d}, {0x0063, 0x0327, 0x00e7},
+    {0x0064, 0x0307, 0x1e0b}, {0x0064, 0x030c, 0x010f}, {0x0064, 0x0323, 0x1e0d}, {0x0064, 0x0327, 0x1e11},
+    {0x0064, 0x032d, 0x1e13}, {0x0064, 0x0331, 0x1e0f}, {0x0065, 0x0300, 0x00e8}, {0x0065, 0x0301, 0x00e9},
+    {0x0065, 0x0302, 0x00ea}, {0x0065, 0x0303, 0x1ebd}, {0x0065, 0x0304, 0x0113}, {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117}, {0x0065, 0x0308, 0x00eb}, {0x0065, 0x0309, 0x1ebb}, {0x0065, 0x030c, 0x011b},
+    {0x0065, 0x030f, 0x0205}, {0x0065, 0x0311, 0x0207}, {0x0065, 0x0323, 0x1eb9}, {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119}, {0x0065, 0x032d, 0x1e19}, {0x0065, 0x0330, 0x1e1b}, {0x0066, 0x0307, 0x1e1f},
+    {0x0067, 0x0301, 0x01f5}, {0x0067, 0x0302, 0x011d}, {0x0067, 0x0304, 0x1e21}, {0x0067, 0x0306, 0x011f},
+    {0x0067, 0x0307, 0x0121}, {0x0067, 0x030c, 0x01e7}, {0x0067, 0x0327, 0x0123}, {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1e23}, {0x0068, 0x0308, 0x1e27}, {0x0068, 0x030c, 0x021f}, {0x0068, 0x0323, 0x1e25},
+    {0x0068, 0x0327, 0x1e29}, {0x0068, 0x032e, 0x1e2b}, {0x0068, 0x0331, 0x1e96}, {0x0069, 0x0300, 0x00ec},
+    {0x0069, 0x0301, 0x00ed}, {0x0069, 0x0302, 0x00ee}, {0x0069, 0x0303, 0x0129}, {0x0069, 0x0304, 0x012b},
+    {0x0069, 0x0306, 0x012d}, {0x0069, 0x0308, 0x00ef}, {0x0069, 0x0309, 0x1ec9}, {0x0069, 0x030c, 0x01d0},
+    {0x0069, 0x030f, 0x0209}, {0x0069, 0x0311, 0x020b}, {0x0069, 0x0323, 0x1ecb}, {0x0069, 0x0328, 0x012f},
+    {0x0069, 0x0330, 0x1e2d}, {0x006a, 0x0302, 0x0135}, {0x006a, 0x030c, 0x01f0}, {0x006b, 0x0301, 0x1e31},
+    {0x006b, 0x030c, 0x01e9}, {0x006b, 0x0323, 0x1e33}, {0x006b, 0x0327, 0x0137}, {0x006b, 0x0331, 0x1e35},
+    {0x006c, 0x0301, 0x013a}, {0x006c, 0x030c, 0x013e}, {0x006c, 0x0323, 0x1e37}, {0x006c, 0x0327, 0x013c},
+    {0x006c, 0x032d, 0x1e3d}, {0x006c, 0x0331, 0x1e3b}, {0x006d, 0x0301, 0x1e3f}, {0x006d, 0x0307, 0x1e41},
+    {0x006d, 0x0323, 0x1e43}, {0x006e, 0x0300, 0x01f9}, {0x006e, 0x0301, 0x0144}, {0x006e, 0x0303, 0x00f1},
+    {0x006e, 0x0307, 0x1e45}, {0x006e, 0x030c, 0x0148}, {0x006e, 0x0323, 0x1e47}, {0x006e, 0x0327, 0x0146},
+    {0x006e, 0x032d, 0x1e4b}, {0x006e, 0x0331, 0x1e49}, {0x006f, 0x0300, 0x00f2}, {0x006f, 0x0301, 0x00f3},
+    {0x006f, 0x0302, 0x00f4}, {0x006f, 0x0303, 0x00f5}, {0x006f, 0x0304, 0x014d}, {0x006f, 0x0306, 0x014f},
+    {0x006f, 0x0307, 0x022f}, {0x006f, 0x0308, 0x00f6}, {0x006f, 0x0309, 0x1ecf}, {0x006f, 0x030b, 0x0151},
+    {0x006f, 0x030c, 0x01d2}, {0x006f, 0x030f, 0x020d}, {0x006f, 0x0311, 0x020f}, {0x006f, 0x031b, 0x01a1},
+    {0x006f, 0x0323, 0x1ecd}, {0x006f, 0x0328, 0x01eb}, {0x0070, 0x0301, 0x1e55}, {0x0070, 0x0307, 0x1e57},
+    {0x0072, 0x0301, 0x0155}, {0x0072, 0x0307, 0x1e59}, {0x0072, 0x030c, 0x0159}, {0x0072, 0x030f, 0x0211},
+    {0x0072, 0x0311, 0x0213}, {0x0072, 0x0323, 0x1e5b}, {0x0072, 0x0327, 0x0157}, {0x0072, 0x0331, 0x1e5f},
+    {0x0073, 0x0301, 0x015b}, {0x0073, 0x0302, 0x015d}, {0x0073, 0x0307, 0x1e61}, {0x0073, 0x030c, 0x0161},
+    {0x0073, 0x0323, 0x1e63}, {0x0073, 0x0326, 0x0219}, {0x0073, 0x0327, 0x015f}, {0x0074, 0x0307, 0x1e6b},
+    {0x0074, 0x0308, 0x1e97}, {0x0074, 0x030c, 0x0165}, {0x0074, 0x0323, 0x1e6d}, {0x0074, 0x0326, 0x021b},
+    {0x0074, 0x0327, 0x0163}, {0x0074, 0x032d, 0x1e71}, {0x0074, 0x0331, 0x1e6f}, {0x0075, 0x0300, 0x00f9},
+    {0x0075, 0x0301, 0x00fa}, {0x0075, 0x0302, 0x00fb}, {0x0075, 0x0303, 0x0169}, {0x0075, 0x0304, 0x016b},
+    {0x0075, 0x0306, 0x016d}, {0x0075, 0x0308, 0x00fc}, {0x0075, 0x0309, 0x1ee7}, {0x0075, 0x030a, 0x016f},
+    {0x0075, 0x030b, 0x0171}, {0x0075, 0x030c, 0x01d4}, {0x0075, 0x030f, 0x0215}, {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031b, 0x01b0}, {0x0075, 0x0323, 0x1ee5}, {0x0075, 0x0324, 0x1e73}, {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032d, 0x1e77}, {0x0075, 0x0330, 0x1e75}, {0x0076, 0x0303, 0x1e7d}, {0x0076, 0x0323, 0x1e7f},
+    {0x0077, 0x0300, 0x1e81}, {0x0077, 0x0301, 0x1e83}, {0x0077, 0x0302, 0x0175}, {0x0077, 0x0307, 0x1e87},
+    {0x0077, 0x0308, 0x1e85}, {0x0077, 0x030a, 0x1e98}, {0x0077, 0x0323, 0x1e89}, {0x0078, 0x0307, 0x1e8b},
+    {0x0078, 0x0308, 0x1e8d}, {0x0079, 0x0300, 0x1ef3}, {0x0079, 0x0301, 0x00fd}, {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1ef9}, {0x0079, 0x0304, 0x0233}, {0x0079, 0x0307, 0x1e8f}, {0x0079, 0x0308, 0x00ff},
+    {0x0079, 0x0309, 0x1ef7}, {0x0079, 0x030a, 0x1e99}, {0x0079, 0x0323, 0x1ef5}, {0x007a, 0x0301, 0x017a},
+    {0x007a, 0x0302, 0x1e91}, {0x007a, 0x0307, 0x017c}, {0x007a, 0x030c, 0x017e}, {0x007a, 0x0323, 0x1e93},
+    {0x007a, 0x0331, 0x1e95}, {0x00a8, 0x0300, 0x1fed}, {0x00a8, 0x0301, 0x0385}, {0x00a8, 0x0342, 0x1fc1},
+    {0x00c2, 0x0300, 0x1ea6}, {0x00c2, 0x0301, 0x1ea4}, {0x00c2, 0x0303, 0x1eaa}, {0x00c2, 0x0309, 0x1ea8},
+    {0x00c4, 0x0304, 0x01de}, {0x00c5, 0x0301, 0x01fa}, {0x00c6, 0x0301, 0x01fc}, {0x00c6, 0x0304, 0x01e2},
+    {0x00c7, 0x0301, 0x1e08}, {0x00ca, 0x0300, 0x1ec0}, {0x00ca, 0x0301, 0x1ebe}, {0x00ca, 0x0303, 0x1ec4},
+    {0x00ca, 0x0309, 0x1ec2}, {0x00cf, 0x0301, 0x1e2e}, {0x00d4, 0x0300, 0x1ed2}, {0x00d4, 0x0301, 0x1ed0},
+    {0x00d4, 0x0303, 0x1ed6}, {0x00d4, 0x0309, 0x1ed4}, {0x00d5, 0x0301, 0x1e4c}, {0x00d5, 0x0304, 0x022c},
+    {0x00d5, 0x0308, 0x1e4e}, {0x00d6, 0x0304, 0x022a}, {0x00d8, 0x0301, 0x01fe}, {0x00dc, 0x0300, 0x01db},
+    {0x00dc, 0x0301, 0x01d7}, {0x00dc, 0x0304, 0x01d5}, {0x00dc, 0x030c, 0x01d9}, {0x00e2, 0x0300, 0x1ea7},
+    {0x00e2, 0x0301, 0x1ea5}, {0x00e2, 0x0303, 0x1eab}, {0x00e2, 0x0309, 0x1ea9}, {0x00e4, 0x0304, 0x01df},
+    {0x00e5, 0x0301, 0x01fb}, {0x00e6, 0x0301, 0x01fd}, {0x00e6, 0x0304, 0x01e3}, {0x00e7, 0x0301, 0x1e09},
+    {0x00ea, 0x0300, 0x1ec1}, {0x00ea, 0x0301, 0x1ebf}, {0x00ea, 0x0303, 0x1ec5}, {0x00ea, 0x0309, 0x1ec3},
+    {0x00ef, 0x0301, 0x1e2f}, {0x00f4, 0x0300, 0x1ed3}, {0x00f4, 0x0301, 0x1ed1}, {0x00f4, 0x0303, 0x1ed7},
+    {0x00f4, 0x0309, 0x1ed5}, {0x00f5, 0x0301, 0x1e4d}, {0x00f5, 0x0304, 0x022d}, {0x00f5, 0x0308, 0x1e4f},
+    {0x00f6, 0x0304, 0x022b}, {0x00f8, 0x0301, 0x01ff}, {0x00fc, 0x0300, 0x01dc}, {0x00fc, 0x0301, 0x01d8},
+    {0x00fc, 0x0304, 0x01d6}, {0x00fc, 0x030c, 0x01da}, {0x0102, 0x0300, 0x1eb0}, {0x0102, 0x0301, 0x1eae},
+    {0x0102, 0x0303, 0x1eb4}, {0x0102, 0x0309, 0x1eb2}, {0x0103, 0x0300, 0x1eb1}, {0x0103, 0x0301, 0x1eaf},
+    {0x0103, 0x0303, 0x1eb5}, {0x0103, 0x0309, 0x1eb3}, {0x0112, 0x0300, 0x1e14}, {0x0112, 0x0301, 0x1e16},
+    {0x0113, 0x0300, 0x1e15}, {0x0113, 0x0301, 0x1e17}, {0x014c, 0x0300, 0x1e50}, {0x014c, 0x0301, 0x1e52},
+    {0x014d, 0x0300, 0x1e51}, {0x014d, 0x0301, 0x1e53}, {0x015a, 0x0307, 0x1e64}, {0x015b, 0x0307, 0x1e65},
+    {0x0160, 0x0307, 0x1e66}, {0x0161, 0x0307, 0x1e67}, {0x0168, 0x0301, 0x1e78}, {0x0169, 0x0301, 0x1e79},
+    {0x016a, 0x0308, 0x1e7a}, {0x016b, 0x0308, 0x1e7b}, {0x017f, 0x0307, 0x1e9b}, {0x01a0, 0x0300, 0x1edc},
+    {0x01a0, 0x0301, 0x1eda}, {0x01a0, 0x0303, 0x1ee0}, {0x01a0, 0x0309, 0x1ede}, {0x01a0, 0x0323, 0x1ee2},
+    {0x01a1, 0x0300, 0x1edd}, {0x01a1, 0x0301, 0x1edb}, {0x01a1, 0x0303, 0x1ee1}, {0x01a1, 0x0309, 0x1edf},
+    {0x01a1, 0x0323, 0x1ee3}, {0x01af, 0x0300, 0x1eea}, {0x01af, 0x0301, 0x1ee8}, {0x01af, 0x0303, 0x1eee},
+    {0x01af, 0x0309, 0x1eec}, {0x01af, 0x0323, 0x1ef0}, {0x01b0, 0x0300, 0x1eeb}, {0x01b0, 0x0301, 0x1ee9},
+    {0x01b0, 0x0303, 0x1eef}, {0x01b0, 0x0309, 0x1eed}, {0x01b0, 0x0323, 0x1ef1}, {0x01b7, 0x030c, 0x01ee},
+    {0x01ea, 0x0304, 0x01ec}, {0x01eb, 0x0304, 0x01ed}, {0x0226, 0x0304, 0x01e0}, {0x0227, 0x0304, 0x01e1},
+    {0x0228, 0x0306, 0x1e1c}, {0x0229, 0x0306, 0x1e1d}, {0x022e, 0x0304, 0x0230}, {0x022f, 0x0304, 0x0231},
+    {0x0292, 0x030c, 0x01ef}, {0x0391, 0x0300, 0x1fba}, {0x0391, 0x0301, 0x0386}, {0x0391, 0x0304, 0x1fb9},
+    {0x0391, 0x0306, 0x1fb8}, {0x0391, 0x0313, 0x1f08}, {0x0391, 0x0314, 0x1f09}, {0x0391, 0x0345, 0x1fbc},
+    {0x0395, 0x0300, 0x1fc8}, {0x0395, 0x0301, 0x0388}, {0x0395, 0x0313, 0x1f18}, {0x0395, 0x0314, 0x1f19},
+    {0x0397, 0x0300, 0x1fca}, {0x0397, 0x0301, 0x0389}, {0x0397, 0x0313, 0x1f28}, {0x0397, 0x0314, 0x1f29},
+    {0x0397, 0x0345, 0x1fcc}, {0x0399, 0x0300, 0x1fda}, {0x0399, 0x0301, 0x038a}, {0x0399, 0x0304, 0x1fd9},
+    {0x0399, 0x0306, 0x1fd8}, {0x0399, 0x0308, 0x03aa}, {0x0399, 0x0313, 0x1f38}, {0x0399, 0x0314, 0x1f39},
+    {0x039f, 0x0300, 0x1ff8}, {0x039f, 0x0301, 0x038c}, {0x039f, 0x0313, 0x1f48}, {0x039f, 0x0314, 0x1f49},
+    {0x03a1, 0x0314, 0x1fec}, {0x03a5, 0x0300, 0x1fea}, {0x03a5, 0x0301, 0x038e}, {0x03a5, 0x0304, 0x1fe9},
+    {0x03a5, 0x0306, 0x1fe8}, {0x03a5, 0x0308, 0x03ab}, {0x03a5, 0x0314, 0x1f59}, {0x03a9, 0x0300, 0x1ffa},
+    {0x03a9, 0x0301, 0x038f}, {0x03a9, 0x0313, 0x1f68}, {0x03a9, 0x0314, 0x1f69}, {0x03a9, 0x0345, 0x1ffc},
+    {0x03ac, 0x0345, 0x1fb4}, {0x03ae, 0x0345, 0x1fc4}, {0x03b1, 0x0300, 0x1f70}, {0x03b1, 0x0301, 0x03ac},
+    {0x03b1, 0x0304, 0x1fb1}, {0x03b1, 0x0306, 0x1fb0}, {0x03b1, 0x0313, 0x1f00}, {0x03b1, 0x0314, 0x1f01},
+    {0x03b1, 0x0342, 0x1fb6}, {0x03b1, 0x0345, 0x1fb3}, {0x03b5, 0x0300, 0x1f72}, {0x03b5, 0x0301, 0x03ad},
+    {0x03b5, 0x0313, 0x1f10}, {0x03b5, 0x0314, 0x1f11}, {0x03b7, 0x0300, 0x1f74}, {0x03b7, 0x0301, 0x03ae},
+    {0x03b7, 0x0313, 0x1f20}, {0x03b7, 0x0314, 0x1f21}, {0x03b7, 0x0342, 0x1fc6}, {0x03b7, 0x0345, 0x1fc3},
+    {0x03b9, 0x0300, 0x1f76}, {0x03b9, 0x0301, 0x03af}, {0x03b9, 0x0304, 0x1fd1}, {0x03b9, 0x0306, 0x1fd0},
+    {0x03b9, 0x0308, 0x03ca}, {0x03b9, 0x0313, 0x1f30}, {0x03b9, 0x0314, 0x1f31}, {0x03b9, 0x0342, 0x1fd6},
+    {0x03bf, 0x0300, 0x1f78}, {0x03bf, 0x0301, 0x03cc}, {0x03bf, 0x0313, 0x1f40}, {0x03bf, 0x0314, 0x1f41},
+    {0x03c1, 0x0313, 0x1fe4}, {0x03c1, 0x0314, 0x1fe5}, {0x03c5, 0x0300, 0x1f7a}, {0x03c5, 0x0301, 0x03cd},
+    {0x03c5, 0x0304, 0x1fe1}, {0x03c5, 0x0306, 0x1fe0}, {0x03c5, 0x0308, 0x03cb}, {0x03c5, 0x0313, 0x1f50},
+    {0x03c5, 0x0314, 0x1f51}, {0x03c5, 0x0342, 0x1fe6}, {0x03c9, 0x0300, 0x1f7c}, {0x03c9, 0x0301, 0x03ce},
+    {0x03c9, 0x0313, 0x1f60}, {0x03c9, 0x0314, 0x1f61}, {0x03c9, 0x0342, 0x1ff6}, {0x03c9, 0x0345, 0x1ff3},
+    {0x03ca, 0x0300, 0x1fd2}, {0x03ca, 0x0301, 0x0390}, {0x03ca, 0x0342, 0x1fd7}, {0x03cb, 0x0300, 0x1fe2},
+    {0x03cb, 0x0301, 0x03b0}, {0x03cb, 0x0342, 0x1fe7}, {0x03ce, 0x0345, 0x1ff4}, {0x03d2, 0x0301, 0x03d3},
+    {0x03d2, 0x0308, 0x03d4}, {0x0406, 0x0308, 0x0407}, {0x0410, 0x0306, 0x04d0}, {0x0410, 0x0308, 0x04d2},
+    {0x0413, 0x0301, 0x0403}, {0x0415, 0x0300, 0x0400}, {0x0415, 0x0306, 0x04d6}, {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04c1}, {0x0416, 0x0308, 0x04dc}, {0x0417, 0x0308, 0x04de}, {0x0418, 0x0300, 0x040d},
+    {0x0418, 0x0304, 0x04e2}, {0x0418, 0x0306, 0x0419}, {0x0418, 0x0308, 0x04e4}, {0x041a, 0x0301, 0x040c},
+    {0x041e, 0x0308, 0x04e6}, {0x0423, 0x0304, 0x04ee}, {0x0423, 0x0306, 0x040e}, {0x0423, 0x0308, 0x04f0},
+    {0x0423, 0x030b, 0x04f2}, {0x0427, 0x0308, 0x04f4}, {0x042b, 0x0308, 0x04f8}, {0x042d, 0x0308, 0x04ec},
+    {0x0430, 0x0306, 0x04d1}, {0x0430, 0x0308, 0x04d3}, {0x0433, 0x0301, 0x0453}, {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04d7}, {0x0435, 0x0308, 0x0451}, {0x0436, 0x0306, 0x04c2}, {0x0436, 0x0308, 0x04dd},
+    {0x0437, 0x0308, 0x04df}, {0x0438, 0x0300, 0x045d}, {0x0438, 0x0304, 0x04e3}, {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04e5}, {0x043a, 0x0301, 0x045c}, {0x043e, 0x0308, 0x04e7}, {0x0443, 0x0304, 0x04ef},
+    {0x0443, 0x0306, 0x045e}, {0x0443, 0x0308, 0x04f1}, {0x0443, 0x030b, 0x04f3}, {0x0447, 0x0308, 0x04f5},
+    {0x044b, 0x0308, 0x04f9}, {0x044d, 0x0308, 0x04ed}, {0x0456, 0x0308, 0x0457}, {0x0474, 0x030f, 0x0476},
+    {0x0475, 0x030f, 0x0477}, {0x04d8, 0x0308, 0x04da}, {0x04d9, 0x0308, 0x04db}, {0x04e8, 0x0308, 0x04ea},
+    {0x04e9, 0x0308, 0x04eb}, {0x0627, 0x0653, 0x0622}, {0x0627, 0x0654, 0x0623}, {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624}, {0x064a, 0x0654, 0x0626}, {0x06c1, 0x0654, 0x06c2}, {0x06d2, 0x0654, 0x06d3},
+    {0x06d5, 0x0654, 0x06c0}, {0x0928, 0x093c, 0x0929}, {0x0930, 0x093c, 0x0931}, {0x0933, 0x093c, 0x0934},
+    {0x09c7, 0x09be, 0x09cb}, {0x09c7, 0x09d7, 0x09cc}, {0x0b47, 0x0b3e, 0x0b4b}, {0x0b47, 0x0b56, 0x0b48},
+    {0x0b47, 0x0b57, 0x0b4c}, {0x0b92, 0x0bd7, 0x0b94}, {0x0bc6, 0x0bbe, 0x0bca}, {0x0bc6, 0x0bd7, 0x0bcc},
+    {0x0bc7, 0x0bbe, 0x0bcb}, {0x0c46, 0x0c56, 0x0c48}, {0x0cbf, 0x0cd5, 0x0cc0}, {0x0cc6, 0x0cc2, 0x0cca},
+    {0x0cc6, 0x0cd5, 0x0cc7}, {0x0cc6, 0x0cd6, 0x0cc8}, {0x0cca, 0x0cd5, 0x0ccb}, {0x0d46, 0x0d3e, 0x0d4a},
+    {0x0d46, 0x0d57, 0x0d4c}, {0x0d47, 0x0d3e, 0x0d4b}, {0x0dd9, 0x0dca, 0x0dda}, {0x0dd9, 0x0dcf, 0x0ddc},
+    {0x0dd9, 0x0ddf, 0x0dde}, {0x0ddc, 0x0dca, 0x0ddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+    {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c}, {0x1b0d, 0x1b35, 0x1b0e},
+    {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b}, {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40},
+    {0x1b3f, 0x1b35, 0x1b41}, {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x0304, 0x1e38}, {0x1e37, 0x0304, 0x1e39},
+    {0x1e5a, 0x0304, 0x1e5c}, {0x1e5b, 0x0304, 0x1e5d}, {0x1e62, 0x0307, 0x1e68}, {0x1e63, 0x0307, 0x1e69},
+    {0x1ea0, 0x0302, 0x1eac}, {0x1ea0, 0x0306, 0x1eb6}, {0x1ea1, 0x0302, 0x1ead}, {0x1ea1, 0x0306, 0x1eb7},
+    {0x1eb8, 0x0302, 0x1ec6}, {0x1eb9, 0x0302, 0x1ec7}, {0x1ecc, 0x0302, 0x1ed8}, {0x1ecd, 0x0302, 0x1ed9},
+    {0x1f00, 0x0300, 0x1f02}, {0x1f00, 0x0301, 0x1f04}, {0x1f00, 0x0342, 0x1f06}, {0x1f00, 0x0345, 0x1f80},
+    {0x1f01, 0x0300, 0x1f03}, {0x1f01, 0x0301, 0x1f05}, {0x1f01, 0x0342, 0x1f07}, {0x1f01, 0x0345, 0x1f81},
+    {0x1f02, 0x0345, 0x1f82}, {0x1f03, 0x0345, 0x1f83}, {0x1f04, 0x0345, 0x1f84}, {0x1f05, 0x0345, 0x1f85},
+    {0x1f06, 0x0345, 0x1f86}, {0x1f07, 0x0345, 0x1f87}, {0x1f08, 0x0300, 0x1f0a}, {0x1f08, 0x0301, 0x1f0c},
+    {0x1f08, 0x0342, 0x1f0e}, {0x1f08, 0x0345, 0x1f88}, {0x1f09, 0x0300, 0x1f0b}, {0x1f09, 0x0301, 0x1f0d},
+    {0x1f09, 0x0342, 0x1f0f}, {0x1f09, 0x0345, 0x1f89}, {0x1f0a, 0x0345, 0x1f8a}, {0x1f0b, 0x0345, 0x1f8b},
+    {0x1f0c, 0x0345, 0x1f8c}, {0x1f0d, 0x0345, 0x1f8d}, {0x1f0e, 0x0345, 0x1f8e}, {0x1f0f, 0x0345, 0x1f8f},
+    {0x1f10, 0x0300, 0x1f12}, {0x1f10, 0x0301, 0x1f14}, {0x1f11, 0x0300, 0x1f13}, {0x1f11, 0x0301, 0x1f15},
+    {0x1f18, 0x0300, 0x1f1a}, {0x1f18, 0x0301, 0x1f1c}, {0x1f19, 0x0300, 0x1f1b}, {0x1f19, 0x0301, 0x1f1d},
+    {0x1f20, 0x0300, 0x1f22}, {0x1f20, 0x0301, 0x1f24}, {0x1f20, 0x0342, 0x1f26}, {0x1f20, 0x0345, 0x1f90},
+    {0x1f21, 0x0300, 0x1f23}, {0x1f21, 0x0301, 0x1f25}, {0x1f21, 0x0342, 0x1f27}, {0x1f21, 0x0345, 0x1f91},
+    {0x1f22, 0x0345, 0x1f92}, {0x1f23, 0x0345, 0x1f93}, {0x1f24, 0x0345, 0x1f94}, {0x1f25, 0x0345, 0x1f95},
+    {0x1f26, 0x0345, 0x1f96}, {0x1f27, 0x0345, 0x1f97}, {0x1f28, 0x0300, 0x1f2a}, {0x1f28, 0x0301, 0x1f2c},
+    {0x1f28, 0x0342, 0x1f2e}, {0x1f28, 0x0345, 0x1f98}, {0x1f29, 0x0300, 0x1f2b}, {0x1f29, 0x0301, 0x1f2d},
+    {0x1f29, 0x0342, 0x1f2f}, {0x1f29, 0x0345, 0x1f99}, {0x1f2a, 0x0345, 0x1f9a}, {0x1f2b, 0x0345, 0x1f9b},
+    {0x1f2c, 0x0345, 0x1f9c}, {0x1f2d, 0x0345, 0x1f9d}, {0x1f2e, 0x0345, 0x1f9e}, {0x1f2f, 0x0345, 0x1f9f},
+    {0x1f30, 0x0300, 0x1f32}, {0x1f30, 0x0301, 0x1f34}, {0x1f30, 0x0342, 0x1f36}, {0x1f31, 0x0300, 0x1f33},
+    {0x1f31, 0x0301, 0x1f35}, {0x1f31, 0x0342, 0x1f37}, {0x1f38, 0x0300, 0x1f3a}, {0x1f38, 0x0301, 0x1f3c},
+    {0x1f38, 0x0342, 0x1f3e}, {0x1f39, 0x0300, 0x1f3b}, {0x1f39, 0x0301, 0x1f3d}, {0x1f39, 0x0342, 0x1f3f},
+    {0x1f40, 0x0300, 0x1f42}, {0x1f40, 0x0301, 0x1f44}, {0x1f41, 0x0300, 0x1f43}, {0x1f41, 0x0301, 0x1f45},
+    {0x1f48, 0x0300, 0x1f4a}, {0x1f48, 0x0301, 0x1f4c}, {0x1f49, 0x0300, 0x1f4b}, {0x1f49, 0x0301, 0x1f4d},
+    {0x1f50, 0x0300, 0x1f52}, {0x1f50, 0x0301, 0x1f54}, {0x1f50, 0x0342, 0x1f56}, {0x1f51, 0x0300, 0x1f53},
+    {0x1f51, 0x0301, 0x1f55}, {0x1f51, 0x0342, 0x1f57}, {0x1f59, 0x0300, 0x1f5b}, {0x1f59, 0x0301, 0x1f5d},
+    {0x1f59, 0x0342, 0x1f5f}, {0x1f60, 0x0300, 0x1f62}, {0x1f60, 0x0301, 0x1f64}, {0x1f60, 0x0342, 0x1f66},
+    {0x1f60, 0x0345, 0x1fa0}, {0x1f61, 0x0300, 0x1f63}, {0x1f61, 0x0301, 0x1f65}, {0x1f61, 0x0342, 0x1f67},
+    {0x1f61, 0x0345, 0x1fa1}, {0x1f62, 0x0345, 0x1fa2}, {0x1f63, 0x0345, 0x1fa3}, {0x1f64, 0x0345, 0x1fa4},
+    {0x1f65, 0x0345, 0x1fa5}, {0x1f66, 0x0345, 0x1fa6}, {0x1f67, 0x0345, 0x1fa7}, {0x1f68, 0x0300, 0x1f6a},
+    {0x1f68, 0x0301, 0x1f6c}, {0x1f68, 0x0342, 0x1f6e}, {0x1f68, 0x0345, 0x1fa8}, {0x1f69, 0x0300, 0x1f6b},
+    {0x1f69, 0x0301, 0x1f6d}, {0x1f69, 0x0342, 0x1f6f}, {0x1f69, 0x0345, 0x1fa9}, {0x1f6a, 0x0345, 0x1faa},
+    {0x1f6b, 0x0345, 0x1fab}, {0x1f6c, 0x0345, 0x1fac}, {0x1f6d, 0x0345, 0x1fad}, {0x1f6e, 0x0345, 0x1fae},
+    {0x1f6f, 0x0345, 0x1faf}, {0x1f70, 0x0345, 0x1fb2}, {0x1f74, 0x0345, 0x1fc2}, {0x1f7c, 0x0345, 0x1ff2},
+    {0x1fb6, 0x0345, 0x1fb7}, {0x1fbf, 0x0300, 0x1fcd}, {0x1fbf, 0x0301, 0x1fce}, {0x1fbf, 0x0342, 0x1fcf},
+    {0x1fc6, 0x0345, 0x1fc7}, {0x1ff6, 0x0345, 0x1ff7}, {0x1ffe, 0x0300, 0x1fdd}, {0x1ffe, 0x0301, 0x1fde},
+    {0x1ffe, 0x0342, 0x1fdf}, {0x2190, 0x0338, 0x219a}, {0x2192, 0x0338, 0x219b}, {0x2194, 0x0338, 0x21ae},
+    {0x21d0, 0x0338, 0x21cd}, {0x21d2, 0x0338, 0x21cf}, {0x21d4, 0x0338, 0x21ce}, {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209}, {0x220b, 0x0338, 0x220c}, {0x2223, 0x0338, 0x2224}, {0x2225, 0x0338, 0x2226},
+    {0x223c, 0x0338, 0x2241}, {0x2243, 0x0338, 0x2244}, {0x2245, 0x0338, 0x2247}, {0x2248, 0x0338, 0x2249},
+    {0x224d, 0x0338, 0x226d}, {0x2261, 0x0338, 0x2262}, {0x2264, 0x0338, 0x2270}, {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274}, {0x2273, 0x0338, 0x2275}, {0x2276, 0x0338, 0x2278}, {0x2277, 0x0338, 0x2279},
+    {0x227a, 0x0338, 0x2280}, {0x227b, 0x0338, 0x2281}, {0x227c, 0x0338, 0x22e0}, {0x227d, 0x0338, 0x22e1},
+    {0x2282, 0x0338, 0x2284}, {0x2283, 0x0338, 0x2285}, {0x2286, 0x0338, 0x2288}, {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22e2}, {0x2292, 0x0338, 0x22e3}, {0x22a2, 0x0338, 0x22ac}, {0x22a8, 0x0338, 0x22ad},
+    {0x22a9, 0x0338, 0x22ae}, {0x22ab, 0x0338, 0x22af}, {0x22b2, 0x0338, 0x22ea}, {0x22b3, 0x0338, 0x22eb},
+    {0x22b4, 0x0338, 0x22ec}, {0x22b5, 0x0338, 0x22ed}, {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c},
+    {0x304d, 0x3099, 0x304e}, {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a}, {0x305b, 0x3099, 0x305c},
+    {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076}, {0x3075, 0x309a, 0x3077},
+    {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a}, {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d},
+    {0x309d, 0x3099, 0x309e}, {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+    {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4}, {0x30b5, 0x3099, 0x30b6},
+    {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba}, {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be},
+    {0x30bf, 0x3099, 0x30c0}, {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+    {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1}, {0x30d2, 0x3099, 0x30d3},
+    {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6}, {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9},
+    {0x30d8, 0x309a, 0x30da}, {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+    {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa}, {0x30fd, 0x3099, 0x30fe},
+    {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c}, {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e},
+    {0x11132, 0x11127, 0x1112f}, {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+    {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba}, {0x115b9, 0x115af, 0x115bb},
+    {0x11935, 0x11930, 0x11938},
+};
+
+
+enum
+{
+	hangul_s       = 0xac00, // the first syllable
+	hangul_l       = 0x1100, // the first leading consonant
+	hangul_v       = 0x1161, // the first vowel
+	hangul_t       = 0x11a7, // one before the first trailing consonant
+	hangul_l_count = 19,
+	hangul_v_count = 21,
+	hangul_t_count = 28,
+	hangul_n       = hangul_v_count * hangul_t_count,
+	hangul_count   = hangul_l_count * hangul_n,
+};
+
+static inline const norm_record& norm_lookup(int cp)
+{
+	if ((unsigned) cp > (unsigned) norm_max)
+		return norm_records[0];
+	return norm_records[norm_blocks[norm_stage1[cp >> norm_shift]][cp & ((1 << norm_shift) - 1)]];
+}
+
+static inline quick_check_result quick_check_of(const norm_record& r, normalization_form form)
+{
+	return (quick_check_result) ((r.QC >> (2 * form)) & 3);
+}
+
+// True if normalization never reaches across the start of a code point with the record 'r',
+// because it is a starter that doesn't combine with anything before it
+static inline bool norm_boundary(const norm_record& r, normalization_form form)
+{
+	return r.CCC == 0 && quick_check_of(r, form) == quick_check_yes;
+}
+
+// Decodes a code point of valid UTF-8, without checking it again
+static inline int decode_valid(const char* s, int& len)
+{
+	uint8_t b = (uint8_t) s[0];
+	if (b <= max1)
+	{
+		len = 1;
+		return b;
+	}
+	if (b < 0xe0)
+	{
+		len = 2;
+		return ((b & 0x1f) << 6) | (s[1] & 0x3f);
+	}
+	if (b < 0xf0)
+	{
+		len = 3;
+		return ((b & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+	}
+	len = 4;
+	return ((b & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+}
+
+// Adds the decomposition of 'cp' in 'keys' to 'out', and returns false if it has none
+static bool find_decomposition(const uint32_t* keys, size_t n, const uint16_t* offsets, const uint16_t* pool, int cp, std::vector<char32_t>& out)
+{
+	const uint32_t* k = std::lower_bound(keys, keys + n, (uint32_t) cp);
+	if (k == keys + n || *k != (uint32_t) cp)
+		return false;
+	for (size_t i = offsets[k - keys]; i < offsets[k - keys + 1]; i++)
+	{
+		char32_t c = pool[i];
+		if (c >= utf16_surrogate_low && c <= utf16_surrogate_high)
+			c = 0x10000 + ((c - utf16_surrogate_low) << 10) + (pool[++i] - 0xdc00);
+		out.push_back(c);
+	}
+	return true;
+}
+
+// Adds the full decomposition of 'cp' to 'out'
+static void decompose(int cp, bool compat, std::vector<char32_t>& out)
+{
+	if (cp >= hangul_s && cp < hangul_s + hangul_count)
+	{
+		int i = cp - hangul_s;
+		out.push_back(hangul_l + i / hangul_n);
+		out.push_back(hangul_v + i % hangul_n / hangul_t_count);
+		if (i % hangul_t_count != 0)
+			out.push_back(hangul_t + i % hangul_t_count);
+		return;
+	}
+	const size_t ncompat    = sizeof(compat_keys) / sizeof(compat_keys[0]);
+	const size_t ncanonical = sizeof(canonical_keys) / sizeof(canonical_keys[0]);
+	if (compat && find_decomposition(compat_keys, ncompat, compat_offsets, compat_pool, cp, out))
+		return;
+	if (!find_decomposition(canonical_keys, ncanonical, canonical_offsets, canonical_pool, cp, out))
+		out.push_back(cp);
+}
+
+// Sorts each run of code points with a non-zero combining class by their class. Code points
+// with the same class keep their order.
+static void canonical_order(char32_t* cps, size_t n)
+{
+	for (size_t i = 1; i < n; i++)
+	{
+		char32_t c   = cps[i];
+		int      ccc = norm_lookup(c).CCC;
+		size_t   j   = i;
+		for (; ccc != 0 && j != 0 && norm_lookup(cps[j - 1]).CCC > ccc; j--)
+			cps[j] = cps[j - 1];
+		cps[j] = c;
+	}
+}
+
+static inline bool operator<(const composition& c, const composition& key)
+{
+	return c.First < key.First || (c.First == key.First && c.Second < key.Second);
+}
+
+// Returns the primary composite of 'a' and 'b', or 'invalid' if there is none
+static int compose_pair(int a, int b)
+{
+	if (a >= hangul_l && a < hangul_l + hangul_l_count && b >= hangul_v && b < hangul_v + hangul_v_count)
+		return hangul_s + ((a - hangul_l) * hangul_v_count + (b - hangul_v)) * hangul_t_count;
+	if (a >= hangul_s && a < hangul_s + hangul_count && (a - hangul_s) % hangul_t_count == 0 && b > hangul_t && b < hangul_t + hangul_t_count)
+		return a + (b - hangul_t);
+	const size_t       n   = sizeof(compositions) / sizeof(compositions[0]);
+	composition        key = {(uint32_t) a, (uint32_t) b, 0};
+	const composition* c   = std::lower_bound(compositions, compositions + n, key);
+	if (c == compositions + n || c->First != (uint32_t) a || c->Second != (uint32_t) b)
+		return invalid;
+	return c->Composite;
+}
+
+// Composes the decomposed code points in canonical order in 'cps', in place, and returns how
+// many are left
+static size_t compose(char32_t* cps, size_t n)
+{
+	const size_t none     = (size_t) -1;
+	size_t       starter  = none; // where the last starter went
+	int          last_ccc = 0;    // of the last code point that wasn't composed
+	size_t       out      = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		char32_t           c = cps[i];
+		const norm_record& r = norm_lookup(c);
+		// only the second code point of a composite can be Maybe, and a code point is blocked
+		// from the starter by any code point between them with the same or a higher class
+		if (starter != none && quick_check_of(r, nfc) == quick_check_maybe && (out - 1 == starter || (last_ccc != 0 && last_ccc < r.CCC)))
+		{
+			int composite = compose_pair(cps[starter], c);
+			if (composite != invalid)
+			{
+				cps[starter] = composite;
+				continue;
+			}
+		}
+		if (r.CCC == 0)
+			starter = out;
+		last_ccc   = r.CCC;
+		cps[out++] = c;
+	}
+	return out;
+}
+
+// Normalizes [s, end), which is valid UTF-8, and adds it to 'out'
+static void normalize_span(const char* s, const char* end, normalization_form form, std::vector<char32_t>& cps, std::string& out)
+{
+	cps.clear();
+	while (s != end)
+	{
+		int len;
+		int cp = decode_valid(s, len);
+		decompose(cp, form == nfkc || form == nfkd, cps);
+		s += len;
+	}
+	size_t n = cps.size();
+	canonical_order(&cps[0], n);
+	if (form == nfc || form == nfkc)
+		n = compose(&cps[0], n);
+	encode(out, &cps[0], n);
+}
+
+// Returns the start of the first code point after the one at 's' that is a norm_boundary, or 'end'
+static const char* next_norm_boundary(const char* s, const char* end, normalization_form form)
+{
+	int len;
+	decode_valid(s, len);
+	for (s += len; s != end; s += len)
+	{
+		if (norm_boundary(norm_lookup(decode_valid(s, len)), form))
+			break;
+	}
+	return s;
+}
+#endif
+
+// Returns the index of the first of the 'norm_block' bytes at 's' that is not ASCII, and not in
+// the set 'simple', which is a row of norm_simple_bytes, or norm_block if there is none
+#if defined(UTFZ_AVX512)
+static const int norm_block = 64;
+
+static inline int first_complex(const char* s, const uint8_t* simple)
+{
+	const __m512i bits = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128));
+	__m512i       set  = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*) simple));
+	__m512i       v    = _mm512_loadu_si512((const void*) s);
+	__m512i       idx  = _mm512_and_si512(_mm512_srli_epi16(v, 3), _mm512_set1_epi8(0x0f));
+	__m512i       bit  = _mm512_shuffle_epi8(bits, _mm512_and_si512(v, _mm512_set1_epi8(7)));
+	uint64_t      m    = _mm512_testn_epi8_mask(_mm512_shuffle_epi8(set, idx), bit) & _mm512_movepi8_mask(v);
+	return m == 0 ? norm_block : ctz64(m);
+}
+#elif defined(UTFZ_AVX2)
+static const int norm_block = 32;
+
+static inline int first_complex(const char* s, const uint8_t* simple)
+{
+	const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	__m256i       set  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) simple));
+	__m256i       v    = _mm256_loadu_si256((const __m256i*) s);
+	__m256i       idx  = _mm256_and_si256(_mm256_srli_epi16(v, 3), _mm256_set1_epi8(0x0f));
+	__m256i       bit  = _mm256_shuffle_epi8(bits, _mm256_and_si256(v, _mm256_set1_epi8(7)));
+	__m256i       miss = _mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(set, idx), bit), _mm256_setzero_si256());
+	uint32_t      m    = _mm256_movemask_epi8(miss) & _mm256_movemask_epi8(v);
+	return m == 0 ? norm_block : ctz64(m);
+}
+#elif defined(UTFZ_SSE42)
+static const int norm_block = 16;
+
+static inline int first_complex(const char* s, const uint8_t* simple)
+{
+	const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	__m128i       set  = _mm_loadu_si128((const __m128i*) simple);
+	__m128i       v    = _mm_loadu_si128((const __m128i*) s);
+	__m128i       idx  = _mm_and_si128(_mm_srli_epi16(v, 3), _mm_set1_epi8(0x0f));
+	__m128i       bit  = _mm_shuffle_epi8(bits, _mm_and_si128(v, _mm_set1_epi8(7)));
+	__m128i       miss = _mm_cmpeq_epi8(_mm_and_si128(_mm_shuffle_epi8(set, idx), bit), _mm_setzero_si128());
+	uint32_t      m    = _mm_movemask_epi8(miss) & _mm_movemask_epi8(v);
+	return m == 0 ? norm_block : ctz64(m);
+}
+#else
+static const int norm_block = 8;
+
+static inline int first_complex(const char* s, const uint8_t* simple)
+{
+	// only ASCII is simple here
+	(void) simple;
+	return is_ascii_8(s) ? norm_block : 0;
+}
+#endif
+
+// Returns the number of bytes at the front of [s, end) that are ASCII, or in the set 'simple'
+static size_t simple_run(const char* s, const char* end, const uint8_t* simple)
+{
+	UTFZ_DISPATCH_TO(simple_run, s, end, simple);
+	const char* p = s;
+	for (; end - p >= norm_block; p += norm_block)
+	{
+		int first = first_complex(p, simple);
+		if (first != norm_block)
+		{
+			p += first;
+			break;
+		}
+	}
+	// Without vectors, first_complex only finds the block, so the byte is found here
+	for (; p != end; p++)
+	{
+		uint8_t b = (uint8_t) *p;
+		if (b > max1 && (simple[(b >> 3) & 0x0f] & (1 << (b & 7))) == 0)
+			break;
+	}
+	return p - s;
+}
+
+#ifndef UTFZ_NAMESPACE
+
+// Scans [s, end), which is valid UTF-8, and returns the first code point that fails the quick
+// check of 'form', because its quick check is No or Maybe, or because it is out of canonical
+// order. Returns 'end' if there is none. 'boundary' is moved to the last norm_boundary before
+// that, and 'last_ccc' is the combining class of the code point before it.
+static const char* norm_scan(const char* s, const char* end, normalization_form form, const char*& boundary, int& last_ccc)
+{
+	const uint8_t* simple = norm_simple_bytes[form];
+	const char*    stop   = s;
+	while (s != end)
+	{
+		if (s >= stop && end - s >= norm_block)
+		{
+			// Every code point that starts before the first complex byte is a boundary
+			size_t run = simple_run(s, end, simple);
+			if (run != 0)
+			{
+				const char* next = s + run;
+				for (s = next - 1; ((uint8_t) *s & 0xc0) == 0x80; s--)
+				{
+				}
+				boundary = s;
+				last_ccc = 0;
+				if (next != end)
+					s = next;
+			}
+			// Check the complex code point one by one, and if the run stopped right away, the
+			// text is likely to be dense with them, so carry on one by one for a block
+			stop = run == 0 ? s + norm_block : s + 1;
+		}
+		if ((uint8_t) *s <= max1)
+		{
+			boundary = s++;
+			last_ccc = 0;
+			continue;
+		}
+		int                len;
+		const norm_record& r = norm_lookup(decode_valid(s, len));
+		if (quick_check_of(r, form) != quick_check_yes || (r.CCC != 0 && last_ccc > r.CCC))
+			return s;
+		if (r.CCC == 0)
+			boundary = s;
+		last_ccc = r.CCC;
+		s += len;
+	}
+	return s;
+}
+
+// Normalizes [s, end), which is valid UTF-8. Only the spans around code points that fail the
+// quick check are normalized, and if they all stay the same, nothing is added to 'out', and it
+// returns true. 'out' can be null, to only find out whether [s, end) is normalized.
+static bool normalize_valid(const char* s, const char* end, normalization_form form, std::string* out)
+{
+	const char*           begin    = s;
+	const char*           copied   = s; // the end of what has been added to 'out'
+	const char*           boundary = s;
+	int                   last_ccc = 0;
+	bool                  same     = true;
+	std::vector<char32_t> cps;
+	std::string           span;
+	while ((s = norm_scan(s, end, form, boundary, last_ccc)) != end)
+	{
+		const char* span_end = next_norm_boundary(s, end, form);
+		span.clear();
+		normalize_span(boundary, span_end, form, cps, span);
+		if (span.size() != (size_t) (span_end - boundary) || memcmp(span.data(), boundary, span.size()) != 0)
+		{
+			if (out == nullptr)
+				return false;
+			if (same)
+				out->reserve(out->size() + (end - begin) + span.size());
+			same = false;
+			out->append(copied, boundary - copied);
+			out->append(span);
+			copied = span_end;
+		}
+		s = boundary = span_end;
+		last_ccc     = 0;
+	}
+	if (!same)
+		out->append(copied, end - copied);
+	return same;
+}
+
+quick_check_result quick_check(const char* s, const char* end, normalization_form form)
+{
+	if (!validate(s, end))
+		return quick_check_no;
+	quick_check_result result   = quick_check_yes;
+	const char*        boundary = s;
+	int                last_ccc = 0;
+	while ((s = norm_scan(s, end, form, boundary, last_ccc)) != end)
+	{
+		int                len;
+		const norm_record& r = norm_lookup(decode_valid(s, len));
+		if (quick_check_of(r, form) == quick_check_no || (r.CCC != 0 && last_ccc > r.CCC))
+			return quick_check_no;
+		result   = quick_check_maybe;
+		last_ccc = r.CCC;
+		s += len;
+	}
+	return result;
+}
+
+bool is_normalized(const char* s, const char* end, normalization_form form)
+{
+	return validate(s, end) && normalize_valid(s, end, form, nullptr);
+}
+
+bool normalize(const char* s, const char* end, std::string& out, normalization_form form)
+{
+	if (validate(s, end))
+		return normalize_valid(s, end, form, &out);
+	std::string clean;
+	sanitize(s, end, clean);
+	if (normalize_valid(clean.data(), clean.data() + clean.size(), form, &out))
+		out.append(clean);
+	return false;
+}
+
+bool normalize(std::string& s, normalization_form form)
+{
+	std::string normalized;
+	if (normalize(s.data(), s.data() + s.size(), normalized, form))
+		return true;
+	s.swap(normalized);
+	return false;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTFZ_NAMESPACE
+// The values of the Grapheme_Cluster_Break property (UAX #29)
+enum grapheme_break
+{
+	gcb_other,
+	gcb_cr,
+	gcb_lf,
+	gcb_control,
+	gcb_extend,
+	gcb_zwj,
+	gcb_regional_indicator,
+	gcb_prepend,
+	gcb_spacing_mark,
+	gcb_l,
+	gcb_v,
+	gcb_t,
+	gcb_lv,
+	gcb_lvt,
+	gcb_pictographic, // Other, and also Extended_Pictographic, which GB11 looks for
+};
+
+// Generated from the Unicode Character Database 14.0
+static const int grapheme_shift = 6;
+static const int grapheme_max   = 0x1fffd; // the last code point below 0x20000 that is not gcb_other
+
+// The block of grapheme_blocks for each group of 64 code points, up to grapheme_max
+static const uint8_t grapheme_stage1[2048] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 3, 3,
+    3, 3, 6, 3, 3, 3, 7, 8, 9, 10, 3, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 24, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 3, 50, 51, 52, 53, 3, 3, 3, 3, 3, 54, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 55, 56, 57, 58,
+    59, 3, 60, 3, 61, 3, 3, 3, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 3, 3, 71, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3,
+    72, 73, 3, 74, 75, 3, 76, 3, 3, 3, 3, 3, 77, 3, 78, 79,
+    3, 3, 3, 80, 3, 3, 81, 82, 83, 84, 85, 84, 86, 87, 88, 3,
+    3, 3, 3, 3, 89, 3, 3, 3, 3, 3, 3, 3, 90, 91, 3, 3,
+    3, 3, 3, 92, 3, 93, 3, 94, 3, 3, 3, 3, 3, 3, 3, 3,
+    95, 3, 96, 3, 3, 3, 3, 3, 3, 3, 97, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 98, 99, 100, 3, 3, 3, 3,
+    101, 3, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 3, 3, 3, 112,
+    113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114,
+    115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116,
+    117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118,
+    119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113,
+    114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115,
+    116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117,
+    118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119,
+    113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114,
+    115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116,
+    117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118,
+    119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 120, 121,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 122, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 123, 3, 3, 1, 3, 3, 99, 124,
+    3, 3, 3, 3, 3, 3, 3, 125, 3, 3, 3, 126, 3, 127, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 128, 3, 3, 129, 3, 3, 3, 3,
+    3, 3, 3, 3, 130, 3, 3, 3, 3, 3, 131, 3, 3, 132, 133, 3,
+    134, 135, 136, 137, 138, 139, 140, 141, 142, 3, 3, 143, 35, 144, 3, 3,
+    145, 146, 147, 148, 3, 3, 149, 150, 151, 152, 153, 3, 154, 3, 3, 3,
+    155, 3, 3, 3, 156, 157, 3, 158, 159, 160, 161, 3, 3, 3, 3, 3,
+    162, 3, 163, 3, 164, 165, 166, 3, 3, 3, 3, 167, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    168, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 169, 170, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 171, 172, 173,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 174, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 175, 176, 3, 3,
+    3, 3, 3, 3, 3, 177, 178, 3, 3, 179, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 180, 181, 182, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    183, 3, 3, 3, 170, 3, 3, 3, 3, 3, 184, 185, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 186, 3, 187, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    84, 84, 84, 84, 188, 189, 190, 191, 192, 193, 84, 84, 84, 84, 84, 194,
+    84, 84, 84, 84, 195, 196, 84, 84, 84, 197, 84, 84, 3, 198, 3, 199,
+    200, 201, 202, 84, 203, 204, 84, 84, 84, 84, 84, 84, 3, 3, 3, 3,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 195,
+};
+
+// The grapheme_break of each code point in a block, two to a byte, with the even code point in
+// the low 4 bits
+static const uint8_t grapheme_blocks[205][32] = {
+    {
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    },
+    {
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x30, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40,
+    },
+    {
+        0x40, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x74, 0x40,
+        0x44, 0x44, 0x04, 0x40, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x40, 0x44, 0x44,
+        0x44, 0x44, 0x40, 0x44, 0x40, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x04, 0x88,
+    },
+    {
+        0x48, 0x44, 0x44, 0x44, 0x84, 0x88, 0x48, 0x88, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84,
+    },
+    {
+        0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    },
+    {
+        0x40, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+    },
+    {
+        0x48, 0x04, 0x00, 0x40, 0x04, 0x40, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x48, 0x44, 0x44, 0x40, 0x84, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44,
+    },
+    {
+        0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    },
+    {
+        0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+    },
+    {
+        0x84, 0x08, 0x00, 0x88, 0x08, 0x88, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x84, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+    },
+    {
+        0x84, 0x88, 0x08, 0x44, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48,
+    },
+    {
+        0x88, 0x84, 0x08, 0x84, 0x08, 0x88, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x84,
+    },
+    {
+        0x48, 0x44, 0x04, 0x88, 0x08, 0x88, 0x48, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x88, 0x44, 0x04, 0x04, 0x88, 0x88, 0x88, 0x48,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x00, 0x00, 0x88,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84,
+    },
+    {
+        0x44, 0x44, 0x04, 0x44, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x84, 0x44, 0x44, 0x44, 0x40, 0x84, 0x48, 0x04,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x00, 0x00, 0x44,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x04, 0x48, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    },
+    {
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+        0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    },
+    {
+        0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+        0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x44, 0x44, 0x44, 0x88,
+    },
+    {
+        0x88, 0x88, 0x88, 0x84, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x84, 0x88, 0x48, 0x84, 0x88, 0x00, 0x00, 0x88, 0x84, 0x88, 0x88, 0x48, 0x44, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x48, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x44, 0x44, 0x44, 0x04,
+        0x04, 0x04, 0x40, 0x44, 0x44, 0x44, 0x84, 0x88, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x84, 0x84, 0x88,
+    },
+    {
+        0x88, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x80, 0x44, 0x44, 0x88, 0x44, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x84, 0x44, 0x88, 0x48, 0x48, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x44, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x84, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x80, 0x44, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x54, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0x00, 0x00, 0xee, 0x0e, 0x00, 0x00,
+    },
+    {
+        0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0x0e,
+    },
+    {
+        0xee, 0xee, 0xee, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0x0e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0xe0, 0x00,
+        0xe0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x0e, 0xe0, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0xe0, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xe0, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0x00, 0x00, 0x00, 0x00,
+        0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0xe0, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x04, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x48, 0x84, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    },
+    {
+        0x88, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0x00,
+    },
+    {
+        0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x88, 0x44, 0x88,
+    },
+    {
+        0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x84, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x04, 0x40, 0x04, 0x00, 0x00, 0x44,
+    },
+    {
+        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x88, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x48, 0x88, 0x84, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd,
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    },
+    {
+        0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+        0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xb0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+        0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00,
+    },
+    {
+        0x40, 0x44, 0x40, 0x04, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x40,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40,
+    },
+    {
+        0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x84, 0x48, 0x04, 0x70, 0x00,
+    },
+    {
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44, 0x84,
+    },
+    {
+        0x08, 0x77, 0x00, 0x00, 0x40, 0x44, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x88, 0x84, 0x44, 0x00, 0x00, 0x00, 0x04,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x88, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x84, 0x88, 0x08, 0x80, 0x08, 0x80, 0x88, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x88, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x88, 0x44, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x48, 0x44, 0x44, 0x84, 0x84, 0x48, 0x48,
+    },
+    {
+        0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x00, 0x88, 0x88, 0x44, 0x48,
+    },
+    {
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x84, 0x48, 0x48,
+    },
+    {
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88, 0x44, 0x44, 0x44, 0x48, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+        0x00, 0x44, 0x44, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x04, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x88, 0x88, 0x80, 0x08, 0x40, 0x84, 0x74,
+    },
+    {
+        0x78, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x00, 0x44, 0x88, 0x88,
+        0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x47, 0x44, 0x04,
+    },
+    {
+        0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x44, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x77, 0x77, 0x77, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84, 0x44, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x48,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x80, 0x44, 0x44, 0x44, 0x84, 0x44, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x04, 0x00, 0x04, 0x44, 0x40,
+    },
+    {
+        0x44, 0x44, 0x44, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x08, 0x44, 0x80, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+        0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    },
+    {
+        0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
+        0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x48, 0x44, 0x00, 0x80, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44,
+    },
+    {
+        0x44, 0x04, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x44, 0x44,
+    },
+    {
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44,
+        0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40, 0x44, 0x44,
+        0x44, 0x40, 0x04, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xee, 0xee, 0xee, 0xee, 0x0e, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    },
+    {
+        0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xee, 0xee, 0xee, 0xee, 0x0e, 0xee, 0xee,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x4e, 0x44, 0x44,
+    },
+    {
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x0e, 0xee, 0xee,
+    },
+    {
+        0xee, 0xee, 0xee, 0xe0, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    },
+};
+
+static const uint16_t gcb_marks = 1 << gcb_extend | 1 << gcb_zwj | 1 << gcb_spacing_mark;
+static const uint16_t gcb_hangul = 1 << gcb_l | 1 << gcb_v | 1 << gcb_t | 1 << gcb_lv | 1 << gcb_lvt;
+
+// For each grapheme_break, the ones that never start a new cluster after it (GB3 to GB9b).
+// GB11 and GB12 to GB13 depend on what comes before the pair, so they are not in here.
+static const uint16_t grapheme_joins[] = {
+    gcb_marks,                                                // other
+    1 << gcb_lf,                                              // cr
+    0,                                                        // lf
+    0,                                                        // control
+    gcb_marks,                                                // extend
+    gcb_marks,                                                // zwj
+    gcb_marks,                                                // regional_indicator
+    0xffff & ~(1 << gcb_cr | 1 << gcb_lf | 1 << gcb_control), // prepend
+    gcb_marks,                                                // spacing_mark
+    gcb_marks | (gcb_hangul & ~(1 << gcb_t)),                 // l
+    gcb_marks | 1 << gcb_v | 1 << gcb_t,                      // v
+    gcb_marks | 1 << gcb_t,                                   // t
+    gcb_marks | 1 << gcb_v | 1 << gcb_t,                      // lv
+    gcb_marks | 1 << gcb_t,                                   // lvt
+    gcb_marks,                                                // pictographic
+};
+
+static inline int grapheme_break_of(int cp)
+{
+	if ((unsigned) cp > (unsigned) grapheme_max)
+	{
+		// Plane 14 holds the tags and the supplementary variation selectors, and the rest of it
+		// is reserved as Control
+		if (cp < 0xe0000 || cp > 0xe0fff)
+			return gcb_other;
+		return (cp >= 0xe0020 && cp <= 0xe007f) || (cp >= 0xe0100 && cp <= 0xe01ef) ? gcb_extend : gcb_control;
+	}
+	uint8_t two = grapheme_blocks[grapheme_stage1[cp >> grapheme_shift]][(cp & ((1 << grapheme_shift) - 1)) >> 1];
+	return cp & 1 ? two >> 4 : two & 15;
+}
+
+// Generated from the Unicode Character Database 14.0
+static const int width_shift = 6;
+static const int width_max   = 0x1faf6; // the last code point below 0x20000 that is not 1 column wide
+
+// The block of width_blocks for each group of 64 code points, up to width_max
+static const uint8_t width_stage1[2028] = {
+    0, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2,
+    2, 2, 5, 2, 2, 2, 6, 7, 8, 9, 2, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 23, 25, 26, 27, 28, 29,
+    30, 31, 26, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+    45, 46, 47, 2, 48, 49, 3, 3, 2, 2, 2, 2, 2, 50, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 51, 52, 53, 54,
+    55, 2, 56, 2, 57, 2, 2, 2, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 2, 2, 67, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+    68, 69, 2, 70, 2, 2, 2, 2, 2, 2, 2, 2, 71, 2, 2, 72,
+    2, 2, 2, 2, 2, 2, 2, 73, 74, 75, 76, 77, 78, 79, 80, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 81, 82, 2, 2,
+    2, 2, 2, 83, 2, 1, 2, 84, 2, 2, 85, 86, 48, 48, 48, 87,
+    88, 89, 90, 48, 91, 48, 92, 93, 94, 95, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 2, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 96, 97, 2, 2, 2, 2, 2, 98, 99, 100, 2, 2, 2, 2,
+    101, 2, 2, 102, 103, 104, 105, 106, 107, 108, 109, 110, 2, 2, 2, 111,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 112, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 48, 48, 48, 48, 48, 48, 48, 48, 113, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 114, 115, 2, 1, 89, 116, 2, 117,
+    2, 2, 2, 2, 2, 2, 2, 118, 2, 2, 2, 119, 2, 120, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 121, 2, 2, 122, 2, 2, 2, 2,
+    2, 2, 2, 2, 123, 2, 2, 2, 2, 2, 124, 2, 2, 125, 126, 2,
+    127, 128, 129, 130, 131, 132, 133, 134, 135, 2, 2, 136, 33, 137, 2, 2,
+    138, 139, 140, 141, 2, 2, 142, 143, 144, 145, 146, 2, 147, 2, 2, 2,
+    148, 2, 2, 2, 149, 150, 2, 151, 152, 153, 154, 2, 2, 2, 2, 2,
+    155, 2, 156, 2, 157, 158, 159, 2, 2, 2, 2, 160, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    161, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 162, 163, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 164, 165, 166,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 167,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 168, 169, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 170,
+    48, 48, 48, 48, 171, 172, 48, 48, 48, 48, 48, 173, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 174, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 175, 176, 2, 2,
+    2, 2, 2, 2, 2, 177, 178, 2, 2, 179, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 180, 181, 182, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    183, 2, 2, 2, 163, 2, 2, 2, 2, 2, 184, 185, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 186, 2, 187, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    188, 2, 2, 189, 2, 2, 190, 191, 192, 193, 2, 2, 194, 195, 196, 197,
+    198, 199, 48, 200, 201, 202, 203, 204, 48, 205, 48, 206, 2, 2, 2, 207,
+    2, 2, 2, 2, 208, 209, 48, 48, 2, 210, 211, 212,
+};
+
+// The width of each code point in a block, in columns, four to a byte, with the first code
+// point in the low 2 bits
+static const uint8_t width_blocks[213][16] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    },
+    {
+        0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x15, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+    },
+    {
+        0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    },
+    {
+        0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+    },
+    {
+        0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    },
+    {
+        0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
+    },
+    {
+        0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+    },
+    {
+        0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+    },
+    {
+        0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
+    },
+    {
+        0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+    },
+    {
+        0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
+    },
+    {
+        0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
+    },
+    {
+        0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
+    },
+    {
+        0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+    },
+    {
+        0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+    },
+    {
+        0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+    },
+    {
+        0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+    },
+    {
+        0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
+    },
+    {
+        0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,
+    },
+    {
+        0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x56, 0x96, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x69,
+    },
+    {
+        0x55, 0x5a, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xa5, 0x59, 0x65, 0x59,
+    },
+    {
+        0x55, 0x59, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x66, 0x95, 0x9a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xa0, 0xaa, 0xaa, 0xaa, 0x6a,
+    },
+    {
+        0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x81, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
+    },
+    {
+        0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56,
+    },
+    {
+        0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
+    },
+    {
+        0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+    },
+    {
+        0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x5a, 0x55, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
+    },
+    {
+        0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    },
+    {
+        0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
+    },
+    {
+        0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51,
+    },
+    {
+        0x45, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
+    },
+    {
+        0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+    },
+    {
+        0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    },
+    {
+        0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+    },
+    {
+        0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
+    },
+    {
+        0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+    },
+    {
+        0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
+    },
+    {
+        0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+    },
+    {
+        0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
+    },
+    {
+        0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x54, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x54, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xa9, 0xaa, 0x69,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+    },
+    {
+        0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+    },
+    {
+        0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x65, 0xa9, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0x6a, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0x56, 0x55, 0x5a, 0x55, 0x55, 0x55, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0xaa, 0x9a, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0x6a, 0x95, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x56, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a,
+    },
+    {
+        0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a,
+    },
+    {
+        0x55, 0x55, 0x95, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa,
+    },
+    {
+        0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    {
+        0xaa, 0x5a, 0x55, 0x56, 0x6a, 0xa9, 0x55, 0xa9, 0x55, 0x55, 0x95, 0x56, 0x55, 0xaa, 0xaa, 0x56,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x56, 0x55, 0x55, 0x55,
+    },
+    {
+        0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa,
+    },
+    {
+        0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    },
+    {
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x56, 0xaa, 0x56,
+    },
+    {
+        0xaa, 0x6a, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xaa, 0x6a, 0x55,
+    },
+    {
+        0xaa, 0x5a, 0x55, 0x55, 0xaa, 0xaa, 0x5a, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0x6a, 0x55, 0x55,
+    },
+};
+
+// Returns the number of columns that the code point 'cp' takes up: 0 for controls, combining
+// marks and format characters, 2 for East Asian Wide and Fullwidth characters and emoji, and 1
+// for everything else
+static inline int width_of(int cp)
+{
+	if ((unsigned) cp > (unsigned) width_max)
+	{
+		// Planes 2 and 3 are CJK ideographs, while plane 14 is tags, variation selectors, and more
+		// that is reserved as default ignorable
+		if (cp >= 0x20000 && cp <= 0x3fffd)
+			return 2;
+		return cp >= 0xe0000 && cp <= 0xe0fff ? 0 : 1;
+	}
+	uint8_t four = width_blocks[width_stage1[cp >> width_shift]][(cp & ((1 << width_shift) - 1)) >> 2];
+	return (four >> (2 * (cp & 3))) & 3;
+}
+
+static inline int ascii_width(char c)
+{
+	return c >= 0x20 && c < 0x7f ? 1 : 0;
+}
+
+// Returns the end of the grapheme cluster that starts at 's', which is not 'end'. If 'width' is
+// not null, it is set to the width of the cluster, as display_width measures it.
+static inline const char* grapheme_end(const char* s, const char* end, int* width)
+{
+	// In ASCII, the only pair that doesn't have a boundary between it is CR LF
+	if ((uint8_t) s[0] <= max1 && (end - s == 1 || ((uint8_t) s[1] <= max1 && !(s[0] == '\r' && s[1] == '\n'))))
+	{
+		if (width != nullptr)
+			*width = ascii_width(s[0]);
+		return s + 1;
+	}
+
+	char32_t    cp;
+	const char* p      = decode_step(s, end, &cp);
+	int         prev   = grapheme_break_of(cp);
+	bool        pict   = prev == gcb_pictographic;       // the cluster ends with Extended_Pictographic Extend*
+	bool        emoji  = false;                          // the ZWJ at the end of the cluster follows pict
+	bool        odd_ri = prev == gcb_regional_indicator; // the cluster ends with an odd number of regional indicators
+	int         w      = 0;
+	bool        vs16   = false; // U+FE0F asks for the emoji presentation of a pictograph, or of a keycap base
+	bool        base   = pict || cp == '#' || cp == '*' || (cp >= '0' && cp <= '9');
+	if (width != nullptr)
+		w = width_of(cp);
+	while (p != end)
+	{
+		// Nothing in ASCII joins what comes before it, except for LF after CR
+		if ((uint8_t) *p <= max1 && prev != gcb_prepend && prev != gcb_cr)
+			break;
+		const char* next = decode_step(p, end, &cp);
+		int         gcb  = grapheme_break_of(cp);
+		if (((grapheme_joins[prev] >> gcb) & 1) == 0)
+		{
+			bool gb11 = gcb == gcb_pictographic && prev == gcb_zwj && emoji;
+			bool gb12 = gcb == gcb_regional_indicator && odd_ri;
+			if (!gb11 && !gb12)
+				break;
+		}
+		if (width != nullptr)
+		{
+			w    = std::max(w, width_of(cp));
+			vs16 = vs16 || cp == 0xfe0f;
+		}
+		emoji  = gcb == gcb_zwj && pict;
+		pict   = gcb == gcb_pictographic || (gcb == gcb_extend && pict);
+		odd_ri = gcb == gcb_regional_indicator && !odd_ri;
+		prev   = gcb;
+		p      = next;
+	}
+	if (width != nullptr)
+		*width = vs16 && base ? 2 : w;
+	return p;
+}
+
+const char* next_grapheme(const char* s, const char* end)
+{
+	if (s == end)
+		return end;
+	return grapheme_end(s, end, nullptr);
+}
+#endif
+
+#ifdef UTFZ_SIMD
+// Returns a mask of the bytes in [s, s + 64) that are above max1
+static inline uint64_t high_mask_64(const char* s)
+{
+#if defined(UTFZ_AVX512)
+	return _mm512_movepi8_mask(_mm512_loadu_si512((const void*) s));
+#elif defined(UTFZ_AVX2)
+	uint64_t lo = (uint32_t) _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) s));
+	uint64_t hi = (uint32_t) _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) (s + 32)));
+	return lo | (hi << 32);
+#else
+	uint64_t high = 0;
+	for (int i = 0; i < 64; i += 16)
+		high |= (uint64_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (s + i))) << i;
+	return high;
+#endif
+}
+
+// Returns a mask of the bytes in [s, s + 64) that are printable ASCII, from space to '~'
+static inline uint64_t printable_mask_64(const char* s)
+{
+#if defined(UTFZ_AVX512)
+	__m512i v = _mm512_loadu_si512((const void*) s);
+	return _mm512_cmpgt_epi8_mask(v, _mm512_set1_epi8(0x1f)) & _mm512_cmplt_epi8_mask(v, _mm512_set1_epi8(0x7f));
+#elif defined(UTFZ_AVX2)
+	uint64_t m = 0;
+	for (int i = 0; i < 64; i += 32)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*) (s + i));
+		__m256i p = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(0x1f)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7f), v));
+		m |= (uint64_t) (uint32_t) _mm256_movemask_epi8(p) << i;
+	}
+	return m;
+#else
+	uint64_t m = 0;
+	for (int i = 0; i < 64; i += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+		__m128i p = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1f)), _mm_cmplt_epi8(v, _mm_set1_epi8(0x7f)));
+		m |= (uint64_t) _mm_movemask_epi8(p) << i;
+	}
+	return m;
+#endif
+}
+#endif
+
+// Counts the clusters in the run of ASCII at 's', if there is one, and moves 's' to the start of
+// the cluster that may go on past it. If there is no run, 'stop' is moved to where to look for one
+// again, which is 'end' once there are too few bytes left to look at.
+static size_t ascii_clusters(const char*& s, const char* end, const char*& stop)
+{
+	UTFZ_DISPATCH_TO(ascii_clusters, s, end, stop);
+#ifdef UTFZ_SIMD
+	size_t n = 0;
+	// pair_mask_64 reads one byte past the 64
+	while (end - s > 64)
+	{
+		uint64_t high = high_mask_64(s);
+		int      run  = high == 0 ? 64 : ctz64(high);
+		if (run < 2)
+		{
+			// look again at the next ASCII byte after the code points that follow
+			uint64_t ascii = ~high & (~(uint64_t) 0 << run);
+			stop           = ascii == 0 ? s + 64 : s + ctz64(ascii);
+			return n;
+		}
+		// Count the clusters that start in the run, apart from the last byte, whose cluster may
+		// go on past the run. If the run ends with CR LF, its cluster ends there.
+		uint64_t crlf  = pair_mask_64(s, 1, '\r', '\n');
+		uint64_t inner = crlf & (((uint64_t) 1 << (run - 2)) - 1);
+		n += run - 1 - popcount((uint32_t) inner) - popcount((uint32_t) (inner >> 32));
+		if ((crlf >> (run - 2)) & 1)
+		{
+			s += run;
+			continue;
+		}
+		s += run - 1;
+		return n;
+	}
+	stop = end;
+	return n;
+#else
+	(void) s;
+	stop = end;
+	return 0;
+#endif
+}
+
+// The same as ascii_clusters, but adds the width of the clusters to 'total' instead. If that would
+// go over 'max_width', 's' is moved to the first cluster that doesn't fit, and it returns true.
+static bool ascii_width(const char*& s, const char* end, const char*& stop, size_t max_width, size_t& total)
+{
+	UTFZ_DISPATCH_TO(ascii_width, s, end, stop, max_width, total);
+#ifdef UTFZ_SIMD
+	if (end - s < 64)
+	{
+		stop = end;
+		return false;
+	}
+	uint64_t high = high_mask_64(s);
+	int      run  = high == 0 ? 64 : ctz64(high);
+	if (run < 2)
+	{
+		// look again at the next ASCII byte after the code points that follow
+		uint64_t ascii = ~high & (~(uint64_t) 0 << run);
+		stop           = ascii == 0 ? s + 64 : s + ctz64(ascii);
+		return false;
+	}
+	// Every byte of the run but the last starts a cluster, whose width is its own, so there's no
+	// need to look for CR LF, which is 0 wide. The cluster of the last byte may go on past the run.
+	uint64_t printable = printable_mask_64(s) & (((uint64_t) 1 << (run - 1)) - 1);
+	size_t   w         = popcount((uint32_t) printable) + popcount((uint32_t) (printable >> 32));
+	if (total + w > max_width)
+	{
+		s += nth_bit(printable, max_width - total);
+		total = max_width;
+		return true;
+	}
+	total += w;
+	s += run - 1;
+	return false;
+#else
+	(void) s;
+	(void) max_width;
+	(void) total;
+	stop = end;
+	return false;
+#endif
+}
+
+#ifndef UTFZ_NAMESPACE
+size_t count_graphemes(const char* s, const char* end)
+{
+	size_t      n    = 0;
+	const char* stop = s; // where to look for a run of ASCII again
+	while (s != end)
+	{
+		if (s >= stop)
+			n += ascii_clusters(s, end, stop);
+		s = next_grapheme(s, end);
+		n++;
+	}
+	return n;
+}
+
+const char* truncate_to_width(const char* s, const char* end, size_t max_width, size_t* width)
+{
+	size_t      total = 0;
+	const char* stop  = s; // where to look for a run of ASCII again
+	while (s != end)
+	{
+		if (s >= stop && ascii_width(s, end, stop, max_width, total))
+			break;
+		int         w;
+		const char* next = grapheme_end(s, end, &w);
+		if (total + w > max_width)
+			break;
+		total += w;
+		s = next;
+	}
+	if (width != nullptr)
+		*width = total;
+	return s;
+}
+
+size_t display_width(const char* s, const char* end)
+{
+	size_t width;
+	truncate_to_width(s, end, (size_t) -1, &width);
+	return width;
+}
+
+graphemes::graphemes(const char* str)
+    : Str(str), End(str + strlen(str))
+{
+}
+
+graphemes::graphemes(const char* str, const char* end)
+    : Str(str), End(end)
+{
+}
+
+graphemes::graphemes(const std::string& s)
+    : Str(s.c_str()), End(s.c_str() + s.length())
+{
+}
+
+graphemes::iter::iter(const char* s, const char* end)
+    : End(end)
+{
+	Span.Start = s;
+	Span.End   = next_grapheme(s, end);
+}
+
+graphemes::iter& graphemes::iter::operator++()
+{
+	Span.Start = Span.End;
+	Span.End   = next_grapheme(Span.Start, End);
+	return *this;
+}
+
+graphemes::iter graphemes::iter::operator++(int)
+{
+	iter old = *this;
+	++*this;
+	return old;
+}
+
+chunks::chunks(const char* str, const char* end, size_t max_bytes)
+    : Str(str), End(end), MaxBytes(max_bytes)
+{
+}
+
+chunks::chunks(const std::string& s, size_t max_bytes)
+    : Str(s.c_str()), End(s.c_str() + s.length()), MaxBytes(max_bytes)
+{
+}
+
+chunks::iter::iter(const char* s, const char* end, size_t max_bytes)
+    : End(end), MaxBytes(max_bytes)
+{
+	Span.Start = s;
+	Span.End   = piece_end(s);
+}
+
+chunks::iter& chunks::iter::operator++()
+{
+	Span.Start = Span.End;
+	Span.End   = piece_end(Span.Start);
+	return *this;
+}
+
+chunks::iter chunks::iter::operator++(int)
+{
+	iter old = *this;
+	++*this;
+	return old;
+}
+
+const char* chunks::iter::piece_end(const char* s) const
+{
+	const char* cut = truncate(s, End, MaxBytes);
+	if (cut == s && s != End)
+	{
+		// The first code point doesn't fit, so it is a piece of its own
+		int len = seq_len(*s);
+		cut     = s + (len == invalid ? 1 : std::min(len, (int) (End - s)));
+	}
+	return cut;
+}
+
+///////////////
+
+// Returns the first byte in [s, end) that can start a sequence. This is restart() without the
+// first step.
+static const char* skip_invalid(const char* s, const char* end)
+{
+	for (; s != end && seq_len(*s) == invalid; s++)
+	{
+	}
+	return s;
+}
+
+stream_decoder::stream_decoder()
+{
+	reset();
+}
+
+void stream_decoder::reset()
+{
+	NPending = 0;
+	Skipping = false;
+}
+
+size_t stream_decoder::feed(const char* s, const char* end, char32_t* out)
+{
+	char32_t* o = out;
+	if (NPending != 0)
+	{
+		// Complete the sequence that was split by the previous chunk
+		int need = seq_len(Pending[0]) - NPending;
+		for (; need != 0 && s != end && ((uint8_t) *s & 0xc0) == 0x80; need--)
+			Pending[NPending++] = *s++;
+		if (need != 0 && s == end)
+			return 0;
+		*o       = (char32_t) decode(Pending, Pending + NPending);
+		Skipping = *o++ == replace;
+		NPending = 0;
+	}
+	if (Skipping)
+	{
+		s        = skip_invalid(s, end);
+		Skipping = s == end;
+	}
+
+	const char* begin = s;
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		o += decode_all(s, bad, o);
+		s = bad;
+		if (bad == stop)
+		{
+			// next() restarts after a genuine U+FFFD, which skips continuation bytes in the next chunk
+			if (s == end && end - begin >= 3 && memcmp(end - 3, "\xEF\xBF\xBD", 3) == 0)
+				Skipping = true;
+			continue;
+		}
+		int len = seq_len(*bad);
+		if (len != invalid && end - bad < len && skip_invalid(bad + 1, end) == end)
+		{
+			// A sequence that may continue in the next chunk
+			NPending = (int) (end - bad);
+			memcpy(Pending, bad, NPending);
+			break;
+		}
+		if (!follows_fffd(begin, bad))
+			*o++ = replace;
+		s        = restart(bad, end);
+		Skipping = s == end;
+	}
+	return o - out;
+}
+
+size_t stream_decoder::finish(char32_t* out)
+{
+	size_t n = 0;
+	if (NPending != 0)
+		out[n++] = replace;
+	reset();
+	return n;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+arena::arena(size_t block_size)
+    : Pos(nullptr), End(nullptr), Buf(nullptr), BufEnd(nullptr), BlockSize(block_size), Next(0)
+{
+}
+
+arena::arena(char* buf, size_t size, size_t block_size)
+    : Pos(buf), End(buf + size), Buf(buf), BufEnd(buf + size), BlockSize(block_size), Next(0)
+{
+}
+
+arena::~arena()
+{
+	for (char* b : Blocks)
+		delete[] b;
+	for (char* b : Large)
+		delete[] b;
+}
+
+static char* align_up(char* p, size_t align)
+{
+	return (char*) (((uintptr_t) p + align - 1) & ~(uintptr_t) (align - 1));
+}
+
+void* arena::allocate(size_t n, size_t align)
+{
+	if (Pos != nullptr && (size_t) (End - Pos) >= n + align - 1)
+	{
+		char* p = align_up(Pos, align);
+		Pos     = p + n;
+		return p;
+	}
+	if (n + align - 1 > BlockSize)
+	{
+		Large.push_back(new char[n + align - 1]);
+		return align_up(Large.back(), align);
+	}
+	if (Next == Blocks.size())
+		Blocks.push_back(new char[BlockSize]);
+	Pos     = Blocks[Next++];
+	End     = Pos + BlockSize;
+	char* p = align_up(Pos, align);
+	Pos     = p + n;
+	return p;
+}
+
+void arena::reset()
+{
+	for (char* b : Large)
+		delete[] b;
+	Large.clear();
+	Next = 0;
+	Pos  = Buf;
+	End  = BufEnd;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+enum
+{
+	parallel_piece      = 1 << 20, // smallest piece of input that is worth a task
+	parallel_max_pieces = 256,     // larger inputs are split into this many pieces
+};
+
+// The threads that thread_executor() runs tasks on. They are started the first time that they
+// are needed, and live until the program exits, so that a parallel call costs a few wakeups
+// instead of creating threads.
+class thread_pool
+{
+public:
+	~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+			Stop = true;
+		}
+		Wake.notify_all();
+		for (auto& t : Threads)
+			t.join();
+	}
+
+	// Makes sure that there are at least 'n' threads
+	void reserve(size_t n)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		while (Threads.size() < n)
+			Threads.push_back(std::thread([this]() { run(); }));
+	}
+
+	void post(std::function<void()> job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+			Jobs.push_back(std::move(job));
+		}
+		Wake.notify_one();
+	}
+
+private:
+	std::mutex                        Lock;
+	std::condition_variable           Wake;
+	std::deque<std::function<void()>> Jobs;
+	std::vector<std::thread>          Threads;
+	bool                              Stop = false;
+
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(Lock);
+		while (true)
+		{
+			Wake.wait(lock, [this]() { return Stop || !Jobs.empty(); });
+			if (Stop)
+				return;
+			std::function<void()> job = std::move(Jobs.front());
+			Jobs.pop_front();
+			lock.unlock();
+			job();
+			lock.lock();
+		}
+	}
+};
+
+static thread_pool& shared_pool()
+{
+	static thread_pool pool;
+	return pool;
+}
+
+executor thread_executor(unsigned threads)
+{
+	return [threads](size_t n, const std::function<void(size_t)>& task) {
+		size_t nthreads = threads != 0 ? threads : std::thread::hardware_concurrency();
+		if (nthreads == 0)
+			nthreads = 1;
+		if (nthreads > n)
+			nthreads = n;
+
+		// The calling thread works too, and only waits for the tasks to finish, not for the
+		// helpers to start, so that a task can make a parallel call of its own. A helper that
+		// starts late finds no tasks left, and the state that it holds keeps 'task' alive.
+		struct job
+		{
+			std::function<void(size_t)> Task;
+			size_t                      N;
+			std::atomic<size_t>         Next;
+			std::atomic<size_t>         Done;
+			std::mutex                  Lock;
+			std::condition_variable     Finished;
+		};
+		auto state  = std::make_shared<job>();
+		state->Task = task;
+		state->N    = n;
+		state->Next = 0;
+		state->Done = 0;
+
+		auto worker = [](job& j) {
+			for (size_t i = j.Next++; i < j.N; i = j.Next++)
+			{
+				j.Task(i);
+				if (++j.Done == j.N)
+				{
+					std::lock_guard<std::mutex> lock(j.Lock);
+					j.Finished.notify_all();
+				}
+			}
+		};
+
+		if (nthreads > 1)
+		{
+			thread_pool& pool = shared_pool();
+			pool.reserve(nthreads - 1);
+			for (size_t i = 1; i < nthreads; i++)
+				pool.post([state, worker]() { worker(*state); });
+		}
+		worker(*state);
+		std::unique_lock<std::mutex> lock(state->Lock);
+		state->Finished.wait(lock, [&]() { return state->Done == n; });
+	};
+}
+
+// Returns the number of code points that decode_all produces for [s, end)
+static size_t decode_length(const char* s, const char* end)
+{
+	const char* begin = s;
+	size_t      n     = 0;
+	while (s != end)
+	{
+		const char* stop = chunk_end(s, end);
+		const char* bad  = first_invalid(s, stop);
+		n += count_valid(s, bad);
+		s = bad;
+		if (bad != stop)
+		{
+			if (!follows_fffd(begin, bad))
+				n++;
+			s = restart(bad, end);
+		}
+	}
+	return n;
+}
+
+// Returns the size of the pieces that a parallel function splits 'n' elements into
+static size_t piece_size(size_t n)
+{
+	size_t piece = n / parallel_max_pieces;
+	return piece > parallel_piece ? piece : (size_t) parallel_piece;
+}
+
+// Splits [s, end) into pieces that start on bytes that can start a sequence. An invalid
+// sequence ends before such a byte, which makes the pieces independent for next(), and
+// for validation. Returns the boundaries, including 's' and 'end'.
+static std::vector<const char*> split_utf8(const char* s, const char* end)
+{
+	std::vector<const char*> bounds(1, s);
+	size_t                   piece = piece_size(end - s);
+	for (const char* p = s; (size_t) (end - p) > piece;)
+	{
+		p += piece;
+		while (p != end && seq_len(*p) == invalid)
+			p++;
+		if (p != end)
+			bounds.push_back(p);
+	}
+	bounds.push_back(end);
+	return bounds;
+}
+
+// Splits 'n' UTF-16 code units into pieces that do not start on the second half of a surrogate pair
+static std::vector<size_t> split_utf16(const char16_t* s, size_t n, byte_order order)
+{
+	bool                swap = must_swap(order);
+	std::vector<size_t> bounds(1, 0);
+	size_t              piece = piece_size(n);
+	for (size_t i = 0; n - i > piece;)
+	{
+		i += piece;
+		if ((order_unit(s[i], swap) & 0xfc00) == utf16_surrogate_trail)
+			i++;
+		bounds.push_back(i);
+	}
+	bounds.push_back(n);
+	return bounds;
+}
+
+// Runs task(0) .. task(n - 1) with 'exec', or on this thread if there is only one
+static void run(size_t n, const executor& exec, const std::function<void(size_t)>& task)
+{
+	if (n == 1)
+		task(0);
+	else if (exec)
+		exec(n, task);
+	else
+		thread_executor()(n, task);
+}
+
+namespace parallel {
+
+const char* first_invalid(const char* s, const char* end, const executor& exec)
+{
+	std::vector<const char*> bounds = split_utf8(s, end);
+	std::vector<const char*> bad(bounds.size() - 1);
+	run(bad.size(), exec, [&](size_t i) {
+		bad[i] = utfz::first_invalid(bounds[i], bounds[i + 1]);
+	});
+	for (size_t i = 0; i < bad.size(); i++)
+	{
+		if (bad[i] != bounds[i + 1])
+			return bad[i];
+	}
+	return end;
+}
+
+bool validate(const char* s, const char* end, const executor& exec)
+{
+	return first_invalid(s, end, exec) == end;
+}
+
+size_t count(const char* s, const char* end, const executor& exec)
+{
+	std::vector<const char*> bounds = split_utf8(s, end);
+	std::vector<size_t>      n(bounds.size() - 1);
+	std::vector<size_t>      overshoot(n.size());
+	run(n.size(), exec, [&](size_t i) {
+		n[i] = count_steps(bounds[i], bounds[i + 1], overshoot[i]);
+	});
+	// cp::iter skips a whole sequence, even when it is invalid, so its steps can cross into the
+	// next piece. When that happens, the next piece is counted again from where the step lands.
+	size_t total = 0;
+	size_t skip  = 0;
+	for (size_t i = 0; i < n.size(); i++)
+	{
+		size_t len = bounds[i + 1] - bounds[i];
+		if (skip >= len)
+		{
+			skip -= len;
+			continue;
+		}
+		if (skip != 0)
+			n[i] = count_steps(bounds[i] + skip, bounds[i + 1], overshoot[i]);
+		total += n[i];
+		skip = overshoot[i];
+	}
+	return total;
+}
+
+size_t decode_all(const char* s, const char* end, char32_t* out, const executor& exec)
+{
+	std::vector<const char*> bounds = split_utf8(s, end);
+	std::vector<size_t>      offset(bounds.size());
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		offset[i + 1] = decode_length(bounds[i], bounds[i + 1]);
+	});
+	for (size_t i = 1; i < offset.size(); i++)
+		offset[i] += offset[i - 1];
+	// decode_all may write anywhere in the room that it is promised, which is one code point per
+	// byte, and that can reach into the output of the next piece. So each piece decodes the part
+	// that fits in its own output in place, and the rest into a buffer of its own. The last piece
+	// has the caller's room, and fits.
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		const char* p    = bounds[i];
+		const char* stop = bounds[i + 1];
+		size_t      n    = offset[i + 1] - offset[i];
+		const char* mid  = stop;
+		if (i + 2 != bounds.size() && (size_t) (stop - p) > n)
+		{
+			mid = p + n;
+			while (mid != p && seq_len(*mid) == invalid)
+				mid--;
+		}
+		char32_t* o = out + offset[i] + utfz::decode_all(p, mid, out + offset[i]);
+		if (mid != stop)
+		{
+			std::unique_ptr<char32_t[]> tail(new char32_t[stop - mid]);
+			memcpy(o, tail.get(), utfz::decode_all(mid, stop, tail.get()) * sizeof(char32_t));
+		}
+	});
+	return offset.back();
+}
+
+size_t utf8_to_utf16(const char* s, const char* end, char16_t* out, byte_order order, const executor& exec)
+{
+	std::vector<const char*> bounds = split_utf8(s, end);
+	std::vector<size_t>      offset(bounds.size());
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		offset[i + 1] = utf16_length(bounds[i], bounds[i + 1]);
+	});
+	for (size_t i = 1; i < offset.size(); i++)
+		offset[i] += offset[i - 1];
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		utfz::utf8_to_utf16(bounds[i], bounds[i + 1], out + offset[i], order);
+	});
+	return offset.back();
+}
+
+size_t utf16_to_utf8(const char16_t* s, size_t n, char* out, byte_order order, const executor& exec)
+{
+	std::vector<size_t> bounds = split_utf16(s, n, order);
+	std::vector<size_t> offset(bounds.size());
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		offset[i + 1] = utf8_length(s + bounds[i], bounds[i + 1] - bounds[i], order);
+	});
+	for (size_t i = 1; i < offset.size(); i++)
+		offset[i] += offset[i - 1];
+	run(bounds.size() - 1, exec, [&](size_t i) {
+		utfz::utf16_to_utf8(s + bounds[i], bounds[i + 1] - bounds[i], out + offset[i], order);
+	});
+	return offset.back();
+}
+
+} // namespace parallel
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+cp::cp(const char* str, size_t len)
+    : Str(str)
+{
+	if (len == -1)
+		End = nullptr;
+	else
+		End = Str + len;
+}
+
+cp::cp(const std::string& s)
+    : Str(s.c_str()), End(s.c_str() + s.length())
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+cp::iter::iter(const char* s, const char* end)
+    : iter(s, s, end)
+{
+}
+
+cp::iter::iter(const char* begin, const char* s, const char* end)
+    : Begin(begin), S(s), End(end)
+{
+	if (!known_end() && S != nullptr)
+	{
+		if (S[0] == 0)
+			S = End;
+	}
+}
+
+cp::iter& cp::iter::operator++()
+{
+	increment();
+	return *this;
+}
+
+cp::iter& cp::iter::operator++(int)
+{
+	increment();
+	return *this;
+}
+
+cp::iter& cp::iter::operator--()
+{
+	decrement();
+	return *this;
+}
+
+cp::iter& cp::iter::operator--(int)
+{
+	decrement();
+	return *this;
+}
+
+void cp::iter::increment()
+{
+	// Guard against iteration after having reached the end.
+	if (S == End)
+		return;
+
+	if (known_end())
+	{
+		int len = seq_len(S[0]);
+		if (len == invalid)
+		{
+			S = restart(S, End);
+		}
+		else
+		{
+			if (S + len > End)
+				S = End;
+			else
+				S += len;
+		}
+	}
+	else
+	{
+		int len = seq_len(S[0]);
+		if (len == invalid)
+		{
+			const char* nextS = restart(S);
+			if (nextS == S || nextS[0] == 0)
+				S = End;
+			else
+				S = nextS;
+		}
+		else
+		{
+			S += len;
+			if ((len == 2 && (S[-1] == 0)) ||
+			    (len == 3 && (S[-2] == 0 || S[-1] == 0)) ||
+			    (len == 4 && (S[-3] == 0 || S[-2] == 0 || S[-1] == 0)) ||
+			    (S[0] == 0))
+			{
+				S = End;
+			}
+		}
+	}
+}
+
+void cp::iter::decrement()
+{
+	// Guard against iteration before the start
+	if (S == Begin)
+		return;
+
+	// The end of a null terminated string is null, until it's measured
+	const char* s = S;
+	if (s == nullptr)
+	{
+		s = Begin + strlen(Begin);
+		if (s == Begin)
+			return;
+	}
+	S = iter_prev(Begin, s);
+}
+
+int cp::iter::operator*() const
+{
+	if (known_end())
+		return decode(S, End);
+	else
+		return decode(S);
+}
+
+bool cp::iter::known_end() const
 {
 	return End != nullptr;
 }
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// Decodes up to 'max' code points from [s, end) into 'cps', with their byte offsets from 's'
+// in 'offsets'. Returns the number of code points, and sets 'next' to the position after them.
+static size_t decode_block(const char* s, const char* end, size_t max, char32_t* cps, uint32_t* offsets, const char*& next)
+{
+	UTFZ_DISPATCH_TO(decode_block, s, end, max, cps, offsets, next);
+	const char* start = s;
+	size_t      n     = 0;
+#ifdef UTFZ_SIMD
+	while (end - s >= 16 && max - n >= 16)
+	{
+		__m128i in   = _mm_loadu_si128((const __m128i*) s);
+		__m128i base = _mm_set1_epi32((int) (s - start));
+		if (_mm_movemask_epi8(in) == 0)
+		{
+			__m128i pos = _mm_add_epi32(base, _mm_setr_epi32(0, 1, 2, 3));
+			_mm_storeu_si128((__m128i*) (cps + n), _mm_cvtepu8_epi32(in));
+			_mm_storeu_si128((__m128i*) (cps + n + 4), _mm_cvtepu8_epi32(_mm_srli_si128(in, 4)));
+			_mm_storeu_si128((__m128i*) (cps + n + 8), _mm_cvtepu8_epi32(_mm_srli_si128(in, 8)));
+			_mm_storeu_si128((__m128i*) (cps + n + 12), _mm_cvtepu8_epi32(_mm_srli_si128(in, 12)));
+			_mm_storeu_si128((__m128i*) (offsets + n), pos);
+			_mm_storeu_si128((__m128i*) (offsets + n + 4), _mm_add_epi32(pos, _mm_set1_epi32(4)));
+			_mm_storeu_si128((__m128i*) (offsets + n + 8), _mm_add_epi32(pos, _mm_set1_epi32(8)));
+			_mm_storeu_si128((__m128i*) (offsets + n + 12), _mm_add_epi32(pos, _mm_set1_epi32(12)));
+			s += 16;
+			n += 16;
+			continue;
+		}
+		__m128i lo, hi;
+		int     nlo, nhi;
+		int     used = decode_2_byte_block(in, lo, nlo, hi, nhi);
+		if (used != 0)
+		{
+			// The code points start on the bytes that are not continuation bytes
+			unsigned lead = ~_mm_movemask_epi8(_mm_cmplt_epi8(in, _mm_set1_epi8((char) 0xc0))) & (0xffff >> (16 - used));
+			__m128i  plo  = _mm_loadl_epi64((const __m128i*) &packed_indices[lead & 0xff]);
+			__m128i  phi  = _mm_add_epi8(_mm_loadl_epi64((const __m128i*) &packed_indices[lead >> 8]), _mm_set1_epi8(8));
+			_mm_storeu_si128((__m128i*) (cps + n), _mm_cvtepu16_epi32(lo));
+			_mm_storeu_si128((__m128i*) (cps + n + 4), _mm_cvtepu16_epi32(_mm_srli_si128(lo, 8)));
+			_mm_storeu_si128((__m128i*) (offsets + n), _mm_add_epi32(base, _mm_cvtepu8_epi32(plo)));
+			_mm_storeu_si128((__m128i*) (offsets + n + 4), _mm_add_epi32(base, _mm_cvtepu8_epi32(_mm_srli_si128(plo, 4))));
+			n += nlo;
+			_mm_storeu_si128((__m128i*) (cps + n), _mm_cvtepu16_epi32(hi));
+			_mm_storeu_si128((__m128i*) (cps + n + 4), _mm_cvtepu16_epi32(_mm_srli_si128(hi, 8)));
+			_mm_storeu_si128((__m128i*) (offsets + n), _mm_add_epi32(base, _mm_cvtepu8_epi32(phi)));
+			_mm_storeu_si128((__m128i*) (offsets + n + 4), _mm_add_epi32(base, _mm_cvtepu8_epi32(_mm_srli_si128(phi, 4))));
+			n += nhi;
+			s += used;
+			continue;
+		}
+		// 3 and 4 byte sequences, and errors
+		for (const char* stop = s + 16; s < stop && n < max; n++)
+		{
+			offsets[n] = (uint32_t) (s - start);
+			s          = iter_step(s, end, cps + n);
+		}
+	}
+#endif
+	for (; s != end && n < max; n++)
+	{
+		offsets[n] = (uint32_t) (s - start);
+		s          = iter_step(s, end, cps + n);
+	}
+	next = s;
+	return n;
+}
+
+#ifndef UTFZ_NAMESPACE
+cp_blocks::cp_blocks(const char* str, size_t block_size)
+    : Str(str), End(str + strlen(str)), BlockSize(block_size)
+{
+}
+
+cp_blocks::cp_blocks(const char* str, const char* end, size_t block_size)
+    : Str(str), End(end), BlockSize(block_size)
+{
+}
+
+cp_blocks::cp_blocks(const std::string& s, size_t block_size)
+    : Str(s.c_str()), End(s.c_str() + s.length()), BlockSize(block_size)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+cp_blocks::iter::iter(cp_blocks* blocks, const char* s)
+    : Blocks(blocks)
+{
+	fill(s);
+}
+
+cp_blocks::iter& cp_blocks::iter::operator++()
+{
+	// Guard against iteration after having reached the end.
+	if (Block.Start != Blocks->End)
+		fill(Block.End);
+	return *this;
+}
+
+void cp_blocks::iter::fill(const char* s)
+{
+	Block.Start  = s;
+	Block.End    = s;
+	Block.CP     = nullptr;
+	Block.Offset = nullptr;
+	Block.Size   = 0;
+	if (s == Blocks->End)
+		return;
+	size_t max = Blocks->BlockSize == 0 ? 1 : Blocks->BlockSize;
+	if (Blocks->CP.size() < max)
+	{
+		Blocks->CP.resize(max);
+		Blocks->Offset.resize(max);
+	}
+	Block.CP     = &Blocks->CP[0];
+	Block.Offset = &Blocks->Offset[0];
+	Block.Size   = decode_block(s, Blocks->End, max, &Blocks->CP[0], &Blocks->Offset[0], Block.End);
+}
+#endif
+
+#ifdef UTFZ_NAMESPACE
+extern const utfz_kernels kernels;
+const utfz_kernels        kernels = {
+    static_cast<const char* (*) (const char*, const char*)>(first_invalid),
+    static_cast<size_t (*)(const char*, const char*, char32_t*)>(decode_all),
+    static_cast<size_t (*)(const char32_t*, size_t, bool&)>(encoded_length),
+    static_cast<size_t (*)(char*, const char32_t*, size_t)>(encode),
+    utf16_length_valid,
+    utf8_to_utf16_valid,
+    utf8_length_of_utf16,
+    utf16_to_utf8_any,
+    codepage_to_utf8_any,
+    utf8_to_codepage_same,
+    count_valid,
+    count_steps,
+    count_lengths,
+    index_marks,
+    find_bytes,
+    ascii_case_run,
+    simple_run,
+    ascii_clusters,
+    ascii_width,
+    decode_block,
+};
+#endif
 } // namespace utfz
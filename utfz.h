@@ -3,7 +3,14 @@
 // -----------------------------------------------------------------------
 #pragma once
 
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <vector>
 
 /* A tiny UTF8 iterator library for C++.
 
@@ -33,6 +40,17 @@ enum limits
 	max4 = 0x10ffff, // maximum code point that can be represented by four bytes
 };
 
+enum
+{
+	min_cp_2             = 0x80,    // minimum code point that is allowed to be encoded with 2 bytes
+	min_cp_3             = 0x800,   // minimum code point that is allowed to be encoded with 3 bytes
+	min_cp_4             = 0x10000, // minimum code point that is allowed to be encoded with 4 bytes
+	utf16_surrogate_low  = 0xd800,
+	utf16_surrogate_high = 0xdfff,
+	invalid_fffe         = 0xfffe, // this is used for BOM detection
+	invalid_ffff         = 0xffff, // don't know why this is illegal
+};
+
 // Returns the sequence length (1,2,3,4) or 'invalid' if not a valid leading byte
 int seq_len(char c);
 
@@ -49,6 +67,7 @@ const char* restart(const char* s, const char* end);
 
 // Decode a code point. Returns the code point, or 'replace' if invalid.
 // If return value is not 'replace', then seq_len holds the sequence length.
+// To choose other rules at compile time, see the error policies below.
 int decode(const char* s, const char* end);
 int decode(const char* s, const char* end, int& seq_len);
 
@@ -72,6 +91,14 @@ bool next(const char*& s, const char* end, int& cp);
 // Returns true if 's' was incremented.
 bool next(const char*& s, int& cp);
 
+// The reverse of next. Moves 's' back to the start of the code point before it, but not past
+// 'begin', and sets 'cp' to that code point. The code points, including the 'replace' code points
+// for invalid sequences, are exactly the ones that next() produces, in reverse order, as long
+// as 's' is a position that next() reaches from 'begin', such as the end of the string.
+// If 's' is at 'begin', then cp is set to 'replace'.
+// Returns true if 's' was decremented.
+bool prev(const char*& s, const char* begin, int& cp);
+
 // Encode the code point 'cp', into the buffer 'buf'.
 // Returns the encoded size (1..4), or 0 for an invalid code point.
 int encode(char* buf, int cp);
@@ -81,6 +108,560 @@ int encode(char* buf, int cp);
 // Returns true if the code point is valid.
 bool encode(std::string& s, int cp);
 
+// Returns true if [s, end) is entirely valid UTF-8, using exactly the same rules
+// as decode() (overlong sequences, UTF-16 surrogates, 0xFFFE, 0xFFFF and code
+// points above max4 are all invalid).
+// Unlike a loop around next(), this can tell a genuine U+FFFD apart from an error.
+// The input is checked 16, 32 or 64 bytes at a time (see instruction_set).
+bool validate(const char* s, const char* end);
+
+// A variant of validate for a null terminated string.
+bool validate(const char* s);
+
+// Returns the start of the first sequence in [s, end) that decode() rejects, or 'end' if
+// [s, end) is valid. This is the same check as validate, and it is just as fast.
+const char* first_invalid(const char* s, const char* end);
+
+// Repair [s, end), replacing each invalid sequence with U+FFFD, using the same replacement and
+// restart rules as next(). If [s, end) is valid, then this returns true, and does not touch
+// 'out', so the input can be used as it is, without a copy. Otherwise, the repaired text is
+// added to 'out', and false is returned. The valid stretches are copied with memcpy.
+bool sanitize(const char* s, const char* end, std::string& out);
+
+// Repair 's' in place. A valid string is left alone, with no allocation. Otherwise 's' grows at
+// most once, by the most that the replacements add to any part of it, and only allocates if
+// that is beyond its capacity.
+// Returns true if 's' was already valid.
+bool sanitize(std::string& s);
+
+// Decode all of [s, end) into 'out', using the same replacement and restart rules
+// as next(). Returns the number of code points written.
+// 'out' must have room for (end - s) code points, which is the most that any
+// input can produce. Runs of ASCII and 2 byte sequences are decoded 16 or more
+// bytes at a time.
+size_t decode_all(const char* s, const char* end, char32_t* out);
+
+// Returns the number of bytes that encoding the 'n' code points in 'cps' produces.
+// Invalid code points contribute nothing, because encode() skips them.
+size_t encoded_length(const char32_t* cps, size_t n);
+
+// A variant of encoded_length that also sets 'all_valid' to false if any code point is invalid
+size_t encoded_length(const char32_t* cps, size_t n, bool& all_valid);
+
+// Encode the 'n' code points in 'cps' into 'buf', which must have room for
+// encoded_length(cps, n) bytes. Code points that encode(char*, int) rejects are
+// skipped. Returns the number of bytes written.
+// Runs of code points below 0x10000 are encoded 4 or more at a time.
+size_t encode(char* buf, const char32_t* cps, size_t n);
+
+// Encode the 'n' code points in 'cps', adding them to the string 's'. The string
+// is grown once, by exactly the encoded length. Invalid code points are skipped.
+// Returns true if all of the code points are valid.
+bool encode(std::string& s, const char32_t* cps, size_t n);
+
+// Byte order of UTF-16 code units. The char16_t buffers that are passed to the UTF-16
+// functions hold their code units in this order, regardless of the machine's byte order.
+enum byte_order
+{
+	little_endian,
+	big_endian,
+};
+
+// Returns the number of UTF-16 code units that utf8_to_utf16 produces for [s, end).
+size_t utf16_length(const char* s, const char* end);
+
+// Transcode [s, end) to UTF-16, using the same replacement and restart rules as next().
+// Code points above max3 become surrogate pairs. 'out' must have room for
+// utf16_length(s, end) code units, which is never more than (end - s).
+// Returns the number of code units written.
+size_t utf8_to_utf16(const char* s, const char* end, char16_t* out, byte_order order = little_endian);
+
+// Transcode [s, end) to UTF-16, adding it to the string 'u'. The string is grown once.
+// Returns true if [s, end) is valid UTF-8.
+bool utf8_to_utf16(std::u16string& u, const char* s, const char* end, byte_order order = little_endian);
+
+// Returns the number of bytes that utf16_to_utf8 produces for the 'n' code units in 's'.
+size_t utf8_length(const char16_t* s, size_t n, byte_order order = little_endian);
+
+// Transcode the 'n' UTF-16 code units in 's' to UTF-8. Unpaired surrogates, 0xFFFE and
+// 0xFFFF are each replaced with 'replace', because decode() rejects them too.
+// 'out' must have room for utf8_length(s, n, order) bytes, which is never more than 3 * n.
+// Returns the number of bytes written.
+// Both directions are vectorized.
+size_t utf16_to_utf8(const char16_t* s, size_t n, char* out, byte_order order = little_endian);
+
+// Transcode the 'n' code units in 'u' to UTF-8, adding them to the string 's'. The string
+// is grown once. Returns true if 'u' is valid UTF-16.
+bool utf16_to_utf8(std::string& s, const char16_t* u, size_t n, byte_order order = little_endian);
+
+// Single byte code pages. Bytes below 0x80 are ASCII in all of them.
+enum codepage
+{
+	iso_8859_1,   // Latin-1, Western European
+	iso_8859_2,   // Latin-2, Central European
+	iso_8859_3,   // Latin-3, South European
+	iso_8859_4,   // Latin-4, North European
+	iso_8859_5,   // Cyrillic
+	iso_8859_6,   // Arabic
+	iso_8859_7,   // Greek
+	iso_8859_8,   // Hebrew
+	iso_8859_9,   // Latin-5, Turkish
+	iso_8859_10,  // Latin-6, Nordic
+	iso_8859_11,  // Thai
+	iso_8859_13,  // Latin-7, Baltic
+	iso_8859_14,  // Latin-8, Celtic
+	iso_8859_15,  // Latin-9, Western European with the Euro sign
+	iso_8859_16,  // Latin-10, South-Eastern European
+	windows_1252, // Western European, the Windows variant of Latin-1
+};
+
+// What utf8_to_codepage does with a code point that the code page can't represent
+enum unmappable
+{
+	unmappable_replace, // write the fallback byte instead
+	unmappable_skip,    // leave it out
+};
+
+// Returns the code point of the byte 'c' in the code page 'page', or 'replace' if the
+// code page doesn't define 'c'.
+int decode(char c, codepage page);
+
+// Returns the byte that represents the code point 'cp' in the code page 'page', or
+// 'invalid' if there is none.
+int encode(int cp, codepage page);
+
+// Returns the number of bytes that codepage_to_utf8 produces for [s, end).
+size_t utf8_length(const char* s, const char* end, codepage page);
+
+// Transcode [s, end), which is text in the code page 'page', to UTF-8. Bytes that the code
+// page doesn't define become 'replace'. 'out' must have room for utf8_length(s, end, page)
+// bytes, which is never more than 3 * (end - s). Returns the number of bytes written.
+size_t codepage_to_utf8(const char* s, const char* end, char* out, codepage page);
+
+// Transcode [s, end) to UTF-8, adding it to the string 'out'. The string is grown once.
+// Returns true if the code page defines every byte in [s, end).
+bool codepage_to_utf8(std::string& out, const char* s, const char* end, codepage page);
+
+// Transcode [s, end) from UTF-8 to the code page 'page'. Decoding errors follow next(), and
+// the 'replace' code points that they produce are unmappable, like every other code point
+// that the code page can't represent. 'policy' decides what happens to those.
+// 'out' must have room for (end - s) bytes. Returns the number of bytes written.
+// Runs of ASCII, and of 2 byte sequences that map to the same byte value (all of Latin-1,
+// and most of the other Western code pages) are transcoded 16 bytes at a time.
+size_t utf8_to_codepage(const char* s, const char* end, char* out, codepage page, unmappable policy = unmappable_replace, char fallback = '?');
+
+// Transcode [s, end) from UTF-8, adding it to the string 'out'.
+// Returns true if [s, end) is valid UTF-8, and the code page can represent all of it.
+bool utf8_to_codepage(std::string& out, const char* s, const char* end, codepage page, unmappable policy = unmappable_replace, char fallback = '?');
+
+// Returns the number of code points in [s, end). This is exactly the number of code points
+// that iterating over cp produces, including the 'replace' code points for invalid sequences.
+// Valid stretches are counted 16, 32 or 64 bytes at a time.
+size_t count(const char* s, const char* end);
+
+// A variant of count for a null terminated string.
+size_t count(const char* s);
+
+// Returns the position of the first match of the UTF-8 string [needle, needle_end) in [s, end),
+// or 'end' if there is none. Matches only start where iterating over cp from 's' stops, so a
+// match is never found in the middle of a sequence, or in bytes that an invalid sequence
+// swallows, and it ends where a code point ends. Only the bytes of the needle match, so a needle
+// of U+FFFD only matches a genuine U+FFFD, and not an invalid sequence. An empty needle matches
+// at 's', and a needle that is not valid UTF-8 never matches.
+// 64 positions are checked at a time for the first and last bytes of the needle, and the rest
+// of the needle is only compared where both match.
+const char* find(const char* s, const char* end, const char* needle, const char* needle_end);
+
+// Returns the position of the first code point 'cp' in [s, end), with the same rules as find,
+// or 'end' if there is none, or if 'cp' is invalid.
+const char* find_cp(const char* s, const char* end, int cp);
+
+// Returns the end of the longest prefix of [s, end) that is at most 'max_bytes' long, and that
+// doesn't end inside a sequence. Only the 3 bytes before the cut are looked at, so it takes the
+// same time however long the string is. In valid UTF-8, the prefix is always whole code points.
+// Inside the bytes of an invalid sequence, the cut can fall anywhere, but it never falls inside
+// a valid sequence.
+const char* truncate(const char* s, const char* end, size_t max_bytes);
+
+// Truncates 's' in place, to at most 'max_bytes', in the same way. Returns true if 's' already
+// fit, in which case it is left alone.
+bool truncate(std::string& s, size_t max_bytes);
+
+// Case mapping and case folding follow the Unicode Character Database 14.0, without the
+// mappings that depend on the language or on the surrounding text. So a final sigma becomes σ
+// like any other, and the Turkish dotless ı and dotted İ are not special either.
+
+// Whether one code point can map to several
+enum case_mapping
+{
+	case_full,   // up to 3 code points, such as ß, which is "SS" in upper case, and folds to "ss"
+	case_simple, // always exactly one code point, so that the number of code points doesn't change
+};
+
+// Returns the simple lower case mapping of 'cp', or 'cp' if it has none
+int to_lower(int cp);
+
+// Returns the simple upper case mapping of 'cp', or 'cp' if it has none
+int to_upper(int cp);
+
+// Returns the simple case folding of 'cp', or 'cp' if it has none. Comparing strings of folded
+// code points ignores case, but only full case folding (of whole strings) makes "ß" equal to "SS".
+int fold_case(int cp);
+
+// Writes the lower case of [s, end) to 'out'. Decoding errors follow next(), and each
+// becomes 'replace'. 'out' must have room for 3 * (end - s) bytes. Returns the number of bytes
+// written. Runs of ASCII are mapped 16, 32 or 64 bytes at a time, or 8 bytes at a time
+// without vector instructions. Other code points are looked up in a two stage table.
+size_t to_lower(const char* s, const char* end, char* out, case_mapping mapping = case_full);
+
+// Writes the upper case of [s, end) to 'out', in the same way as to_lower
+size_t to_upper(const char* s, const char* end, char* out, case_mapping mapping = case_full);
+
+// Writes the case folding of [s, end) to 'out', in the same way as to_lower. Strings that only
+// differ in case have the same full case folding, which makes it the key for case insensitive
+// comparisons and indexes.
+size_t fold_case(const char* s, const char* end, char* out, case_mapping mapping = case_full);
+
+// Adds the lower case of [s, end) to the string 'out'. The string is grown once.
+// Returns true if [s, end) is valid UTF-8.
+bool to_lower(std::string& out, const char* s, const char* end, case_mapping mapping = case_full);
+
+// Adds the upper case of [s, end) to the string 'out', in the same way as to_lower
+bool to_upper(std::string& out, const char* s, const char* end, case_mapping mapping = case_full);
+
+// Adds the case folding of [s, end) to the string 'out', in the same way as to_lower
+bool fold_case(std::string& out, const char* s, const char* end, case_mapping mapping = case_full);
+
+// The Unicode normalization forms (UAX #15), following the Unicode Character Database 14.0
+enum normalization_form
+{
+	nfc,  // canonical composition, the form that nearly all text is already in
+	nfd,  // canonical decomposition
+	nfkc, // compatibility composition, which also turns variants such as "ﬁ" and "²" into "fi" and "2"
+	nfkd, // compatibility decomposition
+};
+
+// The answer of quick_check
+enum quick_check_result
+{
+	quick_check_yes,   // the text is normalized
+	quick_check_no,    // the text is not normalized
+	quick_check_maybe, // only normalizing the text can tell
+};
+
+// Checks whether [s, end) is in the normalization form 'form', with the quick check of UAX #15,
+// which only looks at one code point at a time. Text that is not valid UTF-8 is never
+// normalized. Runs of code points that are too low to fail the check (below U+0300 for NFC) are
+// skipped 16, 32 or 64 bytes at a time, after validating [s, end).
+quick_check_result quick_check(const char* s, const char* end, normalization_form form);
+
+// Returns true if [s, end) is in the normalization form 'form'. This is as fast as quick_check
+// where that says yes, and only normalizes the code points around the ones where it doesn't.
+bool is_normalized(const char* s, const char* end, normalization_form form);
+
+// If [s, end) is in the normalization form 'form', returns true and leaves 'out' alone.
+// Otherwise, adds the normalized text to 'out', and returns false. Only the code points around
+// the ones that fail the quick check are normalized; everything else is copied as it is.
+// Invalid sequences become U+FFFD first, as with sanitize.
+bool normalize(const char* s, const char* end, std::string& out, normalization_form form);
+
+// Normalizes 's' in place. Returns true if it was already normalized, in which case it is left
+// alone.
+bool normalize(std::string& s, normalization_form form);
+
+// Returns the end of the extended grapheme cluster (UAX #29) that starts at 's', which is where
+// the next one starts, or 'end'. A cluster is what a user sees as one character, such as a
+// letter with its accents, a flag, or an emoji ZWJ sequence. 's' must be the start of a cluster,
+// such as the start of the string. Invalid sequences are U+FFFD, as with next(), so each one is
+// a cluster of its own, together with any marks that follow it.
+const char* next_grapheme(const char* s, const char* end);
+
+// Returns the number of extended grapheme clusters in [s, end). In a run of ASCII, every byte
+// other than the LF of CR LF starts a cluster, and such runs are counted 64 bytes at a time.
+size_t count_graphemes(const char* s, const char* end);
+
+// Returns the number of columns that [s, end) takes up in a terminal, which is the sum of the
+// widths of its grapheme clusters. A cluster is as wide as the widest code point in it, which is
+// 2 for East Asian Wide and Fullwidth characters and for emoji, 0 for controls, combining marks
+// and format characters, and 1 for everything else, including East Asian Ambiguous. A
+// pictograph or keycap that is followed by U+FE0F, which asks for an emoji, is 2 wide. Unlike
+// wcwidth(), this doesn't depend on the locale. Runs of ASCII are measured 64 bytes at a time.
+size_t display_width(const char* s, const char* end);
+
+// Returns the end of the longest run of whole grapheme clusters at the start of [s, end) that
+// fits in 'max_width' columns, as display_width measures them. If 'width' is not null, then it
+// is set to the width of the run.
+const char* truncate_to_width(const char* s, const char* end, size_t max_width, size_t* width = nullptr);
+
+// Runs task(0) .. task(n - 1) in any order, possibly at the same time, and returns once they
+// have all finished. The parallel functions hand their work to one of these, so that they can
+// run on your own thread pool.
+typedef std::function<void(size_t n, const std::function<void(size_t i)>& task)> executor;
+
+// Returns an executor that runs the tasks on 'threads' threads, including the calling thread.
+// Each thread takes the next task as soon as it finishes one. When 'threads' is 0, it uses
+// std::thread::hardware_concurrency(). The other threads come from a pool that is shared by
+// all the executors, which is started the first time that it is needed, and grows to the
+// largest number of threads that is asked for.
+executor thread_executor(unsigned threads = 0);
+
+// Parallel variants of the bulk functions, for large buffers. The input is split into pieces
+// of at least 1 MB, at bytes (or UTF-16 code units) where a sequence can start. The pieces are
+// run with 'exec', and their results are stitched together, so the results are exactly the
+// same as the serial functions, and so are the requirements on 'out'.
+// When 'exec' is empty, thread_executor() is used. Inputs that fit in one piece run on the
+// calling thread.
+namespace parallel {
+const char* first_invalid(const char* s, const char* end, const executor& exec = executor());
+bool        validate(const char* s, const char* end, const executor& exec = executor());
+size_t      count(const char* s, const char* end, const executor& exec = executor());
+size_t      decode_all(const char* s, const char* end, char32_t* out, const executor& exec = executor());
+size_t      utf8_to_utf16(const char* s, const char* end, char16_t* out, byte_order order = little_endian, const executor& exec = executor());
+size_t      utf16_to_utf8(const char16_t* s, size_t n, char* out, byte_order order = little_endian, const executor& exec = executor());
+} // namespace parallel
+
+// The instruction sets that the vectorized functions come in, from the narrowest to the widest.
+// The functions that say they work 16, 32 or 64 bytes at a time do so with SSE4.2, AVX2 and
+// AVX-512 kernels. The library, as CMake builds it on x86-64, has all three, and picks the widest
+// one that the CPU supports when it first runs (see current_instruction_set). utfz.hpp, and a
+// library built without UTFZ_DISPATCH, only have the kernels for the instruction sets that the
+// compiler targets, so they need flags such as -mavx2 or /arch:AVX2 to use them. Without any of
+// these, they fall back to scalar code.
+enum instruction_set
+{
+	isa_scalar, // no vector instructions, or whatever utfz.cpp itself was compiled for
+	isa_sse42,
+	isa_avx2,
+	isa_avx512, // AVX-512 BW and VL
+};
+
+// Returns the instruction set that the vectorized functions use. When the library is built with
+// UTFZ_DISPATCH (the CMake default on x86-64), the vector kernels are also compiled for SSE4.2,
+// AVX2 and AVX-512, and the first call picks the widest one that the CPU supports. The environment
+// variable UTFZ_ISA (scalar, sse42, avx2 or avx512) lowers that choice, for testing and
+// benchmarking. Without UTFZ_DISPATCH, this is the instruction set that the compiler targets.
+instruction_set current_instruction_set();
+
+// Returns true if the library has kernels for 'isa', and the CPU supports them
+bool has_instruction_set(instruction_set isa);
+
+// Makes the vectorized functions use 'isa', if has_instruction_set(isa). Returns false, and
+// changes nothing, if it doesn't. Calls that are already running finish with the old kernels.
+bool use_instruction_set(instruction_set isa);
+
+// Returns "scalar", "sse42", "avx2" or "avx512"
+const char* instruction_set_name(instruction_set isa);
+
+// What an error policy does with an invalid sequence
+enum error_action
+{
+	action_replace, // produce 'replace', and continue at the next plausible code point
+	action_skip,    // produce nothing, and continue at the next plausible code point
+	action_stop,    // stop, at the start of the invalid sequence
+};
+
+// Error policies, for the decode, next and decoder templates below. A policy has a static
+// 'noncharacters' flag, which accepts 0xFFFE and 0xFFFF when it is true, and an error()
+// function, which is called with the start of each invalid sequence, and returns what to do with
+// it. Both are resolved at compile time, and when error() returns a constant, as it does in
+// replace_errors, skip_errors and stop_errors, the inner loop has no branch for it.
+struct replace_errors
+{
+	static const bool noncharacters = false;
+	error_action      error(const char*) { return action_replace; }
+};
+
+struct skip_errors
+{
+	static const bool noncharacters = false;
+	error_action      error(const char*) { return action_skip; }
+};
+
+struct stop_errors
+{
+	static const bool noncharacters = false;
+	error_action      error(const char*) { return action_stop; }
+};
+
+// Replaces invalid sequences, and records where they are
+struct report_errors
+{
+	static const bool noncharacters = false;
+	const char*       First         = nullptr; // The first invalid sequence, or null if there is none
+	size_t            Count         = 0;       // The number of invalid sequences
+
+	error_action error(const char* s)
+	{
+		if (Count++ == 0)
+			First = s;
+		return action_replace;
+	}
+};
+
+// Accepts 0xFFFE and 0xFFFF as code points, and otherwise handles errors as 'Policy' does
+template <typename Policy = replace_errors>
+struct allow_noncharacters : Policy
+{
+	static const bool noncharacters = true;
+};
+
+// Returns true if 'cp', from a 3 byte sequence, is not overlong, and not a UTF-16 surrogate.
+// 0xFFFE and 0xFFFF are only legal if 'noncharacters' is true.
+constexpr bool is_legal_3_byte_code(int cp, bool noncharacters = false)
+{
+	return cp >= min_cp_3 && (cp < utf16_surrogate_low || cp > utf16_surrogate_high) && (noncharacters || (cp != invalid_fffe && cp != invalid_ffff));
+}
+
+// decode(), with the rules of 'Policy'. decode(s, end, seq_len) is decode<replace_errors>.
+template <typename Policy>
+int decode(const char* s, const char* end, int& _seq_len)
+{
+	_seq_len = 0;
+	if ((uint8_t) s[0] <= max1)
+	{
+		_seq_len = 1;
+		return s[0];
+	}
+	int slen = seq_len(s[0]);
+	if (slen == invalid || (intptr_t) (end - s) < (intptr_t) slen)
+		return replace;
+
+	int cp = 0;
+	switch (slen)
+	{
+	case 2:
+		if ((s[1] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+		if (cp < min_cp_2)
+			return replace;
+		break;
+	case 3:
+		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+		if (!is_legal_3_byte_code(cp, Policy::noncharacters))
+			return replace;
+		break;
+	case 4:
+		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+		if (cp < min_cp_4 || cp > max4)
+			return replace;
+		break;
+	}
+	_seq_len = slen;
+	return cp;
+}
+
+// next(), with the error handling of 'policy'. Returns false at 'end', or at an invalid sequence
+// that the policy stops at, which leaves 's' at the start of it. next(s, end, cp) is next() with
+// replace_errors.
+// The invalid bytes right after a genuine U+FFFD are reported in the same call as the U+FFFD,
+// because next() swallows them. If the policy stops at them, then this returns false, with 'cp'
+// set to the U+FFFD, and 's' after it.
+template <typename Policy>
+bool next(const char*& s, const char* end, int& cp, Policy& policy)
+{
+	while (s != end)
+	{
+		int slen;
+		cp = decode<Policy>(s, end, slen);
+		if (slen != 0)
+		{
+			// A genuine U+FFFD restarts, as an error does, so that the code points are the same
+			// as the ones that decode_all produces
+			const char* after = s + slen;
+			if (cp == replace)
+			{
+				s = restart(s, end);
+				if (s != after && policy.error(after) == action_stop)
+				{
+					s = after;
+					return false;
+				}
+			}
+			else
+				s = after;
+			return true;
+		}
+		switch (policy.error(s))
+		{
+		case action_replace:
+			s = restart(s, end);
+			return true;
+		case action_skip:
+			s = restart(s, end);
+			break;
+		case action_stop:
+			return false;
+		}
+	}
+	cp = replace;
+	return false;
+}
+
+// Iterates once over the code points of [s, end), with the error handling of 'Policy'. With the
+// default policy, the code points are exactly the ones that next() produces. When iteration
+// ends, S is at End, or at the invalid sequence that the policy stopped at.
+//
+// example:
+//
+//   utfz::decoder<utfz::stop_errors> dec(s, end);
+//   for (int cp : dec)
+//       printf("%d ", cp);
+//   if (dec.S != dec.End)
+//       printf("invalid UTF-8 at byte %d", (int) (dec.S - s));
+//
+template <typename Policy = replace_errors>
+class decoder
+{
+public:
+	const char* S;
+	const char* End;
+	Policy      Errors; // The policy object, which holds what report_errors records
+
+	decoder(const char* s, const char* end, const Policy& errors = Policy()) : S(s), End(end), Errors(errors) {}
+	decoder(const std::string& s, const Policy& errors = Policy()) : S(s.data()), End(s.data() + s.size()), Errors(errors) {}
+
+	// Decodes the next code point into 'cp'. Returns false at the end, or when the policy stops.
+	bool next(int& cp) { return utfz::next(S, End, cp, Errors); }
+
+	class iter
+	{
+	public:
+		typedef std::input_iterator_tag iterator_category;
+		typedef int                     value_type;
+		typedef ptrdiff_t               difference_type;
+		typedef const int*              pointer;
+		typedef int                     reference;
+
+		iter(decoder* d) : D(d), CP(0)
+		{
+			if (D != nullptr && !D->next(CP))
+				D = nullptr;
+		}
+
+		bool  operator==(const iter& b) const { return D == b.D; }
+		bool  operator!=(const iter& b) const { return D != b.D; }
+		int   operator*() const { return CP; }
+		iter& operator++()
+		{
+			if (!D->next(CP))
+				D = nullptr;
+			return *this;
+		}
+
+	private:
+		decoder* D; // null at the end
+		int      CP;
+	};
+
+	iter begin() { return iter(this); }
+	iter end() { return iter(nullptr); }
+};
+
 // Code Point iterator over a utf8 string
 //
 // example:
@@ -91,6 +672,11 @@ bool encode(std::string& s, int cp);
 //
 // If an error is detected, then the replace code point is emitted,
 // and iteration continues on the next plausible code point.
+// Unlike next(), cp steps over as many bytes as the lead byte of an invalid sequence asks for,
+// and it does not restart after a genuine U+FFFD. So the two can produce different code points
+// for invalid input: "\xE4\xB8x" is U+FFFD for cp, and U+FFFD 'x' for next(), while
+// "\xEF\xBF\xBD\x80" is U+FFFD U+FFFD for cp, and one U+FFFD for next(). count, index, find,
+// cp_blocks and stats follow cp, and the other functions that decode follow next().
 class cp
 {
 public:
@@ -103,27 +689,718 @@ public:
 	class iter
 	{
 	public:
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef int                             value_type;
+		typedef ptrdiff_t                       difference_type;
+		typedef const int*                      pointer;
+		typedef int                             reference;
+
+		const char* Begin; // The start of the string, which operator-- stops at
 		const char* S;
 		const char* End; // This is null if length is unknown
 
 		iter(const char* s, const char* end);
+		iter(const char* begin, const char* s, const char* end);
 
 		bool  operator==(const iter& b) const { return S == b.S; }
 		bool  operator!=(const iter& b) const { return S != b.S; }
 		iter& operator++();
 		iter& operator++(int);
+		iter& operator--();
+		iter& operator--(int);
 
 		int operator*() const;
 
 	private:
 		void increment();
+		void decrement();
 
 		bool known_end() const;
 	};
 
-	iter begin() { return iter(Str, End); }
-	iter end() { return iter(End, End); }
-	iter cbegin() const { return iter(Str, End); }
-	iter cend() const { return iter(End, End); }
+	typedef std::reverse_iterator<iter> reverse_iter;
+
+	iter begin() { return iter(Str, Str, End); }
+	iter end() { return iter(Str, End, End); }
+	iter cbegin() const { return iter(Str, Str, End); }
+	iter cend() const { return iter(Str, End, End); }
+
+	// Iterate backwards, producing exactly the code points that forward iteration does, in
+	// reverse order. Stepping back over valid UTF-8 looks at no more than 4 bytes, but a run of
+	// malformed lead bytes is stepped over from its start, because only that tells where the
+	// forward iteration breaks it up. A null terminated string is measured when stepping back
+	// from its end.
+	//
+	// example:
+	//
+	//   for (auto it = c.rbegin(); it != c.rend(); ++it)
+	//       printf("%d ", *it);
+	//
+	reverse_iter rbegin() { return reverse_iter(end()); }
+	reverse_iter rend() { return reverse_iter(begin()); }
+};
+
+// A block of decoded code points, handed out by cp_blocks
+class cp_block
+{
+public:
+	const char*     Start;  // The first byte of the first code point
+	const char*     End;    // One past the last byte of the last code point
+	const char32_t* CP;     // The code points
+	const uint32_t* Offset; // The byte offset of each code point, from Start
+	size_t          Size;   // The number of code points
+
+	size_t          size() const { return Size; }
+	const char32_t* begin() const { return CP; }
+	const char32_t* end() const { return CP + Size; }
+	char32_t        operator[](size_t i) const { return CP[i]; }
+	const char*     pos(size_t i) const { return Start + Offset[i]; }
+};
+
+// Code Point iterator that decodes up to 'block_size' code points at a time.
+// The code points are exactly the ones that cp produces, and they come with their
+// positions. Runs of ASCII and 2 byte sequences are decoded 16 bytes at a time.
+//
+// example:
+//
+//   for (auto block : utfz::cp_blocks(str, 64))
+//       for (char32_t cp : block)
+//           printf("%d ", (int) cp);
+//
+// The blocks share one buffer, so a block is overwritten when the iterator moves on.
+class cp_blocks
+{
+public:
+	const char* Str;
+	const char* End;
+	size_t      BlockSize;
+
+	cp_blocks(const char* str, size_t block_size = 64); // null terminated
+	cp_blocks(const char* str, const char* end, size_t block_size = 64);
+	cp_blocks(const std::string& s, size_t block_size = 64);
+
+	class iter
+	{
+	public:
+		iter(cp_blocks* blocks, const char* s);
+
+		bool  operator==(const iter& b) const { return Block.Start == b.Block.Start; }
+		bool  operator!=(const iter& b) const { return Block.Start != b.Block.Start; }
+		iter& operator++();
+
+		const cp_block& operator*() const { return Block; }
+
+	private:
+		cp_blocks* Blocks;
+		cp_block   Block;
+
+		void fill(const char* s);
+	};
+
+	iter begin() { return iter(this, Str); }
+	iter end() { return iter(this, End); }
+
+private:
+	std::vector<char32_t> CP;
+	std::vector<uint32_t> Offset;
+};
+
+// A sparse index over the code points of [str, end), which records the position of every
+// k-th code point. It is built in one pass, which is vectorized. After that, each lookup takes
+// at most k steps.
+// Code point numbers agree with iterating over cp, including on invalid input.
+// The index holds on to the string, so the string must outlive it.
+//
+// example:
+//
+//   utfz::index idx(str, str + len, 32);
+//   const char* p = idx.pos(1000);           // code point number 1000, counting from 0
+//   size_t      n = idx.code_point(p - str); // n == 1000
+//
+class index
+{
+public:
+	const char* Str;
+	const char* End;
+	size_t      K;
+
+	index(const char* str, const char* end, size_t k = 64);
+	index(const std::string& s, size_t k = 64);
+
+	// Returns the number of code points, which is the same as count(Str, End)
+	size_t size() const { return Size; }
+
+	// Returns the position of code point number 'cp', or End if cp >= size()
+	const char* pos(size_t cp) const;
+
+	// Returns the number of the code point that covers the byte at 'offset' from Str, or size()
+	// if offset is past the end. The bytes that are skipped after an error belong to the
+	// 'replace' code point before them.
+	size_t code_point(size_t offset) const;
+
+private:
+	size_t              Size;
+	std::vector<size_t> Marks; // Offset of code point number i * K from Str, in Marks[i]
+
+	void build();
+};
+
+// The kinds of invalid sequence, following the checks that decode() makes
+enum error_kind
+{
+	error_bad_lead,     // a continuation byte where a sequence should start, or a byte from 0xF8 to 0xFF
+	error_truncated,    // a sequence that ends early, at a byte that is not a continuation byte, or at the end
+	error_overlong,     // a code point that is encoded with more bytes than it needs
+	error_surrogate,    // a UTF-16 surrogate, from 0xD800 to 0xDFFF
+	error_noncharacter, // 0xFFFE or 0xFFFF
+	error_too_large,    // a code point above max4
+	error_kind_count,
+};
+
+// Statistics about the content of [s, end), gathered in one pass: the number of valid sequences
+// of each length, the number of invalid sequences of each kind, and the number of code points,
+// which is the same as count(s, end). Each invalid sequence is one that next() replaces with
+// U+FFFD, including the bytes that it skips after it. The exception is the invalid bytes right
+// after a genuine U+FFFD, which next() swallows, but which are counted here, so that valid()
+// agrees with validate().
+// The string is validated 16, 32 or 64 bytes at a time, and the sequence lengths are counted
+// 8 bytes at a time, a block at a time, while the block is still in cache.
+//
+// example:
+//
+//   utfz::stats st(payload, payload + len);
+//   if (!st.valid())
+//       log("first error at byte %zu, %zu overlong", st.FirstError, st.Errors[utfz::error_overlong]);
+//
+class stats
+{
+public:
+	size_t     Sequences[5];             // Valid sequences of 1 to 4 bytes, in Sequences[1] to Sequences[4]
+	size_t     Errors[error_kind_count]; // Invalid sequences, by kind
+	size_t     FirstError;               // The byte offset of the first invalid sequence, or -1 if there is none
+	error_kind FirstErrorKind;           // The kind of the first invalid sequence, if there is one
+	size_t     CodePoints;               // The number of code points that iterating over cp produces
+
+	stats(const char* s, const char* end);
+	stats(const std::string& s);
+
+	// Returns true if there are no invalid sequences
+	bool valid() const { return FirstError == (size_t) -1; }
+
+	// Returns the number of invalid sequences, of all kinds
+	size_t errors() const;
+
+private:
+	void scan(const char* s, const char* end);
+};
+
+// A span of bytes inside a string
+struct span
+{
+	const char* Start;
+	const char* End;
+
+	size_t      size() const { return End - Start; }
+	const char* begin() const { return Start; }
+	const char* end() const { return End; }
+	std::string str() const { return std::string(Start, End); }
+};
+
+// Extended grapheme cluster iterator over a utf8 string, which produces the span of bytes that
+// each cluster covers, so nothing is copied. The clusters are the ones that next_grapheme finds.
+//
+// example:
+//
+//   // 'str' is a const char*, or an std::string
+//   for (utfz::span g : utfz::graphemes(str))
+//       printf("[%.*s]", (int) g.size(), g.Start); // "e\xCC\x81" is one cluster, and so is a flag
+//
+class graphemes
+{
+public:
+	const char* Str;
+	const char* End;
+
+	graphemes(const char* str); // null terminated
+	graphemes(const char* str, const char* end);
+	graphemes(const std::string& s);
+
+	class iter
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef span                      value_type;
+		typedef ptrdiff_t                 difference_type;
+		typedef const span*               pointer;
+		typedef const span&               reference;
+
+		iter(const char* s, const char* end);
+
+		bool  operator==(const iter& b) const { return Span.Start == b.Span.Start; }
+		bool  operator!=(const iter& b) const { return Span.Start != b.Span.Start; }
+		iter& operator++();
+		iter  operator++(int);
+
+		const span& operator*() const { return Span; }
+		const span* operator->() const { return &Span; }
+
+	private:
+		span        Span;
+		const char* End; // The end of the string
+	};
+
+	iter begin() const { return iter(Str, End); }
+	iter end() const { return iter(End, End); }
+};
+
+// Splits a buffer into pieces of at most 'max_bytes' each, such as for network frames or
+// message size limits, without splitting any sequences. Each piece ends where truncate cuts it,
+// so finding it only looks at the 3 bytes before the limit. A piece is never empty. If
+// 'max_bytes' is less than 4, then a code point that doesn't fit gets a piece of its own.
+//
+// example:
+//
+//   for (utfz::span piece : utfz::chunks(str, str + len, 1024))
+//       send(sock, piece.Start, piece.size(), 0);
+//
+class chunks
+{
+public:
+	const char* Str;
+	const char* End;
+	size_t      MaxBytes;
+
+	chunks(const char* str, const char* end, size_t max_bytes);
+	chunks(const std::string& s, size_t max_bytes);
+
+	class iter
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef span                      value_type;
+		typedef ptrdiff_t                 difference_type;
+		typedef const span*               pointer;
+		typedef const span&               reference;
+
+		iter(const char* s, const char* end, size_t max_bytes);
+
+		bool  operator==(const iter& b) const { return Span.Start == b.Span.Start; }
+		bool  operator!=(const iter& b) const { return Span.Start != b.Span.Start; }
+		iter& operator++();
+		iter  operator++(int);
+
+		const span& operator*() const { return Span; }
+		const span* operator->() const { return &Span; }
+
+	private:
+		span        Span;
+		const char* End; // The end of the string
+		size_t      MaxBytes;
+
+		const char* piece_end(const char* s) const;
+	};
+
+	iter begin() const { return iter(Str, End, MaxBytes); }
+	iter end() const { return iter(End, End, MaxBytes); }
+};
+
+// Decodes a stream of UTF-8 that arrives in chunks. A sequence that is split across two chunks
+// is held back (at most 3 bytes) until the rest of it arrives, so the code points are exactly
+// the ones that decode_all produces for the whole stream. The chunks are decoded in place, with
+// the same vector kernels as decode_all.
+//
+// example:
+//
+//   utfz::stream_decoder dec;
+//   std::vector<char32_t> cps(sizeof(buf) + 1);
+//   while ((n = read(fd, buf, sizeof(buf))) > 0)
+//       use(&cps[0], dec.feed(buf, buf + n, &cps[0]));
+//   use(&cps[0], dec.finish(&cps[0]));
+//
+class stream_decoder
+{
+public:
+	stream_decoder();
+
+	// Decode the next chunk of the stream into 'out', which must have room for (end - s) + 1
+	// code points. Returns the number of code points written.
+	size_t feed(const char* s, const char* end, char32_t* out);
+
+	// End the stream. If the stream ends with a truncated sequence, then 'replace' is written
+	// to 'out', and 1 is returned. Otherwise, 0 is returned.
+	// The decoder is then ready for a new stream.
+	size_t finish(char32_t* out);
+
+	// Returns the number of bytes that are held back from the previous chunk
+	size_t pending() const { return NPending; }
+
+	// Forget the current stream
+	void reset();
+
+private:
+	char Pending[4];
+	int  NPending;
+	bool Skipping; // True when the stream is resynchronizing after an error, which skips continuation bytes
+};
+
+// Memory for many small allocations, which are all given back at once. Allocating is a pointer
+// bump inside a block. The first blocks can be a buffer that you provide, such as an array on
+// the stack. Beyond that, blocks of 'block_size' bytes come from the heap. Allocations that are
+// larger than a block get a heap block of their own.
+class arena
+{
+public:
+	arena(size_t block_size = 64 * 1024);
+	arena(char* buf, size_t size, size_t block_size = 64 * 1024);
+	~arena();
+
+	arena(const arena&) = delete;
+	arena& operator=(const arena&) = delete;
+
+	// Returns 'n' bytes, aligned to 'align', which must be a power of 2
+	void* allocate(size_t n, size_t align = 1);
+
+	// Forget everything that has been allocated. The blocks are kept, and used again.
+	void reset();
+
+private:
+	char*              Pos;
+	char*              End;
+	char*              Buf; // The caller's buffer
+	char*              BufEnd;
+	size_t             BlockSize;
+	size_t             Next;   // The number of Blocks that are in use
+	std::vector<char*> Blocks; // Heap blocks of BlockSize bytes
+	std::vector<char*> Large;  // Allocations that are bigger than BlockSize
+};
+
+// A standard allocator that takes its memory from an arena. deallocate does nothing, because
+// the memory is given back when the arena is reset or destroyed.
+template <typename T>
+class arena_allocator
+{
+public:
+	typedef T value_type;
+
+	arena* Arena;
+
+	arena_allocator(arena& a) : Arena(&a) {}
+	template <typename U>
+	arena_allocator(const arena_allocator<U>& b) : Arena(b.Arena) {}
+
+	T*   allocate(size_t n) { return (T*) Arena->allocate(n * sizeof(T), alignof(T)); }
+	void deallocate(T*, size_t) {}
+
+	template <typename U>
+	bool operator==(const arena_allocator<U>& b) const { return Arena == b.Arena; }
+	template <typename U>
+	bool operator!=(const arena_allocator<U>& b) const { return Arena != b.Arena; }
 };
+
+// Builds a UTF-8 string. The string is written into a buffer that grows by doubling, with one
+// capacity check per code point or span, instead of one per byte. The first 64 bytes are inside
+// the builder, and the rest comes from 'Alloc'. str() returns the string with one allocation of
+// exactly its size, and keeps the buffer for the next string, so a builder that is used again
+// stops allocating once its buffer is big enough. With an arena, the strings of many builders
+// can come from one buffer (see arena_builder).
+//
+// example:
+//
+//   utfz::builder b;
+//   b.append("name: ");
+//   for (char32_t cp : cps)
+//       b.append(cp);
+//   std::string s = b.str();
+//
+template <typename Alloc = std::allocator<char>>
+class basic_builder
+{
+public:
+	typedef std::basic_string<char, std::char_traits<char>, Alloc> string_type;
+
+	basic_builder(const Alloc& alloc = Alloc()) : A(alloc), Buf(Small), Cap(sizeof(Small)), Len(0) {}
+	basic_builder(size_t reserve, const Alloc& alloc = Alloc()) : basic_builder(alloc) { this->reserve(reserve); }
+	~basic_builder() { release(); }
+
+	basic_builder(const basic_builder&) = delete;
+	basic_builder& operator=(const basic_builder&) = delete;
+
+	// Make room for at least 'bytes' more bytes
+	void reserve(size_t bytes)
+	{
+		if (Cap - Len < bytes)
+			grow(bytes);
+	}
+
+	// Add the code point 'cp'. If the code point is invalid, then nothing is written.
+	// Returns true if the code point is valid.
+	bool append(int cp)
+	{
+		reserve(4);
+		if ((unsigned) cp <= max1)
+		{
+			Buf[Len++] = (char) cp;
+			return true;
+		}
+		int n = encode(Buf + Len, cp);
+		Len += n;
+		return n != 0;
+	}
+
+	// Add the 'n' code points in 'cps', skipping invalid code points.
+	// Returns true if all of the code points are valid.
+	bool append(const char32_t* cps, size_t n)
+	{
+		bool   all_valid = true;
+		size_t len       = encoded_length(cps, n, all_valid);
+		reserve(len);
+		Len += encode(Buf + Len, cps, n);
+		return all_valid;
+	}
+
+	// Add [s, end), which must already be valid UTF-8, such as the output of sanitize().
+	// It is copied with memcpy, without looking at it.
+	void append(const char* s, const char* end)
+	{
+		reserve(end - s);
+		memcpy(Buf + Len, s, end - s);
+		Len += end - s;
+	}
+
+	// Add a null terminated string, which must already be valid UTF-8
+	void append(const char* s) { append(s, s + strlen(s)); }
+
+	// Add a string, which must already be valid UTF-8
+	void append(const std::string& s) { append(s.data(), s.data() + s.size()); }
+
+	// The bytes so far. These are not null terminated.
+	const char* data() const { return Buf; }
+	size_t      size() const { return Len; }
+
+	// Start again, keeping the buffer
+	void clear() { Len = 0; }
+
+	// Returns the string, and starts again, keeping the buffer
+	string_type str()
+	{
+		string_type s(Buf, Len, A);
+		Len = 0;
+		return s;
+	}
+
+private:
+	typedef std::allocator_traits<Alloc> traits;
+
+	Alloc  A;
+	char*  Buf; // Small, or Cap bytes from A. The bytes from Len onwards are spare.
+	size_t Cap;
+	size_t Len;
+	char   Small[64];
+
+	void grow(size_t bytes)
+	{
+		size_t cap = std::max(Cap * 2, Len + bytes);
+		char*  buf = traits::allocate(A, cap);
+		memcpy(buf, Buf, Len);
+		release();
+		Buf = buf;
+		Cap = cap;
+	}
+
+	void release()
+	{
+		if (Buf != Small)
+			traits::deallocate(A, Buf, Cap);
+	}
+};
+
+typedef basic_builder<>                      builder;
+typedef basic_builder<arena_allocator<char>> arena_builder;
+typedef arena_builder::string_type           arena_string;
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define UTFZ_CONSTEXPR 1
+
+// Variants of the basic functions that can run at compile time, when compiling as C++14 or
+// later. They follow exactly the same rules as the functions with the same names above, but
+// they are not vectorized, so those are still the ones to use at run time.
+namespace compile_time {
+
+constexpr int seq_len(char c)
+{
+	return (uint8_t) c < 0x80 ? 1 : (uint8_t) c < 0xc0 ? invalid : (uint8_t) c < 0xe0 ? 2 : (uint8_t) c < 0xf0 ? 3 : (uint8_t) c < 0xf8 ? 4 : invalid;
+}
+
+constexpr const char* restart(const char* s, const char* end)
+{
+	if (s >= end)
+		return end;
+	// always increment one byte first, to ensure that we make progress through a series of invalid bytes
+	for (s++; s != end; s++)
+	{
+		if (seq_len(*s) != invalid)
+			break;
+	}
+	return s;
+}
+
+constexpr int decode(const char* s, const char* end, int& _seq_len)
+{
+	_seq_len = 0;
+	int slen = s == end ? invalid : seq_len(s[0]);
+	if (slen == invalid || end - s < slen)
+		return replace;
+
+	int cp = 0;
+	switch (slen)
+	{
+	case 1:
+		cp = s[0];
+		break;
+	case 2:
+		if ((s[1] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+		if (cp < min_cp_2)
+			return replace;
+		break;
+	case 3:
+		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0xf) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+		if (!is_legal_3_byte_code(cp))
+			return replace;
+		break;
+	case 4:
+		if ((s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80)
+			return replace;
+		cp = ((s[0] & 0x7) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+		if (cp < min_cp_4 || cp > max4)
+			return replace;
+		break;
+	}
+	_seq_len = slen;
+	return cp;
+}
+
+constexpr int decode(const char* s, const char* end)
+{
+	int _seq_len = 0;
+	return decode(s, end, _seq_len);
+}
+
+constexpr int encode(char* buf, int cp)
+{
+	unsigned ucp = (unsigned) cp;
+	if (ucp <= max1)
+	{
+		buf[0] = (char) ucp;
+		return 1;
+	}
+	if (ucp <= max2)
+	{
+		buf[0] = (char) (0xc0 | (ucp >> 6));
+		buf[1] = (char) (0x80 | (ucp & 0x3f));
+		return 2;
+	}
+	if (ucp <= max3)
+	{
+		if (ucp >= 0xd800 && (ucp <= 0xdfff || ucp >= 0xfffe))
+			return 0;
+		buf[0] = (char) (0xe0 | (ucp >> 12));
+		buf[1] = (char) (0x80 | ((ucp >> 6) & 0x3f));
+		buf[2] = (char) (0x80 | (ucp & 0x3f));
+		return 3;
+	}
+	if (ucp <= max4)
+	{
+		buf[0] = (char) (0xf0 | (ucp >> 18));
+		buf[1] = (char) (0x80 | ((ucp >> 12) & 0x3f));
+		buf[2] = (char) (0x80 | ((ucp >> 6) & 0x3f));
+		buf[3] = (char) (0x80 | (ucp & 0x3f));
+		return 4;
+	}
+	return 0;
+}
+
+constexpr bool validate(const char* s, const char* end)
+{
+	while (s != end)
+	{
+		int slen = 0;
+		decode(s, end, slen);
+		if (slen == 0)
+			return false;
+		s += slen;
+	}
+	return true;
+}
+
+// Decode all of [s, end) into 'out', which must have room for count(s, end) code points.
+// Returns the number of code points written.
+constexpr size_t decode_all(const char* s, const char* end, char32_t* out)
+{
+	size_t n = 0;
+	while (s != end)
+	{
+		int slen = 0;
+		int cp   = decode(s, end, slen);
+		s        = cp == replace ? restart(s, end) : s + slen;
+		out[n++] = cp;
+	}
+	return n;
+}
+
+// Like utfz::count, this steps over the input the same way as cp, which only differs from
+// decode_all on invalid input.
+constexpr size_t count(const char* s, const char* end)
+{
+	size_t n = 0;
+	for (; s != end; n++)
+	{
+		int slen = seq_len(s[0]);
+		if (slen == invalid)
+			s = restart(s, end);
+		else
+			s = end - s < slen ? end : s + slen;
+	}
+	return n;
+}
+} // namespace compile_time
+
+// A UTF-8 string literal that is validated, counted and decoded at compile time.
+// Make them with UTFZ_LITERAL, which fails the build if the literal is not valid UTF-8.
+//
+// example:
+//
+//   constexpr auto hello = UTFZ_LITERAL("Привет");
+//   static_assert(hello.size() == 6 && hello[0] == 0x41f, "");
+//   for (char32_t cp : hello)
+//       printf("%d ", (int) cp);
+//   puts(hello.Str);
+//
+template <size_t N, bool Valid>
+class literal
+{
+	static_assert(Valid, "utfz::literal is not valid UTF-8");
+
+public:
+	const char* Str;       // The literal itself
+	size_t      Bytes;     // The length of Str, without the null terminator
+	char32_t    CP[N + 1]; // The code points, followed by a zero
+
+	constexpr literal(const char* str, size_t bytes) : Str(str), Bytes(bytes), CP{}
+	{
+		compile_time::decode_all(str, str + bytes, CP);
+	}
+
+	constexpr size_t          size() const { return N; }
+	constexpr const char32_t* begin() const { return CP; }
+	constexpr const char32_t* end() const { return CP + N; }
+	constexpr char32_t        operator[](size_t i) const { return CP[i]; }
+};
+
+// Makes a utfz::literal from a string literal
+#define UTFZ_LITERAL(str) utfz::literal<utfz::compile_time::count(str, str + sizeof(str) - 1), utfz::compile_time::validate(str, str + sizeof(str) - 1)>(str, sizeof(str) - 1)
+#endif
 } // namespace utfz